@@ -0,0 +1 @@
+#include "/root/repo/contrib/kameda/model/client/KamedaAppClient.h"
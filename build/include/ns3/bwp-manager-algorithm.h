@@ -0,0 +1 @@
+#include "/root/repo/contrib/nr/model/bwp-manager-algorithm.h"
@@ -0,0 +1 @@
+#include "/root/repo/contrib/nr/helper/cc-bwp-helper.h"
@@ -0,0 +1 @@
+#include "/root/repo/src/antenna/model/circular-aperture-antenna-model.h"
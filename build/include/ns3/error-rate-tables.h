@@ -0,0 +1 @@
+#include "/root/repo/src/wifi/model/reference/error-rate-tables.h"
@@ -0,0 +1 @@
+#include "/root/repo/src/wifi/model/fcfs-wifi-queue-scheduler.h"
@@ -0,0 +1 @@
+#include "/root/repo/src/mobility/model/grid-spatial-index.h"
@@ -0,0 +1 @@
+#include "/root/repo/contrib/nr/helper/hexagonal-grid-scenario-helper.h"
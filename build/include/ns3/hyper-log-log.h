@@ -0,0 +1 @@
+#include "/root/repo/src/stats/model/hyper-log-log.h"
@@ -0,0 +1 @@
+#include "/root/repo/contrib/nr/model/ideal-beamforming-algorithm.h"
@@ -0,0 +1 @@
+#include "/root/repo/contrib/kameda/helper/kameda-helper.h"
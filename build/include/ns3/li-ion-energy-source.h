@@ -0,0 +1 @@
+#include "/root/repo/src/energy/model/li-ion-energy-source.h"
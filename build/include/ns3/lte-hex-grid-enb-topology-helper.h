@@ -0,0 +1 @@
+#include "/root/repo/src/lte/helper/lte-hex-grid-enb-topology-helper.h"
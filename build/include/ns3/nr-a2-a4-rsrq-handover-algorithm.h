@@ -0,0 +1 @@
+#include "/root/repo/contrib/nr/model/nr-a2-a4-rsrq-handover-algorithm.h"
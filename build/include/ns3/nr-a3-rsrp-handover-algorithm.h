@@ -0,0 +1 @@
+#include "/root/repo/contrib/nr/model/nr-a3-rsrp-handover-algorithm.h"
@@ -0,0 +1 @@
+#include "/root/repo/contrib/nr/model/nr-anr.h"
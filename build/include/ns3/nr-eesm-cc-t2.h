@@ -0,0 +1 @@
+#include "/root/repo/contrib/nr/model/nr-eesm-cc-t2.h"
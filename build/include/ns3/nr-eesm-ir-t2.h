@@ -0,0 +1 @@
+#include "/root/repo/contrib/nr/model/nr-eesm-ir-t2.h"
@@ -0,0 +1 @@
+#include "/root/repo/contrib/nr/model/nr-epc-gnb-s1-sap.h"
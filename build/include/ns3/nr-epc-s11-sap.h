@@ -0,0 +1 @@
+#include "/root/repo/contrib/nr/model/nr-epc-s11-sap.h"
@@ -0,0 +1 @@
+#include "/root/repo/contrib/nr/model/nr-epc-x2-header.h"
@@ -0,0 +1 @@
+#include "/root/repo/contrib/nr/utils/nr-json.hpp"
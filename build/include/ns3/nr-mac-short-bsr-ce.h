@@ -0,0 +1 @@
+#include "/root/repo/contrib/nr/model/nr-mac-short-bsr-ce.h"
@@ -0,0 +1 @@
+#include "/root/repo/contrib/nr/helper/nr-no-backhaul-epc-helper.h"
@@ -0,0 +1 @@
+#include "/root/repo/contrib/nr/model/nr-no-op-component-carrier-manager.h"
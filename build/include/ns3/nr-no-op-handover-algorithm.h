@@ -0,0 +1 @@
+#include "/root/repo/contrib/nr/model/nr-no-op-handover-algorithm.h"
@@ -0,0 +1 @@
+#include "/root/repo/contrib/nr/helper/nr-point-to-point-epc-helper-base.h"
@@ -0,0 +1 @@
+#include "/root/repo/contrib/nr/model/nr-simple-ue-component-carrier-manager.h"
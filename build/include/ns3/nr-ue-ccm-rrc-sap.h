@@ -0,0 +1 @@
+#include "/root/repo/contrib/nr/model/nr-ue-ccm-rrc-sap.h"
@@ -0,0 +1 @@
+#include "/root/repo/contrib/nr/utils/channels/nyu/nyu-propagation-loss-model.h"
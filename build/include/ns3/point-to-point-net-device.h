@@ -0,0 +1 @@
+#include "/root/repo/src/point-to-point/model/point-to-point-net-device.h"
@@ -0,0 +1 @@
+#include "/root/repo/src/point-to-point-layout/model/point-to-point-star.h"
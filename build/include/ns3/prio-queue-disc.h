@@ -0,0 +1 @@
+#include "/root/repo/src/traffic-control/model/prio-queue-disc.h"
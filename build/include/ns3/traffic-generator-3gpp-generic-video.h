@@ -0,0 +1 @@
+#include "/root/repo/contrib/nr/utils/traffic-generators/model/traffic-generator-3gpp-generic-video.h"
@@ -0,0 +1 @@
+#include "/root/repo/contrib/nr/utils/traffic-generators/model/traffic-generator-ftp-single.h"
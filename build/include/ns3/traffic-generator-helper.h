@@ -0,0 +1 @@
+#include "/root/repo/contrib/nr/utils/traffic-generators/helper/traffic-generator-helper.h"
@@ -0,0 +1 @@
+#include "/root/repo/src/wifi/helper/wifi-radio-energy-model-helper.h"
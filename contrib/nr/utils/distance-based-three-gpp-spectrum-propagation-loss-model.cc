@@ -65,12 +65,13 @@ DistanceBasedThreeGppSpectrumPropagationLossModel::GetMaxDistance() const
 }
 
 Ptr<SpectrumSignalParameters>
-DistanceBasedThreeGppSpectrumPropagationLossModel::DoCalcRxPowerSpectralDensity(
+DistanceBasedThreeGppSpectrumPropagationLossModel::DoPrepareRxPowerSpectralDensity(
     Ptr<const SpectrumSignalParameters> params,
     Ptr<const MobilityModel> a,
     Ptr<const MobilityModel> b,
     Ptr<const PhasedArrayModel> aPhasedArrayModel,
-    Ptr<const PhasedArrayModel> bPhasedArrayModel) const
+    Ptr<const PhasedArrayModel> bPhasedArrayModel,
+    std::function<void()>& task) const
 {
     NS_LOG_FUNCTION(this);
     uint32_t aId = a->GetObject<Node>()->GetId(); // id of the node a
@@ -87,12 +88,13 @@ DistanceBasedThreeGppSpectrumPropagationLossModel::DoCalcRxPowerSpectralDensity(
     }
     else
     {
-        return ThreeGppSpectrumPropagationLossModel::DoCalcRxPowerSpectralDensity(
+        return ThreeGppSpectrumPropagationLossModel::DoPrepareRxPowerSpectralDensity(
             params,
             a,
             b,
             aPhasedArrayModel,
-            bPhasedArrayModel);
+            bPhasedArrayModel,
+            task);
     }
 
     return rxParams;
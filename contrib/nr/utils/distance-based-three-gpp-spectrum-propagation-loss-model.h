@@ -65,14 +65,16 @@ class DistanceBasedThreeGppSpectrumPropagationLossModel
      * @param b second node mobility model
      * @param aPhasedArrayModel the antenna array of the first node
      * @param bPhasedArrayModel the antenna array of the second node
-     * @return the received PSD
+     * @param task the task completing the computation, left empty if there is none
+     * @return the received PSD, which is only complete once the task has been run
      */
-    Ptr<SpectrumSignalParameters> DoCalcRxPowerSpectralDensity(
+    Ptr<SpectrumSignalParameters> DoPrepareRxPowerSpectralDensity(
         Ptr<const SpectrumSignalParameters> params,
         Ptr<const MobilityModel> a,
         Ptr<const MobilityModel> b,
         Ptr<const PhasedArrayModel> aPhasedArrayModel,
-        Ptr<const PhasedArrayModel> bPhasedArrayModel) const override;
+        Ptr<const PhasedArrayModel> bPhasedArrayModel,
+        std::function<void()>& task) const override;
 
   private:
     double m_maxDistance{1000}; //!< the maximum distance of the nodes a and b in order to calculate
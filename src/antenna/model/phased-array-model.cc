@@ -104,22 +104,54 @@ PhasedArrayModel::GetBeamformingVector(Angles a) const
     return beamformingVector;
 }
 
+const std::vector<Vector>&
+PhasedArrayModel::GetElementLocations() const
+{
+    m_elementLocations.resize(GetNumElems());
+    for (size_t i = 0; i < m_elementLocations.size(); i++)
+    {
+        m_elementLocations[i] = GetElementLocation(i);
+    }
+    return m_elementLocations;
+}
+
 PhasedArrayModel::ComplexVector
 PhasedArrayModel::GetSteeringVector(Angles a) const
 {
-    ComplexVector steeringVector(GetNumElems());
-    for (size_t i = 0; i < GetNumElems(); i++)
+    const auto& locations = GetElementLocations();
+    const double sinIncl = sin(a.GetInclination());
+    const double cosIncl = cos(a.GetInclination());
+    const double sinAz = sin(a.GetAzimuth());
+    const double cosAz = cos(a.GetAzimuth());
+    ComplexVector steeringVector(locations.size());
+    for (size_t i = 0; i < locations.size(); i++)
     {
-        Vector loc = GetElementLocation(i);
+        const auto& loc = locations[i];
         double phase = -2 * M_PI *
-                       (sin(a.GetInclination()) * cos(a.GetAzimuth()) * loc.x +
-                        sin(a.GetInclination()) * sin(a.GetAzimuth()) * loc.y +
-                        cos(a.GetInclination()) * loc.z);
+                       (sinIncl * cosAz * loc.x + sinIncl * sinAz * loc.y + cosIncl * loc.z);
         steeringVector[i] = std::polar<double>(1.0, phase);
     }
     return steeringVector;
 }
 
+ComplexMatrixArray
+PhasedArrayModel::GetArrayResponse(const std::vector<Vector>& directions) const
+{
+    const auto& locations = GetElementLocations();
+    ComplexMatrixArray response(locations.size(), directions.size());
+    for (size_t d = 0; d < directions.size(); d++)
+    {
+        const auto& dir = directions[d];
+        for (size_t i = 0; i < locations.size(); i++)
+        {
+            const auto& loc = locations[i];
+            double phase = 2 * M_PI * (dir.x * loc.x + dir.y * loc.y + dir.z * loc.z);
+            response(i, d) = std::complex<double>(cos(phase), sin(phase));
+        }
+    }
+    return response;
+}
+
 void
 PhasedArrayModel::SetAntennaElement(Ptr<AntennaModel> antennaElement)
 {
@@ -15,6 +15,7 @@
 #include "ns3/symmetric-adjacency-matrix.h"
 
 #include <complex>
+#include <vector>
 
 namespace ns3
 {
@@ -70,6 +71,14 @@ class PhasedArrayModel : public Object
      */
     virtual Vector GetElementLocation(uint64_t index) const = 0;
 
+    /**
+     * @brief Returns the locations of all the antenna elements, normalized with respect
+     * to the wavelength. The default implementation calls GetElementLocation for each
+     * element, subclasses can return precomputed locations.
+     * @return the locations of the antenna elements, by element index
+     */
+    virtual const std::vector<Vector>& GetElementLocations() const;
+
     /**
      * @brief Returns the number of antenna elements
      * @return the number of antenna elements
@@ -226,6 +235,17 @@ class PhasedArrayModel : public Object
      */
     ComplexVector GetSteeringVector(Angles a) const;
 
+    /**
+     * Returns the response of the array to plane waves arriving from (or departing toward)
+     * a set of directions, i.e., the phase shifts exp(j 2 pi (loc . d)) of the antenna
+     * elements, where loc is the location of an element (see GetElementLocations) and d
+     * is the unit vector of a direction. This is the conjugate of the steering vector
+     * toward each direction.
+     * @param directions the unit vectors of the directions
+     * @return a matrix with a row per antenna element and a column per direction
+     */
+    ComplexMatrixArray GetArrayResponse(const std::vector<Vector>& directions) const;
+
     /**
      * Sets the antenna model to be used
      * @param antennaElement the antenna model
@@ -268,6 +288,8 @@ class PhasedArrayModel : public Object
         m_outOfDateAntennaPairChannel; //!< matrix indicating whether a channel matrix between a
                                        //!< pair of antennas needs to be updated after a change in
                                        //!< one of the antennas configurations
+    mutable std::vector<Vector>
+        m_elementLocations; //!< the locations of the antenna elements (see GetElementLocations)
 };
 
 } /* namespace ns3 */
@@ -109,6 +109,7 @@ UniformPlanarArray::SetNumColumns(uint32_t n)
         InvalidateChannels();
     }
     m_numColumns = n;
+    m_elementLocations.clear();
 }
 
 uint32_t
@@ -127,6 +128,7 @@ UniformPlanarArray::SetNumRows(uint32_t n)
         InvalidateChannels();
     }
     m_numRows = n;
+    m_elementLocations.clear();
 }
 
 uint32_t
@@ -141,6 +143,7 @@ UniformPlanarArray::SetAlpha(double alpha)
     m_alpha = alpha;
     m_cosAlpha = cos(m_alpha);
     m_sinAlpha = sin(m_alpha);
+    m_elementLocations.clear();
     InvalidateChannels();
 }
 
@@ -150,6 +153,7 @@ UniformPlanarArray::SetBeta(double beta)
     m_beta = beta;
     m_cosBeta = cos(m_beta);
     m_sinBeta = sin(m_beta);
+    m_elementLocations.clear();
     InvalidateChannels();
 }
 
@@ -174,6 +178,7 @@ UniformPlanarArray::SetAntennaHorizontalSpacing(double s)
         InvalidateChannels();
     }
     m_disH = s;
+    m_elementLocations.clear();
 }
 
 double
@@ -194,6 +199,7 @@ UniformPlanarArray::SetAntennaVerticalSpacing(double s)
         InvalidateChannels();
     }
     m_disV = s;
+    m_elementLocations.clear();
 }
 
 double
@@ -277,6 +283,17 @@ UniformPlanarArray::GetElementLocation(uint64_t index) const
     return loc;
 }
 
+const std::vector<Vector>&
+UniformPlanarArray::GetElementLocations() const
+{
+    // the locations are computed once, then whenever the geometry of the array changes
+    if (m_elementLocations.empty())
+    {
+        PhasedArrayModel::GetElementLocations();
+    }
+    return m_elementLocations;
+}
+
 uint8_t
 UniformPlanarArray::GetNumPols() const
 {
@@ -389,6 +406,7 @@ UniformPlanarArray::SetDualPol(bool isDualPol)
         m_cosPolSlant[1] = cos(m_polSlant - M_PI / 2);
         m_sinPolSlant[1] = sin(m_polSlant - M_PI / 2);
     }
+    m_elementLocations.clear();
     InvalidateChannels();
 }
 
@@ -72,6 +72,15 @@ class UniformPlanarArray : public PhasedArrayModel
      */
     Vector GetElementLocation(uint64_t index) const override;
 
+    /**
+     * @brief Returns the locations of all the antenna elements, normalized with respect
+     * to the wavelength. The locations are cached until the geometry of the array
+     * (number of rows and columns, spacing, bearing and downtilt angles, polarization)
+     * changes.
+     * @return the locations of the antenna elements, by element index
+     */
+    const std::vector<Vector>& GetElementLocations() const override;
+
     /**
      *  Check if an antenna array contains dual-polarized elements
      *
@@ -9,6 +9,7 @@
 #include "sstream"
 #include "string"
 
+#include "ns3/boolean.h"
 #include "ns3/double.h"
 #include "ns3/isotropic-antenna-model.h"
 #include "ns3/log.h"
@@ -262,6 +263,99 @@ UpdateOnChangeTestCase::DoRun()
                           "Expecting update, antenna parameter changed");
 }
 
+/**
+ * @ingroup antenna-tests
+ *
+ * @brief Test that the precomputed element locations and the array responses are
+ * consistent with GetElementLocation and GetSteeringVector, also after the
+ * configuration of the array is changed
+ */
+class ElementLocationsTestCase : public TestCase
+{
+  public:
+    /**
+     * The constructor of the test case
+     * @param element the antenna element
+     * @param name the test case name
+     */
+    ElementLocationsTestCase(Ptr<AntennaModel> element, std::string name)
+        : TestCase(name),
+          m_element(element){};
+
+  private:
+    /**
+     * Run the test
+     */
+    void DoRun() override;
+    /**
+     * Check the element locations and the array response of an antenna array
+     * @param ant the antenna array
+     */
+    void CheckLocations(Ptr<const UniformPlanarArray> ant);
+    Ptr<AntennaModel> m_element; //!< the antenna element
+};
+
+void
+ElementLocationsTestCase::CheckLocations(Ptr<const UniformPlanarArray> ant)
+{
+    const auto& locations = ant->GetElementLocations();
+    NS_TEST_ASSERT_MSG_EQ(locations.size(), ant->GetNumElems(), "Wrong number of locations");
+    for (size_t i = 0; i < locations.size(); i++)
+    {
+        const auto loc = ant->GetElementLocation(i);
+        NS_TEST_EXPECT_MSG_EQ_TOL(locations[i].x, loc.x, 1e-12, "Wrong x of element " << i);
+        NS_TEST_EXPECT_MSG_EQ_TOL(locations[i].y, loc.y, 1e-12, "Wrong y of element " << i);
+        NS_TEST_EXPECT_MSG_EQ_TOL(locations[i].z, loc.z, 1e-12, "Wrong z of element " << i);
+    }
+
+    const std::vector<Angles> angles{Angles(DegreesToRadians(0), DegreesToRadians(90)),
+                                     Angles(DegreesToRadians(30), DegreesToRadians(60)),
+                                     Angles(DegreesToRadians(-120), DegreesToRadians(150))};
+    std::vector<Vector> directions;
+    for (const auto& a : angles)
+    {
+        directions.emplace_back(sin(a.GetInclination()) * cos(a.GetAzimuth()),
+                                sin(a.GetInclination()) * sin(a.GetAzimuth()),
+                                cos(a.GetInclination()));
+    }
+    const auto response = ant->GetArrayResponse(directions);
+    NS_TEST_ASSERT_MSG_EQ(response.GetNumRows(), ant->GetNumElems(), "Wrong number of rows");
+    NS_TEST_ASSERT_MSG_EQ(response.GetNumCols(), angles.size(), "Wrong number of columns");
+    for (size_t d = 0; d < angles.size(); d++)
+    {
+        const auto steeringVector = ant->GetSteeringVector(angles[d]);
+        for (size_t i = 0; i < ant->GetNumElems(); i++)
+        {
+            NS_TEST_EXPECT_MSG_LT(std::abs(response(i, d) - std::conj(steeringVector[i])),
+                                  1e-9,
+                                  "Wrong response of element " << i << " in direction " << d);
+        }
+    }
+}
+
+void
+ElementLocationsTestCase::DoRun()
+{
+    Ptr<UniformPlanarArray> ant = CreateObject<UniformPlanarArray>();
+    ant->SetAttribute("AntennaElement", PointerValue(m_element));
+    ant->SetAttribute("NumRows", UintegerValue(4));
+    ant->SetAttribute("NumColumns", UintegerValue(2));
+    CheckLocations(ant);
+
+    ant->SetAttribute("NumColumns", UintegerValue(3));
+    CheckLocations(ant);
+    ant->SetAttribute("NumRows", UintegerValue(2));
+    CheckLocations(ant);
+    ant->SetAttribute("AntennaHorizontalSpacing", DoubleValue(0.7));
+    ant->SetAttribute("AntennaVerticalSpacing", DoubleValue(0.6));
+    CheckLocations(ant);
+    ant->SetAttribute("BearingAngle", DoubleValue(DegreesToRadians(30)));
+    ant->SetAttribute("DowntiltAngle", DoubleValue(DegreesToRadians(10)));
+    CheckLocations(ant);
+    ant->SetAttribute("IsDualPolarized", BooleanValue(true));
+    CheckLocations(ant);
+}
+
 /**
  * @ingroup antenna-tests
  *
@@ -451,6 +545,10 @@ UniformPlanarArrayTestSuite::UniformPlanarArrayTestSuite()
                                            "Test IsChannelOutOfDate() and InvalidateChannels() for "
                                            "UniformPlanarArray with 3GPP antenna element"),
                 TestCase::Duration::QUICK);
+    AddTestCase(new ElementLocationsTestCase(isotropic,
+                                             "Test GetElementLocations() and GetArrayResponse() "
+                                             "for UniformPlanarArray"),
+                TestCase::Duration::QUICK);
 }
 
 static UniformPlanarArrayTestSuite staticUniformPlanarArrayTestSuiteInstance;
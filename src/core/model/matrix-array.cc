@@ -22,9 +22,126 @@
 #endif
 #endif
 
+#include <algorithm>
+
+#if !defined(HAVE_EIGEN3) && defined(__GNUC__) && defined(__AVX__)
+#include <immintrin.h>
+#define NS3_MATRIX_ARRAY_SIMD
+#endif
+
 namespace ns3
 {
 
+#ifndef HAVE_EIGEN3
+// Kernels used when the matrix products are not computed by Eigen
+
+namespace
+{
+
+/**
+ * Multiply-accumulate kernel, i.e., y[i] += a * x[i] for each i in [0, n).
+ *
+ * @tparam T the type of the values
+ * @param n the number of values
+ * @param a the scalar factor
+ * @param x the array multiplied by the scalar factor
+ * @param y the array accumulating the products
+ */
+template <class T>
+void
+MultiplyAccumulate(size_t n, T a, const T* x, T* y)
+{
+    for (size_t i = 0; i < n; ++i)
+    {
+        y[i] += a * x[i];
+    }
+}
+
+/**
+ * Multiply-accumulate kernel for complex values. The products are computed explicitly
+ * rather than with the operator* of std::complex, which checks for infinities and NaNs
+ * (C99 Annex G) through a library call and prevents the vectorization of the loop.
+ * Two complex values are processed at once if the build targets AVX (e.g., with
+ * NS3_NATIVE_OPTIMIZATIONS).
+ *
+ * @param n the number of values
+ * @param a the scalar factor
+ * @param x the array multiplied by the scalar factor
+ * @param y the array accumulating the products
+ */
+template <>
+void
+MultiplyAccumulate(size_t n,
+                   std::complex<double> a,
+                   const std::complex<double>* x,
+                   std::complex<double>* y)
+{
+    // std::complex<double> is laid out as an array of two doubles (real, imaginary)
+    const auto xValues = reinterpret_cast<const double*>(x);
+    auto yValues = reinterpret_cast<double*>(y);
+    const auto aReal = a.real();
+    const auto aImag = a.imag();
+    size_t i = 0;
+#ifdef NS3_MATRIX_ARRAY_SIMD
+    const auto aRealVector = _mm256_set1_pd(aReal);
+    const auto aImagVector = _mm256_set1_pd(aImag);
+    for (; i + 2 <= n; i += 2)
+    {
+        // x = (xr0, xi0, xr1, xi1), swapped = (xi0, xr0, xi1, xr1)
+        const auto xVector = _mm256_loadu_pd(xValues + 2 * i);
+        const auto swapped = _mm256_permute_pd(xVector, 0b0101);
+        // (ar * xr - ai * xi, ar * xi + ai * xr) for each value
+        const auto product = _mm256_addsub_pd(_mm256_mul_pd(aRealVector, xVector),
+                                              _mm256_mul_pd(aImagVector, swapped));
+        _mm256_storeu_pd(yValues + 2 * i,
+                         _mm256_add_pd(_mm256_loadu_pd(yValues + 2 * i), product));
+    }
+#endif
+    for (; i < n; ++i)
+    {
+        const auto xReal = xValues[2 * i];
+        const auto xImag = xValues[2 * i + 1];
+        yValues[2 * i] += aReal * xReal - aImag * xImag;
+        yValues[2 * i + 1] += aReal * xImag + aImag * xReal;
+    }
+}
+
+/**
+ * Multiply two column-major matrices, i.e., res += lhs * rhs, one column of the
+ * result at a time, so that all the accesses are sequential.
+ *
+ * @tparam T the type of the values
+ * @param numRows the number of rows of lhs and res
+ * @param numInner the number of columns of lhs and of rows of rhs
+ * @param numCols the number of columns of rhs and res
+ * @param lhs the left matrix
+ * @param rhs the right matrix
+ * @param res the matrix accumulating the product
+ */
+template <class T>
+void
+MultiplyPage(size_t numRows,
+             size_t numInner,
+             size_t numCols,
+             const T* lhs,
+             const T* rhs,
+             T* res)
+{
+    for (size_t j = 0; j < numCols; ++j)
+    {
+        for (size_t k = 0; k < numInner; ++k)
+        {
+            MultiplyAccumulate(numRows,
+                               rhs[j * numInner + k],
+                               lhs + k * numRows,
+                               res + j * numRows);
+        }
+    }
+}
+
+} // namespace
+#endif
+
 #ifdef HAVE_EIGEN3
 template <class T>
 using EigenMatrix = Eigen::Map<Eigen::Matrix<T, Eigen::Dynamic, Eigen::Dynamic>>;
@@ -102,23 +219,17 @@ MatrixArray<T>::operator*(const MatrixArray<T>& rhs) const
         ConstEigenMatrix<T> lhsEigenMatrix(GetPagePtr(page), m_numRows, m_numCols);
         ConstEigenMatrix<T> rhsEigenMatrix(rhs.GetPagePtr(page), rhs.m_numRows, rhs.m_numCols);
         EigenMatrix<T> resEigenMatrix(res.GetPagePtr(page), res.m_numRows, res.m_numCols);
-        resEigenMatrix = lhsEigenMatrix * rhsEigenMatrix;
+        // the result does not alias the operands: avoid the temporary matrix
+        resEigenMatrix.noalias() = lhsEigenMatrix * rhsEigenMatrix;
 
 #else // Eigen not found or Eigen optimizations not enabled
 
-        size_t matrixOffset = page * m_numRows * m_numCols;
-        size_t rhsMatrixOffset = page * rhs.m_numRows * rhs.m_numCols;
-        for (size_t i = 0; i < res.m_numRows; ++i)
-        {
-            for (size_t j = 0; j < res.m_numCols; ++j)
-            {
-                res(i, j, page) = (m_values[std::slice(matrixOffset + i, m_numCols, m_numRows)] *
-                                   rhs.m_values[std::slice(rhsMatrixOffset + j * rhs.m_numRows,
-                                                           rhs.m_numRows,
-                                                           1)])
-                                      .sum();
-            }
-        }
+        MultiplyPage(m_numRows,
+                     m_numCols,
+                     rhs.m_numCols,
+                     GetPagePtr(page),
+                     rhs.GetPagePtr(page),
+                     res.GetPagePtr(page));
 
 #endif
     }
@@ -237,6 +348,8 @@ MatrixArray<T>::MultiplyByLeftAndRightMatrix(const MatrixArray<T>& lMatrix,
 
     ConstEigenMatrix<T> lMatrixEigen(lMatrix.GetPagePtr(0), lMatrix.m_numRows, lMatrix.m_numCols);
     ConstEigenMatrix<T> rMatrixEigen(rMatrix.GetPagePtr(0), rMatrix.m_numRows, rMatrix.m_numCols);
+#else
+    std::vector<T> interRes(m_numRows * rMatrix.m_numCols);
 #endif
 
     for (size_t page = 0; page < m_numPages; ++page)
@@ -246,33 +359,24 @@ MatrixArray<T>::MultiplyByLeftAndRightMatrix(const MatrixArray<T>& lMatrix,
         ConstEigenMatrix<T> matrixEigen(GetPagePtr(page), m_numRows, m_numCols);
         EigenMatrix<T> resEigenMap(res.GetPagePtr(page), res.m_numRows, res.m_numCols);
 
-        resEigenMap = lMatrixEigen * matrixEigen * rMatrixEigen;
+        resEigenMap.noalias() = lMatrixEigen * matrixEigen * rMatrixEigen;
 
 #else // Eigen not found or Eigen optimizations not enabled
 
-        size_t matrixOffset = page * m_numRows * m_numCols;
-        for (size_t resRow = 0; resRow < res.m_numRows; ++resRow)
-        {
-            for (size_t resCol = 0; resCol < res.m_numCols; ++resCol)
-            {
-                // create intermediate row result, a multiply of resRow row of lMatrix and each
-                // column of this matrix
-                std::valarray<T> interRes(m_numCols);
-                for (size_t thisCol = 0; thisCol < m_numCols; ++thisCol)
-                {
-                    interRes[thisCol] =
-                        (lMatrix
-                             .m_values[std::slice(resRow, lMatrix.m_numCols, lMatrix.m_numRows)] *
-                         m_values[std::slice(matrixOffset + thisCol * m_numRows, m_numRows, 1)])
-                            .sum();
-                }
-                // multiply intermediate results and resCol column of the rMatrix
-                res(resRow, resCol, page) =
-                    (interRes *
-                     rMatrix.m_values[std::slice(resCol * rMatrix.m_numRows, rMatrix.m_numRows, 1)])
-                        .sum();
-            }
-        }
+        // lMatrix * (this page * rMatrix), reusing the storage of the intermediate product
+        std::fill(interRes.begin(), interRes.end(), T{0});
+        MultiplyPage(m_numRows,
+                     m_numCols,
+                     rMatrix.m_numCols,
+                     GetPagePtr(page),
+                     rMatrix.GetPagePtr(0),
+                     interRes.data());
+        MultiplyPage(lMatrix.m_numRows,
+                     lMatrix.m_numCols,
+                     rMatrix.m_numCols,
+                     lMatrix.GetPagePtr(0),
+                     interRes.data(),
+                     res.GetPagePtr(page));
 #endif
     }
     return res;
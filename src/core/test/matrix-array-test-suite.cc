@@ -680,6 +680,33 @@ ComplexMatrixArrayTestCase::DoRun()
     NS_LOG_INFO("m2 (2, 3, 2):" << m2);
     NS_LOG_INFO("m3 (2, 3, 2):" << m3);
     NS_TEST_ASSERT_MSG_EQ(m2, m3, "m2 and m3 matrices should be equal");
+
+    // check the products of complex matrices against the definition
+    ComplexMatrixArray m4 = m1 * m2;
+    for (size_t page = 0; page < m4.GetNumPages(); ++page)
+    {
+        for (size_t i = 0; i < m4.GetNumRows(); ++i)
+        {
+            for (size_t j = 0; j < m4.GetNumCols(); ++j)
+            {
+                std::complex<double> expected{0};
+                for (size_t k = 0; k < m1.GetNumCols(); ++k)
+                {
+                    expected += m1(i, k, page) * m2(k, j, page);
+                }
+                NS_TEST_ASSERT_MSG_EQ(m4(i, j, page), expected, "Unexpected complex product");
+            }
+        }
+    }
+    ComplexMatrixArray lMatrix = m3.ExtractPage(1);
+    ComplexMatrixArray rMatrix = m2.ExtractPage(0);
+    ComplexMatrixArray m5 = m1.MultiplyByLeftAndRightMatrix(lMatrix, rMatrix);
+    for (size_t page = 0; page < m5.GetNumPages(); ++page)
+    {
+        NS_TEST_ASSERT_MSG_EQ(m5.ExtractPage(page),
+                              lMatrix * m1.ExtractPage(page) * rMatrix,
+                              "Unexpected product by the left and right matrices");
+    }
 }
 
 /**
@@ -11,6 +11,7 @@
 #include "csma-net-device.h"
 
 #include "ns3/log.h"
+#include "ns3/packet-train.h"
 #include "ns3/packet.h"
 #include "ns3/simulator.h"
 
@@ -181,11 +182,41 @@ CsmaChannel::TransmitStart(Ptr<const Packet> p, uint32_t srcId)
 
     NS_LOG_LOGIC("switch to TRANSMITTING");
     m_currentPkt = p;
+    m_currentTrain = nullptr;
     m_currentSrc = srcId;
     m_state = TRANSMITTING;
     return true;
 }
 
+bool
+CsmaChannel::TransmitTrain(Ptr<const PacketTrain> train, uint32_t srcId)
+{
+    NS_LOG_FUNCTION(this << train << srcId);
+    NS_ASSERT(train->GetNPackets() > 0);
+
+    if (!TransmitStart(train->GetPacket(0), srcId))
+    {
+        return false;
+    }
+    m_currentTrain = train;
+
+    for (auto it = m_deviceList.begin(); it < m_deviceList.end(); it++)
+    {
+        if (it->IsActive() && it->devicePtr != m_deviceList[m_currentSrc].devicePtr)
+        {
+            // schedule the reception of the first packet of the train
+            Simulator::ScheduleWithContext(it->devicePtr->GetNode()->GetId(),
+                                           train->GetLastBitTime(0) + m_delay,
+                                           &CsmaNetDevice::ReceiveTrain,
+                                           it->devicePtr,
+                                           train,
+                                           0,
+                                           m_deviceList[m_currentSrc].devicePtr);
+        }
+    }
+    return true;
+}
+
 bool
 CsmaChannel::IsActive(uint32_t deviceId)
 {
@@ -214,17 +245,21 @@ CsmaChannel::TransmitEnd()
 
     NS_LOG_LOGIC("Receive");
 
-    for (auto it = m_deviceList.begin(); it < m_deviceList.end(); it++)
+    // the receptions of a packet train are scheduled when its transmission starts
+    if (!m_currentTrain)
     {
-        if (it->IsActive() && it->devicePtr != m_deviceList[m_currentSrc].devicePtr)
+        for (auto it = m_deviceList.begin(); it < m_deviceList.end(); it++)
         {
-            // schedule reception events
-            Simulator::ScheduleWithContext(it->devicePtr->GetNode()->GetId(),
-                                           m_delay,
-                                           &CsmaNetDevice::Receive,
-                                           it->devicePtr,
-                                           m_currentPkt,
-                                           m_deviceList[m_currentSrc].devicePtr);
+            if (it->IsActive() && it->devicePtr != m_deviceList[m_currentSrc].devicePtr)
+            {
+                // schedule reception events
+                Simulator::ScheduleWithContext(it->devicePtr->GetNode()->GetId(),
+                                               m_delay,
+                                               &CsmaNetDevice::Receive,
+                                               it->devicePtr,
+                                               m_currentPkt,
+                                               m_deviceList[m_currentSrc].devicePtr);
+            }
         }
     }
 
@@ -18,6 +18,7 @@ namespace ns3
 {
 
 class Packet;
+class PacketTrain;
 
 class CsmaNetDevice;
 
@@ -179,6 +180,26 @@ class CsmaChannel : public Channel
      */
     bool TransmitStart(Ptr<const Packet> p, uint32_t srcId);
 
+    /**
+     * @brief Start transmitting a train of packets over the channel
+     *
+     * The channel becomes busy as for the transmission of a single packet
+     * (the transmitting net device calls TransmitEnd when the last bit of
+     * the last packet of the train has been transmitted), hence the train
+     * is sent as a burst that other net devices cannot interrupt.  The
+     * reception of the train by every other active net device is scheduled
+     * right away with a single event per device; each packet of the train
+     * is then received at the time its last bit arrives.
+     *
+     * @param train A reference to the train that will be transmitted over
+     * the channel; the transmission of the train starts now
+     * @param srcId The device Id of the net device that wants to
+     * transmit on the channel.
+     * @return True if the channel is not busy and the transmitting net
+     * device is currently active.
+     */
+    bool TransmitTrain(Ptr<const PacketTrain> train, uint32_t srcId);
+
     /**
      * @brief Indicates that the net device has finished transmitting
      * the packet over the channel
@@ -316,6 +337,12 @@ class CsmaChannel : public Channel
      */
     Ptr<const Packet> m_currentPkt;
 
+    /**
+     * The packet train that is currently being transmitted on the channel, if
+     * the current transmission is a train (null otherwise).
+     */
+    Ptr<const PacketTrain> m_currentTrain;
+
     /**
      * Device Id of the source that is currently transmitting on the
      * channel. Or last source to have transmitted a packet on the
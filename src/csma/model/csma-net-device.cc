@@ -17,6 +17,7 @@
 #include "ns3/ethernet-trailer.h"
 #include "ns3/llc-snap-header.h"
 #include "ns3/log.h"
+#include "ns3/packet-train.h"
 #include "ns3/pointer.h"
 #include "ns3/queue.h"
 #include "ns3/simulator.h"
@@ -78,6 +79,21 @@ CsmaNetDevice::GetTypeId()
                           PointerValue(),
                           MakePointerAccessor(&CsmaNetDevice::m_queue),
                           MakePointerChecker<Queue<Packet>>())
+            .AddAttribute("TxBatchSize",
+                          "The maximum number of queued packets that are transmitted as a "
+                          "single packet train. When greater than one, the packets waiting "
+                          "in the transmit queue when the channel is acquired are sent back "
+                          "to back (separated by the interframe gap) without releasing the "
+                          "channel, i.e., as a frame burst, and the whole train only takes "
+                          "a single transmission complete event. Since the packets are "
+                          "dequeued when the train starts, the Dequeue trace of the transmit "
+                          "queue and the Sniffer, PromiscSniffer and PhyTxBegin traces fire "
+                          "for all of them at the start of the train, and the PhyTxEnd trace "
+                          "fires for all of them at its end. Hence, batching is disabled "
+                          "(i.e., set to one) by default.",
+                          UintegerValue(1),
+                          MakeUintegerAccessor(&CsmaNetDevice::m_txBatchSize),
+                          MakeUintegerChecker<uint32_t>(1))
 
             //
             // Trace sources at the "top" of the net device, where packets transition
@@ -174,7 +190,8 @@ CsmaNetDevice::GetTypeId()
 }
 
 CsmaNetDevice::CsmaNetDevice()
-    : m_linkUp(false)
+    : m_txBatchSize(1),
+      m_linkUp(false)
 {
     NS_LOG_FUNCTION(this);
     m_txMachineState = READY;
@@ -208,6 +225,7 @@ CsmaNetDevice::DoDispose()
     m_channel = nullptr;
     m_node = nullptr;
     m_queue = nullptr;
+    m_batchedPkts.clear();
     NetDevice::DoDispose();
 }
 
@@ -498,13 +516,42 @@ CsmaNetDevice::TransmitStart()
     else
     {
         //
-        // The channel is free, transmit the packet
+        // The channel is free, transmit the packet.  If more packets are
+        // waiting, up to TxBatchSize - 1 of them are sent along with it, back
+        // to back and separated by the interframe gap, as a packet train.
         //
         m_phyTxBeginTrace(m_currentPkt);
-        if (!m_channel->TransmitStart(m_currentPkt, m_deviceId))
+        Time tEvent = m_bps.CalculateBytesTxTime(m_currentPkt->GetSize());
+        Ptr<PacketTrain> train;
+        while (m_batchedPkts.size() + 1 < m_txBatchSize && !m_queue->IsEmpty())
+        {
+            if (!train)
+            {
+                train = CreateObject<PacketTrain>();
+                train->AddPacket(m_currentPkt, Time(), tEvent);
+            }
+            Ptr<Packet> packet = m_queue->Dequeue();
+            m_snifferTrace(packet);
+            m_promiscSnifferTrace(packet);
+            m_phyTxBeginTrace(packet);
+            train->AddPacket(packet,
+                             tEvent + m_tInterframeGap,
+                             m_bps.CalculateBytesTxTime(packet->GetSize()));
+            tEvent = train->GetDuration();
+            m_batchedPkts.push_back(packet);
+        }
+
+        bool started = train ? m_channel->TransmitTrain(train, m_deviceId)
+                             : m_channel->TransmitStart(m_currentPkt, m_deviceId);
+        if (!started)
         {
             NS_LOG_WARN("Channel TransmitStart returns an error");
             m_phyTxDropTrace(m_currentPkt);
+            for (const auto& batchedPkt : m_batchedPkts)
+            {
+                m_phyTxDropTrace(batchedPkt);
+            }
+            m_batchedPkts.clear();
             m_currentPkt = nullptr;
             m_txMachineState = READY;
         }
@@ -517,7 +564,6 @@ CsmaNetDevice::TransmitStart()
             m_backoff.ResetBackoffTime();
             m_txMachineState = BUSY;
 
-            Time tEvent = m_bps.CalculateBytesTxTime(m_currentPkt->GetSize());
             NS_LOG_LOGIC("Schedule TransmitCompleteEvent in " << tEvent.As(Time::S));
             Simulator::Schedule(tEvent, &CsmaNetDevice::TransmitCompleteEvent, this);
         }
@@ -598,6 +644,11 @@ CsmaNetDevice::TransmitCompleteEvent()
     m_channel->TransmitEnd();
     m_phyTxEndTrace(m_currentPkt);
     m_currentPkt = nullptr;
+    for (const auto& batchedPkt : m_batchedPkts)
+    {
+        m_phyTxEndTrace(batchedPkt);
+    }
+    m_batchedPkts.clear();
 
     NS_LOG_LOGIC("Schedule TransmitReadyEvent in " << m_tInterframeGap.As(Time::S));
 
@@ -683,6 +734,31 @@ CsmaNetDevice::SetReceiveErrorModel(Ptr<ErrorModel> em)
     m_receiveErrorModel = em;
 }
 
+void
+CsmaNetDevice::ReceiveTrain(Ptr<const PacketTrain> train,
+                            uint32_t index,
+                            Ptr<CsmaNetDevice> senderDevice)
+{
+    NS_LOG_FUNCTION(train << index << senderDevice);
+
+    //
+    // The last bit of the index-th packet of the train has just arrived.  The
+    // next packet of the train (if any) is received after the difference of
+    // the last bit times, hence at most one event per train is pending.
+    //
+    Receive(train->GetPacket(index), senderDevice);
+
+    if (index + 1 < train->GetNPackets())
+    {
+        Simulator::Schedule(train->GetLastBitTime(index + 1) - train->GetLastBitTime(index),
+                            &CsmaNetDevice::ReceiveTrain,
+                            this,
+                            train,
+                            index + 1,
+                            senderDevice);
+    }
+}
+
 void
 CsmaNetDevice::Receive(Ptr<const Packet> packet, Ptr<CsmaNetDevice> senderDevice)
 {
@@ -24,12 +24,14 @@
 #include "ns3/traced-callback.h"
 
 #include <cstring>
+#include <vector>
 
 namespace ns3
 {
 
 class CsmaChannel;
 class ErrorModel;
+class PacketTrain;
 
 /**
  * @defgroup csma CSMA Network Device
@@ -163,6 +165,20 @@ class CsmaNetDevice : public NetDevice
      */
     void Receive(Ptr<const Packet> p, Ptr<CsmaNetDevice> sender);
 
+    /**
+     * Receive a packet of a train from a connected CsmaChannel.
+     *
+     * This method is called by the channel when the last bit of the first
+     * packet of a train has arrived at the device.  Each packet of the train
+     * is then passed to Receive() when its last bit arrives.
+     *
+     * @see CsmaChannel
+     * @param train a reference to the received train
+     * @param index the index of the packet whose last bit has just arrived
+     * @param sender the CsmaNetDevice that transmitted the train in the first place
+     */
+    void ReceiveTrain(Ptr<const PacketTrain> train, uint32_t index, Ptr<CsmaNetDevice> sender);
+
     /**
      * Is the send side of the network device enabled?
      *
@@ -510,6 +526,21 @@ class CsmaNetDevice : public NetDevice
      */
     Ptr<Packet> m_currentPkt;
 
+    /**
+     * Packets that are being transmitted after the current packet, in the
+     * same train.
+     */
+    std::vector<Ptr<Packet>> m_batchedPkts;
+
+    /**
+     * The maximum number of packets that are transmitted as a single train
+     * (i.e., as a burst that holds the channel), which then completes with a
+     * single event. The transmit traces of the packets of a train fire at the
+     * start (or the end, for PhyTxEnd) of the train rather than of the
+     * individual packet.
+     */
+    uint32_t m_txBatchSize;
+
     /**
      * The CsmaChannel to which this CsmaNetDevice has been
      * attached.
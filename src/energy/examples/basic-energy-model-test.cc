@@ -8,6 +8,7 @@
 
 #include "ns3/basic-energy-source-helper.h"
 #include "ns3/basic-energy-source.h"
+#include "ns3/boolean.h"
 #include "ns3/config.h"
 #include "ns3/device-energy-model-container.h"
 #include "ns3/double.h"
@@ -409,6 +410,236 @@ BasicEnergyDepletionTest::DepletionTestCase(double simTimeS, double updateInterv
 
 // -------------------------------------------------------------------------- //
 
+/**
+ * Test case of on-demand energy updates (i.e., no periodic update) for
+ * BasicEnergySource and lazy depletion events for WifiRadioEnergyModel.
+ */
+class BasicEnergyOnDemandTest
+{
+  public:
+    BasicEnergyOnDemandTest();
+    virtual ~BasicEnergyOnDemandTest();
+
+    /**
+     * Checks that on-demand updates detect the energy depletion at the expected
+     * time and yield the same remaining energy as periodic updates, with fewer events.
+     * @return true is some error happened.
+     */
+    bool DoRun();
+
+  private:
+    /**
+     * Callback invoked when energy is drained from source.
+     */
+    void DepletionHandler();
+
+    /**
+     * @param onDemand whether periodic energy updates and depletion events are disabled
+     * @param [out] remainingEnergy the remaining energy at the end of the simulation
+     * @param [out] nEvents the number of events executed during the simulation
+     * @return False if all is good.
+     *
+     * Runs a simulation in which the radio is idle except for a few short transmissions.
+     */
+    bool OnDemandTestCase(bool onDemand, double& remainingEnergy, uint64_t& nEvents);
+
+    /**
+     * @return False if all is good.
+     *
+     * Runs a simulation with on-demand updates in which the radio is idle and then
+     * transmits until the source is depleted, and checks that the depletion is detected
+     * at the exact crossing time, although it is predicted when the radio switches to
+     * the higher current.
+     */
+    bool CurrentIncreaseTestCase();
+
+  private:
+    double m_simTimeS;    //!< simulation time, in seconds
+    double m_tolerance;   //!< tolerance for energy and time comparisons
+    Time m_depletionTime; //!< time the depletion callback was invoked
+    int m_nTx;            //!< number of transmissions
+    Time m_txInterval;    //!< interval between the start of two transmissions
+    Time m_txDuration;    //!< duration of each transmission
+};
+
+BasicEnergyOnDemandTest::BasicEnergyOnDemandTest()
+{
+    m_simTimeS = 11.5; // the source is depleted after ~11 s, emptied after ~12.2 s
+    m_tolerance = 1.0e-6;
+    m_nTx = 20;
+    m_txInterval = MilliSeconds(100);
+    m_txDuration = MilliSeconds(1);
+}
+
+BasicEnergyOnDemandTest::~BasicEnergyOnDemandTest()
+{
+}
+
+bool
+BasicEnergyOnDemandTest::DoRun()
+{
+    double periodicEnergy;
+    double onDemandEnergy;
+    uint64_t periodicEvents;
+    uint64_t onDemandEvents;
+
+    if (OnDemandTestCase(false, periodicEnergy, periodicEvents) ||
+        OnDemandTestCase(true, onDemandEnergy, onDemandEvents) || CurrentIncreaseTestCase())
+    {
+        return true;
+    }
+
+    NS_LOG_DEBUG("Remaining energy: periodic=" << periodicEnergy << "J, on-demand="
+                                               << onDemandEnergy << "J");
+    NS_LOG_DEBUG("Events: periodic=" << periodicEvents << ", on-demand=" << onDemandEvents);
+
+    if (std::abs(periodicEnergy - onDemandEnergy) > m_tolerance)
+    {
+        std::cerr << "Remaining energy depends on periodic updates!" << std::endl;
+        return true;
+    }
+    if (onDemandEvents >= periodicEvents)
+    {
+        std::cerr << "On-demand updates do not save events!" << std::endl;
+        return true;
+    }
+    return false;
+}
+
+void
+BasicEnergyOnDemandTest::DepletionHandler()
+{
+    m_depletionTime = Simulator::Now();
+}
+
+bool
+BasicEnergyOnDemandTest::OnDemandTestCase(bool onDemand,
+                                          double& remainingEnergy,
+                                          uint64_t& nEvents)
+{
+    Ptr<Node> node = CreateObject<Node>();
+
+    Ptr<BasicEnergySource> source = CreateObject<BasicEnergySource>();
+    source->SetInitialEnergy(10);
+    source->SetEnergyUpdateInterval(onDemand ? Seconds(0) : Seconds(1));
+    node->AggregateObject(source);
+    source->SetNode(node);
+
+    Ptr<WifiRadioEnergyModel> model = CreateObject<WifiRadioEnergyModel>();
+    model->SetAttribute("LazyDepletionEvent", BooleanValue(onDemand));
+    model->SetEnergySource(source);
+    source->AppendDeviceEnergyModel(model);
+    model->SetEnergyDepletionCallback(
+        MakeCallback(&BasicEnergyOnDemandTest::DepletionHandler, this));
+
+    for (int i = 0; i < m_nTx; i++)
+    {
+        Simulator::Schedule(m_txInterval * i,
+                            &WifiRadioEnergyModel::ChangeState,
+                            model,
+                            static_cast<int>(WifiPhyState::TX));
+        Simulator::Schedule(m_txInterval * i + m_txDuration,
+                            &WifiRadioEnergyModel::ChangeState,
+                            model,
+                            static_cast<int>(WifiPhyState::IDLE));
+    }
+
+    m_depletionTime = Time();
+    Simulator::Stop(Seconds(m_simTimeS));
+    Simulator::Run();
+    remainingEnergy = source->GetRemainingEnergy();
+    nEvents = Simulator::GetEventCount();
+    Simulator::Destroy();
+
+    // energy = current * voltage * time
+    const double voltage = source->GetSupplyVoltage();
+    const double txEnergy =
+        m_nTx * m_txDuration.GetSeconds() * (model->GetTxCurrentA() - model->GetIdleCurrentA()) *
+        voltage;
+    const double idlePower = model->GetIdleCurrentA() * voltage;
+    const double depletionEnergy = (1 - 0.1) * source->GetInitialEnergy(); // default threshold
+    const double estDepletionTimeS = (depletionEnergy - txEnergy) / idlePower;
+    const double estRemainingEnergy =
+        source->GetInitialEnergy() - txEnergy - idlePower * m_simTimeS;
+
+    NS_LOG_DEBUG("On-demand = " << onDemand << ", depletion at " << m_depletionTime.As(Time::S)
+                                << ", expected at " << estDepletionTimeS << "s");
+
+    if (std::abs(remainingEnergy - estRemainingEnergy) > m_tolerance)
+    {
+        std::cerr << "Incorrect remaining energy!" << std::endl;
+        return true;
+    }
+    if (!m_depletionTime.IsStrictlyPositive())
+    {
+        std::cerr << "Depletion callback not invoked!" << std::endl;
+        return true;
+    }
+    // periodic updates detect the depletion at the first update after the threshold is crossed
+    const double maxDelayS = onDemand ? m_tolerance : 1;
+    if (m_depletionTime.GetSeconds() < estDepletionTimeS - m_tolerance ||
+        m_depletionTime.GetSeconds() > estDepletionTimeS + maxDelayS)
+    {
+        std::cerr << "Depletion detected at the wrong time!" << std::endl;
+        return true;
+    }
+    return false;
+}
+
+bool
+BasicEnergyOnDemandTest::CurrentIncreaseTestCase()
+{
+    Ptr<Node> node = CreateObject<Node>();
+
+    Ptr<BasicEnergySource> source = CreateObject<BasicEnergySource>();
+    source->SetInitialEnergy(10);
+    source->SetEnergyUpdateInterval(Seconds(0));
+    node->AggregateObject(source);
+    source->SetNode(node);
+
+    Ptr<WifiRadioEnergyModel> model = CreateObject<WifiRadioEnergyModel>();
+    model->SetAttribute("LazyDepletionEvent", BooleanValue(true));
+    model->SetEnergySource(source);
+    source->AppendDeviceEnergyModel(model);
+    model->SetEnergyDepletionCallback(
+        MakeCallback(&BasicEnergyOnDemandTest::DepletionHandler, this));
+
+    // the radio is idle and then keeps transmitting
+    const Time txStart = Seconds(1);
+    Simulator::Schedule(txStart,
+                        &WifiRadioEnergyModel::ChangeState,
+                        model,
+                        static_cast<int>(WifiPhyState::TX));
+
+    m_depletionTime = Time();
+    Simulator::Stop(Seconds(8.5)); // the source is depleted after ~8.2 s, emptied after ~9 s
+    Simulator::Run();
+    Simulator::Destroy();
+
+    // energy = current * voltage * time
+    const double voltage = source->GetSupplyVoltage();
+    const double idleEnergy = model->GetIdleCurrentA() * voltage * txStart.GetSeconds();
+    const double txPower = model->GetTxCurrentA() * voltage;
+    const double depletionEnergy = (1 - 0.1) * source->GetInitialEnergy(); // default threshold
+    const double estDepletionTimeS =
+        txStart.GetSeconds() + (depletionEnergy - idleEnergy) / txPower;
+
+    NS_LOG_DEBUG("Current increase: depletion at " << m_depletionTime.As(Time::S)
+                                                   << ", expected at " << estDepletionTimeS
+                                                   << "s");
+
+    if (!m_depletionTime.IsStrictlyPositive() ||
+        std::abs(m_depletionTime.GetSeconds() - estDepletionTimeS) > m_tolerance)
+    {
+        std::cerr << "Depletion not detected at the crossing time after a current increase!"
+                  << std::endl;
+        return true;
+    }
+    return false;
+}
+
+// -------------------------------------------------------------------------- //
+
 int
 main(int argc, char** argv)
 {
@@ -424,5 +655,11 @@ main(int argc, char** argv)
         return 1;
     }
 
+    BasicEnergyOnDemandTest testOnDemand;
+    if (testOnDemand.DoRun())
+    {
+        return 1;
+    }
+
     return 0;
 }
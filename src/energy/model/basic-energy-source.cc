@@ -14,6 +14,8 @@
 #include "ns3/simulator.h"
 #include "ns3/trace-source-accessor.h"
 
+#include <cmath>
+
 namespace ns3
 {
 namespace energy
@@ -54,7 +56,11 @@ BasicEnergySource::GetTypeId()
                           MakeDoubleAccessor(&BasicEnergySource::m_highBatteryTh),
                           MakeDoubleChecker<double>())
             .AddAttribute("PeriodicEnergyUpdateInterval",
-                          "Time between two consecutive periodic energy updates.",
+                          "Time between two consecutive periodic energy updates. If zero, no "
+                          "periodic update is performed: the remaining energy is only updated "
+                          "when queried or when the current drawn from the source changes, and "
+                          "an update is scheduled for the time the low (or high) battery "
+                          "threshold is expected to be crossed.",
                           TimeValue(Seconds(1)),
                           MakeTimeAccessor(&BasicEnergySource::SetEnergyUpdateInterval,
                                            &BasicEnergySource::GetEnergyUpdateInterval),
@@ -166,7 +172,17 @@ BasicEnergySource::UpdateEnergySource()
         NotifyEnergyChanged();
     }
 
-    if (m_energyUpdateEvent.IsExpired())
+    if (m_energyUpdateInterval.IsZero())
+    {
+        // device energy models update the source before switching to the current of their
+        // new state, hence the threshold crossing is predicted once the current is updated
+        if (!m_thresholdPredictionEvent.IsPending())
+        {
+            m_thresholdPredictionEvent =
+                Simulator::ScheduleNow(&BasicEnergySource::ScheduleThresholdEvent, this);
+        }
+    }
+    else if (m_energyUpdateEvent.IsExpired())
     {
         m_energyUpdateEvent = Simulator::Schedule(m_energyUpdateInterval,
                                                   &BasicEnergySource::UpdateEnergySource,
@@ -189,6 +205,7 @@ void
 BasicEnergySource::DoDispose()
 {
     NS_LOG_FUNCTION(this);
+    m_thresholdPredictionEvent.Cancel();
     BreakDeviceEnergyModelRefCycle(); // break reference cycle
 }
 
@@ -208,6 +225,50 @@ BasicEnergySource::HandleEnergyRechargedEvent()
     NotifyEnergyRecharged(); // notify DeviceEnergyModel objects
 }
 
+void
+BasicEnergySource::ScheduleThresholdEvent()
+{
+    NS_LOG_FUNCTION(this);
+
+    // the remaining energy varies linearly until the current drawn from the source changes,
+    // which triggers a new update, hence the threshold crossing time can be computed exactly
+    NS_ASSERT(m_lastUpdateTime == Simulator::Now());
+    const auto powerW = CalculateTotalCurrent() * m_supplyVoltageV;
+    double energyGapJ;
+    if (!m_depleted && powerW > 0)
+    {
+        energyGapJ = m_remainingEnergyJ - m_lowBatteryTh * m_initialEnergyJ;
+    }
+    else if (m_depleted && powerW < 0)
+    {
+        energyGapJ = m_highBatteryTh * m_initialEnergyJ - m_remainingEnergyJ;
+    }
+    else
+    {
+        // no threshold can be crossed; a pending update, if any, is harmless
+        return;
+    }
+
+    const auto delayS = energyGapJ / std::abs(powerW);
+    if (delayS > (Simulator::GetMaximumSimulationTime() - Simulator::Now()).GetSeconds())
+    {
+        return;
+    }
+    // an update performed slightly before the crossing schedules another one
+    const auto delay = Max(Seconds(delayS), TimeStep(1));
+
+    if (m_energyUpdateEvent.IsPending() &&
+        TimeStep(m_energyUpdateEvent.GetTs()) <= Simulator::Now() + delay)
+    {
+        // the pending update occurs earlier and will reschedule this one, if needed
+        return;
+    }
+    NS_LOG_DEBUG("Threshold expected to be crossed in " << delay.As(Time::S));
+    m_energyUpdateEvent.Cancel();
+    m_energyUpdateEvent =
+        Simulator::Schedule(delay, &BasicEnergySource::UpdateEnergySource, this);
+}
+
 void
 BasicEnergySource::CalculateRemainingEnergy()
 {
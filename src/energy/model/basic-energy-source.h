@@ -89,7 +89,8 @@ class BasicEnergySource : public EnergySource
     /**
      * @param interval Energy update interval.
      *
-     * This function sets the interval between each energy update.
+     * This function sets the interval between each energy update. A zero interval
+     * disables the periodic updates (see ScheduleThresholdEvent()).
      */
     void SetEnergyUpdateInterval(Time interval);
 
@@ -120,6 +121,20 @@ class BasicEnergySource : public EnergySource
      */
     void HandleEnergyRechargedEvent();
 
+    /**
+     * Used when periodic updates are disabled. Schedules an update of the energy
+     * source at the time the remaining energy is expected to cross the low battery
+     * threshold (or the high battery threshold, if the source is depleted and being
+     * recharged), unless an update is already scheduled earlier. The remaining
+     * energy varies linearly between two updates, hence no other update is needed
+     * to detect the threshold crossings.
+     *
+     * This function is scheduled to run at the time of each update (after the
+     * device energy models switched to their new state), so that the prediction
+     * is based on the new total current.
+     */
+    void ScheduleThresholdEvent();
+
     /**
      * Calculates remaining energy. This function uses the total current from all
      * device models to calculate the amount of energy to decrease. The energy to
@@ -142,6 +157,7 @@ class BasicEnergySource : public EnergySource
     bool m_depleted;
     TracedValue<double> m_remainingEnergyJ; //!< remaining energy, in Joules
     EventId m_energyUpdateEvent;            //!< energy update event
+    EventId m_thresholdPredictionEvent;     //!< event predicting the threshold crossing time
     Time m_lastUpdateTime;                  //!< last update time
     Time m_energyUpdateInterval;            //!< energy update interval
 };
@@ -0,0 +1,176 @@
+//
+// SPDX-License-Identifier: GPL-2.0-only
+//
+
+//
+// Benchmark of the FlowMonitor bookkeeping for a large number of
+// concurrent flows.
+//
+// The Ipv4FlowClassifier and the FlowMonitor are driven directly (no
+// network is simulated): every flow sends a configurable number of
+// packets, all the packets of a round are first reported as transmitted
+// (so that up to nFlows packets are in flight at the same time) and are
+// then reported as received.  The wall-clock time spent classifying and
+// tracking the packets is printed at the end.
+//
+// Usage example:
+//
+//     ./ns3 run "flowmon-benchmark --nFlows=1000000 --nRounds=4"
+//
+// With --sketch=1, the FlowMonitor keeps approximate statistics with a
+// memory footprint that does not depend on the number of flows, and the
+// classifier keeps no per-flow state.
+//
+
+#include "ns3/core-module.h"
+#include "ns3/flow-monitor.h"
+#include "ns3/ipv4-flow-classifier.h"
+#include "ns3/ipv4-header.h"
+#include "ns3/packet.h"
+#include "ns3/udp-header.h"
+
+#include <chrono>
+#include <iostream>
+#include <vector>
+
+using namespace ns3;
+
+/// FlowId and FlowPacketId of the packets of the current round, indexed by flow
+static std::vector<std::pair<FlowId, FlowPacketId>> g_packetIds;
+
+/**
+ * A probe that does not hook any trace source, used to feed the
+ * FlowMonitor directly.
+ */
+class BenchmarkFlowProbe : public FlowProbe
+{
+  public:
+    /**
+     * Constructor
+     * @param monitor the FlowMonitor this probe reports to
+     */
+    BenchmarkFlowProbe(Ptr<FlowMonitor> monitor)
+        : FlowProbe(monitor)
+    {
+    }
+};
+
+/**
+ * Classify and report the transmission or the reception of one packet per flow.
+ * @param classifier the flow classifier
+ * @param monitor the flow monitor
+ * @param probe the probe used to report the events
+ * @param nFlows the number of flows
+ * @param round the index of the round, which is also the packet identifier within each flow
+ *        (unless the classifier keeps no per-flow state)
+ * @param tx true to report transmissions, false to report receptions
+ */
+static void
+RunRound(Ptr<Ipv4FlowClassifier> classifier,
+         Ptr<FlowMonitor> monitor,
+         Ptr<FlowProbe> probe,
+         uint32_t nFlows,
+         uint32_t round,
+         bool tx)
+{
+    Ptr<Packet> payload = Create<Packet>(100);
+    UdpHeader udp;
+    udp.SetSourcePort(49153);
+    udp.SetDestinationPort(9);
+    payload->AddHeader(udp);
+
+    Ipv4Header ipHeader;
+    ipHeader.SetProtocol(17);
+    ipHeader.SetPayloadSize(payload->GetSize());
+
+    for (uint32_t i = 0; i < nFlows; i++)
+    {
+        // spread the flows over 2^16 sources and 2^16 destinations
+        ipHeader.SetSource(Ipv4Address(0x0a000000 | (i & 0xffff)));
+        ipHeader.SetDestination(Ipv4Address(0x0b000000 | (i >> 16)));
+
+        if (tx)
+        {
+            FlowId flowId;
+            FlowPacketId packetId;
+            classifier->Classify(ipHeader, payload, &flowId, &packetId);
+            // flows are classified in order, hence the FlowId of the i-th flow is i + 1,
+            // unless FlowIds are hashes of the five-tuples
+            NS_ASSERT(classifier->IsStateless() || (flowId == i + 1 && packetId == round));
+            g_packetIds[i] = {flowId, packetId};
+            monitor->ReportFirstTx(probe, flowId, packetId, payload->GetSize());
+        }
+        else
+        {
+            const auto [flowId, packetId] = g_packetIds[i];
+            monitor->ReportLastRx(probe, flowId, packetId, payload->GetSize());
+        }
+    }
+}
+
+int
+main(int argc, char* argv[])
+{
+    uint32_t nFlows = 1000000;
+    uint32_t nRounds = 4;
+    bool sketch = false;
+
+    CommandLine cmd(__FILE__);
+    cmd.AddValue("nFlows", "Number of concurrent flows", nFlows);
+    cmd.AddValue("nRounds", "Number of packets sent by each flow", nRounds);
+    cmd.AddValue("sketch", "Collect approximate statistics", sketch);
+    cmd.Parse(argc, argv);
+
+    Ptr<Ipv4FlowClassifier> classifier = Create<Ipv4FlowClassifier>();
+    Ptr<FlowMonitor> monitor = CreateObjectWithAttributes<FlowMonitor>(
+        "StatisticsMode",
+        EnumValue(sketch ? FlowMonitor::STATS_SKETCH : FlowMonitor::STATS_EXACT));
+    monitor->AddFlowClassifier(classifier);
+    g_packetIds.resize(nFlows);
+    Ptr<FlowProbe> probe = CreateObject<BenchmarkFlowProbe>(monitor);
+    monitor->StartRightNow();
+
+    auto start = std::chrono::steady_clock::now();
+    for (uint32_t round = 0; round < nRounds; round++)
+    {
+        Time roundStart = MilliSeconds(10) * round;
+        Simulator::Schedule(roundStart, &RunRound, classifier, monitor, probe, nFlows, round, true);
+        Simulator::Schedule(roundStart + MilliSeconds(5),
+                            &RunRound,
+                            classifier,
+                            monitor,
+                            probe,
+                            nFlows,
+                            round,
+                            false);
+    }
+    Simulator::Stop(MilliSeconds(10) * nRounds);
+    Simulator::Run();
+    monitor->CheckForLostPackets();
+    auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start);
+
+    uint64_t rxPackets = 0;
+    if (sketch)
+    {
+        rxPackets = monitor->GetSketchStats().rxPackets.GetTotal();
+        std::cout << "estimated flows: " << monitor->GetSketchStats().flows.Estimate()
+                  << ", median delay: " << monitor->GetSketchStats().delay.GetQuantile(0.5)
+                  << " s" << std::endl;
+    }
+    else
+    {
+        for (FlowId flowId = 1; flowId <= nFlows; flowId++)
+        {
+            const FlowMonitor::FlowStats* stats = monitor->GetFlowStats(flowId);
+            NS_ABORT_MSG_IF(stats == nullptr, "Missing statistics for flow " << flowId);
+            rxPackets += stats->rxPackets;
+        }
+    }
+
+    std::cout << "flows: " << nFlows << ", packets: " << rxPackets
+              << ", elapsed: " << elapsed.count() << " s, "
+              << (2 * rxPackets / elapsed.count()) << " reports/s" << std::endl;
+
+    Simulator::Destroy();
+    return 0;
+}
@@ -12,7 +12,8 @@ namespace ns3
 {
 
 FlowClassifier::FlowClassifier()
-    : m_lastNewFlowId(0)
+    : m_lastNewFlowId(0),
+      m_stateless(false)
 {
 }
 
@@ -26,4 +27,30 @@ FlowClassifier::GetNewFlowId()
     return ++m_lastNewFlowId;
 }
 
+void
+FlowClassifier::SetStateless(bool stateless)
+{
+    m_stateless = stateless;
+}
+
+bool
+FlowClassifier::IsStateless() const
+{
+    return m_stateless;
+}
+
+void
+FlowClassifier::RemoveFlow(FlowId flowId)
+{
+}
+
+FlowId
+FlowClassifier::GetHashedFlowId(std::size_t hash)
+{
+    uint64_t h = hash;
+    auto flowId = static_cast<FlowId>(h ^ (h >> 32));
+    // FlowIds start at 1
+    return flowId == 0 ? 1 : flowId;
+}
+
 } // namespace ns3
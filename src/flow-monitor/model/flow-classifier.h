@@ -43,6 +43,7 @@ class FlowClassifier : public SimpleRefCount<FlowClassifier>
 {
   private:
     FlowId m_lastNewFlowId; //!< Last known Flow ID
+    bool m_stateless;       //!< whether no per-flow state is kept
 
   public:
     FlowClassifier();
@@ -57,11 +58,32 @@ class FlowClassifier : public SimpleRefCount<FlowClassifier>
     /// @param indent number of spaces to use as base indentation level
     virtual void SerializeToXmlStream(std::ostream& os, uint16_t indent) const = 0;
 
+    /// Set whether the classifier keeps no per-flow state (used by the FlowMonitor
+    /// when it only keeps approximate statistics).  In such a case, the FlowId of a
+    /// flow is a hash of its classification key, hence distinct flows may share the
+    /// same FlowId, and the flows cannot be looked up nor serialized.
+    /// @param stateless whether no per-flow state is kept
+    void SetStateless(bool stateless);
+
+    /// @returns whether the classifier keeps no per-flow state
+    bool IsStateless() const;
+
+    /// Release the state kept for a flow (used by the FlowMonitor when it evicts
+    /// an idle flow).  If packets of the flow are classified afterwards, they are
+    /// given a new FlowId.  The default implementation does nothing.
+    /// @param flowId the FlowId of the flow
+    virtual void RemoveFlow(FlowId flowId);
+
   protected:
     /// Returns a new, unique Flow Identifier
     /// @returns a new FlowId
     FlowId GetNewFlowId();
 
+    /// Returns the Flow Identifier given to a flow when no per-flow state is kept
+    /// @param hash the hash of the classification key of the flow
+    /// @returns the FlowId of the flow
+    static FlowId GetHashedFlowId(std::size_t hash);
+
     ///
     /// @brief Add a number of spaces for indentation purposes.
     /// @param os The stream to write to.
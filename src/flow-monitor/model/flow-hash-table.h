@@ -0,0 +1,258 @@
+//
+// SPDX-License-Identifier: GPL-2.0-only
+//
+
+#ifndef FLOW_HASH_TABLE_H
+#define FLOW_HASH_TABLE_H
+
+#include "ns3/assert.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <utility>
+#include <vector>
+
+namespace ns3
+{
+
+/**
+ * @ingroup flow-monitor
+ * @brief Open-addressing hash table used by the flow monitor hot paths.
+ *
+ * Keys and values are stored inline in a single power-of-two sized slot
+ * array and collisions are resolved by linear probing, so that a lookup
+ * usually touches a single cache line.  Erasure uses backward-shift
+ * deletion, hence no tombstones accumulate and the probe sequences stay
+ * short even when entries are continuously inserted and removed (as is
+ * the case for in-flight packets).
+ *
+ * The hash produced by the Hash functor is post-mixed, therefore
+ * functors returning poorly distributed values (e.g., std::hash on
+ * integers, which is the identity on most platforms) can be used safely.
+ *
+ * Pointers returned by Find() and Insert() are invalidated by any
+ * subsequent Insert() or Erase().
+ *
+ * @tparam Key the key type (must be default constructible)
+ * @tparam Value the mapped type (must be default constructible)
+ * @tparam Hash the hash functor
+ * @tparam KeyEqual the key equality functor
+ */
+template <typename Key,
+          typename Value,
+          typename Hash = std::hash<Key>,
+          typename KeyEqual = std::equal_to<Key>>
+class FlowHashTable
+{
+  public:
+    /**
+     * Constructor
+     * @param initialCapacity number of slots to allocate upfront (rounded up to a power of two)
+     */
+    explicit FlowHashTable(std::size_t initialCapacity = 16)
+        : m_size(0)
+    {
+        std::size_t capacity = 16;
+        while (capacity < initialCapacity)
+        {
+            capacity <<= 1;
+        }
+        m_slots.resize(capacity);
+        m_mask = capacity - 1;
+    }
+
+    /**
+     * Look up a key
+     * @param key the key
+     * @return a pointer to the mapped value, or nullptr if the key is not present
+     */
+    Value* Find(const Key& key)
+    {
+        std::size_t index = Bucket(key);
+        while (m_slots[index].used)
+        {
+            if (m_equal(m_slots[index].key, key))
+            {
+                return &m_slots[index].value;
+            }
+            index = (index + 1) & m_mask;
+        }
+        return nullptr;
+    }
+
+    /**
+     * Look up a key
+     * @param key the key
+     * @return a pointer to the mapped value, or nullptr if the key is not present
+     */
+    const Value* Find(const Key& key) const
+    {
+        return const_cast<FlowHashTable*>(this)->Find(key);
+    }
+
+    /**
+     * Insert a key, unless it is already present
+     * @param key the key
+     * @param value the value to map the key to, if the key is not present
+     * @return a pointer to the mapped value and a flag set to true if the key was inserted
+     */
+    std::pair<Value*, bool> Insert(const Key& key, const Value& value = Value())
+    {
+        // keep the load factor below 0.5 so that probe sequences stay short
+        if (2 * (m_size + 1) > m_slots.size())
+        {
+            Rehash(m_slots.size() * 2);
+        }
+        std::size_t index = Bucket(key);
+        while (m_slots[index].used)
+        {
+            if (m_equal(m_slots[index].key, key))
+            {
+                return {&m_slots[index].value, false};
+            }
+            index = (index + 1) & m_mask;
+        }
+        m_slots[index].key = key;
+        m_slots[index].value = value;
+        m_slots[index].used = true;
+        m_size++;
+        return {&m_slots[index].value, true};
+    }
+
+    /**
+     * Remove a key
+     * @param key the key
+     * @return true if the key was present
+     */
+    bool Erase(const Key& key)
+    {
+        std::size_t index = Bucket(key);
+        while (m_slots[index].used)
+        {
+            if (m_equal(m_slots[index].key, key))
+            {
+                EraseSlot(index);
+                return true;
+            }
+            index = (index + 1) & m_mask;
+        }
+        return false;
+    }
+
+    /**
+     * @return the number of stored entries
+     */
+    std::size_t GetSize() const
+    {
+        return m_size;
+    }
+
+    /**
+     * Remove all the entries and release the slot array
+     */
+    void Clear()
+    {
+        m_slots.assign(16, Slot());
+        m_mask = 15;
+        m_size = 0;
+    }
+
+    /**
+     * Invoke a function on every stored entry, in unspecified order
+     * @tparam F the function type, invoked as f(const Key&, const Value&)
+     * @param f the function
+     */
+    template <typename F>
+    void ForEach(F f) const
+    {
+        for (const auto& slot : m_slots)
+        {
+            if (slot.used)
+            {
+                f(slot.key, slot.value);
+            }
+        }
+    }
+
+  private:
+    /// A slot of the table
+    struct Slot
+    {
+        Key key{};         //!< the key
+        Value value{};     //!< the mapped value
+        bool used{false};  //!< whether the slot holds an entry
+    };
+
+    /**
+     * @param key the key
+     * @return the home bucket of the key
+     */
+    std::size_t Bucket(const Key& key) const
+    {
+        // 64-bit finalizer of MurmurHash3, spreads low-entropy hashes over all the bits
+        uint64_t h = static_cast<uint64_t>(m_hash(key));
+        h ^= h >> 33;
+        h *= 0xff51afd7ed558ccdULL;
+        h ^= h >> 33;
+        h *= 0xc4ceb9fe1a85ec53ULL;
+        h ^= h >> 33;
+        return static_cast<std::size_t>(h) & m_mask;
+    }
+
+    /**
+     * Empty a slot and shift back the entries of the same probe sequence
+     * @param index the slot to empty
+     */
+    void EraseSlot(std::size_t index)
+    {
+        std::size_t next = (index + 1) & m_mask;
+        while (m_slots[next].used)
+        {
+            std::size_t home = Bucket(m_slots[next].key);
+            // move the entry back if its home bucket is not in the cyclic range (index, next]
+            if (((next - home) & m_mask) >= ((next - index) & m_mask))
+            {
+                m_slots[index] = std::move(m_slots[next]);
+                index = next;
+            }
+            next = (next + 1) & m_mask;
+        }
+        m_slots[index] = Slot();
+        m_size--;
+    }
+
+    /**
+     * Reallocate the slot array and reinsert all the entries
+     * @param capacity the new number of slots (a power of two)
+     */
+    void Rehash(std::size_t capacity)
+    {
+        NS_ASSERT((capacity & (capacity - 1)) == 0);
+        std::vector<Slot> old(capacity);
+        old.swap(m_slots);
+        m_mask = capacity - 1;
+        for (auto& slot : old)
+        {
+            if (slot.used)
+            {
+                std::size_t index = Bucket(slot.key);
+                while (m_slots[index].used)
+                {
+                    index = (index + 1) & m_mask;
+                }
+                m_slots[index] = std::move(slot);
+            }
+        }
+    }
+
+    std::vector<Slot> m_slots; //!< the slot array
+    std::size_t m_mask;        //!< number of slots minus one
+    std::size_t m_size;        //!< number of stored entries
+    Hash m_hash;               //!< the hash functor
+    KeyEqual m_equal;          //!< the key equality functor
+};
+
+} // namespace ns3
+
+#endif /* FLOW_HASH_TABLE_H */
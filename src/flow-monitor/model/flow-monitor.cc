@@ -9,9 +9,18 @@
 #include "flow-monitor.h"
 
 #include "ns3/double.h"
+#include "ns3/enum.h"
 #include "ns3/log.h"
 #include "ns3/simulator.h"
+#include "ns3/string.h"
+#include "ns3/uinteger.h"
 
+#ifdef HAVE_SQLITE3
+#include "ns3/sqlite-output.h"
+#endif
+
+#include <algorithm>
+#include <cmath>
 #include <fstream>
 #include <limits>
 #include <sstream>
@@ -25,6 +34,21 @@ NS_LOG_COMPONENT_DEFINE("FlowMonitor");
 
 NS_OBJECT_ENSURE_REGISTERED(FlowMonitor);
 
+/**
+ * Pack a (FlowId, FlowPacketId) pair in a single key
+ * @param flowId the flow identification
+ * @param packetId the packet identification
+ * @return the key of the tracked packet
+ */
+static inline uint64_t
+TrackedPacketKey(FlowId flowId, FlowPacketId packetId)
+{
+    return (static_cast<uint64_t>(flowId) << 32) | packetId;
+}
+
+/// Key denoting the absence of a tracked packet (FlowIds start at 1, hence no packet has it)
+static const uint64_t NO_TRACKED_PACKET = 0;
+
 TypeId
 FlowMonitor::GetTypeId()
 {
@@ -70,7 +94,61 @@ FlowMonitor::GetTypeId()
                 ("The minimum inter-arrival time that is considered a flow interruption."),
                 TimeValue(Seconds(0.5)),
                 MakeTimeAccessor(&FlowMonitor::m_flowInterruptionsMinTime),
-                MakeTimeChecker());
+                MakeTimeChecker())
+            .AddAttribute("ExportInterval",
+                          "The interval between two exports of the flow statistics deltas "
+                          "(see ExportFlowStatsDeltas). Zero disables the periodic export. "
+                          "The export is not available in Sketch mode.",
+                          TimeValue(Seconds(0)),
+                          MakeTimeAccessor(&FlowMonitor::m_exportInterval),
+                          MakeTimeChecker(Seconds(0)))
+            .AddAttribute("ExportFileName",
+                          "The name of the file the flow statistics deltas are exported to.",
+                          StringValue("flowmon-deltas.csv"),
+                          MakeStringAccessor(&FlowMonitor::m_exportFileName),
+                          MakeStringChecker())
+            .AddAttribute("ExportFormat",
+                          "The format of the file the flow statistics deltas are exported to.",
+                          EnumValue(EXPORT_CSV),
+                          MakeEnumAccessor<ExportFormat>(&FlowMonitor::m_exportFormat),
+                          MakeEnumChecker(EXPORT_CSV, "Csv", EXPORT_SQLITE, "Sqlite"))
+            .AddAttribute("IdleFlowTimeout",
+                          "After each export of the flow statistics deltas, the flows that "
+                          "neither sent nor received packets during this time are evicted "
+                          "from memory. Zero disables the eviction.",
+                          TimeValue(Seconds(0)),
+                          MakeTimeAccessor(&FlowMonitor::m_idleFlowTimeout),
+                          MakeTimeChecker(Seconds(0)))
+            .AddAttribute("StatisticsMode",
+                          "Whether to keep exact statistics for every flow, or approximate "
+                          "statistics whose memory footprint does not depend on the number "
+                          "of flows (see FlowMonitor::SketchStats). In the latter case, the "
+                          "flow classifiers added afterwards keep no per-flow state either "
+                          "(see FlowClassifier::SetStateless), hence this attribute must be "
+                          "set before the classifiers are added (e.g., by means of "
+                          "FlowMonitorHelper::SetMonitorAttribute).",
+                          EnumValue(STATS_EXACT),
+                          MakeEnumAccessor<StatisticsMode>(&FlowMonitor::m_statisticsMode),
+                          MakeEnumChecker(STATS_EXACT, "Exact", STATS_SKETCH, "Sketch"))
+            .AddAttribute("SketchWidth",
+                          "The number of counters per row of the count-min sketches (Sketch "
+                          "mode only). The per-flow counts are overestimated by at most "
+                          "e/SketchWidth times the total count, with high probability.",
+                          UintegerValue(2048),
+                          MakeUintegerAccessor(&FlowMonitor::m_sketchWidth),
+                          MakeUintegerChecker<uint32_t>(1))
+            .AddAttribute("SketchDepth",
+                          "The number of rows of the count-min sketches (Sketch mode only). "
+                          "The error bound is exceeded with probability exp(-SketchDepth).",
+                          UintegerValue(4),
+                          MakeUintegerAccessor(&FlowMonitor::m_sketchDepth),
+                          MakeUintegerChecker<uint32_t>(1))
+            .AddAttribute("SketchRelativeAccuracy",
+                          "The relative accuracy of the delay and packet size quantiles "
+                          "(Sketch mode only).",
+                          DoubleValue(0.01),
+                          MakeDoubleAccessor(&FlowMonitor::m_sketchAccuracy),
+                          MakeDoubleChecker<double>(0, 1));
     return tid;
 }
 
@@ -81,7 +159,9 @@ FlowMonitor::GetInstanceTypeId() const
 }
 
 FlowMonitor::FlowMonitor()
-    : m_enabled(false)
+    : m_oldestTrackedPacket(NO_TRACKED_PACKET),
+      m_newestTrackedPacket(NO_TRACKED_PACKET),
+      m_enabled(false)
 {
     NS_LOG_FUNCTION(this);
 }
@@ -92,6 +172,8 @@ FlowMonitor::DoDispose()
     NS_LOG_FUNCTION(this);
     Simulator::Cancel(m_startEvent);
     Simulator::Cancel(m_stopEvent);
+    Simulator::Cancel(m_exportEvent);
+    CloseExportFile();
     for (auto iter = m_classifiers.begin(); iter != m_classifiers.end(); iter++)
     {
         *iter = nullptr;
@@ -101,6 +183,9 @@ FlowMonitor::DoDispose()
         m_flowProbes[i]->Dispose();
         m_flowProbes[i] = nullptr;
     }
+    m_trackedPackets.Clear();
+    m_oldestTrackedPacket = NO_TRACKED_PACKET;
+    m_newestTrackedPacket = NO_TRACKED_PACKET;
     Object::DoDispose();
 }
 
@@ -108,10 +193,17 @@ inline FlowMonitor::FlowStats&
 FlowMonitor::GetStatsForFlow(FlowId flowId)
 {
     NS_LOG_FUNCTION(this);
-    auto iter = m_flowStats.find(flowId);
-    if (iter == m_flowStats.end())
+    if (flowId >= m_flowStatsIndex.size())
     {
-        FlowMonitor::FlowStats& ref = m_flowStats[flowId];
+        // flow identifiers are assigned sequentially, hence the vector stays dense
+        m_flowStatsIndex.resize(flowId + 1, nullptr);
+    }
+    if (m_flowStatsIndex[flowId] == nullptr)
+    {
+        // new flows usually have the largest identifier, hence the hint
+        auto it = m_flowStats.emplace_hint(m_flowStats.end(), flowId, FlowStats());
+        m_flowStatsIndex[flowId] = &it->second;
+        FlowMonitor::FlowStats& ref = it->second;
         ref.delaySum = Seconds(0);
         ref.jitterSum = Seconds(0);
         ref.lastDelay = Seconds(0);
@@ -131,7 +223,7 @@ FlowMonitor::GetStatsForFlow(FlowId flowId)
     }
     else
     {
-        return iter->second;
+        return *m_flowStatsIndex[flowId];
     }
 }
 
@@ -147,14 +239,29 @@ FlowMonitor::ReportFirstTx(Ptr<FlowProbe> probe,
         NS_LOG_DEBUG("FlowMonitor not enabled; returning");
         return;
     }
+    NS_ASSERT_MSG(flowId != 0, "FlowIds start at 1");
     Time now = Simulator::Now();
-    TrackedPacket& tracked = m_trackedPackets[std::make_pair(flowId, packetId)];
-    tracked.firstSeenTime = now;
-    tracked.lastSeenTime = tracked.firstSeenTime;
-    tracked.timesForwarded = 0;
+    uint64_t key = TrackedPacketKey(flowId, packetId);
+    auto [tracked, inserted] = m_trackedPackets.Insert(key);
+    if (!inserted)
+    {
+        UnlinkTrackedPacket(*tracked);
+    }
+    tracked->firstSeenTime = now;
+    tracked->lastSeenTime = tracked->firstSeenTime;
+    tracked->timesForwarded = 0;
+    LinkTrackedPacket(key, *tracked);
     NS_LOG_DEBUG("ReportFirstTx: adding tracked packet (flowId=" << flowId << ", packetId="
                                                                  << packetId << ").");
 
+    if (m_statisticsMode == STATS_SKETCH)
+    {
+        m_sketchStats.txPackets.Add(flowId);
+        m_sketchStats.txBytes.Add(flowId, packetSize);
+        m_sketchStats.flows.Add(flowId);
+        return;
+    }
+
     probe->AddPacketStats(flowId, packetSize, Seconds(0));
 
     FlowStats& stats = GetStatsForFlow(flowId);
@@ -179,20 +286,26 @@ FlowMonitor::ReportForwarding(Ptr<FlowProbe> probe,
         NS_LOG_DEBUG("FlowMonitor not enabled; returning");
         return;
     }
-    std::pair<FlowId, FlowPacketId> key(flowId, packetId);
-    auto tracked = m_trackedPackets.find(key);
-    if (tracked == m_trackedPackets.end())
+    uint64_t key = TrackedPacketKey(flowId, packetId);
+    TrackedPacket* tracked = m_trackedPackets.Find(key);
+    if (tracked == nullptr)
     {
         NS_LOG_WARN("Received packet forward report (flowId="
                     << flowId << ", packetId=" << packetId << ") but not known to be transmitted.");
         return;
     }
 
-    tracked->second.timesForwarded++;
-    tracked->second.lastSeenTime = Simulator::Now();
+    tracked->timesForwarded++;
+    tracked->lastSeenTime = Simulator::Now();
+    // the packet is now the one seen most recently
+    UnlinkTrackedPacket(*tracked);
+    LinkTrackedPacket(key, *tracked);
 
-    Time delay = (Simulator::Now() - tracked->second.firstSeenTime);
-    probe->AddPacketStats(flowId, packetSize, delay);
+    if (m_statisticsMode == STATS_EXACT)
+    {
+        Time delay = (Simulator::Now() - tracked->firstSeenTime);
+        probe->AddPacketStats(flowId, packetSize, delay);
+    }
 }
 
 void
@@ -207,8 +320,9 @@ FlowMonitor::ReportLastRx(Ptr<FlowProbe> probe,
         NS_LOG_DEBUG("FlowMonitor not enabled; returning");
         return;
     }
-    auto tracked = m_trackedPackets.find(std::make_pair(flowId, packetId));
-    if (tracked == m_trackedPackets.end())
+    uint64_t key = TrackedPacketKey(flowId, packetId);
+    TrackedPacket* tracked = m_trackedPackets.Find(key);
+    if (tracked == nullptr)
     {
         NS_LOG_WARN("Received packet last-tx report (flowId="
                     << flowId << ", packetId=" << packetId << ") but not known to be transmitted.");
@@ -216,7 +330,19 @@ FlowMonitor::ReportLastRx(Ptr<FlowProbe> probe,
     }
 
     Time now = Simulator::Now();
-    Time delay = (now - tracked->second.firstSeenTime);
+    Time delay = (now - tracked->firstSeenTime);
+
+    if (m_statisticsMode == STATS_SKETCH)
+    {
+        m_sketchStats.rxPackets.Add(flowId);
+        m_sketchStats.rxBytes.Add(flowId, packetSize);
+        m_sketchStats.delay.AddValue(delay.GetSeconds());
+        m_sketchStats.packetSize.AddValue(packetSize);
+        UnlinkTrackedPacket(*tracked);
+        m_trackedPackets.Erase(key);
+        return;
+    }
+
     probe->AddPacketStats(flowId, packetSize, delay);
 
     FlowStats& stats = GetStatsForFlow(flowId);
@@ -263,12 +389,14 @@ FlowMonitor::ReportLastRx(Ptr<FlowProbe> probe,
         }
     }
     stats.timeLastRxPacket = now;
-    stats.timesForwarded += tracked->second.timesForwarded;
+    stats.timesForwarded += tracked->timesForwarded;
 
     NS_LOG_DEBUG("ReportLastTx: removing tracked packet (flowId=" << flowId << ", packetId="
                                                                   << packetId << ").");
 
-    m_trackedPackets.erase(tracked); // we don't need to track this packet anymore
+    // we don't need to track this packet anymore
+    UnlinkTrackedPacket(*tracked);
+    m_trackedPackets.Erase(key);
 }
 
 void
@@ -285,6 +413,13 @@ FlowMonitor::ReportDrop(Ptr<FlowProbe> probe,
         return;
     }
 
+    if (m_statisticsMode == STATS_SKETCH)
+    {
+        m_sketchStats.lostPackets.Add(flowId);
+        EraseTrackedPacket(TrackedPacketKey(flowId, packetId));
+        return;
+    }
+
     probe->AddPacketDropStats(flowId, packetSize, reasonCode);
 
     FlowStats& stats = GetStatsForFlow(flowId);
@@ -299,14 +434,12 @@ FlowMonitor::ReportDrop(Ptr<FlowProbe> probe,
     NS_LOG_DEBUG("++stats.packetsDropped["
                  << reasonCode << "]; // becomes: " << stats.packetsDropped[reasonCode]);
 
-    auto tracked = m_trackedPackets.find(std::make_pair(flowId, packetId));
-    if (tracked != m_trackedPackets.end())
+    // we don't need to track this packet anymore
+    // FIXME: this will not necessarily be true with broadcast/multicast
+    if (EraseTrackedPacket(TrackedPacketKey(flowId, packetId)))
     {
-        // we don't need to track this packet anymore
-        // FIXME: this will not necessarily be true with broadcast/multicast
-        NS_LOG_DEBUG("ReportDrop: removing tracked packet (flowId=" << flowId << ", packetId="
-                                                                    << packetId << ").");
-        m_trackedPackets.erase(tracked);
+        NS_LOG_DEBUG("ReportDrop: removed tracked packet (flowId=" << flowId << ", packetId="
+                                                                   << packetId << ").");
     }
 }
 
@@ -316,29 +449,107 @@ FlowMonitor::GetFlowStats() const
     return m_flowStats;
 }
 
+const FlowMonitor::SketchStats&
+FlowMonitor::GetSketchStats() const
+{
+    return m_sketchStats;
+}
+
+const FlowMonitor::FlowStats*
+FlowMonitor::GetFlowStats(FlowId flowId) const
+{
+    return flowId < m_flowStatsIndex.size() ? m_flowStatsIndex[flowId] : nullptr;
+}
+
 void
 FlowMonitor::CheckForLostPackets(Time maxDelay)
 {
     NS_LOG_FUNCTION(this << maxDelay.As(Time::S));
     Time now = Simulator::Now();
 
-    for (auto iter = m_trackedPackets.begin(); iter != m_trackedPackets.end();)
+    // the tracked packets are linked in the order in which they were last seen, so only
+    // the oldest ones need to be visited
+    while (m_oldestTrackedPacket != NO_TRACKED_PACKET)
     {
-        if (now - iter->second.lastSeenTime >= maxDelay)
+        const uint64_t key = m_oldestTrackedPacket;
+        const TrackedPacket* tracked = m_trackedPackets.Find(key);
+        NS_ASSERT(tracked != nullptr);
+        if (now - tracked->lastSeenTime < maxDelay)
         {
-            // packet is considered lost, add it to the loss statistics
-            auto flow = m_flowStats.find(iter->first.first);
-            NS_ASSERT(flow != m_flowStats.end());
-            flow->second.lostPackets++;
+            break;
+        }
 
-            // we won't track it anymore
-            m_trackedPackets.erase(iter++);
+        // packet is considered lost, add it to the loss statistics
+        auto flowId = static_cast<FlowId>(key >> 32);
+        if (m_statisticsMode == STATS_SKETCH)
+        {
+            m_sketchStats.lostPackets.Add(flowId);
+        }
+        else if (flowId < m_flowStatsIndex.size() && m_flowStatsIndex[flowId] != nullptr)
+        {
+            m_flowStatsIndex[flowId]->lostPackets++;
         }
         else
         {
-            iter++;
+            // the flow was evicted since the packet was last seen; its statistics have
+            // been exported and must not be created again
+            NS_LOG_DEBUG("Ignoring a lost packet of the evicted flow " << flowId);
         }
+
+        // we won't track it anymore
+        UnlinkTrackedPacket(*tracked);
+        m_trackedPackets.Erase(key);
+    }
+}
+
+void
+FlowMonitor::LinkTrackedPacket(uint64_t key, TrackedPacket& tracked)
+{
+    tracked.prevKey = m_newestTrackedPacket;
+    tracked.nextKey = NO_TRACKED_PACKET;
+    if (m_newestTrackedPacket == NO_TRACKED_PACKET)
+    {
+        m_oldestTrackedPacket = key;
+    }
+    else
+    {
+        m_trackedPackets.Find(m_newestTrackedPacket)->nextKey = key;
+    }
+    m_newestTrackedPacket = key;
+}
+
+void
+FlowMonitor::UnlinkTrackedPacket(const TrackedPacket& tracked)
+{
+    if (tracked.prevKey == NO_TRACKED_PACKET)
+    {
+        m_oldestTrackedPacket = tracked.nextKey;
     }
+    else
+    {
+        m_trackedPackets.Find(tracked.prevKey)->nextKey = tracked.nextKey;
+    }
+    if (tracked.nextKey == NO_TRACKED_PACKET)
+    {
+        m_newestTrackedPacket = tracked.prevKey;
+    }
+    else
+    {
+        m_trackedPackets.Find(tracked.nextKey)->prevKey = tracked.prevKey;
+    }
+}
+
+bool
+FlowMonitor::EraseTrackedPacket(uint64_t key)
+{
+    const TrackedPacket* tracked = m_trackedPackets.Find(key);
+    if (tracked == nullptr)
+    {
+        return false;
+    }
+    UnlinkTrackedPacket(*tracked);
+    m_trackedPackets.Erase(key);
+    return true;
 }
 
 void
@@ -358,6 +569,16 @@ void
 FlowMonitor::NotifyConstructionCompleted()
 {
     Object::NotifyConstructionCompleted();
+    if (m_statisticsMode == STATS_SKETCH)
+    {
+        m_sketchStats.txPackets = CountMinSketch(m_sketchWidth, m_sketchDepth);
+        m_sketchStats.txBytes = CountMinSketch(m_sketchWidth, m_sketchDepth);
+        m_sketchStats.rxPackets = CountMinSketch(m_sketchWidth, m_sketchDepth);
+        m_sketchStats.rxBytes = CountMinSketch(m_sketchWidth, m_sketchDepth);
+        m_sketchStats.lostPackets = CountMinSketch(m_sketchWidth, m_sketchDepth);
+        m_sketchStats.delay = DdSketch(m_sketchAccuracy);
+        m_sketchStats.packetSize = DdSketch(m_sketchAccuracy);
+    }
     Simulator::Schedule(PERIODIC_CHECK_INTERVAL, &FlowMonitor::PeriodicCheckForLostPackets, this);
 }
 
@@ -406,6 +627,13 @@ FlowMonitor::StartRightNow()
         return;
     }
     m_enabled = true;
+    if (m_exportInterval.IsStrictlyPositive() && !m_exportEvent.IsPending())
+    {
+        NS_ABORT_MSG_IF(m_statisticsMode == STATS_SKETCH,
+                        "The flow statistics deltas cannot be exported in Sketch mode");
+        OpenExportFile();
+        m_exportEvent = Simulator::Schedule(m_exportInterval, &FlowMonitor::PeriodicExport, this);
+    }
 }
 
 void
@@ -419,11 +647,19 @@ FlowMonitor::StopRightNow()
     }
     m_enabled = false;
     CheckForLostPackets();
+    if (m_exportEvent.IsPending())
+    {
+        m_exportEvent.Cancel();
+        ExportFlowStatsDeltas();
+    }
 }
 
 void
 FlowMonitor::AddFlowClassifier(Ptr<FlowClassifier> classifier)
 {
+    // approximate statistics only need the FlowIds, hence the classifiers do not have to
+    // keep a state for each flow
+    classifier->SetStateless(m_statisticsMode == STATS_SKETCH);
     m_classifiers.push_back(classifier);
 }
 
@@ -440,12 +676,12 @@ FlowMonitor::SerializeToXmlStream(std::ostream& os,
     indent += 2;
     os << std::string(indent, ' ') << "<FlowStats>\n";
     indent += 2;
-    for (auto flowI = m_flowStats.begin(); flowI != m_flowStats.end(); flowI++)
+    for (const auto& [flowId, flow] : m_flowStats)
     {
         os << std::string(indent, ' ');
-#define ATTRIB(name) " " #name "=\"" << flowI->second.name << "\""
-#define ATTRIB_TIME(name) " " #name "=\"" << flowI->second.name.As(Time::NS) << "\""
-        os << "<Flow flowId=\"" << flowI->first << "\"" << ATTRIB_TIME(timeFirstTxPacket)
+#define ATTRIB(name) " " #name "=\"" << flow.name << "\""
+#define ATTRIB_TIME(name) " " #name "=\"" << flow.name.As(Time::NS) << "\""
+        os << "<Flow flowId=\"" << flowId << "\"" << ATTRIB_TIME(timeFirstTxPacket)
            << ATTRIB_TIME(timeFirstRxPacket) << ATTRIB_TIME(timeLastTxPacket)
            << ATTRIB_TIME(timeLastRxPacket) << ATTRIB_TIME(delaySum) << ATTRIB_TIME(jitterSum)
            << ATTRIB_TIME(lastDelay) << ATTRIB_TIME(maxDelay) << ATTRIB_TIME(minDelay)
@@ -455,30 +691,26 @@ FlowMonitor::SerializeToXmlStream(std::ostream& os,
 #undef ATTRIB
 
         indent += 2;
-        for (uint32_t reasonCode = 0; reasonCode < flowI->second.packetsDropped.size();
-             reasonCode++)
+        for (uint32_t reasonCode = 0; reasonCode < flow.packetsDropped.size(); reasonCode++)
         {
             os << std::string(indent, ' ');
             os << "<packetsDropped reasonCode=\"" << reasonCode << "\""
-               << " number=\"" << flowI->second.packetsDropped[reasonCode] << "\" />\n";
+               << " number=\"" << flow.packetsDropped[reasonCode] << "\" />\n";
         }
-        for (uint32_t reasonCode = 0; reasonCode < flowI->second.bytesDropped.size(); reasonCode++)
+        for (uint32_t reasonCode = 0; reasonCode < flow.bytesDropped.size(); reasonCode++)
         {
             os << std::string(indent, ' ');
             os << "<bytesDropped reasonCode=\"" << reasonCode << "\""
-               << " bytes=\"" << flowI->second.bytesDropped[reasonCode] << "\" />\n";
+               << " bytes=\"" << flow.bytesDropped[reasonCode] << "\" />\n";
         }
         if (enableHistograms)
         {
-            flowI->second.delayHistogram.SerializeToXmlStream(os, indent, "delayHistogram");
-            flowI->second.jitterHistogram.SerializeToXmlStream(os, indent, "jitterHistogram");
-            flowI->second.packetSizeHistogram.SerializeToXmlStream(os,
-                                                                   indent,
-                                                                   "packetSizeHistogram");
-            flowI->second.flowInterruptionsHistogram.SerializeToXmlStream(
-                os,
-                indent,
-                "flowInterruptionsHistogram");
+            flow.delayHistogram.SerializeToXmlStream(os, indent, "delayHistogram");
+            flow.jitterHistogram.SerializeToXmlStream(os, indent, "jitterHistogram");
+            flow.packetSizeHistogram.SerializeToXmlStream(os, indent, "packetSizeHistogram");
+            flow.flowInterruptionsHistogram.SerializeToXmlStream(os,
+                                                                 indent,
+                                                                 "flowInterruptionsHistogram");
         }
         indent -= 2;
 
@@ -487,6 +719,28 @@ FlowMonitor::SerializeToXmlStream(std::ostream& os,
     indent -= 2;
     os << std::string(indent, ' ') << "</FlowStats>\n";
 
+    if (m_statisticsMode == STATS_SKETCH)
+    {
+        const SketchStats& sketch = m_sketchStats;
+        os << std::string(indent, ' ') << "<SketchStats"
+           << " distinctFlows=\"" << std::llround(sketch.flows.Estimate()) << "\""
+           << " txPackets=\"" << sketch.txPackets.GetTotal() << "\""
+           << " txBytes=\"" << sketch.txBytes.GetTotal() << "\""
+           << " rxPackets=\"" << sketch.rxPackets.GetTotal() << "\""
+           << " rxBytes=\"" << sketch.rxBytes.GetTotal() << "\""
+           << " lostPackets=\"" << sketch.lostPackets.GetTotal() << "\"";
+        if (sketch.delay.GetCount() > 0)
+        {
+            Time mean = Seconds(sketch.delay.GetSum() / sketch.delay.GetCount());
+            os << " delayMean=\"" << mean.As(Time::NS) << "\""
+               << " delayP50=\"" << Seconds(sketch.delay.GetQuantile(0.5)).As(Time::NS) << "\""
+               << " delayP90=\"" << Seconds(sketch.delay.GetQuantile(0.9)).As(Time::NS) << "\""
+               << " delayP99=\"" << Seconds(sketch.delay.GetQuantile(0.99)).As(Time::NS) << "\""
+               << " delayMax=\"" << Seconds(sketch.delay.GetMax()).As(Time::NS) << "\"";
+        }
+        os << " />\n";
+    }
+
     for (auto iter = m_classifiers.begin(); iter != m_classifiers.end(); iter++)
     {
         (*iter)->SerializeToXmlStream(os, indent);
@@ -532,9 +786,8 @@ FlowMonitor::ResetAllStats()
 {
     NS_LOG_FUNCTION(this);
 
-    for (auto& iter : m_flowStats)
+    for (auto& [flowId, flowStat] : m_flowStats)
     {
-        auto& flowStat = iter.second;
         flowStat.delaySum = Seconds(0);
         flowStat.jitterSum = Seconds(0);
         flowStat.lastDelay = Seconds(0);
@@ -554,6 +807,183 @@ FlowMonitor::ResetAllStats()
         flowStat.packetSizeHistogram.Clear();
         flowStat.flowInterruptionsHistogram.Clear();
     }
+    // the next export reports the variations with respect to the reset counters
+    m_exportedStats.Clear();
+
+    m_sketchStats.txPackets.Clear();
+    m_sketchStats.txBytes.Clear();
+    m_sketchStats.rxPackets.Clear();
+    m_sketchStats.rxBytes.Clear();
+    m_sketchStats.lostPackets.Clear();
+    m_sketchStats.flows.Clear();
+    m_sketchStats.delay.Clear();
+    m_sketchStats.packetSize.Clear();
+}
+
+void
+FlowMonitor::OpenExportFile()
+{
+    NS_LOG_FUNCTION(this);
+    if (m_exportFormat == EXPORT_CSV && !m_exportCsv.is_open())
+    {
+        m_exportCsv.open(m_exportFileName, std::ios::out | std::ios::trunc);
+        NS_ABORT_MSG_IF(!m_exportCsv.is_open(), "Cannot open file " << m_exportFileName);
+        // all times are in nanoseconds
+        m_exportCsv << "time,flowId,txPackets,txBytes,rxPackets,rxBytes,lostPackets,"
+                       "timesForwarded,delaySum,jitterSum\n";
+    }
+#ifdef HAVE_SQLITE3
+    else if (m_exportFormat == EXPORT_SQLITE && !m_exportDb)
+    {
+        m_exportDb = Create<SQLiteOutput>(m_exportFileName);
+        bool ok = m_exportDb->SpinExec(
+            "CREATE TABLE IF NOT EXISTS FlowStatsDeltas (time INTEGER, flowId INTEGER, "
+            "txPackets INTEGER, txBytes INTEGER, rxPackets INTEGER, rxBytes INTEGER, "
+            "lostPackets INTEGER, timesForwarded INTEGER, delaySum INTEGER, jitterSum INTEGER)");
+        NS_ABORT_MSG_UNLESS(ok, "Cannot create the FlowStatsDeltas table in " << m_exportFileName);
+    }
+#else
+    else if (m_exportFormat == EXPORT_SQLITE)
+    {
+        NS_FATAL_ERROR("ns-3 was built without SQLite support; use the Csv ExportFormat");
+    }
+#endif
+}
+
+void
+FlowMonitor::CloseExportFile()
+{
+    NS_LOG_FUNCTION(this);
+    if (m_exportCsv.is_open())
+    {
+        m_exportCsv.close();
+    }
+#ifdef HAVE_SQLITE3
+    m_exportDb = nullptr;
+#endif
+}
+
+void
+FlowMonitor::PeriodicExport()
+{
+    ExportFlowStatsDeltas();
+    m_exportEvent = Simulator::Schedule(m_exportInterval, &FlowMonitor::PeriodicExport, this);
+}
+
+void
+FlowMonitor::ExportFlowStatsDeltas()
+{
+    NS_LOG_FUNCTION(this);
+    NS_ABORT_MSG_IF(m_statisticsMode == STATS_SKETCH,
+                    "The flow statistics deltas cannot be exported in Sketch mode");
+    OpenExportFile();
+    // account for the lost packets before computing the deltas
+    CheckForLostPackets();
+
+    Time now = Simulator::Now();
+
+#ifdef HAVE_SQLITE3
+    sqlite3_stmt* stmt = nullptr;
+    if (m_exportDb)
+    {
+        m_exportDb->SpinExec("BEGIN TRANSACTION");
+        bool ok = m_exportDb->SpinPrepare(&stmt,
+                                          "INSERT INTO FlowStatsDeltas VALUES "
+                                          "(?, ?, ?, ?, ?, ?, ?, ?, ?, ?)");
+        NS_ABORT_MSG_UNLESS(ok, "Cannot prepare the FlowStatsDeltas insert statement");
+    }
+#endif
+
+    for (const auto& [flowId, stats] : m_flowStats)
+    {
+        // the pointer is not used after the next insertion, which may invalidate it
+        ExportedFlowStats& exported = *m_exportedStats.Insert(flowId).first;
+        if (stats.txPackets == exported.txPackets && stats.rxPackets == exported.rxPackets &&
+            stats.lostPackets == exported.lostPackets)
+        {
+            // nothing happened to this flow since the previous export
+            continue;
+        }
+
+        ExportedFlowStats delta;
+        delta.txPackets = stats.txPackets - exported.txPackets;
+        delta.txBytes = stats.txBytes - exported.txBytes;
+        delta.rxPackets = stats.rxPackets - exported.rxPackets;
+        delta.rxBytes = stats.rxBytes - exported.rxBytes;
+        delta.lostPackets = stats.lostPackets - exported.lostPackets;
+        delta.timesForwarded = stats.timesForwarded - exported.timesForwarded;
+        delta.delaySum = stats.delaySum - exported.delaySum;
+        delta.jitterSum = stats.jitterSum - exported.jitterSum;
+
+        if (m_exportCsv.is_open())
+        {
+            m_exportCsv << now.GetNanoSeconds() << ',' << flowId << ',' << delta.txPackets << ','
+                        << delta.txBytes << ',' << delta.rxPackets << ',' << delta.rxBytes << ','
+                        << delta.lostPackets << ',' << delta.timesForwarded << ','
+                        << delta.delaySum.GetNanoSeconds() << ','
+                        << delta.jitterSum.GetNanoSeconds() << '\n';
+        }
+#ifdef HAVE_SQLITE3
+        if (stmt != nullptr)
+        {
+            SQLiteOutput::SpinReset(stmt);
+            m_exportDb->Bind(stmt, 1, static_cast<long long>(now.GetNanoSeconds()));
+            m_exportDb->Bind(stmt, 2, static_cast<uint32_t>(flowId));
+            m_exportDb->Bind(stmt, 3, delta.txPackets);
+            m_exportDb->Bind(stmt, 4, static_cast<long long>(delta.txBytes));
+            m_exportDb->Bind(stmt, 5, delta.rxPackets);
+            m_exportDb->Bind(stmt, 6, static_cast<long long>(delta.rxBytes));
+            m_exportDb->Bind(stmt, 7, delta.lostPackets);
+            m_exportDb->Bind(stmt, 8, delta.timesForwarded);
+            m_exportDb->Bind(stmt, 9, static_cast<long long>(delta.delaySum.GetNanoSeconds()));
+            m_exportDb->Bind(stmt, 10, static_cast<long long>(delta.jitterSum.GetNanoSeconds()));
+            SQLiteOutput::SpinStep(stmt);
+        }
+#endif
+
+        exported.txPackets = stats.txPackets;
+        exported.txBytes = stats.txBytes;
+        exported.rxPackets = stats.rxPackets;
+        exported.rxBytes = stats.rxBytes;
+        exported.lostPackets = stats.lostPackets;
+        exported.timesForwarded = stats.timesForwarded;
+        exported.delaySum = stats.delaySum;
+        exported.jitterSum = stats.jitterSum;
+    }
+
+#ifdef HAVE_SQLITE3
+    if (stmt != nullptr)
+    {
+        SQLiteOutput::SpinFinalize(stmt);
+        m_exportDb->SpinExec("END TRANSACTION");
+    }
+#endif
+    m_exportCsv.flush();
+
+    if (!m_idleFlowTimeout.IsStrictlyPositive())
+    {
+        return;
+    }
+    for (auto it = m_flowStats.begin(); it != m_flowStats.end();)
+    {
+        const auto& [flowId, stats] = *it;
+        if (now - std::max(stats.timeLastTxPacket, stats.timeLastRxPacket) >= m_idleFlowTimeout)
+        {
+            NS_LOG_DEBUG("Evicting idle flow " << flowId);
+            // everything up to now has been exported
+            m_flowStatsIndex[flowId] = nullptr;
+            m_exportedStats.Erase(flowId);
+            for (const auto& classifier : m_classifiers)
+            {
+                classifier->RemoveFlow(flowId);
+            }
+            it = m_flowStats.erase(it);
+        }
+        else
+        {
+            ++it;
+        }
+    }
 }
 
 } // namespace ns3
@@ -10,20 +10,29 @@
 #define FLOW_MONITOR_H
 
 #include "flow-classifier.h"
+#include "flow-hash-table.h"
 #include "flow-probe.h"
 
+#include "ns3/count-min-sketch.h"
+#include "ns3/dd-sketch.h"
 #include "ns3/event-id.h"
 #include "ns3/histogram.h"
+#include "ns3/hyper-log-log.h"
 #include "ns3/nstime.h"
 #include "ns3/object.h"
 #include "ns3/ptr.h"
 
+#include <fstream>
 #include <map>
 #include <vector>
 
 namespace ns3
 {
 
+#ifdef HAVE_SQLITE3
+class SQLiteOutput;
+#endif
+
 /**
  * @defgroup flow-monitor Flow Monitor
  * @brief  Collect and store performance data from a simulation
@@ -36,6 +45,11 @@ namespace ns3
  * The FlowMonitor class is responsible for coordinating efforts
  * regarding probes, and collects end-to-end flow statistics.
  *
+ * By default, exact statistics are kept for every flow (see FlowStats).
+ * When the StatisticsMode attribute is set to Sketch, the monitor
+ * instead keeps approximate statistics whose memory footprint does not
+ * depend on the number of flows (see SketchStats), the probes do not
+ * collect per-flow statistics and the classifiers keep no per-flow state.
  */
 class FlowMonitor : public Object
 {
@@ -131,6 +145,41 @@ class FlowMonitor : public Object
         Histogram flowInterruptionsHistogram; //!< histogram of durations of flow interruptions
     };
 
+    /// @brief Approximate statistics of all the flows, kept in sketch mode
+    struct SketchStats
+    {
+        /// Number of transmitted packets, per FlowId
+        CountMinSketch txPackets;
+        /// Number of transmitted bytes, per FlowId
+        CountMinSketch txBytes;
+        /// Number of received packets, per FlowId
+        CountMinSketch rxPackets;
+        /// Number of received bytes, per FlowId
+        CountMinSketch rxBytes;
+        /// Number of lost (dropped or expired) packets, per FlowId
+        CountMinSketch lostPackets;
+        /// Distinct flows that transmitted at least one packet
+        HyperLogLog flows;
+        /// End-to-end delays (in seconds) of the received packets of all the flows
+        DdSketch delay;
+        /// Packet sizes of the received packets of all the flows
+        DdSketch packetSize;
+    };
+
+    /// Kind of statistics collected by the monitor
+    enum StatisticsMode
+    {
+        STATS_EXACT, //!< exact statistics of every flow (FlowStats)
+        STATS_SKETCH //!< approximate statistics with bounded memory (SketchStats)
+    };
+
+    /// Format of the periodic export of the flow statistics
+    enum ExportFormat
+    {
+        EXPORT_CSV,   //!< comma-separated values, one row per flow and export interval
+        EXPORT_SQLITE //!< rows of the FlowStatsDeltas table of an SQLite database
+    };
+
     // --- basic methods ---
     /**
      * @brief Get the type ID.
@@ -140,7 +189,8 @@ class FlowMonitor : public Object
     TypeId GetInstanceTypeId() const override;
     FlowMonitor();
 
-    /// Add a FlowClassifier to be used by the flow monitor.
+    /// Add a FlowClassifier to be used by the flow monitor.  In Sketch mode, the
+    /// classifier is set to keep no per-flow state.
     /// @param classifier the FlowClassifier
     void AddFlowClassifier(Ptr<FlowClassifier> classifier);
 
@@ -237,9 +287,23 @@ class FlowMonitor : public Object
     /// FlowMonitor has not stopped monitoring yet, you should call
     /// CheckForLostPackets() to make sure all possibly lost packets are
     /// accounted for.
+    ///
+    /// The returned container is the one where the statistics are stored,
+    /// hence it is not copied and reflects any later update.  Flows evicted
+    /// because idle (see the IdleFlowTimeout attribute) are removed from it.
     /// @returns the flows statistics
     const FlowStatsContainer& GetFlowStats() const;
 
+    /// Retrieve the statistics of a single flow.
+    /// @param flowId the flow identification
+    /// @returns a pointer to the flow statistics, or nullptr if the flow is unknown
+    const FlowStats* GetFlowStats(FlowId flowId) const;
+
+    /// Retrieve the approximate statistics collected when the StatisticsMode
+    /// attribute is set to Sketch.
+    /// @returns the approximate statistics
+    const SketchStats& GetSketchStats() const;
+
     /// Get a list of all FlowProbe's associated with this FlowMonitor
     /// @returns a list of all the probes
     const FlowProbeContainer& GetAllProbes() const;
@@ -270,6 +334,18 @@ class FlowMonitor : public Object
     /// Reset all the statistics
     void ResetAllStats();
 
+    /// Write to the export file (see the ExportFileName and ExportFormat
+    /// attributes), for each flow that changed since the previous export,
+    /// the variation of its counters.  Afterwards, the flows that have
+    /// been idle for longer than the IdleFlowTimeout attribute are evicted
+    /// from memory, along with their state in the classifiers (see
+    /// FlowClassifier::RemoveFlow).  Packets of an evicted flow reported
+    /// lost afterwards are not counted.  This method is called every ExportInterval while the
+    /// monitor is running, and when it stops.  The deltas are only available
+    /// with exact statistics, hence this method must not be called when the
+    /// StatisticsMode attribute is set to Sketch.
+    void ExportFlowStatsDeltas();
+
   protected:
     void NotifyConstructionCompleted() override;
     void DoDispose() override;
@@ -281,14 +357,27 @@ class FlowMonitor : public Object
         Time firstSeenTime;      //!< absolute time when the packet was first seen by a probe
         Time lastSeenTime;       //!< absolute time when the packet was last seen by a probe
         uint32_t timesForwarded; //!< number of times the packet was reportedly forwarded
+        uint64_t prevKey;        //!< key of the packet last seen before this one, if any
+        uint64_t nextKey;        //!< key of the packet last seen after this one, if any
     };
 
     /// FlowId --> FlowStats
     FlowStatsContainer m_flowStats;
+    /// FlowId --> pointer to the corresponding entry of m_flowStats (nullptr if none),
+    /// to avoid a map lookup for every reported packet.  Map entries are never moved,
+    /// hence the pointers stay valid until the entry is erased.
+    std::vector<FlowStats*> m_flowStatsIndex;
 
-    /// (FlowId,PacketId) --> TrackedPacket
-    typedef std::map<std::pair<FlowId, FlowPacketId>, TrackedPacket> TrackedPacketMap;
+    /// (FlowId,PacketId) packed in a 64-bit key --> TrackedPacket
+    typedef FlowHashTable<uint64_t, TrackedPacket> TrackedPacketMap;
     TrackedPacketMap m_trackedPackets; //!< Tracked packets
+
+    /// The tracked packets are linked, through their prevKey and nextKey fields, in
+    /// the order in which they were last seen, so that the packets that may be lost
+    /// are found without visiting all the tracked packets.
+    uint64_t m_oldestTrackedPacket; //!< key of the packet last seen the longest time ago
+    uint64_t m_newestTrackedPacket; //!< key of the packet last seen most recently
+
     Time m_maxPerHopDelay;             //!< Minimum per-hop delay
     FlowProbeContainer m_flowProbes;   //!< all the FlowProbes
 
@@ -303,6 +392,11 @@ class FlowMonitor : public Object
     double m_packetSizeBinWidth;        //!< packet size bin width (for histograms)
     double m_flowInterruptionsBinWidth; //!< Flow interruptions bin width (for histograms)
     Time m_flowInterruptionsMinTime;    //!< Flow interruptions minimum time
+    StatisticsMode m_statisticsMode;    //!< kind of collected statistics
+    uint32_t m_sketchWidth;             //!< number of counters per row of the count-min sketches
+    uint32_t m_sketchDepth;             //!< number of rows of the count-min sketches
+    double m_sketchAccuracy;            //!< relative accuracy of the quantile sketches
+    SketchStats m_sketchStats;          //!< approximate statistics (sketch mode only)
 
     /// Get the stats for a given flow
     /// @param flowId the Flow identification
@@ -311,6 +405,52 @@ class FlowMonitor : public Object
 
     /// Periodic function to check for lost packets and prune statistics
     void PeriodicCheckForLostPackets();
+
+    /// Append a tracked packet to the list of tracked packets, as the newest one
+    /// @param key the key of the tracked packet
+    /// @param tracked the tracked packet
+    void LinkTrackedPacket(uint64_t key, TrackedPacket& tracked);
+
+    /// Remove a tracked packet from the list of tracked packets
+    /// @param tracked the tracked packet
+    void UnlinkTrackedPacket(const TrackedPacket& tracked);
+
+    /// Stop tracking a packet
+    /// @param key the key of the tracked packet
+    /// @returns true if the packet was tracked
+    bool EraseTrackedPacket(uint64_t key);
+
+    /// Counters of a flow as of the last export
+    struct ExportedFlowStats
+    {
+        Time delaySum;           //!< FlowStats::delaySum
+        Time jitterSum;          //!< FlowStats::jitterSum
+        uint64_t txBytes;        //!< FlowStats::txBytes
+        uint64_t rxBytes;        //!< FlowStats::rxBytes
+        uint32_t txPackets;      //!< FlowStats::txPackets
+        uint32_t rxPackets;      //!< FlowStats::rxPackets
+        uint32_t lostPackets;    //!< FlowStats::lostPackets
+        uint32_t timesForwarded; //!< FlowStats::timesForwarded
+    };
+
+    /// Open the export file, if not already open
+    void OpenExportFile();
+    /// Close the export file, if open
+    void CloseExportFile();
+    /// Periodic function to export the flow statistics deltas
+    void PeriodicExport();
+
+    Time m_exportInterval;        //!< interval between exports (zero to disable)
+    std::string m_exportFileName; //!< name of the export file
+    ExportFormat m_exportFormat;  //!< format of the export file
+    Time m_idleFlowTimeout;       //!< idle time after which a flow is evicted
+    EventId m_exportEvent;        //!< periodic export event
+    std::ofstream m_exportCsv;    //!< export file in CSV format
+    /// FlowId --> counters as of the last export
+    FlowHashTable<FlowId, ExportedFlowStats> m_exportedStats;
+#ifdef HAVE_SQLITE3
+    Ptr<SQLiteOutput> m_exportDb; //!< export database in SQLite format
+#endif
 };
 
 } // namespace ns3
@@ -10,11 +10,12 @@
 #define IPV4_FLOW_CLASSIFIER_H
 
 #include "flow-classifier.h"
+#include "flow-hash-table.h"
 
 #include "ns3/ipv4-header.h"
 
-#include <map>
 #include <stdint.h>
+#include <vector>
 
 namespace ns3
 {
@@ -38,6 +39,15 @@ class Ipv4FlowClassifier : public FlowClassifier
         uint16_t destinationPort;       //!< Destination port
     };
 
+    /// Hash function for FiveTuple
+    struct FiveTupleHash
+    {
+        /// Hash operator
+        /// @param tuple the five-tuple
+        /// @return the hash value
+        std::size_t operator()(const FiveTuple& tuple) const;
+    };
+
     Ipv4FlowClassifier();
 
     /// @brief try to classify the packet into flow-id and packet-id
@@ -55,7 +65,8 @@ class Ipv4FlowClassifier : public FlowClassifier
                   uint32_t* out_flowId,
                   uint32_t* out_packetId);
 
-    /// Searches for the FiveTuple corresponding to the given flowId
+    /// Searches for the FiveTuple corresponding to the given flowId.  It is
+    /// a fatal error if the flow is unknown, e.g., if it was removed.
     /// @param flowId the FlowId to search for
     /// @returns the FiveTuple corresponding to flowId
     FiveTuple FindFlow(FlowId flowId) const;
@@ -81,13 +92,22 @@ class Ipv4FlowClassifier : public FlowClassifier
 
     void SerializeToXmlStream(std::ostream& os, uint16_t indent) const override;
 
+    void RemoveFlow(FlowId flowId) override;
+
   private:
-    /// Map to Flows Identifiers to FlowIds
-    std::map<FiveTuple, FlowId> m_flowMap;
-    /// Map to FlowIds to FlowPacketId
-    std::map<FlowId, FlowPacketId> m_flowPktIdMap;
-    /// Map FlowIds to (DSCP value, packet count) pairs
-    std::map<FlowId, std::map<Ipv4Header::DscpType, uint32_t>> m_flowDscpMap;
+    /// Per-flow classification state
+    struct FlowInfo
+    {
+        FlowId flowId;             //!< the FlowId of the flow
+        FlowPacketId lastPacketId; //!< identifier of the last classified packet
+        /// (DSCP value, packet count) pairs, usually holding a single element
+        std::vector<std::pair<Ipv4Header::DscpType, uint32_t>> dscpCounts;
+    };
+
+    /// Map the five-tuples of the flows to their classification state
+    FlowHashTable<FiveTuple, FlowInfo, FiveTupleHash> m_flowMap;
+    /// Map the FlowIds to the five-tuples of the flows
+    FlowHashTable<FlowId, FiveTuple> m_flowTuples;
 };
 
 /**
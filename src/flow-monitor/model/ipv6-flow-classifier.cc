@@ -81,6 +81,18 @@ operator==(const Ipv6FlowClassifier::FiveTuple& t1, const Ipv6FlowClassifier::Fi
             t1.sourcePort == t2.sourcePort && t1.destinationPort == t2.destinationPort);
 }
 
+std::size_t
+Ipv6FlowClassifier::FiveTupleHash::operator()(const FiveTuple& tuple) const
+{
+    Ipv6AddressHash addressHash;
+    std::size_t h = addressHash(tuple.sourceAddress);
+    h = h * 0x9e3779b97f4a7c15ULL + addressHash(tuple.destinationAddress);
+    h = h * 0x9e3779b97f4a7c15ULL + tuple.protocol;
+    h = h * 0x9e3779b97f4a7c15ULL +
+        ((static_cast<uint32_t>(tuple.sourcePort) << 16) | tuple.destinationPort);
+    return h;
+}
+
 Ipv6FlowClassifier::Ipv6FlowClassifier()
 {
 }
@@ -134,35 +146,44 @@ Ipv6FlowClassifier::Classify(const Ipv6Header& ipHeader,
     tuple.sourcePort = srcPort;
     tuple.destinationPort = dstPort;
 
+    if (IsStateless())
+    {
+        // the packet UID is unique, hence it identifies the packet within the flow
+        *out_flowId = GetHashedFlowId(FiveTupleHash()(tuple));
+        *out_packetId = static_cast<FlowPacketId>(ipPayload->GetUid());
+        return true;
+    }
+
     // try to insert the tuple, but check if it already exists
-    auto insert = m_flowMap.insert(std::pair<FiveTuple, FlowId>(tuple, 0));
+    auto [flow, inserted] = m_flowMap.Insert(tuple);
 
     // if the insertion succeeded, we need to assign this tuple a new flow identifier
-    if (insert.second)
+    if (inserted)
     {
-        FlowId newFlowId = GetNewFlowId();
-        insert.first->second = newFlowId;
-        m_flowPktIdMap[newFlowId] = 0;
-        m_flowDscpMap[newFlowId];
+        flow->flowId = GetNewFlowId();
+        m_flowTuples.Insert(flow->flowId, tuple);
     }
     else
     {
-        m_flowPktIdMap[insert.first->second]++;
+        flow->lastPacketId++;
     }
 
     // increment the counter of packets with the same DSCP value
     Ipv6Header::DscpType dscp = ipHeader.GetDscp();
-    auto dscpInserter = m_flowDscpMap[insert.first->second].insert(
-        std::pair<Ipv6Header::DscpType, uint32_t>(dscp, 1));
-
-    // if the insertion did not succeed, we need to increment the counter
-    if (!dscpInserter.second)
+    auto dscpIt = std::find_if(flow->dscpCounts.begin(),
+                               flow->dscpCounts.end(),
+                               [dscp](const auto& p) { return p.first == dscp; });
+    if (dscpIt == flow->dscpCounts.end())
+    {
+        flow->dscpCounts.emplace_back(dscp, 1);
+    }
+    else
     {
-        m_flowDscpMap[insert.first->second][dscp]++;
+        dscpIt->second++;
     }
 
-    *out_flowId = insert.first->second;
-    *out_packetId = m_flowPktIdMap[*out_flowId];
+    *out_flowId = flow->flowId;
+    *out_packetId = flow->lastPacketId;
 
     return true;
 }
@@ -170,16 +191,12 @@ Ipv6FlowClassifier::Classify(const Ipv6Header& ipHeader,
 Ipv6FlowClassifier::FiveTuple
 Ipv6FlowClassifier::FindFlow(FlowId flowId) const
 {
-    for (auto iter = m_flowMap.begin(); iter != m_flowMap.end(); iter++)
+    const FiveTuple* tuple = m_flowTuples.Find(flowId);
+    if (tuple == nullptr)
     {
-        if (iter->second == flowId)
-        {
-            return iter->first;
-        }
+        NS_FATAL_ERROR("Could not find the flow with ID " << flowId);
     }
-    NS_FATAL_ERROR("Could not find the flow with ID " << flowId);
-    FiveTuple retval = {Ipv6Address::GetZero(), Ipv6Address::GetZero(), 0, 0, 0};
-    return retval;
+    return *tuple;
 }
 
 bool
@@ -192,15 +209,8 @@ Ipv6FlowClassifier::SortByCount::operator()(std::pair<Ipv6Header::DscpType, uint
 std::vector<std::pair<Ipv6Header::DscpType, uint32_t>>
 Ipv6FlowClassifier::GetDscpCounts(FlowId flowId) const
 {
-    auto flow = m_flowDscpMap.find(flowId);
-
-    if (flow == m_flowDscpMap.end())
-    {
-        NS_FATAL_ERROR("Could not find the flow with ID " << flowId);
-    }
-
-    std::vector<std::pair<Ipv6Header::DscpType, uint32_t>> v(flow->second.begin(),
-                                                             flow->second.end());
+    std::vector<std::pair<Ipv6Header::DscpType, uint32_t>> v(
+        m_flowMap.Find(FindFlow(flowId))->dscpCounts);
     std::sort(v.begin(), v.end(), SortByCount());
     return v;
 }
@@ -211,28 +221,33 @@ Ipv6FlowClassifier::SerializeToXmlStream(std::ostream& os, uint16_t indent) cons
     Indent(os, indent);
     os << "<Ipv6FlowClassifier>\n";
 
+    // serialize the flows in order of FlowId
+    std::vector<std::pair<FlowId, const FiveTuple*>> flows;
+    flows.reserve(m_flowTuples.GetSize());
+    m_flowTuples.ForEach([&flows](const FlowId& flowId, const FiveTuple& tuple) {
+        flows.emplace_back(flowId, &tuple);
+    });
+    std::sort(flows.begin(), flows.end());
+
     indent += 2;
-    for (auto iter = m_flowMap.begin(); iter != m_flowMap.end(); iter++)
+    for (const auto& [flowId, tuple] : flows)
     {
         Indent(os, indent);
-        os << "<Flow flowId=\"" << iter->second << "\""
-           << " sourceAddress=\"" << iter->first.sourceAddress << "\""
-           << " destinationAddress=\"" << iter->first.destinationAddress << "\""
-           << " protocol=\"" << int(iter->first.protocol) << "\""
-           << " sourcePort=\"" << iter->first.sourcePort << "\""
-           << " destinationPort=\"" << iter->first.destinationPort << "\">\n";
+        os << "<Flow flowId=\"" << flowId << "\""
+           << " sourceAddress=\"" << tuple->sourceAddress << "\""
+           << " destinationAddress=\"" << tuple->destinationAddress << "\""
+           << " protocol=\"" << int(tuple->protocol) << "\""
+           << " sourcePort=\"" << tuple->sourcePort << "\""
+           << " destinationPort=\"" << tuple->destinationPort << "\">\n";
 
         indent += 2;
-        auto flow = m_flowDscpMap.find(iter->second);
-
-        if (flow != m_flowDscpMap.end())
+        auto dscpCounts = m_flowMap.Find(*tuple)->dscpCounts;
+        std::sort(dscpCounts.begin(), dscpCounts.end());
+        for (const auto& [dscp, packets] : dscpCounts)
         {
-            for (auto i = flow->second.begin(); i != flow->second.end(); i++)
-            {
-                Indent(os, indent);
-                os << "<Dscp value=\"0x" << std::hex << static_cast<uint32_t>(i->first) << "\""
-                   << " packets=\"" << std::dec << i->second << "\" />\n";
-            }
+            Indent(os, indent);
+            os << "<Dscp value=\"0x" << std::hex << static_cast<uint32_t>(dscp) << "\""
+               << " packets=\"" << std::dec << packets << "\" />\n";
         }
 
         indent -= 2;
@@ -245,4 +260,14 @@ Ipv6FlowClassifier::SerializeToXmlStream(std::ostream& os, uint16_t indent) cons
     os << "</Ipv6FlowClassifier>\n";
 }
 
+void
+Ipv6FlowClassifier::RemoveFlow(FlowId flowId)
+{
+    if (const FiveTuple* tuple = m_flowTuples.Find(flowId))
+    {
+        m_flowMap.Erase(*tuple);
+        m_flowTuples.Erase(flowId);
+    }
+}
+
 } // namespace ns3
@@ -6,7 +6,10 @@
 #     (example_name, do_run, do_valgrind_run).
 #
 # See test.py for more information.
-cpp_examples = []
+cpp_examples = [
+    ("flowmon-benchmark --nFlows=1000 --nRounds=2", "True", "True"),
+    ("flowmon-benchmark --nFlows=1000 --nRounds=2 --sketch=1", "True", "False"),
+]
 
 # A list of Python examples to run in order to ensure that they remain
 # runnable over time.  Each tuple in the list contains
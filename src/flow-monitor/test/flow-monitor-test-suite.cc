@@ -0,0 +1,813 @@
+//
+// SPDX-License-Identifier: GPL-2.0-only
+//
+
+#include "ns3/enum.h"
+#include "ns3/flow-hash-table.h"
+#include "ns3/flow-monitor.h"
+#include "ns3/flow-probe.h"
+#include "ns3/ipv4-flow-classifier.h"
+#include "ns3/ipv6-flow-classifier.h"
+#include "ns3/nstime.h"
+#include "ns3/packet.h"
+#include "ns3/simulator.h"
+#include "ns3/string.h"
+#include "ns3/test.h"
+#include "ns3/udp-header.h"
+
+#ifdef HAVE_SQLITE3
+#include "ns3/sqlite-output.h"
+#endif
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <vector>
+
+using namespace ns3;
+
+/**
+ * @defgroup flow-monitor-test Flow Monitor module tests
+ * @ingroup flow-monitor
+ * @ingroup tests
+ */
+
+/**
+ * @ingroup flow-monitor-test
+ *
+ * @brief A probe that does not hook any trace source, used to feed the FlowMonitor directly.
+ */
+class FlowMonitorTestProbe : public FlowProbe
+{
+  public:
+    /**
+     * Constructor
+     * @param monitor the FlowMonitor this probe reports to
+     */
+    FlowMonitorTestProbe(Ptr<FlowMonitor> monitor)
+        : FlowProbe(monitor)
+    {
+    }
+};
+
+/**
+ * @ingroup flow-monitor-test
+ *
+ * @brief Test the periodic export of the flow statistics deltas and the eviction of idle flows.
+ *
+ * The statistics are exported every second and the flows that are idle for 1.5 seconds are
+ * evicted. Flow 1 sends two packets before the first export, then it is idle and is evicted
+ * at the second export, and finally sends another packet before the third export. Flow 2 sends
+ * a packet before the first export and another one before the second export. We check that
+ * only the flows whose counters changed are exported, that the exported values are the
+ * variations since the previous export (also for the evicted flow, whose statistics start
+ * from scratch) and that the evicted flow is no longer returned by GetFlowStats().
+ */
+class FlowMonitorExportTestCase : public TestCase
+{
+  public:
+    /**
+     * Constructor
+     * @param format the format of the export file
+     */
+    FlowMonitorExportTestCase(FlowMonitor::ExportFormat format);
+
+  private:
+    void DoRun() override;
+
+    /**
+     * Report the transmission of a packet and schedule the report of its reception.
+     * @param flowId the flow identification
+     * @param packetId the packet identification
+     * @param packetSize the packet size
+     * @param delay the end-to-end delay of the packet
+     */
+    void SendPacket(FlowId flowId, FlowPacketId packetId, uint32_t packetSize, Time delay);
+
+    /**
+     * Check the flows whose statistics are kept by the monitor.
+     * @param flowIds the identifiers of the expected flows
+     */
+    void CheckFlows(std::vector<FlowId> flowIds);
+
+    /// Exported record: time, flowId, txPackets, txBytes, rxPackets, rxBytes, lostPackets,
+    /// timesForwarded, delaySum and jitterSum (times in nanoseconds)
+    using Record = std::vector<int64_t>;
+
+    /**
+     * @return the records read from the export file
+     */
+    std::vector<Record> ReadRecords() const;
+
+    FlowMonitor::ExportFormat m_format; ///< the format of the export file
+    std::string m_fileName;             ///< the name of the export file
+    Ptr<FlowMonitor> m_monitor;         ///< the flow monitor
+    Ptr<FlowProbe> m_probe;             ///< the probe used to report the packets
+};
+
+FlowMonitorExportTestCase::FlowMonitorExportTestCase(FlowMonitor::ExportFormat format)
+    : TestCase(std::string("Export of the flow statistics deltas in ") +
+               (format == FlowMonitor::EXPORT_CSV ? "CSV" : "SQLite") + " format"),
+      m_format(format)
+{
+}
+
+void
+FlowMonitorExportTestCase::SendPacket(FlowId flowId,
+                                      FlowPacketId packetId,
+                                      uint32_t packetSize,
+                                      Time delay)
+{
+    m_monitor->ReportFirstTx(m_probe, flowId, packetId, packetSize);
+    Simulator::Schedule(delay,
+                        &FlowMonitor::ReportLastRx,
+                        m_monitor,
+                        m_probe,
+                        flowId,
+                        packetId,
+                        packetSize);
+}
+
+void
+FlowMonitorExportTestCase::CheckFlows(std::vector<FlowId> flowIds)
+{
+    const auto& stats = m_monitor->GetFlowStats();
+    NS_TEST_EXPECT_MSG_EQ(stats.size(),
+                          flowIds.size(),
+                          "Unexpected number of flows at " << Simulator::Now().As(Time::S));
+    for (const auto flowId : flowIds)
+    {
+        NS_TEST_EXPECT_MSG_EQ(stats.count(flowId),
+                              1,
+                              "Flow " << flowId << " not found at "
+                                      << Simulator::Now().As(Time::S));
+        NS_TEST_EXPECT_MSG_EQ((m_monitor->GetFlowStats(flowId) != nullptr),
+                              true,
+                              "Flow " << flowId << " not found at "
+                                      << Simulator::Now().As(Time::S));
+    }
+}
+
+std::vector<FlowMonitorExportTestCase::Record>
+FlowMonitorExportTestCase::ReadRecords() const
+{
+    std::vector<Record> records;
+
+    if (m_format == FlowMonitor::EXPORT_CSV)
+    {
+        std::ifstream file(m_fileName);
+        std::string line;
+        std::getline(file, line); // header
+        while (std::getline(file, line))
+        {
+            std::istringstream iss(line);
+            std::string field;
+            Record record;
+            while (std::getline(iss, field, ','))
+            {
+                record.push_back(std::stoll(field));
+            }
+            records.push_back(record);
+        }
+    }
+#ifdef HAVE_SQLITE3
+    else
+    {
+        SQLiteOutput db(m_fileName);
+        sqlite3_stmt* stmt;
+        db.SpinPrepare(&stmt, "SELECT * FROM FlowStatsDeltas ORDER BY time, flowId");
+        while (SQLiteOutput::SpinStep(stmt) == SQLITE_ROW)
+        {
+            Record record;
+            for (int i = 0; i < 10; i++)
+            {
+                // double values represent 64-bit integers exactly up to 2^53
+                record.push_back(static_cast<int64_t>(db.RetrieveColumn<double>(stmt, i)));
+            }
+            records.push_back(record);
+        }
+        SQLiteOutput::SpinFinalize(stmt);
+    }
+#endif
+
+    return records;
+}
+
+void
+FlowMonitorExportTestCase::DoRun()
+{
+    m_fileName = CreateTempDirFilename(
+        std::string("flowmon-deltas") + (m_format == FlowMonitor::EXPORT_CSV ? ".csv" : ".db"));
+    std::remove(m_fileName.c_str());
+
+    m_monitor = CreateObjectWithAttributes<FlowMonitor>("ExportInterval",
+                                                        TimeValue(Seconds(1)),
+                                                        "ExportFileName",
+                                                        StringValue(m_fileName),
+                                                        "ExportFormat",
+                                                        EnumValue(m_format),
+                                                        "IdleFlowTimeout",
+                                                        TimeValue(MilliSeconds(1500)));
+    m_probe = CreateObject<FlowMonitorTestProbe>(m_monitor);
+    m_monitor->StartRightNow();
+
+    Simulator::Schedule(MilliSeconds(100),
+                        &FlowMonitorExportTestCase::SendPacket,
+                        this,
+                        1,
+                        0,
+                        500,
+                        MilliSeconds(50));
+    Simulator::Schedule(MilliSeconds(200),
+                        &FlowMonitorExportTestCase::SendPacket,
+                        this,
+                        1,
+                        1,
+                        500,
+                        MilliSeconds(50));
+    Simulator::Schedule(MilliSeconds(300),
+                        &FlowMonitorExportTestCase::SendPacket,
+                        this,
+                        2,
+                        0,
+                        1000,
+                        MilliSeconds(20));
+    Simulator::Schedule(MilliSeconds(1500),
+                        &FlowMonitorExportTestCase::SendPacket,
+                        this,
+                        2,
+                        1,
+                        1000,
+                        MilliSeconds(20));
+    Simulator::Schedule(MilliSeconds(2200),
+                        &FlowMonitorExportTestCase::SendPacket,
+                        this,
+                        1,
+                        2,
+                        500,
+                        MilliSeconds(50));
+
+    // flow 1 is evicted at the second export and is back after its third packet is sent
+    Simulator::Schedule(MilliSeconds(1100),
+                        &FlowMonitorExportTestCase::CheckFlows,
+                        this,
+                        std::vector<FlowId>{1, 2});
+    Simulator::Schedule(MilliSeconds(2100),
+                        &FlowMonitorExportTestCase::CheckFlows,
+                        this,
+                        std::vector<FlowId>{2});
+    Simulator::Schedule(MilliSeconds(3100),
+                        &FlowMonitorExportTestCase::CheckFlows,
+                        this,
+                        std::vector<FlowId>{1, 2});
+
+    Simulator::Stop(MilliSeconds(3500));
+    Simulator::Run();
+
+    // close the export file
+    m_monitor->Dispose();
+    m_monitor = nullptr;
+    m_probe = nullptr;
+    Simulator::Destroy();
+
+    const std::vector<Record> expected{
+        {1000000000, 1, 2, 1000, 2, 1000, 0, 0, 100000000, 0},
+        {1000000000, 2, 1, 1000, 1, 1000, 0, 0, 20000000, 0},
+        {2000000000, 2, 1, 1000, 1, 1000, 0, 0, 20000000, 0},
+        {3000000000, 1, 1, 500, 1, 500, 0, 0, 50000000, 0},
+    };
+    const auto records = ReadRecords();
+
+    NS_TEST_ASSERT_MSG_EQ(records.size(), expected.size(), "Unexpected number of records");
+    for (std::size_t i = 0; i < records.size(); i++)
+    {
+        NS_TEST_ASSERT_MSG_EQ(records[i].size(),
+                              expected[i].size(),
+                              "Unexpected number of fields in record " << i);
+        for (std::size_t j = 0; j < records[i].size(); j++)
+        {
+            NS_TEST_EXPECT_MSG_EQ(records[i][j],
+                                  expected[i][j],
+                                  "Unexpected value of field " << j << " in record " << i);
+        }
+    }
+}
+
+/**
+ * @ingroup flow-monitor-test
+ *
+ * @brief Test the open-addressing hash table used by the flow monitor and the classifiers.
+ *
+ * Enough entries are inserted for the table to be resized several times, then half of them
+ * are erased and the others are checked. The test is run with a hash function producing
+ * many collisions, so that long probe sequences are shifted back by the erasures.
+ */
+class FlowHashTableTestCase : public TestCase
+{
+  public:
+    FlowHashTableTestCase();
+
+  private:
+    void DoRun() override;
+
+    /// Hash function mapping all the keys to four values
+    struct CollidingHash
+    {
+        /**
+         * @param key the key
+         * @return the hash value
+         */
+        std::size_t operator()(uint32_t key) const
+        {
+            return key % 4;
+        }
+    };
+
+    /**
+     * Fill a table, erase half of its entries and check the remaining ones
+     * @tparam Hash the hash function
+     * @param name the name of the hash function
+     */
+    template <typename Hash>
+    void CheckTable(std::string name);
+};
+
+FlowHashTableTestCase::FlowHashTableTestCase()
+    : TestCase("Insertion, lookup and erasure in the flow hash table")
+{
+}
+
+template <typename Hash>
+void
+FlowHashTableTestCase::CheckTable(std::string name)
+{
+    const uint32_t nKeys = 1000;
+    FlowHashTable<uint32_t, uint32_t, Hash> table;
+
+    for (uint32_t key = 1; key <= nKeys; key++)
+    {
+        auto [value, inserted] = table.Insert(key, 2 * key);
+        NS_TEST_EXPECT_MSG_EQ(inserted, true, "Key " << key << " not inserted with " << name);
+        NS_TEST_EXPECT_MSG_EQ(*value, 2 * key, "Unexpected value of key " << key);
+    }
+    NS_TEST_EXPECT_MSG_EQ(table.GetSize(), nKeys, "Unexpected size with " << name);
+
+    // inserting an existing key leaves its value unchanged
+    auto [value, inserted] = table.Insert(1, 0);
+    NS_TEST_EXPECT_MSG_EQ(inserted, false, "Existing key inserted again with " << name);
+    NS_TEST_EXPECT_MSG_EQ(*value, 2, "Value of an existing key changed with " << name);
+
+    for (uint32_t key = 1; key <= nKeys; key += 2)
+    {
+        NS_TEST_EXPECT_MSG_EQ(table.Erase(key), true, "Key " << key << " not erased");
+        NS_TEST_EXPECT_MSG_EQ(table.Erase(key), false, "Key " << key << " erased twice");
+    }
+    NS_TEST_EXPECT_MSG_EQ(table.GetSize(), nKeys / 2, "Unexpected size after the erasures");
+
+    for (uint32_t key = 1; key <= nKeys; key++)
+    {
+        const uint32_t* found = table.Find(key);
+        if (key % 2 == 1)
+        {
+            NS_TEST_EXPECT_MSG_EQ((found == nullptr), true, "Erased key " << key << " found");
+        }
+        else
+        {
+            NS_TEST_ASSERT_MSG_NE(found, nullptr, "Key " << key << " not found with " << name);
+            NS_TEST_EXPECT_MSG_EQ(*found, 2 * key, "Unexpected value of key " << key);
+        }
+    }
+    NS_TEST_EXPECT_MSG_EQ((table.Find(nKeys + 1) == nullptr), true, "Unknown key found");
+
+    std::size_t count = 0;
+    table.ForEach([this, &count](const uint32_t& key, const uint32_t& value) {
+        NS_TEST_EXPECT_MSG_EQ(value, 2 * key, "Unexpected value of key " << key);
+        count++;
+    });
+    NS_TEST_EXPECT_MSG_EQ(count, nKeys / 2, "Unexpected number of visited entries");
+
+    table.Clear();
+    NS_TEST_EXPECT_MSG_EQ(table.GetSize(), 0, "Table not cleared with " << name);
+    NS_TEST_EXPECT_MSG_EQ((table.Find(2) == nullptr), true, "Key found after clearing");
+}
+
+void
+FlowHashTableTestCase::DoRun()
+{
+    CheckTable<std::hash<uint32_t>>("std::hash");
+    CheckTable<CollidingHash>("a colliding hash");
+}
+
+/**
+ * @ingroup flow-monitor-test
+ *
+ * @brief Test the detection of the lost packets among the tracked packets.
+ *
+ * Three packets are sent at time 0. At 1 s, the first one is forwarded and the second one
+ * is received. The third packet is lost at the check made at 1.5 s and the first one at the
+ * check made at 2.5 s, each check considering as lost the packets not seen for 1 s. Finally,
+ * a fourth packet is sent and dropped at 3 s, and it is no longer tracked by the check made
+ * right after.
+ */
+class FlowMonitorLostPacketsTestCase : public TestCase
+{
+  public:
+    FlowMonitorLostPacketsTestCase();
+
+  private:
+    void DoRun() override;
+
+    /**
+     * Check for lost packets and check the number of lost packets of the flow
+     * @param maxDelay the maximum delay for a packet not to be considered lost
+     * @param lostPackets the expected number of lost packets
+     */
+    void CheckLostPackets(Time maxDelay, uint32_t lostPackets);
+
+    Ptr<FlowMonitor> m_monitor; ///< the flow monitor
+    Ptr<FlowProbe> m_probe;     ///< the probe used to report the packets
+};
+
+FlowMonitorLostPacketsTestCase::FlowMonitorLostPacketsTestCase()
+    : TestCase("Detection of the lost packets")
+{
+}
+
+void
+FlowMonitorLostPacketsTestCase::CheckLostPackets(Time maxDelay, uint32_t lostPackets)
+{
+    m_monitor->CheckForLostPackets(maxDelay);
+    const auto stats = m_monitor->GetFlowStats(1);
+    NS_TEST_ASSERT_MSG_NE(stats, nullptr, "Flow not found at " << Simulator::Now().As(Time::S));
+    NS_TEST_EXPECT_MSG_EQ(stats->lostPackets,
+                          lostPackets,
+                          "Unexpected number of lost packets at " << Simulator::Now().As(Time::S));
+}
+
+void
+FlowMonitorLostPacketsTestCase::DoRun()
+{
+    m_monitor = CreateObject<FlowMonitor>();
+    m_probe = CreateObject<FlowMonitorTestProbe>(m_monitor);
+    m_monitor->StartRightNow();
+
+    for (FlowPacketId packetId = 0; packetId < 3; packetId++)
+    {
+        m_monitor->ReportFirstTx(m_probe, 1, packetId, 100);
+    }
+    Simulator::Schedule(Seconds(1), &FlowMonitor::ReportForwarding, m_monitor, m_probe, 1, 0, 100);
+    Simulator::Schedule(Seconds(1), &FlowMonitor::ReportLastRx, m_monitor, m_probe, 1, 1, 100);
+    Simulator::Schedule(MilliSeconds(1500),
+                        &FlowMonitorLostPacketsTestCase::CheckLostPackets,
+                        this,
+                        Seconds(1),
+                        1);
+    Simulator::Schedule(MilliSeconds(2500),
+                        &FlowMonitorLostPacketsTestCase::CheckLostPackets,
+                        this,
+                        Seconds(1),
+                        2);
+    Simulator::Schedule(Seconds(3), &FlowMonitor::ReportFirstTx, m_monitor, m_probe, 1, 3, 100);
+    Simulator::Schedule(Seconds(3), &FlowMonitor::ReportDrop, m_monitor, m_probe, 1, 3, 100, 0);
+    // the dropped packet is counted as lost when dropped, and only then
+    Simulator::Schedule(Seconds(3),
+                        &FlowMonitorLostPacketsTestCase::CheckLostPackets,
+                        this,
+                        Seconds(0),
+                        3);
+
+    Simulator::Stop(Seconds(4));
+    Simulator::Run();
+
+    const auto stats = m_monitor->GetFlowStats(1);
+    NS_TEST_ASSERT_MSG_NE(stats, nullptr, "Flow not found");
+    NS_TEST_EXPECT_MSG_EQ(stats->txPackets, 4, "Unexpected number of transmitted packets");
+    NS_TEST_EXPECT_MSG_EQ(stats->rxPackets, 1, "Unexpected number of received packets");
+
+    m_monitor->Dispose();
+    m_monitor = nullptr;
+    m_probe = nullptr;
+    Simulator::Destroy();
+}
+
+/**
+ * @param sourcePort the source port
+ * @param destinationPort the destination port
+ * @return a packet starting with a UDP header carrying the given ports
+ */
+static Ptr<Packet>
+CreateUdpPayload(uint16_t sourcePort, uint16_t destinationPort)
+{
+    auto packet = Create<Packet>(100);
+    UdpHeader udpHeader;
+    udpHeader.SetSourcePort(sourcePort);
+    udpHeader.SetDestinationPort(destinationPort);
+    packet->AddHeader(udpHeader);
+    return packet;
+}
+
+/**
+ * @ingroup flow-monitor-test
+ *
+ * @brief Test the eviction of an idle flow.
+ *
+ * A packet of a flow is sent at time 0 and never received. The flow is evicted at the export
+ * made at 2 s, while the packet is still tracked. We check that the flow is not created again
+ * when the packet is considered lost, and that the classifier no longer knows the flow, hence
+ * a packet with the same five-tuple is given a new FlowId.
+ */
+class FlowMonitorEvictionTestCase : public TestCase
+{
+  public:
+    FlowMonitorEvictionTestCase();
+
+  private:
+    void DoRun() override;
+
+    /// Check that the monitor keeps no flow statistics
+    void CheckNoFlow();
+
+    Ptr<FlowMonitor> m_monitor; ///< the flow monitor
+};
+
+FlowMonitorEvictionTestCase::FlowMonitorEvictionTestCase()
+    : TestCase("Eviction of an idle flow")
+{
+}
+
+void
+FlowMonitorEvictionTestCase::CheckNoFlow()
+{
+    NS_TEST_EXPECT_MSG_EQ((m_monitor->GetFlowStats(1) == nullptr),
+                          true,
+                          "Evicted flow found at " << Simulator::Now().As(Time::S));
+    NS_TEST_EXPECT_MSG_EQ(m_monitor->GetFlowStats().size(),
+                          0,
+                          "Unexpected flows at " << Simulator::Now().As(Time::S));
+}
+
+void
+FlowMonitorEvictionTestCase::DoRun()
+{
+    const auto fileName = CreateTempDirFilename("flowmon-eviction.csv");
+    m_monitor = CreateObjectWithAttributes<FlowMonitor>("ExportFileName",
+                                                        StringValue(fileName),
+                                                        "IdleFlowTimeout",
+                                                        TimeValue(Seconds(1)),
+                                                        "MaxPerHopDelay",
+                                                        TimeValue(Seconds(10)));
+    Ptr<FlowProbe> probe = CreateObject<FlowMonitorTestProbe>(m_monitor);
+    auto classifier = Create<Ipv4FlowClassifier>();
+    m_monitor->AddFlowClassifier(classifier);
+    m_monitor->StartRightNow();
+
+    Ipv4Header ipHeader;
+    ipHeader.SetSource(Ipv4Address("10.0.0.1"));
+    ipHeader.SetDestination(Ipv4Address("10.0.0.2"));
+    ipHeader.SetProtocol(17);
+    uint32_t flowId;
+    uint32_t packetId;
+    classifier->Classify(ipHeader, CreateUdpPayload(1000, 9), &flowId, &packetId);
+    NS_TEST_ASSERT_MSG_EQ(flowId, 1, "Unexpected FlowId");
+    m_monitor->ReportFirstTx(probe, flowId, packetId, 100);
+
+    Simulator::Schedule(Seconds(2), &FlowMonitor::ExportFlowStatsDeltas, m_monitor);
+    Simulator::Schedule(MilliSeconds(2100), &FlowMonitorEvictionTestCase::CheckNoFlow, this);
+    // the packet is considered lost after the maximum per-hop delay
+    Simulator::Schedule(Seconds(12),
+                        static_cast<void (FlowMonitor::*)()>(&FlowMonitor::CheckForLostPackets),
+                        m_monitor);
+    Simulator::Schedule(MilliSeconds(12100), &FlowMonitorEvictionTestCase::CheckNoFlow, this);
+
+    Simulator::Stop(Seconds(13));
+    Simulator::Run();
+
+    classifier->Classify(ipHeader, CreateUdpPayload(1000, 9), &flowId, &packetId);
+    NS_TEST_EXPECT_MSG_EQ(flowId, 2, "The evicted flow was not removed from the classifier");
+    NS_TEST_EXPECT_MSG_EQ(packetId, 0, "Unexpected packet identifier");
+    std::ostringstream oss;
+    classifier->SerializeToXmlStream(oss, 0);
+    NS_TEST_EXPECT_MSG_EQ((oss.str().find("flowId=\"1\"") == std::string::npos),
+                          true,
+                          "The evicted flow was serialized");
+    NS_TEST_EXPECT_MSG_EQ((oss.str().find("flowId=\"2\"") != std::string::npos),
+                          true,
+                          "The new flow was not serialized");
+
+    m_monitor->Dispose();
+    m_monitor = nullptr;
+    Simulator::Destroy();
+    std::remove(fileName.c_str());
+}
+
+/**
+ * @ingroup flow-monitor-test
+ *
+ * @brief Test the classification of IPv4 packets into flows.
+ *
+ * Enough flows are classified for the hash table of the classifier to be resized several
+ * times. We check that each five-tuple is assigned its own FlowId, that the packet
+ * identifiers are consecutive within each flow, that FindFlow and GetDscpCounts return
+ * the five-tuple and the DSCP values of the flows, and that a stateless classifier
+ * assigns the same FlowId to the packets of a flow and uses the packet UID as packet
+ * identifier.
+ */
+class Ipv4FlowClassifierTestCase : public TestCase
+{
+  public:
+    Ipv4FlowClassifierTestCase();
+
+  private:
+    void DoRun() override;
+};
+
+Ipv4FlowClassifierTestCase::Ipv4FlowClassifierTestCase()
+    : TestCase("Classification of IPv4 packets")
+{
+}
+
+void
+Ipv4FlowClassifierTestCase::DoRun()
+{
+    const uint16_t nFlows = 1000;
+    auto classifier = Create<Ipv4FlowClassifier>();
+    Ipv4Header ipHeader;
+    ipHeader.SetSource(Ipv4Address("10.0.0.1"));
+    ipHeader.SetDestination(Ipv4Address("10.0.0.2"));
+    ipHeader.SetProtocol(17);
+    uint32_t flowId;
+    uint32_t packetId;
+
+    for (FlowPacketId expectedPacketId = 0; expectedPacketId < 2; expectedPacketId++)
+    {
+        for (uint16_t i = 0; i < nFlows; i++)
+        {
+            auto classified =
+                classifier->Classify(ipHeader, CreateUdpPayload(1000 + i, 9), &flowId, &packetId);
+            NS_TEST_ASSERT_MSG_EQ(classified, true, "Packet of flow " << i << " not classified");
+            NS_TEST_EXPECT_MSG_EQ(flowId, i + 1U, "Unexpected FlowId");
+            NS_TEST_EXPECT_MSG_EQ(packetId, expectedPacketId, "Unexpected packet identifier");
+        }
+    }
+    for (uint16_t i = 0; i < nFlows; i++)
+    {
+        const auto tuple = classifier->FindFlow(i + 1);
+        NS_TEST_EXPECT_MSG_EQ(tuple.sourceAddress, Ipv4Address("10.0.0.1"), "Wrong source");
+        NS_TEST_EXPECT_MSG_EQ(tuple.destinationAddress, Ipv4Address("10.0.0.2"), "Wrong dest");
+        NS_TEST_EXPECT_MSG_EQ(+tuple.protocol, 17, "Unexpected protocol");
+        NS_TEST_EXPECT_MSG_EQ(tuple.sourcePort, 1000 + i, "Unexpected source port");
+        NS_TEST_EXPECT_MSG_EQ(tuple.destinationPort, 9, "Unexpected destination port");
+    }
+
+    ipHeader.SetDscp(Ipv4Header::DSCP_EF);
+    classifier->Classify(ipHeader, CreateUdpPayload(1000, 9), &flowId, &packetId);
+    NS_TEST_EXPECT_MSG_EQ(flowId, 1, "Unexpected FlowId");
+    NS_TEST_EXPECT_MSG_EQ(packetId, 2, "Unexpected packet identifier");
+    const auto dscpCounts = classifier->GetDscpCounts(1);
+    NS_TEST_ASSERT_MSG_EQ(dscpCounts.size(), 2, "Unexpected number of DSCP values");
+    NS_TEST_EXPECT_MSG_EQ(dscpCounts[0].first, Ipv4Header::DscpDefault, "Unexpected DSCP");
+    NS_TEST_EXPECT_MSG_EQ(dscpCounts[0].second, 2, "Unexpected DSCP count");
+    NS_TEST_EXPECT_MSG_EQ(dscpCounts[1].first, Ipv4Header::DSCP_EF, "Unexpected DSCP");
+    NS_TEST_EXPECT_MSG_EQ(dscpCounts[1].second, 1, "Unexpected DSCP count");
+
+    // only TCP and UDP packets are classified
+    ipHeader.SetProtocol(1);
+    NS_TEST_EXPECT_MSG_EQ(
+        classifier->Classify(ipHeader, CreateUdpPayload(1000, 9), &flowId, &packetId),
+        false,
+        "ICMP packet classified");
+
+    auto stateless = Create<Ipv4FlowClassifier>();
+    stateless->SetStateless(true);
+    ipHeader.SetProtocol(17);
+    uint32_t firstFlowId = 0;
+    for (uint32_t i = 0; i < 2; i++)
+    {
+        auto payload = CreateUdpPayload(1000, 9);
+        stateless->Classify(ipHeader, payload, &flowId, &packetId);
+        NS_TEST_EXPECT_MSG_NE(flowId, 0, "Invalid stateless FlowId");
+        NS_TEST_EXPECT_MSG_EQ(packetId, payload->GetUid(), "Unexpected stateless packet id");
+        if (i == 0)
+        {
+            firstFlowId = flowId;
+        }
+        NS_TEST_EXPECT_MSG_EQ(flowId, firstFlowId, "Stateless FlowId differs within a flow");
+    }
+}
+
+/**
+ * @ingroup flow-monitor-test
+ *
+ * @brief Test the classification of IPv6 packets into flows.
+ *
+ * Same checks as Ipv4FlowClassifierTestCase, for IPv6 packets.
+ */
+class Ipv6FlowClassifierTestCase : public TestCase
+{
+  public:
+    Ipv6FlowClassifierTestCase();
+
+  private:
+    void DoRun() override;
+};
+
+Ipv6FlowClassifierTestCase::Ipv6FlowClassifierTestCase()
+    : TestCase("Classification of IPv6 packets")
+{
+}
+
+void
+Ipv6FlowClassifierTestCase::DoRun()
+{
+    const uint16_t nFlows = 1000;
+    auto classifier = Create<Ipv6FlowClassifier>();
+    Ipv6Header ipHeader;
+    ipHeader.SetSource(Ipv6Address("2001:db8::1"));
+    ipHeader.SetDestination(Ipv6Address("2001:db8::2"));
+    ipHeader.SetNextHeader(17);
+    uint32_t flowId;
+    uint32_t packetId;
+
+    for (FlowPacketId expectedPacketId = 0; expectedPacketId < 2; expectedPacketId++)
+    {
+        for (uint16_t i = 0; i < nFlows; i++)
+        {
+            auto classified =
+                classifier->Classify(ipHeader, CreateUdpPayload(9, 1000 + i), &flowId, &packetId);
+            NS_TEST_ASSERT_MSG_EQ(classified, true, "Packet of flow " << i << " not classified");
+            NS_TEST_EXPECT_MSG_EQ(flowId, i + 1U, "Unexpected FlowId");
+            NS_TEST_EXPECT_MSG_EQ(packetId, expectedPacketId, "Unexpected packet identifier");
+        }
+    }
+    for (uint16_t i = 0; i < nFlows; i++)
+    {
+        const auto tuple = classifier->FindFlow(i + 1);
+        NS_TEST_EXPECT_MSG_EQ(tuple.sourceAddress, Ipv6Address("2001:db8::1"), "Wrong source");
+        NS_TEST_EXPECT_MSG_EQ(tuple.destinationAddress, Ipv6Address("2001:db8::2"), "Wrong dest");
+        NS_TEST_EXPECT_MSG_EQ(+tuple.protocol, 17, "Unexpected protocol");
+        NS_TEST_EXPECT_MSG_EQ(tuple.sourcePort, 9, "Unexpected source port");
+        NS_TEST_EXPECT_MSG_EQ(tuple.destinationPort, 1000 + i, "Unexpected destination port");
+    }
+
+    ipHeader.SetDscp(Ipv6Header::DSCP_AF11);
+    classifier->Classify(ipHeader, CreateUdpPayload(9, 1000), &flowId, &packetId);
+    NS_TEST_EXPECT_MSG_EQ(flowId, 1, "Unexpected FlowId");
+    NS_TEST_EXPECT_MSG_EQ(packetId, 2, "Unexpected packet identifier");
+    const auto dscpCounts = classifier->GetDscpCounts(1);
+    NS_TEST_ASSERT_MSG_EQ(dscpCounts.size(), 2, "Unexpected number of DSCP values");
+    NS_TEST_EXPECT_MSG_EQ(dscpCounts[0].first, Ipv6Header::DscpDefault, "Unexpected DSCP");
+    NS_TEST_EXPECT_MSG_EQ(dscpCounts[1].first, Ipv6Header::DSCP_AF11, "Unexpected DSCP");
+
+    // multicast packets are not classified
+    ipHeader.SetDestination(Ipv6Address("ff02::1"));
+    NS_TEST_EXPECT_MSG_EQ(
+        classifier->Classify(ipHeader, CreateUdpPayload(9, 1000), &flowId, &packetId),
+        false,
+        "Multicast packet classified");
+
+    auto stateless = Create<Ipv6FlowClassifier>();
+    stateless->SetStateless(true);
+    ipHeader.SetDestination(Ipv6Address("2001:db8::2"));
+    uint32_t firstFlowId = 0;
+    for (uint32_t i = 0; i < 2; i++)
+    {
+        auto payload = CreateUdpPayload(9, 1000);
+        stateless->Classify(ipHeader, payload, &flowId, &packetId);
+        NS_TEST_EXPECT_MSG_NE(flowId, 0, "Invalid stateless FlowId");
+        NS_TEST_EXPECT_MSG_EQ(packetId, payload->GetUid(), "Unexpected stateless packet id");
+        if (i == 0)
+        {
+            firstFlowId = flowId;
+        }
+        NS_TEST_EXPECT_MSG_EQ(flowId, firstFlowId, "Stateless FlowId differs within a flow");
+    }
+}
+
+/**
+ * @ingroup flow-monitor-test
+ *
+ * @brief Flow Monitor Test Suite
+ */
+class FlowMonitorTestSuite : public TestSuite
+{
+  public:
+    FlowMonitorTestSuite();
+};
+
+FlowMonitorTestSuite::FlowMonitorTestSuite()
+    : TestSuite("flow-monitor", Type::UNIT)
+{
+    AddTestCase(new FlowMonitorExportTestCase(FlowMonitor::EXPORT_CSV),
+                TestCase::Duration::QUICK);
+#ifdef HAVE_SQLITE3
+    AddTestCase(new FlowMonitorExportTestCase(FlowMonitor::EXPORT_SQLITE),
+                TestCase::Duration::QUICK);
+#endif
+    AddTestCase(new FlowHashTableTestCase(), TestCase::Duration::QUICK);
+    AddTestCase(new FlowMonitorLostPacketsTestCase(), TestCase::Duration::QUICK);
+    AddTestCase(new Ipv4FlowClassifierTestCase(), TestCase::Duration::QUICK);
+    AddTestCase(new Ipv6FlowClassifierTestCase(), TestCase::Duration::QUICK);
+    AddTestCase(new FlowMonitorEvictionTestCase(), TestCase::Duration::QUICK);
+}
+
+static FlowMonitorTestSuite g_flowMonitorTestSuite; //!< Static variable for test initialization
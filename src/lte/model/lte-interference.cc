@@ -172,9 +172,11 @@ LteInterference::ConditionallyEvaluateChunk()
         NS_LOG_LOGIC(this << " signal = " << *m_rxSignal << " allSignals = " << *m_allSignals
                           << " noise = " << *m_noise);
 
-        SpectrumValue interf = (*m_allSignals) - (*m_rxSignal) + (*m_noise);
+        SpectrumValue interf = *m_noise;
+        interf.AddDifference(*m_allSignals, *m_rxSignal);
 
-        SpectrumValue sinr = (*m_rxSignal) / interf;
+        SpectrumValue sinr;
+        sinr.AssignRatio(*m_rxSignal, interf);
         Time duration = Now() - m_lastChangeTime;
         for (auto it = m_sinrChunkProcessorList.begin(); it != m_sinrChunkProcessorList.end(); ++it)
         {
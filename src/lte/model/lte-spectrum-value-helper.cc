@@ -14,6 +14,7 @@
 
 #include <cmath>
 #include <map>
+#include <tuple>
 
 // just needed to log a std::vector<int> properly...
 namespace std
@@ -235,6 +236,65 @@ operator<(const LteSpectrumModelId& a, const LteSpectrumModelId& b)
 static std::map<LteSpectrumModelId, Ptr<SpectrumModel>>
     g_lteSpectrumModelMap; ///< LTE spectrum model map
 
+/// LteTxPsdId structure, identifying a transmit PSD
+struct LteTxPsdId
+{
+    bool uplink;                      ///< whether the PSD is an uplink PSD
+    uint32_t earfcn;                  ///< EARFCN
+    uint16_t bandwidth;               ///< bandwidth
+    double powerTx;                   ///< total transmit power (dBm)
+    std::map<int, double> powerTxMap; ///< transmit power per RB (dBm)
+    std::vector<int> activeRbs;       ///< active RBs
+};
+
+/**
+ * Less than operator
+ *
+ * @param a lhs
+ * @param b rhs
+ * @returns true if the parameters of a are less than the parameters of b
+ */
+bool
+operator<(const LteTxPsdId& a, const LteTxPsdId& b)
+{
+    return std::tie(a.uplink, a.earfcn, a.bandwidth, a.powerTx, a.powerTxMap, a.activeRbs) <
+           std::tie(b.uplink, b.earfcn, b.bandwidth, b.powerTx, b.powerTxMap, b.activeRbs);
+}
+
+static std::map<LteTxPsdId, Ptr<const SpectrumValue>>
+    g_lteTxPsdMap; ///< immutable transmit PSD templates
+
+/// Maximum number of transmit PSD templates (the templates are discarded once reached)
+static const std::size_t LTE_TX_PSD_MAP_MAX_SIZE = 1024;
+
+/**
+ * Get a copy of the transmit PSD with the given parameters. The PSD is created with
+ * the given function the first time and its template, whose span is trimmed to the
+ * active RBs, is then reused.
+ *
+ * @param key the parameters of the transmit PSD
+ * @param create the function creating the transmit PSD
+ * @returns a copy of the transmit PSD, which the caller may modify
+ */
+template <typename F>
+static Ptr<SpectrumValue>
+GetTxPsd(LteTxPsdId&& key, F create)
+{
+    auto it = g_lteTxPsdMap.find(key);
+    if (it == g_lteTxPsdMap.end())
+    {
+        if (g_lteTxPsdMap.size() >= LTE_TX_PSD_MAP_MAX_SIZE)
+        {
+            g_lteTxPsdMap.clear();
+        }
+        Ptr<SpectrumValue> txPsd = create();
+        txPsd->TrimSpan();
+        NS_LOG_LOGIC(*txPsd);
+        it = g_lteTxPsdMap.emplace(std::move(key), txPsd).first;
+    }
+    return it->second->Copy();
+}
+
 Ptr<SpectrumModel>
 LteSpectrumValueHelper::GetSpectrumModel(uint32_t earfcn, uint16_t txBandwidthConfiguration)
 {
@@ -278,23 +338,24 @@ LteSpectrumValueHelper::CreateTxPowerSpectralDensity(uint32_t earfcn,
 {
     NS_LOG_FUNCTION(earfcn << txBandwidthConfiguration << powerTx << activeRbs);
 
-    Ptr<SpectrumModel> model = GetSpectrumModel(earfcn, txBandwidthConfiguration);
-    Ptr<SpectrumValue> txPsd = Create<SpectrumValue>(model);
-
-    // powerTx is expressed in dBm. We must convert it into natural unit.
-    double powerTxW = std::pow(10., (powerTx - 30) / 10);
+    LteTxPsdId key{false, earfcn, txBandwidthConfiguration, powerTx, {}, activeRbs};
+    return GetTxPsd(std::move(key), [&]() {
+        Ptr<SpectrumModel> model = GetSpectrumModel(earfcn, txBandwidthConfiguration);
+        Ptr<SpectrumValue> txPsd = Create<SpectrumValue>(model);
 
-    double txPowerDensity = (powerTxW / (txBandwidthConfiguration * 180000));
+        // powerTx is expressed in dBm. We must convert it into natural unit.
+        double powerTxW = std::pow(10., (powerTx - 30) / 10);
 
-    for (auto it = activeRbs.begin(); it != activeRbs.end(); it++)
-    {
-        int rbId = (*it);
-        (*txPsd)[rbId] = txPowerDensity;
-    }
+        double txPowerDensity = (powerTxW / (txBandwidthConfiguration * 180000));
 
-    NS_LOG_LOGIC(*txPsd);
+        for (auto it = activeRbs.begin(); it != activeRbs.end(); it++)
+        {
+            int rbId = (*it);
+            (*txPsd)[rbId] = txPowerDensity;
+        }
 
-    return txPsd;
+        return txPsd;
+    });
 }
 
 Ptr<SpectrumValue>
@@ -306,36 +367,37 @@ LteSpectrumValueHelper::CreateTxPowerSpectralDensity(uint32_t earfcn,
 {
     NS_LOG_FUNCTION(earfcn << txBandwidthConfiguration << activeRbs);
 
-    Ptr<SpectrumModel> model = GetSpectrumModel(earfcn, txBandwidthConfiguration);
-    Ptr<SpectrumValue> txPsd = Create<SpectrumValue>(model);
+    LteTxPsdId key{false, earfcn, txBandwidthConfiguration, powerTx, powerTxMap, activeRbs};
+    return GetTxPsd(std::move(key), [&]() {
+        Ptr<SpectrumModel> model = GetSpectrumModel(earfcn, txBandwidthConfiguration);
+        Ptr<SpectrumValue> txPsd = Create<SpectrumValue>(model);
 
-    // powerTx is expressed in dBm. We must convert it into natural unit.
-    double basicPowerTxW = std::pow(10., (powerTx - 30) / 10);
+        // powerTx is expressed in dBm. We must convert it into natural unit.
+        double basicPowerTxW = std::pow(10., (powerTx - 30) / 10);
 
-    for (auto it = activeRbs.begin(); it != activeRbs.end(); it++)
-    {
-        int rbId = (*it);
+        for (auto it = activeRbs.begin(); it != activeRbs.end(); it++)
+        {
+            int rbId = (*it);
 
-        auto powerIt = powerTxMap.find(rbId);
+            auto powerIt = powerTxMap.find(rbId);
 
-        double txPowerDensity;
+            double txPowerDensity;
 
-        if (powerIt != powerTxMap.end())
-        {
-            double powerTxW = std::pow(10., (powerIt->second - 30) / 10);
-            txPowerDensity = (powerTxW / (txBandwidthConfiguration * 180000));
-        }
-        else
-        {
-            txPowerDensity = (basicPowerTxW / (txBandwidthConfiguration * 180000));
-        }
-
-        (*txPsd)[rbId] = txPowerDensity;
-    }
+            if (powerIt != powerTxMap.end())
+            {
+                double powerTxW = std::pow(10., (powerIt->second - 30) / 10);
+                txPowerDensity = (powerTxW / (txBandwidthConfiguration * 180000));
+            }
+            else
+            {
+                txPowerDensity = (basicPowerTxW / (txBandwidthConfiguration * 180000));
+            }
 
-    NS_LOG_LOGIC(*txPsd);
+            (*txPsd)[rbId] = txPowerDensity;
+        }
 
-    return txPsd;
+        return txPsd;
+    });
 }
 
 Ptr<SpectrumValue>
@@ -346,23 +408,24 @@ LteSpectrumValueHelper::CreateUlTxPowerSpectralDensity(uint16_t earfcn,
 {
     NS_LOG_FUNCTION(earfcn << txBandwidthConfiguration << powerTx << activeRbs);
 
-    Ptr<SpectrumModel> model = GetSpectrumModel(earfcn, txBandwidthConfiguration);
-    Ptr<SpectrumValue> txPsd = Create<SpectrumValue>(model);
+    LteTxPsdId key{true, earfcn, txBandwidthConfiguration, powerTx, {}, activeRbs};
+    return GetTxPsd(std::move(key), [&]() {
+        Ptr<SpectrumModel> model = GetSpectrumModel(earfcn, txBandwidthConfiguration);
+        Ptr<SpectrumValue> txPsd = Create<SpectrumValue>(model);
 
-    // powerTx is expressed in dBm. We must convert it into natural unit.
-    double powerTxW = std::pow(10., (powerTx - 30) / 10);
+        // powerTx is expressed in dBm. We must convert it into natural unit.
+        double powerTxW = std::pow(10., (powerTx - 30) / 10);
 
-    double txPowerDensity = (powerTxW / (activeRbs.size() * 180000));
+        double txPowerDensity = (powerTxW / (activeRbs.size() * 180000));
 
-    for (auto it = activeRbs.begin(); it != activeRbs.end(); it++)
-    {
-        int rbId = (*it);
-        (*txPsd)[rbId] = txPowerDensity;
-    }
-
-    NS_LOG_LOGIC(*txPsd);
+        for (auto it = activeRbs.begin(); it != activeRbs.end(); it++)
+        {
+            int rbId = (*it);
+            (*txPsd)[rbId] = txPowerDensity;
+        }
 
-    return txPsd;
+        return txPsd;
+    });
 }
 
 Ptr<SpectrumValue>
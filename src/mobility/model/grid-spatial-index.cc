@@ -0,0 +1,251 @@
+/*
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+#include "grid-spatial-index.h"
+
+#include "mobility-model.h"
+
+#include "ns3/abort.h"
+#include "ns3/double.h"
+#include "ns3/log.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace ns3
+{
+
+NS_LOG_COMPONENT_DEFINE("GridSpatialIndex");
+
+NS_OBJECT_ENSURE_REGISTERED(GridSpatialIndex);
+
+TypeId
+GridSpatialIndex::GetTypeId()
+{
+    static TypeId tid = TypeId("ns3::GridSpatialIndex")
+                            .SetParent<Object>()
+                            .SetGroupName("Mobility")
+                            .AddConstructor<GridSpatialIndex>()
+                            .AddAttribute("CellSize",
+                                          "The size (m) of the square cells of the grid. The "
+                                          "cells should be about the size of the queried ranges.",
+                                          DoubleValue(100.0),
+                                          MakeDoubleAccessor(&GridSpatialIndex::m_cellSize),
+                                          MakeDoubleChecker<double>(1e-3));
+    return tid;
+}
+
+GridSpatialIndex::GridSpatialIndex()
+{
+    NS_LOG_FUNCTION(this);
+}
+
+GridSpatialIndex::~GridSpatialIndex()
+{
+    NS_LOG_FUNCTION(this);
+}
+
+void
+GridSpatialIndex::DoDispose()
+{
+    NS_LOG_FUNCTION(this);
+    for (auto& [id, item] : m_items)
+    {
+        if (auto it = m_itemsByMobility.find(PeekPointer(item.mobility));
+            it != m_itemsByMobility.end())
+        {
+            item.mobility->TraceDisconnectWithoutContext(
+                "CourseChange",
+                MakeCallback(&GridSpatialIndex::NotifyCourseChange, this));
+            m_itemsByMobility.erase(it);
+        }
+    }
+    m_items.clear();
+    m_cells.clear();
+    m_moving.clear();
+    Object::DoDispose();
+}
+
+void
+GridSpatialIndex::Add(uint32_t id, Ptr<MobilityModel> mobility)
+{
+    NS_LOG_FUNCTION(this << id << mobility);
+    NS_ASSERT(mobility);
+    auto [it, inserted] = m_items.emplace(id, Item{mobility, Vector(), false, 0});
+    NS_ABORT_MSG_IF(!inserted, "Item " << id << " is already indexed");
+
+    auto& ids = m_itemsByMobility[PeekPointer(mobility)];
+    if (ids.empty())
+    {
+        mobility->TraceConnectWithoutContext(
+            "CourseChange",
+            MakeCallback(&GridSpatialIndex::NotifyCourseChange, this));
+    }
+    ids.push_back(id);
+    Place(id, it->second);
+}
+
+void
+GridSpatialIndex::Remove(uint32_t id)
+{
+    NS_LOG_FUNCTION(this << id);
+    auto it = m_items.find(id);
+    if (it == m_items.end())
+    {
+        return;
+    }
+    Unplace(id, it->second);
+
+    auto mobilityIt = m_itemsByMobility.find(PeekPointer(it->second.mobility));
+    NS_ASSERT(mobilityIt != m_itemsByMobility.end());
+    auto& ids = mobilityIt->second;
+    ids.erase(std::find(ids.begin(), ids.end(), id));
+    if (ids.empty())
+    {
+        it->second.mobility->TraceDisconnectWithoutContext(
+            "CourseChange",
+            MakeCallback(&GridSpatialIndex::NotifyCourseChange, this));
+        m_itemsByMobility.erase(mobilityIt);
+    }
+    m_items.erase(it);
+}
+
+bool
+GridSpatialIndex::Contains(uint32_t id) const
+{
+    return m_items.contains(id);
+}
+
+std::size_t
+GridSpatialIndex::GetN() const
+{
+    return m_items.size();
+}
+
+int32_t
+GridSpatialIndex::GetCellIndex(double coordinate) const
+{
+    const double index = std::floor(coordinate / m_cellSize);
+    return static_cast<int32_t>(std::clamp<double>(index,
+                                                   std::numeric_limits<int32_t>::min(),
+                                                   std::numeric_limits<int32_t>::max()));
+}
+
+GridSpatialIndex::CellKey
+GridSpatialIndex::GetCellKey(int32_t x, int32_t y)
+{
+    return (static_cast<uint64_t>(static_cast<uint32_t>(x)) << 32) | static_cast<uint32_t>(y);
+}
+
+void
+GridSpatialIndex::Place(uint32_t id, Item& item)
+{
+    const auto velocity = item.mobility->GetVelocity();
+    item.moving = (velocity.x != 0 || velocity.y != 0 || velocity.z != 0);
+    if (item.moving)
+    {
+        NS_LOG_LOGIC("Item " << id << " is moving");
+        m_moving.push_back(id);
+        return;
+    }
+    item.position = item.mobility->GetPosition();
+    item.cell = GetCellKey(GetCellIndex(item.position.x), GetCellIndex(item.position.y));
+    NS_LOG_LOGIC("Item " << id << " is at " << item.position);
+    m_cells[item.cell].push_back(id);
+}
+
+void
+GridSpatialIndex::Unplace(uint32_t id, const Item& item)
+{
+    if (item.moving)
+    {
+        m_moving.erase(std::find(m_moving.begin(), m_moving.end(), id));
+        return;
+    }
+    auto cellIt = m_cells.find(item.cell);
+    NS_ASSERT(cellIt != m_cells.end());
+    auto& ids = cellIt->second;
+    ids.erase(std::find(ids.begin(), ids.end(), id));
+    if (ids.empty())
+    {
+        m_cells.erase(cellIt);
+    }
+}
+
+void
+GridSpatialIndex::NotifyCourseChange(Ptr<const MobilityModel> mobility)
+{
+    NS_LOG_FUNCTION(this << mobility);
+    auto mobilityIt = m_itemsByMobility.find(PeekPointer(mobility));
+    if (mobilityIt == m_itemsByMobility.end())
+    {
+        return;
+    }
+    for (auto id : mobilityIt->second)
+    {
+        auto& item = m_items.at(id);
+        Unplace(id, item);
+        Place(id, item);
+    }
+}
+
+std::vector<uint32_t>
+GridSpatialIndex::GetItemsWithinRange(const Vector& position, double range) const
+{
+    NS_LOG_FUNCTION(this << position << range);
+    std::vector<uint32_t> ids;
+
+    auto addIfWithinRange = [&](uint32_t id, const Vector& itemPosition) {
+        if (CalculateDistance(position, itemPosition) <= range)
+        {
+            ids.push_back(id);
+        }
+    };
+    auto addCell = [&](const std::vector<uint32_t>& cell) {
+        for (auto id : cell)
+        {
+            addIfWithinRange(id, m_items.at(id).position);
+        }
+    };
+
+    const auto xMin = GetCellIndex(position.x - range);
+    const auto xMax = GetCellIndex(position.x + range);
+    const auto yMin = GetCellIndex(position.y - range);
+    const auto yMax = GetCellIndex(position.y + range);
+    const double nCells =
+        (static_cast<double>(xMax) - xMin + 1) * (static_cast<double>(yMax) - yMin + 1);
+
+    if (nCells > m_cells.size())
+    {
+        // the range covers more cells than there are non-empty cells
+        for (const auto& [key, cell] : m_cells)
+        {
+            addCell(cell);
+        }
+    }
+    else
+    {
+        for (auto x = static_cast<int64_t>(xMin); x <= xMax; x++)
+        {
+            for (auto y = static_cast<int64_t>(yMin); y <= yMax; y++)
+            {
+                if (auto it = m_cells.find(GetCellKey(x, y)); it != m_cells.end())
+                {
+                    addCell(it->second);
+                }
+            }
+        }
+    }
+
+    for (auto id : m_moving)
+    {
+        addIfWithinRange(id, m_items.at(id).mobility->GetPosition());
+    }
+
+    std::sort(ids.begin(), ids.end());
+    return ids;
+}
+
+} // namespace ns3
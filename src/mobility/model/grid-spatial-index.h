@@ -0,0 +1,147 @@
+/*
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+#ifndef GRID_SPATIAL_INDEX_H
+#define GRID_SPATIAL_INDEX_H
+
+#include "ns3/object.h"
+#include "ns3/ptr.h"
+#include "ns3/vector.h"
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+namespace ns3
+{
+
+class MobilityModel;
+
+/**
+ * @ingroup mobility
+ * @brief Uniform grid index of the positions of a set of mobility models.
+ *
+ * Each indexed item is identified by a caller-defined integer identifier
+ * and is associated with a MobilityModel (several items may share the same
+ * MobilityModel). Items are bucketed into square cells of the horizontal
+ * (x, y) plane, and the index follows their movements through the
+ * CourseChange trace source of their MobilityModel, so that the items
+ * located within a given distance of a point can be found without scanning
+ * all the items.
+ *
+ * An item whose velocity is not null when its course last changed cannot
+ * be kept in a cell; it is stored in a list of moving items, whose
+ * positions are read from their MobilityModel on each query.
+ */
+class GridSpatialIndex : public Object
+{
+  public:
+    /**
+     * @brief Get the type ID.
+     * @return the object TypeId
+     */
+    static TypeId GetTypeId();
+
+    GridSpatialIndex();
+    ~GridSpatialIndex() override;
+
+    /**
+     * Add an item to the index.
+     *
+     * @param id the identifier of the item, which must not be already indexed
+     * @param mobility the mobility model of the item
+     */
+    void Add(uint32_t id, Ptr<MobilityModel> mobility);
+
+    /**
+     * Remove an item from the index, if present.
+     *
+     * @param id the identifier of the item
+     */
+    void Remove(uint32_t id);
+
+    /**
+     * @param id the identifier of an item
+     * @return true if the item is indexed
+     */
+    bool Contains(uint32_t id) const;
+
+    /**
+     * @return the number of indexed items
+     */
+    std::size_t GetN() const;
+
+    /**
+     * Get the items located within the given distance of the given position.
+     *
+     * @param position the position
+     * @param range the maximum distance (m)
+     * @return the identifiers of the items, sorted in increasing order
+     */
+    std::vector<uint32_t> GetItemsWithinRange(const Vector& position, double range) const;
+
+  protected:
+    void DoDispose() override;
+
+  private:
+    /// Key of a grid cell, made of the cell coordinates along x and y
+    using CellKey = uint64_t;
+
+    /// An indexed item
+    struct Item
+    {
+        Ptr<MobilityModel> mobility; //!< the mobility model of the item
+        Vector position;             //!< the position of the item, if not moving
+        bool moving;                 //!< whether the item is in the list of moving items
+        CellKey cell;                //!< the cell of the item, if not moving
+    };
+
+    /**
+     * @param coordinate a coordinate (m)
+     * @return the index of the cell containing the coordinate along one axis
+     */
+    int32_t GetCellIndex(double coordinate) const;
+
+    /**
+     * @param x the index of the cell along x
+     * @param y the index of the cell along y
+     * @return the key of the cell
+     */
+    static CellKey GetCellKey(int32_t x, int32_t y);
+
+    /**
+     * Store an item in its cell, or in the list of moving items, according
+     * to the current state of its mobility model.
+     *
+     * @param id the identifier of the item
+     * @param item the item
+     */
+    void Place(uint32_t id, Item& item);
+
+    /**
+     * Remove an item from its cell or from the list of moving items.
+     *
+     * @param id the identifier of the item
+     * @param item the item
+     */
+    void Unplace(uint32_t id, const Item& item);
+
+    /**
+     * Callback connected to the CourseChange trace source of the indexed
+     * mobility models.
+     *
+     * @param mobility the mobility model whose course changed
+     */
+    void NotifyCourseChange(Ptr<const MobilityModel> mobility);
+
+    double m_cellSize;                                           //!< the size of the cells (m)
+    std::unordered_map<uint32_t, Item> m_items;                  //!< the items, by identifier
+    std::unordered_map<CellKey, std::vector<uint32_t>> m_cells;  //!< the static items, by cell
+    std::vector<uint32_t> m_moving;                              //!< the moving items
+    std::unordered_map<const MobilityModel*, std::vector<uint32_t>>
+        m_itemsByMobility; //!< the items associated with each mobility model
+};
+
+} // namespace ns3
+
+#endif /* GRID_SPATIAL_INDEX_H */
@@ -0,0 +1,156 @@
+/*
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+#include "ns3/constant-position-mobility-model.h"
+#include "ns3/constant-velocity-mobility-model.h"
+#include "ns3/double.h"
+#include "ns3/grid-spatial-index.h"
+#include "ns3/simulator.h"
+#include "ns3/test.h"
+
+#include <vector>
+
+using namespace ns3;
+
+/**
+ * @ingroup mobility-test
+ *
+ * @brief Grid Spatial Index Test
+ *
+ * Check that the items found within range by the grid index are the same as
+ * those found by a linear scan, for static items, for items whose position
+ * is changed, and for moving items.
+ */
+class GridSpatialIndexTestCase : public TestCase
+{
+  public:
+    GridSpatialIndexTestCase();
+
+  private:
+    void DoRun() override;
+
+    /**
+     * Check the items found within range of the given position.
+     * @param position the position
+     * @param range the range (m)
+     */
+    void CheckRange(Vector position, double range);
+
+    Ptr<GridSpatialIndex> m_index;                 ///< the index under test
+    std::vector<Ptr<MobilityModel>> m_mobilities;  ///< the mobility model of each item
+    std::vector<bool> m_indexed;                   ///< whether each item is indexed
+};
+
+GridSpatialIndexTestCase::GridSpatialIndexTestCase()
+    : TestCase("Check that the grid spatial index finds the items within range")
+{
+}
+
+void
+GridSpatialIndexTestCase::CheckRange(Vector position, double range)
+{
+    std::vector<uint32_t> expected;
+    for (uint32_t id = 0; id < m_mobilities.size(); id++)
+    {
+        if (m_indexed[id] && CalculateDistance(position, m_mobilities[id]->GetPosition()) <= range)
+        {
+            expected.push_back(id);
+        }
+    }
+    auto found = m_index->GetItemsWithinRange(position, range);
+    NS_TEST_ASSERT_MSG_EQ(found.size(),
+                          expected.size(),
+                          "Unexpected number of items within " << range << " m of " << position
+                                                               << " at " << Simulator::Now());
+    for (std::size_t i = 0; i < found.size(); i++)
+    {
+        NS_TEST_EXPECT_MSG_EQ(found[i], expected[i], "Unexpected item within range");
+    }
+}
+
+void
+GridSpatialIndexTestCase::DoRun()
+{
+    m_index = CreateObjectWithAttributes<GridSpatialIndex>("CellSize", DoubleValue(10));
+
+    // static items on a 200 m x 200 m square, including negative coordinates
+    for (int32_t x = -100; x < 100; x += 7)
+    {
+        for (int32_t y = -100; y < 100; y += 9)
+        {
+            auto mobility = CreateObject<ConstantPositionMobilityModel>();
+            mobility->SetPosition(Vector(x, y, (x + y) % 3));
+            m_index->Add(m_mobilities.size(), mobility);
+            m_mobilities.push_back(mobility);
+            m_indexed.push_back(true);
+        }
+    }
+    // two items sharing the same moving mobility model
+    auto moving = CreateObject<ConstantVelocityMobilityModel>();
+    moving->SetPosition(Vector(-50, 0, 0));
+    for (uint32_t i = 0; i < 2; i++)
+    {
+        m_index->Add(m_mobilities.size(), moving);
+        m_mobilities.push_back(moving);
+        m_indexed.push_back(true);
+    }
+    NS_TEST_EXPECT_MSG_EQ(m_index->GetN(), m_mobilities.size(), "Unexpected number of items");
+
+    for (double range : {0.0, 5.0, 10.0, 33.0, 1000.0})
+    {
+        CheckRange(Vector(0, 0, 0), range);
+        CheckRange(Vector(-45.5, 17.2, 1), range);
+    }
+
+    // move a static item and remove another one
+    m_mobilities[3]->SetPosition(Vector(1, 1, 0));
+    m_index->Remove(4);
+    m_indexed[4] = false;
+    NS_TEST_EXPECT_MSG_EQ(m_index->Contains(4), false, "Item 4 was not removed");
+    CheckRange(Vector(0, 0, 0), 5);
+    CheckRange(m_mobilities[4]->GetPosition(), 5);
+
+    // the moving items are followed without course changes
+    moving->SetVelocity(Vector(10, 0, 0));
+    for (auto t : {1.0, 2.5, 7.0, 10.0})
+    {
+        Simulator::Schedule(Seconds(t),
+                            &GridSpatialIndexTestCase::CheckRange,
+                            this,
+                            Vector(0, 0, 0),
+                            20.0);
+    }
+    // the moving items stop and are stored in a cell again
+    Simulator::Schedule(Seconds(11), &ConstantVelocityMobilityModel::SetVelocity, moving, Vector());
+    Simulator::Schedule(Seconds(12),
+                        &GridSpatialIndexTestCase::CheckRange,
+                        this,
+                        Vector(60, 0, 0),
+                        3.0);
+    Simulator::Run();
+    Simulator::Destroy();
+
+    m_index->Dispose();
+    m_index = nullptr;
+    m_mobilities.clear();
+}
+
+/**
+ * @ingroup mobility-test
+ *
+ * @brief Grid Spatial Index Test Suite
+ */
+class GridSpatialIndexTestSuite : public TestSuite
+{
+  public:
+    GridSpatialIndexTestSuite();
+};
+
+GridSpatialIndexTestSuite::GridSpatialIndexTestSuite()
+    : TestSuite("grid-spatial-index", Type::UNIT)
+{
+    AddTestCase(new GridSpatialIndexTestCase, TestCase::Duration::QUICK);
+}
+
+static GridSpatialIndexTestSuite g_gridSpatialIndexTestSuite; ///< the test suite
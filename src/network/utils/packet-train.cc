@@ -0,0 +1,118 @@
+/*
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+#include "packet-train.h"
+
+#include "ns3/assert.h"
+#include "ns3/log.h"
+#include "ns3/packet.h"
+
+namespace ns3
+{
+
+NS_LOG_COMPONENT_DEFINE("PacketTrain");
+
+NS_OBJECT_ENSURE_REGISTERED(PacketTrain);
+
+TypeId
+PacketTrain::GetTypeId()
+{
+    static TypeId tid = TypeId("ns3::PacketTrain")
+                            .SetParent<Object>()
+                            .SetGroupName("Network")
+                            .AddConstructor<PacketTrain>();
+    return tid;
+}
+
+PacketTrain::PacketTrain()
+{
+    NS_LOG_FUNCTION(this);
+}
+
+PacketTrain::~PacketTrain()
+{
+    NS_LOG_FUNCTION(this);
+}
+
+void
+PacketTrain::DoDispose()
+{
+    NS_LOG_FUNCTION(this);
+    m_items.clear();
+}
+
+Ptr<PacketTrain>
+PacketTrain::Copy() const
+{
+    NS_LOG_FUNCTION(this);
+    Ptr<PacketTrain> train = CreateObject<PacketTrain>();
+    train->m_items.reserve(m_items.size());
+    for (const auto& item : m_items)
+    {
+        train->m_items.push_back({item.packet->Copy(), item.txStart, item.txTime});
+    }
+    return train;
+}
+
+void
+PacketTrain::AddPacket(Ptr<Packet> packet, Time txStart, Time txTime)
+{
+    NS_LOG_FUNCTION(this << packet << txStart << txTime);
+    NS_ASSERT_MSG(m_items.empty() || txStart >= GetDuration(),
+                  "Packets of a train cannot overlap");
+    m_items.push_back({packet, txStart, txTime});
+}
+
+uint32_t
+PacketTrain::GetNPackets() const
+{
+    return m_items.size();
+}
+
+Ptr<Packet>
+PacketTrain::GetPacket(uint32_t i) const
+{
+    NS_ASSERT(i < m_items.size());
+    return m_items[i].packet;
+}
+
+Time
+PacketTrain::GetTxStart(uint32_t i) const
+{
+    NS_ASSERT(i < m_items.size());
+    return m_items[i].txStart;
+}
+
+Time
+PacketTrain::GetTxTime(uint32_t i) const
+{
+    NS_ASSERT(i < m_items.size());
+    return m_items[i].txTime;
+}
+
+Time
+PacketTrain::GetLastBitTime(uint32_t i) const
+{
+    NS_ASSERT(i < m_items.size());
+    return m_items[i].txStart + m_items[i].txTime;
+}
+
+Time
+PacketTrain::GetDuration() const
+{
+    return m_items.empty() ? Time() : GetLastBitTime(m_items.size() - 1);
+}
+
+uint32_t
+PacketTrain::GetSize() const
+{
+    uint32_t size = 0;
+    for (const auto& item : m_items)
+    {
+        size += item.packet->GetSize();
+    }
+    return size;
+}
+
+} // namespace ns3
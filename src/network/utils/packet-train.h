@@ -0,0 +1,121 @@
+/*
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+#ifndef PACKET_TRAIN_H
+#define PACKET_TRAIN_H
+
+#include "ns3/nstime.h"
+#include "ns3/object.h"
+
+#include <stdint.h>
+#include <vector>
+
+namespace ns3
+{
+
+class Packet;
+
+/**
+ * @ingroup network
+ * @brief A train of packets sent back to back by a device
+ *
+ * A packet train allows a device to hand a burst of packets to a channel
+ * at once (and hence with a single event) while preserving the timing of
+ * each packet.  Along with each packet, the train stores the time at which
+ * the transmission of the packet starts and its duration, both relative to
+ * the start of the train.  Channels and receiving devices use these
+ * timestamps to deliver each packet at the time it would have been
+ * delivered had it been transmitted on its own.
+ */
+class PacketTrain : public Object
+{
+  public:
+    /**
+     * @brief Get the type ID.
+     * @return the object TypeId
+     */
+    static TypeId GetTypeId();
+    PacketTrain();
+    ~PacketTrain() override;
+
+    /**
+     * @return a copy of the packet train (packets are copied as well)
+     */
+    Ptr<PacketTrain> Copy() const;
+
+    /**
+     * @brief Append a packet to the train
+     * @param packet the packet to add
+     * @param txStart the time at which the transmission of the packet starts, relative to the
+     *                start of the train (must not precede the end of the previous packet)
+     * @param txTime the transmission time of the packet
+     */
+    void AddPacket(Ptr<Packet> packet, Time txStart, Time txTime);
+
+    /**
+     * @return the number of packets in the train
+     */
+    uint32_t GetNPackets() const;
+
+    /**
+     * @param i the index of the packet
+     * @return the i-th packet of the train
+     */
+    Ptr<Packet> GetPacket(uint32_t i) const;
+
+    /**
+     * @param i the index of the packet
+     * @return the time at which the transmission of the i-th packet starts,
+     *         relative to the start of the train
+     */
+    Time GetTxStart(uint32_t i) const;
+
+    /**
+     * @param i the index of the packet
+     * @return the transmission time of the i-th packet
+     */
+    Time GetTxTime(uint32_t i) const;
+
+    /**
+     * @param i the index of the packet
+     * @return the time at which the last bit of the i-th packet is transmitted,
+     *         relative to the start of the train
+     */
+    Time GetLastBitTime(uint32_t i) const;
+
+    /**
+     * @return the time at which the last bit of the last packet is transmitted,
+     *         relative to the start of the train
+     */
+    Time GetDuration() const;
+
+    /**
+     * @return the size of the train in bytes (the size of all packets)
+     */
+    uint32_t GetSize() const;
+
+    /**
+     * TracedCallback signature for Ptr<PacketTrain>
+     *
+     * @param [in] train The PacketTrain
+     */
+    typedef void (*TracedCallback)(Ptr<const PacketTrain> train);
+
+  private:
+    void DoDispose() override;
+
+    /// A packet of the train along with its timestamps
+    struct Item
+    {
+        Ptr<Packet> packet; //!< the packet
+        Time txStart;       //!< start of the transmission, relative to the start of the train
+        Time txTime;        //!< transmission time
+    };
+
+    std::vector<Item> m_items; //!< the packets of the train
+};
+
+} // namespace ns3
+
+#endif /* PACKET_TRAIN_H */
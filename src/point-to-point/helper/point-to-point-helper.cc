@@ -15,6 +15,7 @@
 #include "ns3/point-to-point-channel.h"
 #include "ns3/point-to-point-net-device.h"
 #include "ns3/simulator.h"
+#include "ns3/uinteger.h"
 
 #ifdef NS3_MPI
 #include "ns3/mpi-interface.h"
@@ -37,6 +38,7 @@ PointToPointHelper::PointToPointHelper()
     m_deviceFactory.SetTypeId("ns3::PointToPointNetDevice");
     m_channelFactory.SetTypeId("ns3::PointToPointChannel");
     m_enableFlowControl = true;
+    m_nTxQueues = 1;
 }
 
 void
@@ -57,6 +59,13 @@ PointToPointHelper::DisableFlowControl()
     m_enableFlowControl = false;
 }
 
+void
+PointToPointHelper::SetNTxQueues(std::size_t nTxQueues)
+{
+    NS_ABORT_MSG_IF(nTxQueues == 0 || nTxQueues > 256, "Invalid number of transmit queues");
+    m_nTxQueues = nTxQueues;
+}
+
 void
 PointToPointHelper::EnablePcapInternal(std::string prefix,
                                        Ptr<NetDevice> nd,
@@ -231,22 +240,33 @@ PointToPointHelper::Install(Ptr<Node> a, Ptr<Node> b)
     Ptr<PointToPointNetDevice> devA = m_deviceFactory.Create<PointToPointNetDevice>();
     devA->SetAddress(Mac48Address::Allocate());
     a->AddDevice(devA);
-    Ptr<Queue<Packet>> queueA = m_queueFactory.Create<Queue<Packet>>();
-    devA->SetQueue(queueA);
     Ptr<PointToPointNetDevice> devB = m_deviceFactory.Create<PointToPointNetDevice>();
     devB->SetAddress(Mac48Address::Allocate());
     b->AddDevice(devB);
-    Ptr<Queue<Packet>> queueB = m_queueFactory.Create<Queue<Packet>>();
-    devB->SetQueue(queueB);
-    if (m_enableFlowControl)
+
+    for (auto dev : {devA, devB})
     {
-        // Aggregate NetDeviceQueueInterface objects
-        Ptr<NetDeviceQueueInterface> ndqiA = CreateObject<NetDeviceQueueInterface>();
-        ndqiA->GetTxQueue(0)->ConnectQueueTraces(queueA);
-        devA->AggregateObject(ndqiA);
-        Ptr<NetDeviceQueueInterface> ndqiB = CreateObject<NetDeviceQueueInterface>();
-        ndqiB->GetTxQueue(0)->ConnectQueueTraces(queueB);
-        devB->AggregateObject(ndqiB);
+        for (std::size_t i = 0; i < m_nTxQueues; i++)
+        {
+            dev->SetTxQueue(i, m_queueFactory.Create<Queue<Packet>>());
+        }
+        if (m_enableFlowControl)
+        {
+            // Aggregate a NetDeviceQueueInterface object
+            Ptr<NetDeviceQueueInterface> ndqi =
+                CreateObjectWithAttributes<NetDeviceQueueInterface>("NTxQueues",
+                                                                    UintegerValue(m_nTxQueues));
+            for (std::size_t i = 0; i < m_nTxQueues; i++)
+            {
+                ndqi->GetTxQueue(i)->ConnectQueueTraces(dev->GetTxQueue(i));
+            }
+            if (m_nTxQueues > 1)
+            {
+                ndqi->SetSelectQueueCallback(
+                    MakeBoundCallback(&PointToPointNetDevice::SelectQueueByPriority, m_nTxQueues));
+            }
+            dev->AggregateObject(ndqi);
+        }
     }
 
     Ptr<PointToPointChannel> channel = nullptr;
@@ -91,6 +91,20 @@ class PointToPointHelper : public PcapHelperForDevice, public AsciiTraceHelperFo
      */
     void DisableFlowControl();
 
+    /**
+     * Set the number of transmit queues of each PointToPointNetDevice created
+     * through PointToPointHelper::Install.  Each transmit queue is created by
+     * the queue factory (see SetQueue) and, if flow control is enabled, is
+     * associated with a netdevice queue of the aggregated
+     * NetDeviceQueueInterface, so that a multi-queue queue disc (such as
+     * MqQueueDisc) can be installed on the device.  Packets are mapped to
+     * transmit queues based on their priority
+     * (see PointToPointNetDevice::SelectQueueByPriority).
+     *
+     * @param nTxQueues the number of transmit queues (one by default)
+     */
+    void SetNTxQueues(std::size_t nTxQueues);
+
     /**
      * @param c a set of nodes
      * @return a NetDeviceContainer for nodes
@@ -179,6 +193,7 @@ class PointToPointHelper : public PcapHelperForDevice, public AsciiTraceHelperFo
     ObjectFactory m_channelFactory; //!< Channel Factory
     ObjectFactory m_deviceFactory;  //!< Device Factory
     bool m_enableFlowControl;       //!< whether to enable flow control
+    std::size_t m_nTxQueues;        //!< number of transmit queues of each device
 };
 
 /***************************************************************
@@ -9,6 +9,7 @@
 #include "point-to-point-net-device.h"
 
 #include "ns3/log.h"
+#include "ns3/packet-train.h"
 #include "ns3/packet.h"
 #include "ns3/simulator.h"
 #include "ns3/trace-source-accessor.h"
@@ -96,6 +97,38 @@ PointToPointChannel::TransmitStart(Ptr<const Packet> p, Ptr<PointToPointNetDevic
     return true;
 }
 
+bool
+PointToPointChannel::TransmitTrain(Ptr<const PacketTrain> train, Ptr<PointToPointNetDevice> src)
+{
+    NS_LOG_FUNCTION(this << train << src);
+    NS_LOG_LOGIC("Train of " << train->GetNPackets() << " packets");
+
+    NS_ASSERT(m_link[0].m_state != INITIALIZING);
+    NS_ASSERT(m_link[1].m_state != INITIALIZING);
+    NS_ASSERT(train->GetNPackets() > 0);
+
+    uint32_t wire = src == m_link[0].m_src ? 0 : 1;
+
+    Simulator::ScheduleWithContext(m_link[wire].m_dst->GetNode()->GetId(),
+                                   train->GetLastBitTime(0) + m_delay,
+                                   &PointToPointNetDevice::ReceiveTrain,
+                                   m_link[wire].m_dst,
+                                   train->Copy(),
+                                   0);
+
+    // Call the tx anim callback on the net device for every packet of the train
+    for (uint32_t i = 0; i < train->GetNPackets(); i++)
+    {
+        Time lastBitTime = train->GetLastBitTime(i);
+        m_txrxPointToPoint(train->GetPacket(i),
+                           src,
+                           m_link[wire].m_dst,
+                           lastBitTime,
+                           lastBitTime + m_delay);
+    }
+    return true;
+}
+
 std::size_t
 PointToPointChannel::GetNDevices() const
 {
@@ -20,6 +20,7 @@ namespace ns3
 
 class PointToPointNetDevice;
 class Packet;
+class PacketTrain;
 
 /**
  * @ingroup point-to-point
@@ -70,6 +71,20 @@ class PointToPointChannel : public Channel
      */
     virtual bool TransmitStart(Ptr<const Packet> p, Ptr<PointToPointNetDevice> src, Time txTime);
 
+    /**
+     * @brief Transmit a train of packets over this channel
+     *
+     * The train is delivered to the destination device with a single event
+     * scheduled when the last bit of its first packet arrives; each packet is
+     * then received at the time its last bit arrives.
+     *
+     * @param train the train of packets to transmit; the transmission of the
+     *              train starts now
+     * @param src Source PointToPointNetDevice
+     * @returns true if successful (currently always true)
+     */
+    virtual bool TransmitTrain(Ptr<const PacketTrain> train, Ptr<PointToPointNetDevice> src);
+
     /**
      * @brief Get number of devices on this channel
      * @returns number of devices on this channel
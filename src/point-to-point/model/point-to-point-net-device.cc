@@ -9,13 +9,17 @@
 #include "point-to-point-channel.h"
 #include "ppp-header.h"
 
+#include "ns3/abort.h"
 #include "ns3/error-model.h"
 #include "ns3/llc-snap-header.h"
 #include "ns3/log.h"
 #include "ns3/mac48-address.h"
+#include "ns3/packet-train.h"
 #include "ns3/pointer.h"
+#include "ns3/queue-item.h"
 #include "ns3/queue.h"
 #include "ns3/simulator.h"
+#include "ns3/socket.h"
 #include "ns3/trace-source-accessor.h"
 #include "ns3/uinteger.h"
 
@@ -68,8 +72,25 @@ PointToPointNetDevice::GetTypeId()
             .AddAttribute("TxQueue",
                           "A queue to use as the transmit queue in the device.",
                           PointerValue(),
-                          MakePointerAccessor(&PointToPointNetDevice::m_queue),
+                          MakePointerAccessor(&PointToPointNetDevice::SetQueue,
+                                              &PointToPointNetDevice::GetQueue),
                           MakePointerChecker<Queue<Packet>>())
+            .AddAttribute("TxBatchSize",
+                          "The maximum number of queued packets that are handed to the "
+                          "channel back to back by a single transmission. When greater "
+                          "than one and the device is saturated, the packets waiting in "
+                          "the transmit queues are pulled at once (as a NIC does with its "
+                          "TX ring) and a single transmission complete event is scheduled "
+                          "for all of them, while each packet is still received at the "
+                          "time it would be received if sent individually. Since the packets "
+                          "are dequeued when the batch starts, the Dequeue trace of the "
+                          "transmit queues and the Sniffer, PromiscSniffer and PhyTxBegin "
+                          "traces fire for all of them at the start of the batch, and the "
+                          "PhyTxEnd trace fires for all of them at its end. Hence, batching "
+                          "is disabled (i.e., set to one) by default.",
+                          UintegerValue(1),
+                          MakeUintegerAccessor(&PointToPointNetDevice::m_txBatchSize),
+                          MakeUintegerChecker<uint32_t>(1))
 
             //
             // Trace sources at the "top" of the net device, where packets transition
@@ -166,6 +187,8 @@ PointToPointNetDevice::GetTypeId()
 PointToPointNetDevice::PointToPointNetDevice()
     : m_txMachineState(READY),
       m_channel(nullptr),
+      m_nextTxQueue(0),
+      m_txBatchSize(1),
       m_linkUp(false),
       m_currentPkt(nullptr)
 {
@@ -204,7 +227,8 @@ PointToPointNetDevice::DoDispose()
     m_channel = nullptr;
     m_receiveErrorModel = nullptr;
     m_currentPkt = nullptr;
-    m_queue = nullptr;
+    m_batchedPkts.clear();
+    m_queues.clear();
     NetDevice::DoDispose();
 }
 
@@ -241,9 +265,51 @@ PointToPointNetDevice::TransmitStart(Ptr<Packet> p)
     Time txTime = m_bps.CalculateBytesTxTime(p->GetSize());
     Time txCompleteTime = txTime + m_tInterframeGap;
 
+    //
+    // If more packets are waiting, pull up to TxBatchSize - 1 of them as well
+    // and send them back to back after the current one, as a packet train.
+    // The channel delivers each packet of the train at the time it would be
+    // delivered if sent on its own, but the whole train only takes a single
+    // transmission complete event and a single channel event.
+    //
+    Ptr<PacketTrain> train;
+    while (m_batchedPkts.size() + 1 < m_txBatchSize)
+    {
+        Ptr<Packet> next = DequeueNext();
+        if (!next)
+        {
+            break;
+        }
+        if (!train)
+        {
+            train = CreateObject<PacketTrain>();
+            train->AddPacket(p, Time(), txTime);
+        }
+        m_snifferTrace(next);
+        m_promiscSnifferTrace(next);
+        m_phyTxBeginTrace(next);
+        Time nextTxTime = m_bps.CalculateBytesTxTime(next->GetSize());
+        train->AddPacket(next, txCompleteTime, nextTxTime);
+        txCompleteTime += nextTxTime + m_tInterframeGap;
+        m_batchedPkts.push_back(next);
+    }
+
     NS_LOG_LOGIC("Schedule TransmitCompleteEvent in " << txCompleteTime.As(Time::S));
     Simulator::Schedule(txCompleteTime, &PointToPointNetDevice::TransmitComplete, this);
 
+    if (train)
+    {
+        bool result = m_channel->TransmitTrain(train, this);
+        if (!result)
+        {
+            for (uint32_t i = 0; i < train->GetNPackets(); i++)
+            {
+                m_phyTxDropTrace(train->GetPacket(i));
+            }
+        }
+        return result;
+    }
+
     bool result = m_channel->TransmitStart(p, this, txTime);
     if (!result)
     {
@@ -270,8 +336,13 @@ PointToPointNetDevice::TransmitComplete()
 
     m_phyTxEndTrace(m_currentPkt);
     m_currentPkt = nullptr;
+    for (const auto& batchedPkt : m_batchedPkts)
+    {
+        m_phyTxEndTrace(batchedPkt);
+    }
+    m_batchedPkts.clear();
 
-    Ptr<Packet> p = m_queue->Dequeue();
+    Ptr<Packet> p = DequeueNext();
     if (!p)
     {
         NS_LOG_LOGIC("No pending packets in device queue after tx complete");
@@ -286,6 +357,23 @@ PointToPointNetDevice::TransmitComplete()
     TransmitStart(p);
 }
 
+Ptr<Packet>
+PointToPointNetDevice::DequeueNext()
+{
+    NS_LOG_FUNCTION(this);
+
+    for (std::size_t i = 0; i < m_queues.size(); i++)
+    {
+        std::size_t index = (m_nextTxQueue + i) % m_queues.size();
+        if (!m_queues[index]->IsEmpty())
+        {
+            m_nextTxQueue = (index + 1) % m_queues.size();
+            return m_queues[index]->Dequeue();
+        }
+    }
+    return nullptr;
+}
+
 bool
 PointToPointNetDevice::Attach(Ptr<PointToPointChannel> ch)
 {
@@ -308,7 +396,23 @@ void
 PointToPointNetDevice::SetQueue(Ptr<Queue<Packet>> q)
 {
     NS_LOG_FUNCTION(this << q);
-    m_queue = q;
+    SetTxQueue(0, q);
+}
+
+void
+PointToPointNetDevice::SetTxQueue(std::size_t index, Ptr<Queue<Packet>> q)
+{
+    NS_LOG_FUNCTION(this << index << q);
+    NS_ABORT_MSG_IF(index > m_queues.size(),
+                    "Transmit queues must be attached with consecutive indices");
+    if (index == m_queues.size())
+    {
+        m_queues.push_back(q);
+    }
+    else
+    {
+        m_queues[index] = q;
+    }
 }
 
 void
@@ -318,6 +422,28 @@ PointToPointNetDevice::SetReceiveErrorModel(Ptr<ErrorModel> em)
     m_receiveErrorModel = em;
 }
 
+void
+PointToPointNetDevice::ReceiveTrain(Ptr<PacketTrain> train, uint32_t index)
+{
+    NS_LOG_FUNCTION(this << train << index);
+
+    //
+    // The last bit of the index-th packet of the train has just arrived.  The
+    // next packet of the train (if any) is received after the difference of
+    // the last bit times, hence at most one event per train is pending.
+    //
+    Receive(train->GetPacket(index));
+
+    if (index + 1 < train->GetNPackets())
+    {
+        Simulator::Schedule(train->GetLastBitTime(index + 1) - train->GetLastBitTime(index),
+                            &PointToPointNetDevice::ReceiveTrain,
+                            this,
+                            train,
+                            index + 1);
+    }
+}
+
 void
 PointToPointNetDevice::Receive(Ptr<Packet> packet)
 {
@@ -377,7 +503,50 @@ Ptr<Queue<Packet>>
 PointToPointNetDevice::GetQueue() const
 {
     NS_LOG_FUNCTION(this);
-    return m_queue;
+    return m_queues.empty() ? nullptr : m_queues[0];
+}
+
+Ptr<Queue<Packet>>
+PointToPointNetDevice::GetTxQueue(std::size_t index) const
+{
+    NS_LOG_FUNCTION(this << index);
+    NS_ASSERT(index < m_queues.size());
+    return m_queues[index];
+}
+
+std::size_t
+PointToPointNetDevice::GetNTxQueues() const
+{
+    return m_queues.size();
+}
+
+std::size_t
+PointToPointNetDevice::GetTxQueueIndex(Ptr<const Packet> p) const
+{
+    if (m_queues.size() <= 1)
+    {
+        return 0;
+    }
+    SocketPriorityTag priorityTag;
+    if (!p->PeekPacketTag(priorityTag))
+    {
+        return 0;
+    }
+    return priorityTag.GetPriority() % m_queues.size();
+}
+
+uint8_t
+PointToPointNetDevice::SelectQueueByPriority(std::size_t nTxQueues, Ptr<QueueItem> item)
+{
+    SocketPriorityTag priorityTag;
+    if (!item->GetPacket()->PeekPacketTag(priorityTag))
+    {
+        uint8_t dsField = 0;
+        item->GetUint8Value(QueueItem::IP_DSFIELD, dsField);
+        priorityTag.SetPriority(dsField >> 5);
+        item->GetPacket()->AddPacketTag(priorityTag);
+    }
+    return static_cast<uint8_t>(priorityTag.GetPriority() % nTxQueues);
 }
 
 void
@@ -526,14 +695,15 @@ PointToPointNetDevice::Send(Ptr<Packet> packet, const Address& dest, uint16_t pr
     //
     // We should enqueue and dequeue the packet to hit the tracing hooks.
     //
-    if (m_queue->Enqueue(packet))
+    if (m_queues[GetTxQueueIndex(packet)]->Enqueue(packet))
     {
         //
         // If the channel is ready for transition we send the packet right now
+        // (all the other queues are empty if the transmitter is ready)
         //
         if (m_txMachineState == READY)
         {
-            packet = m_queue->Dequeue();
+            packet = DequeueNext();
             m_snifferTrace(packet);
             m_promiscSnifferTrace(packet);
             bool ret = TransmitStart(packet);
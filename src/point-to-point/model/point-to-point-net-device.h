@@ -20,12 +20,15 @@
 #include "ns3/traced-callback.h"
 
 #include <cstring>
+#include <vector>
 
 namespace ns3
 {
 
 class PointToPointChannel;
 class ErrorModel;
+class PacketTrain;
+class QueueItem;
 
 /**
  * @defgroup point-to-point Point-To-Point Network Device
@@ -48,6 +51,10 @@ class ErrorModel;
  * Key parameters or objects that can be specified for this device
  * include a queue, data rate, and interframe transmission gap (the
  * propagation delay is set in the PointToPointChannel).
+ *
+ * The device may own several transmit queues, in which case it behaves
+ * like a multi-queue NIC: packets are stored in the queue selected by
+ * their SocketPriorityTag and the queues are served in round robin order.
  */
 class PointToPointNetDevice : public NetDevice
 {
@@ -121,6 +128,58 @@ class PointToPointNetDevice : public NetDevice
      */
     Ptr<Queue<Packet>> GetQueue() const;
 
+    /**
+     * Attach a transmit queue to the PointToPointNetDevice.
+     *
+     * Transmit queues must be attached with consecutive indices starting
+     * from zero.  The queue with index zero is the one set by SetQueue().
+     *
+     * @param index the index of the transmit queue
+     * @param queue Ptr to the new queue.
+     */
+    void SetTxQueue(std::size_t index, Ptr<Queue<Packet>> queue);
+
+    /**
+     * Get a copy of an attached transmit queue.
+     *
+     * @param index the index of the transmit queue
+     * @returns Ptr to the queue.
+     */
+    Ptr<Queue<Packet>> GetTxQueue(std::size_t index) const;
+
+    /**
+     * @returns the number of transmit queues of this device.
+     */
+    std::size_t GetNTxQueues() const;
+
+    /**
+     * Get the index of the transmit queue a packet is stored into.
+     *
+     * This is the priority of the SocketPriorityTag carried by the packet
+     * (zero if the packet has no such tag) modulo the number of transmit
+     * queues.
+     *
+     * @param p the packet
+     * @returns the index of the transmit queue for the packet.
+     */
+    std::size_t GetTxQueueIndex(Ptr<const Packet> p) const;
+
+    /**
+     * Select queue callback for the NetDeviceQueueInterface aggregated to a
+     * multi-queue PointToPointNetDevice (the number of transmit queues must
+     * be bound to the callback).
+     *
+     * Packets not carrying a SocketPriorityTag are tagged with a priority
+     * equal to the three most significant bits of their DS field, hence the
+     * returned index is the one of the queue the device will store the packet
+     * into.
+     *
+     * @param nTxQueues the number of transmit queues of the device
+     * @param item the item to transmit
+     * @returns the index of the selected transmit queue.
+     */
+    static uint8_t SelectQueueByPriority(std::size_t nTxQueues, Ptr<QueueItem> item);
+
     /**
      * Attach a receive ErrorModel to the PointToPointNetDevice.
      *
@@ -143,6 +202,18 @@ class PointToPointNetDevice : public NetDevice
      */
     void Receive(Ptr<Packet> p);
 
+    /**
+     * Receive a packet of a train from a connected PointToPointChannel.
+     *
+     * This method is called by the channel when the last bit of the first
+     * packet of a train has arrived at the device.  Each packet of the train
+     * is then passed to Receive() when its last bit arrives.
+     *
+     * @param train Ptr to the received train.
+     * @param index the index of the packet whose last bit has just arrived.
+     */
+    void ReceiveTrain(Ptr<PacketTrain> train, uint32_t index);
+
     // The remaining methods are documented in ns3::NetDevice*
 
     void SetIfIndex(const uint32_t index) override;
@@ -250,6 +321,14 @@ class PointToPointNetDevice : public NetDevice
      */
     void TransmitComplete();
 
+    /**
+     * Dequeue the next packet to transmit, serving the non-empty transmit
+     * queues in round robin order.
+     *
+     * @returns the dequeued packet, or nullptr if all the queues are empty
+     */
+    Ptr<Packet> DequeueNext();
+
     /**
      * @brief Make the link up and running
      *
@@ -290,12 +369,22 @@ class PointToPointNetDevice : public NetDevice
     Ptr<PointToPointChannel> m_channel;
 
     /**
-     * The Queue which this PointToPointNetDevice uses as a packet source.
-     * Management of this Queue has been delegated to the PointToPointNetDevice
+     * The Queues which this PointToPointNetDevice uses as a packet source.
+     * Management of these Queues has been delegated to the PointToPointNetDevice
      * and it has the responsibility for deletion.
      * @see class DropTailQueue
      */
-    Ptr<Queue<Packet>> m_queue;
+    std::vector<Ptr<Queue<Packet>>> m_queues;
+
+    std::size_t m_nextTxQueue; //!< Index of the queue served first at the next dequeue
+
+    /**
+     * The maximum number of packets that are handed to the channel back to
+     * back by a single transmission, which then completes with a single event.
+     * The transmit traces of the packets of a batch fire at the start (or the
+     * end, for PhyTxEnd) of the batch rather than of the individual packet.
+     */
+    uint32_t m_txBatchSize;
 
     /**
      * Error model for receive packet events
@@ -431,7 +520,9 @@ class PointToPointNetDevice : public NetDevice
      */
     uint32_t m_mtu;
 
-    Ptr<Packet> m_currentPkt; //!< Current packet processed
+    Ptr<Packet> m_currentPkt;               //!< Current packet processed
+    std::vector<Ptr<Packet>> m_batchedPkts; //!< Packets sent after the current one in the same
+                                            //   transmission
 
     /**
      * @brief PPP to Ethernet protocol number mapping
@@ -12,6 +12,7 @@
 
 #include "ns3/log.h"
 #include "ns3/mpi-interface.h"
+#include "ns3/packet-train.h"
 #include "ns3/packet.h"
 #include "ns3/simulator.h"
 
@@ -62,4 +63,17 @@ PointToPointRemoteChannel::TransmitStart(Ptr<const Packet> p,
     return true;
 }
 
+bool
+PointToPointRemoteChannel::TransmitTrain(Ptr<const PacketTrain> train,
+                                         Ptr<PointToPointNetDevice> src)
+{
+    NS_LOG_FUNCTION(this << train << src);
+
+    for (uint32_t i = 0; i < train->GetNPackets(); i++)
+    {
+        TransmitStart(train->GetPacket(i), src, train->GetLastBitTime(i));
+    }
+    return true;
+}
+
 } // namespace ns3
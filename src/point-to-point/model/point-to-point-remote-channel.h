@@ -56,6 +56,17 @@ class PointToPointRemoteChannel : public PointToPointChannel
      * @returns true if successful (currently always true)
      */
     bool TransmitStart(Ptr<const Packet> p, Ptr<PointToPointNetDevice> src, Time txTime) override;
+
+    /**
+     * @brief Transmit a train of packets
+     *
+     * Packets are sent to the remote system one by one.
+     *
+     * @param train the train of packets to transmit
+     * @param src Source PointToPointNetDevice
+     * @returns true if successful (currently always true)
+     */
+    bool TransmitTrain(Ptr<const PacketTrain> train, Ptr<PointToPointNetDevice> src) override;
 };
 
 } // namespace ns3
@@ -11,9 +11,13 @@
 #include "ns3/point-to-point-channel.h"
 #include "ns3/point-to-point-net-device.h"
 #include "ns3/simulator.h"
+#include "ns3/socket.h"
 #include "ns3/test.h"
+#include "ns3/uinteger.h"
 
+#include <set>
 #include <string>
+#include <vector>
 
 using namespace ns3;
 
@@ -128,6 +132,183 @@ PointToPointTest::DoRun()
     Simulator::Destroy();
 }
 
+/**
+ * @brief Test the transmit queues and the batched transmissions of the
+ * PointToPointNetDevice
+ *
+ * A burst of packets with different priorities is sent through a device
+ * with two transmit queues: the packets must be stored in the queue given
+ * by their priority and the queues must be served in round robin order.
+ * The same burst is then sent with batched transmissions enabled, which
+ * must not change the reception times while reducing the number of
+ * transmission complete events.
+ */
+class PointToPointMultiQueueTest : public TestCase
+{
+  public:
+    /**
+     * @brief Create the test
+     */
+    PointToPointMultiQueueTest();
+
+    /**
+     * @brief Run the test
+     */
+    void DoRun() override;
+
+  private:
+    /**
+     * @brief Send a burst of packets through two connected devices
+     *
+     * The i-th packet has a size of 100 + i bytes. The first half of the
+     * packets has priority 0 and the second half has priority 1.
+     *
+     * @param nPackets the number of packets of the burst
+     * @param txBatchSize the value of the TxBatchSize attribute of the sender
+     */
+    void SendBurst(uint32_t nPackets, uint32_t txBatchSize);
+
+    /**
+     * @brief Callback function which stores the size and time of received packets
+     *
+     * @param dev The receiving device.
+     * @param pkt The received packet.
+     * @param mode The protocol mode used.
+     * @param sender The sender address.
+     *
+     * @return A boolean indicating packet handled properly.
+     */
+    bool RxPacket(Ptr<NetDevice> dev, Ptr<const Packet> pkt, uint16_t mode, const Address& sender);
+
+    /**
+     * @brief Callback function which stores the times of the PhyTxEnd trace
+     *
+     * @param pkt The transmitted packet.
+     */
+    void PhyTxEnd(Ptr<const Packet> pkt);
+
+    std::vector<uint32_t> m_rxSizes;   //!< sizes of the received packets
+    std::vector<Time> m_rxTimes;       //!< reception times of the received packets
+    std::set<Time> m_txEndTimes;       //!< distinct times of the PhyTxEnd trace
+    std::vector<uint32_t> m_nEnqueued; //!< number of packets received by each transmit queue
+};
+
+PointToPointMultiQueueTest::PointToPointMultiQueueTest()
+    : TestCase("PointToPoint transmit queues and batched transmissions")
+{
+}
+
+bool
+PointToPointMultiQueueTest::RxPacket(Ptr<NetDevice> dev,
+                                     Ptr<const Packet> pkt,
+                                     uint16_t mode,
+                                     const Address& sender)
+{
+    m_rxSizes.push_back(pkt->GetSize());
+    m_rxTimes.push_back(Simulator::Now());
+    return true;
+}
+
+void
+PointToPointMultiQueueTest::PhyTxEnd(Ptr<const Packet> pkt)
+{
+    m_txEndTimes.insert(Simulator::Now());
+}
+
+void
+PointToPointMultiQueueTest::SendBurst(uint32_t nPackets, uint32_t txBatchSize)
+{
+    m_rxSizes.clear();
+    m_rxTimes.clear();
+    m_txEndTimes.clear();
+
+    Ptr<Node> a = CreateObject<Node>();
+    Ptr<Node> b = CreateObject<Node>();
+    Ptr<PointToPointNetDevice> devA =
+        CreateObjectWithAttributes<PointToPointNetDevice>("DataRate",
+                                                          DataRateValue(DataRate("10Mbps")),
+                                                          "TxBatchSize",
+                                                          UintegerValue(txBatchSize));
+    Ptr<PointToPointNetDevice> devB = CreateObject<PointToPointNetDevice>();
+    Ptr<PointToPointChannel> channel =
+        CreateObjectWithAttributes<PointToPointChannel>("Delay", TimeValue(MicroSeconds(50)));
+
+    devA->Attach(channel);
+    devA->SetAddress(Mac48Address::Allocate());
+    devA->SetTxQueue(0, CreateObject<DropTailQueue<Packet>>());
+    devA->SetTxQueue(1, CreateObject<DropTailQueue<Packet>>());
+    devB->Attach(channel);
+    devB->SetAddress(Mac48Address::Allocate());
+    devB->SetQueue(CreateObject<DropTailQueue<Packet>>());
+
+    a->AddDevice(devA);
+    b->AddDevice(devB);
+
+    devB->SetReceiveCallback(MakeCallback(&PointToPointMultiQueueTest::RxPacket, this));
+    devA->TraceConnectWithoutContext("PhyTxEnd",
+                                     MakeCallback(&PointToPointMultiQueueTest::PhyTxEnd, this));
+
+    for (uint32_t i = 0; i < nPackets; i++)
+    {
+        Ptr<Packet> p = Create<Packet>(100 + i);
+        SocketPriorityTag priorityTag;
+        priorityTag.SetPriority(i < nPackets / 2 ? 0 : 1);
+        p->AddPacketTag(priorityTag);
+        Simulator::Schedule(Seconds(1),
+                            &PointToPointNetDevice::Send,
+                            devA,
+                            p,
+                            devB->GetAddress(),
+                            0x800);
+    }
+
+    Simulator::Run();
+
+    m_nEnqueued = {devA->GetTxQueue(0)->GetTotalReceivedPackets(),
+                   devA->GetTxQueue(1)->GetTotalReceivedPackets()};
+
+    Simulator::Destroy();
+}
+
+void
+PointToPointMultiQueueTest::DoRun()
+{
+    const uint32_t nPackets = 10;
+
+    SendBurst(nPackets, 1);
+    NS_TEST_ASSERT_MSG_EQ(m_rxSizes.size(), nPackets, "Unexpected number of received packets");
+    NS_TEST_EXPECT_MSG_EQ(m_nEnqueued[0], nPackets / 2, "Unexpected packets in queue 0");
+    NS_TEST_EXPECT_MSG_EQ(m_nEnqueued[1], nPackets / 2, "Unexpected packets in queue 1");
+    NS_TEST_EXPECT_MSG_EQ(m_txEndTimes.size(), nPackets, "Unexpected number of transmissions");
+
+    // the first packet (priority 0) is sent right away, then queue 1 is served
+    // first and the queues alternate
+    std::vector<uint32_t> expectedSizes{100, 105, 101, 106, 102, 107, 103, 108, 104, 109};
+    NS_TEST_EXPECT_MSG_EQ((m_rxSizes == expectedSizes), true, "Queues not served in round robin");
+
+    // the packets (with their 2-byte PPP header) are sent back to back
+    Time txStart = Seconds(1);
+    for (uint32_t i = 0; i < nPackets; i++)
+    {
+        Time txTime = DataRate("10Mbps").CalculateBytesTxTime(m_rxSizes[i] + 2);
+        NS_TEST_EXPECT_MSG_EQ(m_rxTimes[i],
+                              txStart + txTime + MicroSeconds(50),
+                              "Unexpected reception time of packet " << i);
+        txStart += txTime;
+    }
+
+    std::vector<Time> unbatchedRxTimes = m_rxTimes;
+
+    SendBurst(nPackets, 4);
+    NS_TEST_ASSERT_MSG_EQ(m_rxSizes.size(), nPackets, "Unexpected number of received packets");
+    NS_TEST_EXPECT_MSG_EQ((m_rxSizes == expectedSizes), true, "Queues not served in round robin");
+    NS_TEST_EXPECT_MSG_EQ((m_rxTimes == unbatchedRxTimes),
+                          true,
+                          "Batched transmissions changed the reception times");
+    // the first packet is sent alone, the remaining nine in batches of 4, 4 and 1
+    NS_TEST_EXPECT_MSG_EQ(m_txEndTimes.size(), 4, "Unexpected number of transmissions");
+}
+
 /**
  * @brief TestSuite for PointToPoint module
  */
@@ -144,6 +325,7 @@ PointToPointTestSuite::PointToPointTestSuite()
     : TestSuite("devices-point-to-point", Type::UNIT)
 {
     AddTestCase(new PointToPointTest, TestCase::Duration::QUICK);
+    AddTestCase(new PointToPointMultiQueueTest, TestCase::Duration::QUICK);
 }
 
 static PointToPointTestSuite g_pointToPointTestSuite; //!< The testsuite
@@ -0,0 +1,139 @@
+//
+// SPDX-License-Identifier: GPL-2.0-only
+//
+
+//
+// Benchmark of the generation of the 3GPP TR 38.901 channel matrices and of the
+// computation of the beamforming gain, for a pair of uniform planar arrays.
+//
+// Each iteration of the first phase rotates the bearing angle of the transmit
+// antenna, which invalidates the channel matrix, and then calls
+// ThreeGppChannelModel::GetChannel, so that a new channel matrix is generated
+// from the same channel parameters. Each iteration of the second phase does the
+// same, but calls ThreeGppSpectrumPropagationLossModel::CalcRxPowerSpectralDensity
+// instead, which also computes the long term component and applies the
+// beamforming gain to the received PSD. The number of channel matrices computed
+// per second is printed for each phase, together with a checksum of the results.
+//
+// The default configuration uses two 8x8 arrays, i.e., 64x64 channel matrices.
+// The channel is NLOS, so that all the clusters of the channel are generated.
+//
+// Usage example:
+//
+//     ./ns3 run "three-gpp-channel-benchmark --numRows=4 --numColumns=4"
+//
+
+#include "ns3/channel-condition-model.h"
+#include "ns3/command-line.h"
+#include "ns3/constant-position-mobility-model.h"
+#include "ns3/double.h"
+#include "ns3/isotropic-antenna-model.h"
+#include "ns3/node-container.h"
+#include "ns3/node.h"
+#include "ns3/object-factory.h"
+#include "ns3/pointer.h"
+#include "ns3/spectrum-signal-parameters.h"
+#include "ns3/string.h"
+#include "ns3/three-gpp-channel-model.h"
+#include "ns3/three-gpp-spectrum-propagation-loss-model.h"
+#include "ns3/uinteger.h"
+#include "ns3/uniform-planar-array.h"
+
+#include <chrono>
+#include <iostream>
+
+using namespace ns3;
+
+int
+main(int argc, char* argv[])
+{
+    uint32_t numRows = 8;
+    uint32_t numColumns = 8;
+    uint32_t nIterations = 200;
+    uint32_t nBands = 100;
+
+    CommandLine cmd(__FILE__);
+    cmd.AddValue("numRows", "Number of rows of the antenna arrays", numRows);
+    cmd.AddValue("numColumns", "Number of columns of the antenna arrays", numColumns);
+    cmd.AddValue("nIterations", "Number of channel matrices generated per phase", nIterations);
+    cmd.AddValue("nBands", "Number of bands of the transmitted PSD", nBands);
+    cmd.Parse(argc, argv);
+
+    auto channelModel = CreateObject<ThreeGppChannelModel>();
+    channelModel->SetAttribute("Frequency", DoubleValue(3.5e9));
+    channelModel->SetAttribute("Scenario", StringValue("UMa"));
+    channelModel->SetAttribute("ChannelConditionModel",
+                               PointerValue(CreateObject<NeverLosChannelConditionModel>()));
+    channelModel->AssignStreams(1);
+    auto lossModel = CreateObject<ThreeGppSpectrumPropagationLossModel>();
+    lossModel->SetChannelModel(channelModel);
+
+    NodeContainer nodes;
+    nodes.Create(2);
+    std::vector<Ptr<MobilityModel>> mobilities;
+    std::vector<Ptr<UniformPlanarArray>> antennas;
+    for (uint32_t i = 0; i < nodes.GetN(); i++)
+    {
+        auto mobility = CreateObject<ConstantPositionMobilityModel>();
+        mobility->SetPosition(Vector(100.0 * i, 0.0, i == 0 ? 25.0 : 1.5));
+        nodes.Get(i)->AggregateObject(mobility);
+        mobilities.push_back(mobility);
+        auto antenna = CreateObjectWithAttributes<UniformPlanarArray>(
+            "NumColumns",
+            UintegerValue(numColumns),
+            "NumRows",
+            UintegerValue(numRows),
+            "AntennaElement",
+            PointerValue(CreateObject<IsotropicAntennaModel>()));
+        antenna->SetBeamformingVector(
+            antenna->GetBeamformingVector(Angles(i == 0 ? 0.0 : M_PI, M_PI / 2)));
+        antennas.push_back(antenna);
+    }
+
+    std::vector<double> centerFrequencies;
+    for (uint32_t i = 0; i < nBands; i++)
+    {
+        centerFrequencies.push_back(3.5e9 + i * 180e3);
+    }
+    auto txParams = Create<SpectrumSignalParameters>();
+    txParams->psd = Create<SpectrumValue>(Create<SpectrumModel>(centerFrequencies));
+    *txParams->psd = 1e-12;
+
+    std::cout.precision(12);
+    std::cout << "array: " << numRows << "x" << numColumns << ", iterations: " << nIterations
+              << std::endl;
+
+    for (const std::string phase : {"channel", "channel+beamforming"})
+    {
+        double checksum = 0;
+        const auto start = std::chrono::steady_clock::now();
+        for (uint32_t i = 0; i < nIterations; i++)
+        {
+            // invalidate the channel matrix, without changing the channel parameters
+            antennas[0]->SetAlpha(i % 2 == 0 ? 1e-3 : 0.0);
+            if (phase == "channel")
+            {
+                auto channel = channelModel->GetChannel(mobilities[0],
+                                                        mobilities[1],
+                                                        antennas[0],
+                                                        antennas[1]);
+                checksum += std::abs(channel->m_channel(i % (numRows * numColumns), 0, 0));
+            }
+            else
+            {
+                auto rxParams = lossModel->CalcRxPowerSpectralDensity(txParams,
+                                                                      mobilities[0],
+                                                                      mobilities[1],
+                                                                      antennas[0],
+                                                                      antennas[1]);
+                checksum += Sum(*rxParams->psd);
+            }
+        }
+        const auto elapsed =
+            std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        std::cout << phase << ": " << nIterations / elapsed << " matrices/s, " << elapsed
+                  << " s, checksum " << checksum << std::endl;
+    }
+
+    return 0;
+}
@@ -73,18 +73,13 @@ ConstantSpectrumPropagationLossModel::DoCalcRxPowerSpectralDensity(
     NS_LOG_FUNCTION(this);
 
     Ptr<SpectrumValue> rxPsd = Copy<SpectrumValue>(params->psd);
-    auto vit = rxPsd->ValuesBegin();
-    auto fit = rxPsd->ConstBandsBegin();
-
-    while (vit != rxPsd->ValuesEnd())
-    {
-        NS_ASSERT(fit != rxPsd->ConstBandsEnd());
-        NS_LOG_LOGIC("Ptx = " << *vit);
-        *vit /= m_lossLinear; // Prx = Ptx / loss
-        NS_LOG_LOGIC("Prx = " << *vit);
-        ++vit;
-        ++fit;
-    }
+
+    // the values out of the span of the PSD are zero and do not need to be computed
+    rxPsd->ModifySpanValues([this](std::size_t, double& value) {
+        NS_LOG_LOGIC("Ptx = " << value);
+        value /= m_lossLinear; // Prx = Ptx / loss
+        NS_LOG_LOGIC("Prx = " << value);
+    });
     return rxPsd;
 }
 
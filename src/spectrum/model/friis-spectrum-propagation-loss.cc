@@ -44,7 +44,6 @@ FriisSpectrumPropagationLossModel::DoCalcRxPowerSpectralDensity(
     Ptr<const MobilityModel> b) const
 {
     Ptr<SpectrumValue> rxPsd = Copy<SpectrumValue>(params->psd);
-    auto vit = rxPsd->ValuesBegin();
     auto fit = rxPsd->ConstBandsBegin();
 
     NS_ASSERT(a);
@@ -52,13 +51,11 @@ FriisSpectrumPropagationLossModel::DoCalcRxPowerSpectralDensity(
 
     double d = a->GetDistanceFrom(b);
 
-    while (vit != rxPsd->ValuesEnd())
-    {
-        NS_ASSERT(fit != rxPsd->ConstBandsEnd());
-        *vit /= CalculateLoss(fit->fc, d); // Prx = Ptx / loss
-        ++vit;
-        ++fit;
-    }
+    // the values out of the span of the PSD are zero and do not need to be computed
+    rxPsd->ModifySpanValues([&](std::size_t i, double& value) {
+        NS_ASSERT(fit + i < rxPsd->ConstBandsEnd());
+        value /= CalculateLoss((fit + i)->fc, d); // Prx = Ptx / loss
+    });
     return rxPsd;
 }
 
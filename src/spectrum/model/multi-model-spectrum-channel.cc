@@ -16,6 +16,7 @@
 #include "ns3/angles.h"
 #include "ns3/antenna-model.h"
 #include "ns3/double.h"
+#include "ns3/grid-spatial-index.h"
 #include "ns3/log.h"
 #include "ns3/mobility-model.h"
 #include "ns3/net-device.h"
@@ -26,9 +27,14 @@
 #include "ns3/propagation-delay-model.h"
 #include "ns3/propagation-loss-model.h"
 #include "ns3/simulator.h"
+#include "ns3/uinteger.h"
 
 #include <algorithm>
+#include <atomic>
+#include <condition_variable>
 #include <iostream>
+#include <mutex>
+#include <thread>
 #include <utility>
 
 namespace ns3
@@ -69,8 +75,129 @@ RxSpectrumModelInfo::RxSpectrumModelInfo(Ptr<const SpectrumModel> rxSpectrumMode
 {
 }
 
+/**
+ * Pool of threads running batches of independent tasks. The thread calling Run
+ * takes part in the execution of the tasks and returns once all of them are done.
+ * The tasks must not access any state shared with other tasks or with the
+ * simulator (including the reference counts of the ns-3 objects and the logging).
+ */
+class MultiModelSpectrumChannel::ThreadPool
+{
+  public:
+    /**
+     * Constructor
+     * @param nThreads the number of threads running the tasks, including the caller of Run
+     */
+    explicit ThreadPool(uint32_t nThreads)
+        : m_nThreads(nThreads)
+    {
+        for (uint32_t i = 1; i < nThreads; ++i)
+        {
+            m_workers.emplace_back(&ThreadPool::Work, this);
+        }
+    }
+
+    ~ThreadPool()
+    {
+        {
+            std::lock_guard lock(m_mutex);
+            m_stop = true;
+        }
+        m_start.notify_all();
+        for (auto& worker : m_workers)
+        {
+            worker.join();
+        }
+    }
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    /// @return the number of threads running the tasks, including the caller of Run
+    uint32_t GetNThreads() const
+    {
+        return m_nThreads;
+    }
+
+    /**
+     * Run the given tasks and wait for their completion.
+     * @param tasks the tasks
+     */
+    void Run(const std::vector<std::function<void()>>& tasks)
+    {
+        {
+            std::lock_guard lock(m_mutex);
+            m_tasks = &tasks;
+            m_next = 0;
+            m_busy = m_workers.size();
+            ++m_generation;
+        }
+        m_start.notify_all();
+        RunTasks();
+        std::unique_lock lock(m_mutex);
+        m_done.wait(lock, [this] { return m_busy == 0; });
+        m_tasks = nullptr;
+    }
+
+  private:
+    /// Run the tasks of the current batch which have not been started yet
+    void RunTasks()
+    {
+        const auto& tasks = *m_tasks;
+        for (auto i = m_next++; i < tasks.size(); i = m_next++)
+        {
+            tasks[i]();
+        }
+    }
+
+    /// Body of the worker threads
+    void Work()
+    {
+        uint64_t generation = 0;
+        while (true)
+        {
+            {
+                std::unique_lock lock(m_mutex);
+                m_start.wait(lock, [this, generation] {
+                    return m_stop || m_generation != generation;
+                });
+                if (m_stop)
+                {
+                    return;
+                }
+                generation = m_generation;
+            }
+            RunTasks();
+            {
+                std::lock_guard lock(m_mutex);
+                --m_busy;
+            }
+            m_done.notify_one();
+        }
+    }
+
+    uint32_t m_nThreads;                                        //!< number of threads
+    std::vector<std::thread> m_workers;                         //!< worker threads
+    std::mutex m_mutex;                                         //!< protects the batch state
+    std::condition_variable m_start;                            //!< signals a new batch or the stop
+    std::condition_variable m_done;                             //!< signals the end of a worker
+    const std::vector<std::function<void()>>* m_tasks{nullptr}; //!< tasks of the current batch
+    std::atomic<std::size_t> m_next{0};                         //!< index of the next task to run
+    std::size_t m_busy{0};                                      //!< busy workers
+    uint64_t m_generation{0};                                   //!< number of batches started
+    bool m_stop{false};                                         //!< whether the workers must exit
+};
+
 MultiModelSpectrumChannel::MultiModelSpectrumChannel()
-    : m_numDevices{0}
+    : m_numDevices{0},
+      m_receiverCullingRange{0.0},
+      m_nextRxPhyId{0},
+      m_rxComputationThreads{0}
+{
+    NS_LOG_FUNCTION(this);
+}
+
+MultiModelSpectrumChannel::~MultiModelSpectrumChannel()
 {
     NS_LOG_FUNCTION(this);
 }
@@ -81,6 +208,15 @@ MultiModelSpectrumChannel::DoDispose()
     NS_LOG_FUNCTION(this);
     m_txSpectrumModelInfoMap.clear();
     m_rxSpectrumModelInfoMap.clear();
+    m_rxPhysById.clear();
+    if (m_receiverIndex)
+    {
+        m_receiverIndex->Dispose();
+        m_receiverIndex = nullptr;
+    }
+    m_unindexedRxPhys.clear();
+    m_rxComputationTasks.clear();
+    m_threadPool.reset();
     SpectrumChannel::DoDispose();
 }
 
@@ -91,8 +227,30 @@ MultiModelSpectrumChannel::GetTypeId()
                             .SetParent<SpectrumChannel>()
                             .SetGroupName("Spectrum")
                             .AddConstructor<MultiModelSpectrumChannel>()
-
-        ;
+            .AddAttribute("ReceiverCullingRange",
+                          "If strictly positive, signals are only delivered to the receivers "
+                          "located within this distance (m) of the transmitter. The receivers "
+                          "are found through a spatial index of their positions, which avoids "
+                          "processing all the receivers of the channel. Note that the default "
+                          "value corresponds to considering all the receivers. Tune this value "
+                          "with care, the range must exceed the interference range.",
+                          DoubleValue(0.0),
+                          MakeDoubleAccessor(&MultiModelSpectrumChannel::m_receiverCullingRange),
+                          MakeDoubleChecker<double>(0.0))
+            .AddAttribute("RxComputationThreads",
+                          "If zero, the propagation losses of a signal are computed for each "
+                          "receiver when the signal reaches the receiver. Otherwise, the "
+                          "computations of the phased array spectrum propagation loss model "
+                          "which do not alter the state of the simulation (e.g., the spectrum "
+                          "channel matrices of the 3GPP model) are run by this number of "
+                          "threads for the receivers reached when the transmission starts, "
+                          "i.e., with a zero propagation delay (all of them if no propagation "
+                          "delay model is set). The losses for the other receivers are still "
+                          "computed when the signal reaches them. The results are thus the "
+                          "same for any number of threads, including zero.",
+                          UintegerValue(0),
+                          MakeUintegerAccessor(&MultiModelSpectrumChannel::m_rxComputationThreads),
+                          MakeUintegerChecker<uint32_t>());
     return tid;
 }
 
@@ -119,6 +277,19 @@ MultiModelSpectrumChannel::RemoveRx(Ptr<SpectrumPhy> phy)
             break; // there should be at most one entry
         }
     }
+
+    auto idIt = std::find_if(m_rxPhysById.begin(), m_rxPhysById.end(), [&phy](const auto& entry) {
+        return entry.second == phy;
+    });
+    if (idIt != m_rxPhysById.end())
+    {
+        if (m_receiverIndex)
+        {
+            m_receiverIndex->Remove(idIt->first);
+        }
+        m_unindexedRxPhys.erase(idIt->first);
+        m_rxPhysById.erase(idIt);
+    }
 }
 
 void
@@ -145,6 +316,14 @@ MultiModelSpectrumChannel::AddRx(Ptr<SpectrumPhy> phy)
     // prevented insertion. In both cases, add the phy to the element pointed to by rxInfoIterator
     rxInfoIterator->second.m_rxPhys.push_back(phy);
 
+    // identifiers follow the order of the receivers in m_rxPhys, to which they are appended
+    m_rxPhysById.emplace(m_nextRxPhyId, phy);
+    if (m_receiverIndex)
+    {
+        m_unindexedRxPhys.insert(m_nextRxPhyId);
+    }
+    ++m_nextRxPhyId;
+
     if (inserted)
     {
         // create the necessary converters for all the TX spectrum models that we know of
@@ -268,6 +447,20 @@ MultiModelSpectrumChannel::StartTx(Ptr<SpectrumSignalParameters> txParams)
         convertedPsds.emplace(rxSpectrumModelUid, convertedTxPowerSpectrum);
     }
 
+    if (m_receiverCullingRange > 0 && txMobility)
+    {
+        for (const auto& rxPhy : GetRxPhysWithinCullingRange(txMobility->GetPosition()))
+        {
+            const auto rxSpectrumModelUid = rxPhy->GetRxSpectrumModel()->GetUid();
+            if (convertedPsds.contains(rxSpectrumModelUid))
+            {
+                StartTxToReceiver(txParams, rxPhy, convertedPsds);
+            }
+        }
+        RunRxComputationTasks();
+        return;
+    }
+
     for (auto rxInfoIterator = m_rxSpectrumModelInfoMap.begin();
          rxInfoIterator != m_rxSpectrumModelInfoMap.end();
          ++rxInfoIterator)
@@ -288,81 +481,201 @@ MultiModelSpectrumChannel::StartTx(Ptr<SpectrumSignalParameters> txParams)
             NS_ASSERT_MSG((*rxPhyIterator)->GetRxSpectrumModel()->GetUid() == rxSpectrumModelUid,
                           "SpectrumModel change was not notified to MultiModelSpectrumChannel "
                           "(i.e., AddRx should be called again after model is changed)");
+            StartTxToReceiver(txParams, *rxPhyIterator, convertedPsds);
+        }
+    }
+    RunRxComputationTasks();
+}
 
-            auto txAntennaGain{0.0};
-            if ((*rxPhyIterator) != txParams->txPhy)
-            {
-                auto rxNetDevice = (*rxPhyIterator)->GetDevice();
-                auto txNetDevice = txParams->txPhy->GetDevice();
+void
+MultiModelSpectrumChannel::RunRxComputationTasks()
+{
+    NS_LOG_FUNCTION(this << m_rxComputationTasks.size());
+    if (m_rxComputationThreads > 1 && m_rxComputationTasks.size() > 1)
+    {
+        if (!m_threadPool || m_threadPool->GetNThreads() != m_rxComputationThreads)
+        {
+            m_threadPool = std::make_unique<ThreadPool>(m_rxComputationThreads);
+        }
+        m_threadPool->Run(m_rxComputationTasks);
+    }
+    else
+    {
+        for (const auto& task : m_rxComputationTasks)
+        {
+            task();
+        }
+    }
+    // the tasks (and the objects they reference) are released by this thread
+    m_rxComputationTasks.clear();
+}
 
-                if (rxNetDevice && txNetDevice)
-                {
-                    // we assume that devices are attached to a node
-                    if (rxNetDevice->GetNode()->GetId() == txNetDevice->GetNode()->GetId())
-                    {
-                        NS_LOG_DEBUG(
-                            "Skipping the pathloss calculation among different antennas of the "
-                            "same node, not supported yet by any pathloss model in ns-3.");
-                        continue;
-                    }
-                }
+void
+MultiModelSpectrumChannel::StartTxToReceiver(
+    Ptr<SpectrumSignalParameters> txParams,
+    Ptr<SpectrumPhy> receiver,
+    const std::map<SpectrumModelUid_t, Ptr<SpectrumValue>>& convertedPsds)
+{
+    NS_LOG_FUNCTION(this << txParams << receiver);
+    const auto rxSpectrumModelUid = receiver->GetRxSpectrumModel()->GetUid();
+    auto txMobility = txParams->txPhy->GetMobility();
 
-                if (m_filter && m_filter->Filter(txParams, *rxPhyIterator))
-                {
-                    continue;
-                }
+    if (receiver == txParams->txPhy)
+    {
+        return;
+    }
 
-                NS_LOG_LOGIC("copying signal parameters " << txParams);
-                auto rxParams = txParams->Copy();
-                rxParams->psd = Copy<SpectrumValue>(convertedPsds.at(rxSpectrumModelUid));
-                Time delay{0};
+    auto rxNetDevice = receiver->GetDevice();
+    auto txNetDevice = txParams->txPhy->GetDevice();
 
-                auto receiverMobility = (*rxPhyIterator)->GetMobility();
+    if (rxNetDevice && txNetDevice)
+    {
+        // we assume that devices are attached to a node
+        if (rxNetDevice->GetNode()->GetId() == txNetDevice->GetNode()->GetId())
+        {
+            NS_LOG_DEBUG("Skipping the pathloss calculation among different antennas of the "
+                         "same node, not supported yet by any pathloss model in ns-3.");
+            return;
+        }
+    }
 
-                if (txMobility && receiverMobility)
-                {
-                    if (rxParams->txAntenna)
-                    {
-                        Angles txAngles(receiverMobility->GetPosition(), txMobility->GetPosition());
-                        txAntennaGain = rxParams->txAntenna->GetGainDb(txAngles);
-                        NS_LOG_LOGIC("txAntennaGain = " << txAntennaGain << " dB");
-                    }
-                    if (m_propagationDelay)
-                    {
-                        delay = m_propagationDelay->GetDelay(txMobility, receiverMobility);
-                    }
-                }
+    if (m_filter && m_filter->Filter(txParams, receiver))
+    {
+        return;
+    }
 
-                if (rxNetDevice)
-                {
-                    // the receiver has a NetDevice, so we expect that it is attached to a Node
-                    auto dstNode = rxNetDevice->GetNode()->GetId();
-                    Simulator::ScheduleWithContext(dstNode,
-                                                   delay,
-                                                   &MultiModelSpectrumChannel::StartRx,
-                                                   this,
-                                                   txParams->psd,
-                                                   txAntennaGain,
-                                                   rxParams,
-                                                   *rxPhyIterator,
-                                                   convertedPsds);
-                }
-                else
-                {
-                    // the receiver is not attached to a NetDevice, so we cannot assume that it is
-                    // attached to a node
-                    Simulator::Schedule(delay,
-                                        &MultiModelSpectrumChannel::StartRx,
-                                        this,
-                                        txParams->psd,
-                                        txAntennaGain,
-                                        rxParams,
-                                        *rxPhyIterator,
-                                        convertedPsds);
-                }
-            }
+    NS_LOG_LOGIC("copying signal parameters " << txParams);
+    auto rxParams = txParams->Copy();
+    rxParams->psd = Copy<SpectrumValue>(convertedPsds.at(rxSpectrumModelUid));
+    Time delay{0};
+    auto txAntennaGain{0.0};
+
+    auto receiverMobility = receiver->GetMobility();
+
+    if (txMobility && receiverMobility)
+    {
+        if (rxParams->txAntenna)
+        {
+            Angles txAngles(receiverMobility->GetPosition(), txMobility->GetPosition());
+            txAntennaGain = rxParams->txAntenna->GetGainDb(txAngles);
+            NS_LOG_LOGIC("txAntennaGain = " << txAntennaGain << " dB");
+        }
+        if (m_propagationDelay)
+        {
+            delay = m_propagationDelay->GetDelay(txMobility, receiverMobility);
         }
     }
+
+    auto startRx = &MultiModelSpectrumChannel::StartRx;
+    if (m_rxComputationThreads > 0 && delay.IsZero())
+    {
+        // the signal reaches the receiver now, so the received signal can be computed now
+        // (with the same positions, velocities and time as if computed upon reception), so
+        // that the computations for all such receivers can be run concurrently
+        std::function<void()> task;
+        rxParams = CalcRxParams(txAntennaGain, rxParams, receiver, &task);
+        if (!rxParams)
+        {
+            return;
+        }
+        if (task)
+        {
+            m_rxComputationTasks.push_back(std::move(task));
+        }
+        startRx = &MultiModelSpectrumChannel::DeliverRx;
+    }
+
+    if (rxNetDevice)
+    {
+        // the receiver has a NetDevice, so we expect that it is attached to a Node
+        auto dstNode = rxNetDevice->GetNode()->GetId();
+        Simulator::ScheduleWithContext(dstNode,
+                                       delay,
+                                       startRx,
+                                       this,
+                                       txParams->psd,
+                                       txAntennaGain,
+                                       rxParams,
+                                       receiver,
+                                       convertedPsds);
+    }
+    else
+    {
+        // the receiver is not attached to a NetDevice, so we cannot assume that it is
+        // attached to a node
+        Simulator::Schedule(delay,
+                            startRx,
+                            this,
+                            txParams->psd,
+                            txAntennaGain,
+                            rxParams,
+                            receiver,
+                            convertedPsds);
+    }
+}
+
+void
+MultiModelSpectrumChannel::UpdateReceiverIndex()
+{
+    if (!m_receiverIndex)
+    {
+        m_receiverIndex =
+            CreateObjectWithAttributes<GridSpatialIndex>("CellSize",
+                                                         DoubleValue(m_receiverCullingRange));
+        for (const auto& [id, phy] : m_rxPhysById)
+        {
+            m_unindexedRxPhys.insert(id);
+        }
+    }
+    auto it = m_unindexedRxPhys.begin();
+    while (it != m_unindexedRxPhys.end())
+    {
+        if (auto mobility = m_rxPhysById.at(*it)->GetMobility())
+        {
+            m_receiverIndex->Add(*it, mobility);
+            it = m_unindexedRxPhys.erase(it);
+        }
+        else
+        {
+            ++it;
+        }
+    }
+}
+
+std::vector<Ptr<SpectrumPhy>>
+MultiModelSpectrumChannel::GetRxPhysWithinCullingRange(const Vector& position)
+{
+    NS_LOG_FUNCTION(this << position);
+    NS_ASSERT(m_receiverCullingRange > 0);
+    if (!m_receiverIndex || !m_unindexedRxPhys.empty())
+    {
+        UpdateReceiverIndex();
+    }
+    auto ids = m_receiverIndex->GetItemsWithinRange(position, m_receiverCullingRange);
+    NS_LOG_DEBUG(ids.size() << " receivers out of " << m_rxPhysById.size() << " within "
+                            << m_receiverCullingRange << " m");
+    ids.insert(ids.end(), m_unindexedRxPhys.cbegin(), m_unindexedRxPhys.cend());
+    std::sort(ids.begin(), ids.end());
+
+    // receivers are considered by RX SpectrumModel first, then by order of addition
+    std::vector<std::pair<SpectrumModelUid_t, Ptr<SpectrumPhy>>> receivers;
+    receivers.reserve(ids.size());
+    for (auto id : ids)
+    {
+        const auto& phy = m_rxPhysById.at(id);
+        receivers.emplace_back(phy->GetRxSpectrumModel()->GetUid(), phy);
+    }
+    std::stable_sort(receivers.begin(), receivers.end(), [](const auto& lhs, const auto& rhs) {
+        return lhs.first < rhs.first;
+    });
+
+    std::vector<Ptr<SpectrumPhy>> phys;
+    phys.reserve(receivers.size());
+    for (const auto& [uid, phy] : receivers)
+    {
+        phys.push_back(phy);
+    }
+    return phys;
 }
 
 void
@@ -388,7 +701,9 @@ MultiModelSpectrumChannel::StartRx(
         if (itConvertedPsd != availableConvertedPsds.cend())
         {
             NS_LOG_LOGIC("converted PSD already exists for " << phySpectrumModelUid);
-            params->psd = itConvertedPsd->second;
+            // the converted PSD may be the transmitted one and is shared by the receivers,
+            // hence it is copied before the losses are applied
+            params->psd = Copy<SpectrumValue>(itConvertedPsd->second);
         }
         else
         {
@@ -404,7 +719,7 @@ MultiModelSpectrumChannel::StartRx(
             if (rxConverterIterator == txInfoIterator->second.m_spectrumConverterMap.cend())
             {
                 // No converter means TX SpectrumModel is orthogonal to current PHY SpectrumModel
-                params->psd = txPsd;
+                params->psd = Copy<SpectrumValue>(txPsd);
             }
             else
             {
@@ -413,6 +728,40 @@ MultiModelSpectrumChannel::StartRx(
         }
     }
 
+    if (auto rxParams = CalcRxParams(txAntennaGain, params, receiver, nullptr))
+    {
+        receiver->StartRx(rxParams);
+    }
+}
+
+void
+MultiModelSpectrumChannel::DeliverRx(
+    Ptr<SpectrumValue> txPsd,
+    double txAntennaGain,
+    Ptr<SpectrumSignalParameters> params,
+    Ptr<SpectrumPhy> receiver,
+    const std::map<SpectrumModelUid_t, Ptr<SpectrumValue>>& availableConvertedPsds)
+{
+    NS_LOG_FUNCTION(this);
+
+    if (params->psd->GetSpectrumModelUid() != receiver->GetRxSpectrumModel()->GetUid())
+    {
+        NS_LOG_LOGIC("SpectrumModelUid changed since TX started, computing the reception again");
+        StartRx(txPsd, txAntennaGain, params, receiver, availableConvertedPsds);
+        return;
+    }
+
+    receiver->StartRx(params);
+}
+
+Ptr<SpectrumSignalParameters>
+MultiModelSpectrumChannel::CalcRxParams(double txAntennaGain,
+                                        Ptr<SpectrumSignalParameters> params,
+                                        Ptr<SpectrumPhy> receiver,
+                                        std::function<void()>* task)
+{
+    NS_LOG_FUNCTION(this << txAntennaGain << params << receiver);
+
     auto txMobility = params->txPhy->GetMobility();
     auto rxMobility = receiver->GetMobility();
     if (txMobility && rxMobility)
@@ -452,7 +801,7 @@ MultiModelSpectrumChannel::StartRx(
         if (pathLossDb > m_maxLossDb)
         {
             // beyond range
-            return;
+            return nullptr;
         }
 
         const auto pathLossLinear = std::pow(10.0, (-pathLossDb) / 10.0);
@@ -473,16 +822,29 @@ MultiModelSpectrumChannel::StartRx(
                           "PhasedArrayModel instances should be installed at both TX and RX "
                           "SpectrumPhy in order to use PhasedArraySpectrumPropagationLoss.");
 
-            params = m_phasedArraySpectrumPropagationLoss->CalcRxPowerSpectralDensity(
-                params,
-                txMobility,
-                rxMobility,
-                txPhasedArrayModel,
-                rxPhasedArrayModel);
+            if (task)
+            {
+                params = m_phasedArraySpectrumPropagationLoss->PrepareRxPowerSpectralDensity(
+                    params,
+                    txMobility,
+                    rxMobility,
+                    txPhasedArrayModel,
+                    rxPhasedArrayModel,
+                    *task);
+            }
+            else
+            {
+                params = m_phasedArraySpectrumPropagationLoss->CalcRxPowerSpectralDensity(
+                    params,
+                    txMobility,
+                    rxMobility,
+                    txPhasedArrayModel,
+                    rxPhasedArrayModel);
+            }
         }
     }
 
-    receiver->StartRx(params);
+    return params;
 }
 
 std::size_t
@@ -16,12 +16,17 @@
 
 #include "ns3/propagation-delay-model.h"
 
+#include <functional>
 #include <map>
+#include <memory>
 #include <set>
+#include <vector>
 
 namespace ns3
 {
 
+class GridSpatialIndex;
+
 /**
  * @ingroup spectrum
  * Container: SpectrumModelUid_t, SpectrumConverter
@@ -88,11 +93,18 @@ typedef std::map<SpectrumModelUid_t, RxSpectrumModelInfo> RxSpectrumModelInfoMap
  * for this to work is that, after the SpectrumPhy switched its
  * SpectrumModel,  MultiModelSpectrumChannel::AddRx () is
  * called again passing the pointer to that SpectrumPhy.
+ *
+ * In large scenarios, the ReceiverCullingRange attribute can be set so that
+ * the signals are only delivered to the SpectrumPhy instances located within
+ * the given distance of the transmitter. These receivers are found through
+ * a ns3::GridSpatialIndex of their positions, so that the cost of a
+ * transmission does not grow with the number of receivers out of range.
  */
 class MultiModelSpectrumChannel : public SpectrumChannel
 {
   public:
     MultiModelSpectrumChannel();
+    ~MultiModelSpectrumChannel() override;
 
     /**
      * @brief Get the type ID.
@@ -109,6 +121,17 @@ class MultiModelSpectrumChannel : public SpectrumChannel
     std::size_t GetNDevices() const override;
     Ptr<NetDevice> GetDevice(std::size_t i) const override;
 
+    /**
+     * Get the receivers located within the receiver culling range of the
+     * given position, in the order in which StartTx considers them when
+     * culling is disabled. The receivers whose mobility model is not known
+     * yet are always included.
+     *
+     * @param position the position of the transmitter
+     * @return the receivers
+     */
+    std::vector<Ptr<SpectrumPhy>> GetRxPhysWithinCullingRange(const Vector& position);
+
   protected:
     void DoDispose() override;
 
@@ -126,6 +149,49 @@ class MultiModelSpectrumChannel : public SpectrumChannel
     TxSpectrumModelInfoMap_t::const_iterator FindAndEventuallyAddTxSpectrumModel(
         Ptr<const SpectrumModel> txSpectrumModel);
 
+    /**
+     * Used internally by StartTx to schedule the reception of a signal by a
+     * given receiver.
+     *
+     * @param txParams The signal parameters.
+     * @param receiver A pointer to the receiver SpectrumPhy.
+     * @param convertedPsds the TX PSD converted to each RX SpectrumModel.
+     */
+    void StartTxToReceiver(
+        Ptr<SpectrumSignalParameters> txParams,
+        Ptr<SpectrumPhy> receiver,
+        const std::map<SpectrumModelUid_t, Ptr<SpectrumValue>>& convertedPsds);
+
+    /**
+     * Run the tasks completing the computation of the signals received from the current
+     * transmission, using the thread pool if more than one thread is configured.
+     */
+    void RunRxComputationTasks();
+
+    /**
+     * Compute the signal received by the given receiver, i.e., apply the antenna gains and
+     * the propagation losses to the PSD of the given signal parameters, which is expressed
+     * in the SpectrumModel of the receiver.
+     *
+     * @param txAntennaGain The antenna gain at the transmitter.
+     * @param params The signal parameters.
+     * @param receiver A pointer to the receiver SpectrumPhy.
+     * @param task If not null, where to store the part of the computation of the phased
+     *             array spectrum propagation loss model that can be run concurrently
+     *             (see PhasedArraySpectrumPropagationLossModel::PrepareRxPowerSpectralDensity)
+     * @return the received signal parameters, or a null pointer if the signal is beyond range
+     */
+    Ptr<SpectrumSignalParameters> CalcRxParams(double txAntennaGain,
+                                               Ptr<SpectrumSignalParameters> params,
+                                               Ptr<SpectrumPhy> receiver,
+                                               std::function<void()>* task);
+
+    /**
+     * Add to the spatial index of the receivers the SpectrumPhy instances
+     * that are not indexed yet and whose mobility model is now known.
+     */
+    void UpdateReceiverIndex();
+
     /**
      * Used internally to reschedule transmission after the propagation delay.
      *
@@ -142,6 +208,24 @@ class MultiModelSpectrumChannel : public SpectrumChannel
         Ptr<SpectrumPhy> receiver,
         const std::map<SpectrumModelUid_t, Ptr<SpectrumValue>>& availableConvertedPsds);
 
+    /**
+     * Used internally to deliver a signal whose reception was computed at the start of
+     * the transmission (i.e., when RxComputationThreads is not zero and the propagation
+     * delay to the receiver is zero). The reception is computed again if the SpectrumModel
+     * of the receiver changed in the meantime.
+     *
+     * @param txPsd The transmitted PSD.
+     * @param txAntennaGain The antenna gain at the transmitter.
+     * @param params The received signal parameters.
+     * @param receiver A pointer to the receiver SpectrumPhy.
+     * @param availableConvertedPsds available converted PSDs from the TX PSD.
+     */
+    void DeliverRx(Ptr<SpectrumValue> txPsd,
+                   double txAntennaGain,
+                   Ptr<SpectrumSignalParameters> params,
+                   Ptr<SpectrumPhy> receiver,
+                   const std::map<SpectrumModelUid_t, Ptr<SpectrumValue>>& availableConvertedPsds);
+
     /**
      * Data structure holding, for each TX SpectrumModel,  all the
      * converters to any RX SpectrumModel, and all the corresponding
@@ -160,6 +244,19 @@ class MultiModelSpectrumChannel : public SpectrumChannel
      * Number of devices connected to the channel.
      */
     std::size_t m_numDevices;
+
+    double m_receiverCullingRange; //!< Max distance (m) to the receivers, 0 to disable
+    uint32_t m_nextRxPhyId;        //!< Identifier of the next receiver added to the channel
+    std::map<uint32_t, Ptr<SpectrumPhy>> m_rxPhysById; //!< Receivers, by order of addition
+    Ptr<GridSpatialIndex> m_receiverIndex;             //!< Spatial index of the receivers
+    std::set<uint32_t> m_unindexedRxPhys;              //!< Receivers not in the index
+
+    class ThreadPool; //!< Pool of threads running the tasks completing the receptions
+    uint32_t m_rxComputationThreads; //!< Threads computing the receptions with a zero
+                                     //!< propagation delay, 0 to compute all upon reception
+    std::vector<std::function<void()>>
+        m_rxComputationTasks;                 //!< Tasks completing the current receptions
+    std::unique_ptr<ThreadPool> m_threadPool; //!< Pool running the tasks
 };
 
 } // namespace ns3
@@ -77,6 +77,41 @@ PhasedArraySpectrumPropagationLossModel::CalcRxPowerSpectralDensity(
     return rxParams;
 }
 
+Ptr<SpectrumSignalParameters>
+PhasedArraySpectrumPropagationLossModel::PrepareRxPowerSpectralDensity(
+    Ptr<const SpectrumSignalParameters> params,
+    Ptr<const MobilityModel> a,
+    Ptr<const MobilityModel> b,
+    Ptr<const PhasedArrayModel> aPhasedArrayModel,
+    Ptr<const PhasedArrayModel> bPhasedArrayModel,
+    std::function<void()>& task) const
+{
+    task = nullptr;
+    if (m_next)
+    {
+        // the models of the chain are evaluated in sequence
+        return CalcRxPowerSpectralDensity(params, a, b, aPhasedArrayModel, bPhasedArrayModel);
+    }
+    return DoPrepareRxPowerSpectralDensity(params,
+                                           a,
+                                           b,
+                                           aPhasedArrayModel,
+                                           bPhasedArrayModel,
+                                           task);
+}
+
+Ptr<SpectrumSignalParameters>
+PhasedArraySpectrumPropagationLossModel::DoPrepareRxPowerSpectralDensity(
+    Ptr<const SpectrumSignalParameters> params,
+    Ptr<const MobilityModel> a,
+    Ptr<const MobilityModel> b,
+    Ptr<const PhasedArrayModel> aPhasedArrayModel,
+    Ptr<const PhasedArrayModel> bPhasedArrayModel,
+    std::function<void()>& task) const
+{
+    return DoCalcRxPowerSpectralDensity(params, a, b, aPhasedArrayModel, bPhasedArrayModel);
+}
+
 int64_t
 PhasedArraySpectrumPropagationLossModel::AssignStreams(int64_t stream)
 {
@@ -14,6 +14,8 @@
 #include "ns3/object.h"
 #include "ns3/phased-array-model.h"
 
+#include <functional>
+
 namespace ns3
 {
 
@@ -78,6 +80,32 @@ class PhasedArraySpectrumPropagationLossModel : public Object
         Ptr<const PhasedArrayModel> aPhasedArrayModel,
         Ptr<const PhasedArrayModel> bPhasedArrayModel) const;
 
+    /**
+     * Same as CalcRxPowerSpectralDensity, except that the part of the computation which
+     * does not access any state shared with other receptions (the random variables, the
+     * caches of the model, the reference counts of shared objects, the logging, etc.) may
+     * be returned as a task instead of being performed. The tasks returned for different
+     * receptions can be run concurrently, provided that they are all run before any other
+     * call to this model.
+     *
+     * @param params the spectrum signal parameters.
+     * @param a sender mobility
+     * @param b receiver mobility
+     * @param aPhasedArrayModel the instance of the phased antenna array of the sender
+     * @param bPhasedArrayModel the instance of the phased antenna array of the receiver
+     * @param task the task completing the computation, left empty if there is none
+     *
+     * @return the received SpectrumSignalParameters, which are only complete once the
+     * task has been run
+     */
+    Ptr<SpectrumSignalParameters> PrepareRxPowerSpectralDensity(
+        Ptr<const SpectrumSignalParameters> params,
+        Ptr<const MobilityModel> a,
+        Ptr<const MobilityModel> b,
+        Ptr<const PhasedArrayModel> aPhasedArrayModel,
+        Ptr<const PhasedArrayModel> bPhasedArrayModel,
+        std::function<void()>& task) const;
+
     /**
      * If this loss model uses objects of type RandomVariableStream,
      * set the stream numbers to the integers starting with the offset
@@ -124,6 +152,32 @@ class PhasedArraySpectrumPropagationLossModel : public Object
         Ptr<const PhasedArrayModel> aPhasedArrayModel,
         Ptr<const PhasedArrayModel> bPhasedArrayModel) const = 0;
 
+    /**
+     * Compute the received SpectrumSignalParameters, possibly returning the part of the
+     * computation that does not access any shared state as a task (see
+     * PrepareRxPowerSpectralDensity). The default implementation performs the whole
+     * computation with DoCalcRxPowerSpectralDensity. A subclass overriding
+     * DoCalcRxPowerSpectralDensity of a model that overrides this method must override
+     * this method as well.
+     *
+     * @param params the spectrum signal parameters.
+     * @param a sender mobility
+     * @param b receiver mobility
+     * @param aPhasedArrayModel the instance of the phased antenna array of the sender
+     * @param bPhasedArrayModel the instance of the phased antenna array of the receiver
+     * @param task the task completing the computation, left empty if there is none
+     *
+     * @return the received SpectrumSignalParameters, which are only complete once the
+     * task has been run
+     */
+    virtual Ptr<SpectrumSignalParameters> DoPrepareRxPowerSpectralDensity(
+        Ptr<const SpectrumSignalParameters> params,
+        Ptr<const MobilityModel> a,
+        Ptr<const MobilityModel> b,
+        Ptr<const PhasedArrayModel> aPhasedArrayModel,
+        Ptr<const PhasedArrayModel> bPhasedArrayModel,
+        std::function<void()>& task) const;
+
     Ptr<PhasedArraySpectrumPropagationLossModel>
         m_next; //!< PhasedArraySpectrumPropagationLossModel chained to this one.
 };
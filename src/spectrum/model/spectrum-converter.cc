@@ -29,7 +29,9 @@ SpectrumConverter::SpectrumConverter(Ptr<const SpectrumModel> fromSpectrumModel,
     m_fromSpectrumModel = fromSpectrumModel;
     m_toSpectrumModel = toSpectrumModel;
 
+    m_conversionColRows.resize(fromSpectrumModel->GetNumBands());
     size_t rowPtr = 0;
+    size_t rowInd = 0;
     for (auto toit = toSpectrumModel->Begin(); toit != toSpectrumModel->End(); ++toit)
     {
         size_t colInd = 0;
@@ -45,10 +47,17 @@ SpectrumConverter::SpectrumConverter(Ptr<const SpectrumModel> fromSpectrumModel,
                 m_conversionMatrix.push_back(c);
                 m_conversionColInd.push_back(colInd);
                 rowPtr++;
+                auto& colRows = m_conversionColRows[colInd];
+                if (colRows.first == colRows.second)
+                {
+                    colRows.first = rowInd;
+                }
+                colRows.second = rowInd + 1;
             }
             colInd++;
         }
         m_conversionRowPtr.push_back(rowPtr);
+        rowInd++;
     }
 }
 
@@ -69,20 +78,33 @@ SpectrumConverter::Convert(Ptr<const SpectrumValue> fvvf) const
 
     Ptr<SpectrumValue> tvvf = Create<SpectrumValue>(m_toSpectrumModel);
 
-    auto tvit = tvvf->ValuesBegin();
-    size_t i = 0; // Index of conversion coefficient
+    // the values out of the span of fvvf are zero, hence only the rows having a non-zero
+    // element in the columns of the span need to be computed, and the span of tvvf is
+    // trimmed to these rows once they are computed
+    size_t rowBegin = m_conversionRowPtr.size();
+    size_t rowEnd = 0;
+    for (auto col = fvvf->GetSpanBegin(); col < fvvf->GetSpanEnd(); ++col)
+    {
+        const auto& [first, second] = m_conversionColRows[col];
+        if (first < second)
+        {
+            rowBegin = std::min(rowBegin, first);
+            rowEnd = std::max(rowEnd, second);
+        }
+    }
 
-    for (auto convIt = m_conversionRowPtr.begin(); convIt != m_conversionRowPtr.end(); ++convIt)
+    for (auto row = rowBegin; row < rowEnd; ++row)
     {
         double sum = 0;
-        while (i < *convIt)
+        for (auto i = (row == 0) ? 0 : m_conversionRowPtr.at(row - 1);
+             i < m_conversionRowPtr.at(row);
+             ++i)
         {
             sum += (*fvvf)[m_conversionColInd.at(i)] * m_conversionMatrix.at(i);
-            i++;
         }
-        *tvit = sum;
-        ++tvit;
+        (*tvvf)[row] = sum;
     }
+    tvvf->TrimSpan();
 
     return tvvf;
 }
@@ -11,6 +11,9 @@
 
 #include "spectrum-value.h"
 
+#include <utility>
+#include <vector>
+
 namespace ns3
 {
 
@@ -69,6 +72,9 @@ class SpectrumConverter : public SimpleRefCount<SpectrumConverter>
     std::vector<size_t> m_conversionRowPtr; //!< offset of rows in m_conversionMatrix
     std::vector<size_t>
         m_conversionColInd; //!< column of each non-zero element in m_conversionMatrix
+    std::vector<std::pair<size_t, size_t>>
+        m_conversionColRows; //!< range of rows [first, second) with a non-zero element in each
+                             //!< column of m_conversionMatrix
 
     Ptr<const SpectrumModel> m_fromSpectrumModel; //!<  the SpectrumModel this SpectrumConverter
                                                   //!<  instance can convert from
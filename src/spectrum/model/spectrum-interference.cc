@@ -115,7 +115,10 @@ SpectrumInterference::ConditionallyEvaluateChunk()
     NS_LOG_LOGIC("if condition: " << condition);
     if (condition)
     {
-        SpectrumValue sinr = (*m_rxSignal) / ((*m_allSignals) - (*m_rxSignal) + (*m_noise));
+        // sinr = rxSignal / (allSignals - rxSignal + noise), computed in a single SpectrumValue
+        SpectrumValue sinr = *m_noise;
+        sinr.AddDifference(*m_allSignals, *m_rxSignal);
+        sinr.AssignRatio(*m_rxSignal, sinr);
         Time duration = Now() - m_lastChangeTime;
         NS_LOG_LOGIC("calling m_errorModel->EvaluateChunk (sinr, duration)");
         m_errorModel->EvaluateChunk(sinr, duration);
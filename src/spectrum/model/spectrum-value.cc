@@ -12,11 +12,279 @@
 #include "ns3/log.h"
 #include "ns3/math.h"
 
+#include <algorithm>
+#include <cmath>
+#include <tuple>
+
+#if defined(__GNUC__) && (defined(__AVX__) || defined(__AVX512F__))
+#include <immintrin.h>
+#define NS3_SPECTRUM_VALUE_SIMD
+#endif
+
 namespace ns3
 {
 
 NS_LOG_COMPONENT_DEFINE("SpectrumValue");
 
+namespace
+{
+
+#ifdef NS3_SPECTRUM_VALUE_SIMD
+/**
+ * Vector of values processed at once by the SIMD kernels. The vector types of the
+ * intrinsics support the arithmetic operators with GCC and Clang, hence the same
+ * generic operation is applied to the vectors and to the remaining values.
+ */
+struct Simd
+{
+#ifdef __AVX512F__
+    using Type = __m512d;                  //!< vector type
+    static constexpr std::size_t SIZE = 8; //!< number of values per vector
+
+    /**
+     * @param p pointer to the first value
+     * @return the vector of the (unaligned) values starting at p
+     */
+    static Type Load(const double* p)
+    {
+        return _mm512_loadu_pd(p);
+    }
+
+    /**
+     * @param p pointer to the first value
+     * @param v the vector to store (unaligned) at p
+     */
+    static void Store(double* p, Type v)
+    {
+        _mm512_storeu_pd(p, v);
+    }
+
+    /**
+     * @param s the flat value
+     * @return a vector whose values are all equal to s
+     */
+    static Type Broadcast(double s)
+    {
+        return _mm512_set1_pd(s);
+    }
+#else
+    using Type = __m256d;                  //!< vector type
+    static constexpr std::size_t SIZE = 4; //!< number of values per vector
+
+    /**
+     * @param p pointer to the first value
+     * @return the vector of the (unaligned) values starting at p
+     */
+    static Type Load(const double* p)
+    {
+        return _mm256_loadu_pd(p);
+    }
+
+    /**
+     * @param p pointer to the first value
+     * @param v the vector to store (unaligned) at p
+     */
+    static void Store(double* p, Type v)
+    {
+        _mm256_storeu_pd(p, v);
+    }
+
+    /**
+     * @param s the flat value
+     * @return a vector whose values are all equal to s
+     */
+    static Type Broadcast(double s)
+    {
+        return _mm256_set1_pd(s);
+    }
+#endif
+};
+
+/**
+ * @param p pointer to the values of an operand
+ * @return p
+ */
+const double*
+Prepare(const double* p)
+{
+    return p;
+}
+
+/**
+ * @param s a flat operand
+ * @return the vector of the flat operand
+ */
+Simd::Type
+Prepare(double s)
+{
+    return Simd::Broadcast(s);
+}
+
+/**
+ * @param p pointer to the values of an operand
+ * @param i the index of the first value
+ * @return the vector of the values starting at the given index
+ */
+Simd::Type
+Load(const double* p, std::size_t i)
+{
+    return Simd::Load(p + i);
+}
+
+/**
+ * @param v the vector of a flat operand
+ * @return v
+ */
+Simd::Type
+Load(Simd::Type v, std::size_t)
+{
+    return v;
+}
+
+/**
+ * Vectorized part of Transform.
+ *
+ * @tparam Op the type of the operation
+ * @tparam Operands the types of the (prepared) operands
+ * @param n the number of values
+ * @param out the array storing the result
+ * @param op the operation
+ * @param operands the operands, as returned by Prepare
+ * @return the number of values that have been computed
+ */
+template <typename Op, typename... Operands>
+std::size_t
+TransformSimd(std::size_t n, double* out, Op op, Operands... operands)
+{
+    std::size_t i = 0;
+    for (; i + Simd::SIZE <= n; i += Simd::SIZE)
+    {
+        Simd::Store(out + i, op(Load(operands, i)...));
+    }
+    return i;
+}
+#endif
+
+/**
+ * @param p pointer to the values of an operand
+ * @param i the index
+ * @return the value at the given index
+ */
+double
+At(const double* p, std::size_t i)
+{
+    return p[i];
+}
+
+/**
+ * @param s a flat operand
+ * @return s
+ */
+double
+At(double s, std::size_t)
+{
+    return s;
+}
+
+/**
+ * Apply an element-wise operation to the given operands, i.e., out[i] = op(args[i]...)
+ * for each i in [0, n). An operand is either an array of n values or a flat value.
+ * The values at a given index are all read before the result at that index is written,
+ * hence out can be one of the operands.
+ *
+ * The vectorized kernels are used when the build targets AVX or AVX-512 (e.g., with
+ * NS3_NATIVE_OPTIMIZATIONS). Since the operations are element-wise, the results do
+ * not depend on whether the kernels are used.
+ *
+ * @tparam Op the type of the operation
+ * @tparam Args the types of the operands
+ * @param n the number of values
+ * @param out the array storing the result
+ * @param op the operation, taking either values or vectors
+ * @param args the operands
+ */
+template <typename Op, typename... Args>
+void
+Transform(std::size_t n, double* out, Op op, Args... args)
+{
+    std::size_t i = 0;
+#ifdef NS3_SPECTRUM_VALUE_SIMD
+    i = TransformSimd(n, out, op, Prepare(args)...);
+#endif
+    for (; i < n; ++i)
+    {
+        out[i] = op(At(args, i)...);
+    }
+}
+
+/// A range of bands [first, second)
+using BandRange = std::pair<std::size_t, std::size_t>;
+
+/**
+ * @param a a range of bands
+ * @param b a range of bands
+ * @return the smallest range of bands including both ranges
+ */
+BandRange
+Union(const BandRange& a, const BandRange& b)
+{
+    if (a.first >= a.second)
+    {
+        return b;
+    }
+    if (b.first >= b.second)
+    {
+        return a;
+    }
+    return {std::min(a.first, b.first), std::max(a.second, b.second)};
+}
+
+/**
+ * @param p pointer to the values of an operand
+ * @param i the index of a value
+ * @return pointer to the value at the given index
+ */
+const double*
+Offset(const double* p, std::size_t i)
+{
+    return p + i;
+}
+
+/**
+ * @param s a flat operand
+ * @return s
+ */
+double
+Offset(double s, std::size_t)
+{
+    return s;
+}
+
+/**
+ * Apply Transform to the values in the given range of bands.
+ *
+ * @tparam Op the type of the operation
+ * @tparam Args the types of the operands
+ * @param range the range of bands
+ * @param out the array storing the result
+ * @param op the operation, taking either values or vectors
+ * @param args the operands
+ */
+template <typename Op, typename... Args>
+void
+TransformRange(const BandRange& range, double* out, Op op, Args... args)
+{
+    if (range.first < range.second)
+    {
+        Transform(range.second - range.first,
+                  out + range.first,
+                  op,
+                  Offset(args, range.first)...);
+    }
+}
+
+} // namespace
+
 SpectrumValue::SpectrumValue()
 {
 }
@@ -27,9 +295,29 @@ SpectrumValue::SpectrumValue(Ptr<const SpectrumModel> sof)
 {
 }
 
+SpectrumValue&
+SpectrumValue::operator=(const SpectrumValue& other)
+{
+    if (this != &other)
+    {
+        // the values are copied in place, hence they may still be modified through a reference
+        // or an iterator obtained before the assignment and the span must not be shrunk
+        BandRange span{0, other.m_values.size()};
+        if (m_values.size() == other.m_values.size())
+        {
+            span = Union({m_spanBegin, m_spanEnd}, {other.m_spanBegin, other.m_spanEnd});
+        }
+        m_spectrumModel = other.m_spectrumModel;
+        m_values = other.m_values;
+        std::tie(m_spanBegin, m_spanEnd) = span;
+    }
+    return *this;
+}
+
 double&
 SpectrumValue::operator[](size_t index)
 {
+    SetFullSpan();
     return m_values.at(index);
 }
 
@@ -66,12 +354,14 @@ SpectrumValue::ConstValuesEnd() const
 Values::iterator
 SpectrumValue::ValuesBegin()
 {
+    SetFullSpan();
     return m_values.begin();
 }
 
 Values::iterator
 SpectrumValue::ValuesEnd()
 {
+    SetFullSpan();
     return m_values.end();
 }
 
@@ -87,50 +377,84 @@ SpectrumValue::ConstBandsEnd() const
     return m_spectrumModel->End();
 }
 
+std::size_t
+SpectrumValue::GetSpanBegin() const
+{
+    return m_spanBegin;
+}
+
+std::size_t
+SpectrumValue::GetSpanEnd() const
+{
+    return m_spanEnd;
+}
+
 void
-SpectrumValue::Add(const SpectrumValue& x)
+SpectrumValue::ExtendSpan(std::size_t begin, std::size_t end)
 {
-    auto it1 = m_values.begin();
-    auto it2 = x.m_values.begin();
+    std::tie(m_spanBegin, m_spanEnd) = Union({m_spanBegin, m_spanEnd}, {begin, end});
+}
 
+void
+SpectrumValue::TrimSpan()
+{
+    NS_LOG_FUNCTION(this);
+    while (m_spanBegin < m_spanEnd && m_values[m_spanBegin] == 0)
+    {
+        m_spanBegin++;
+    }
+    while (m_spanEnd > m_spanBegin && m_values[m_spanEnd - 1] == 0)
+    {
+        m_spanEnd--;
+    }
+    if (m_spanBegin == m_spanEnd)
+    {
+        m_spanBegin = m_spanEnd = 0;
+    }
+}
+
+void
+SpectrumValue::Add(const SpectrumValue& x)
+{
     NS_ASSERT(m_spectrumModel == x.m_spectrumModel);
     NS_ASSERT(m_values.size() == x.m_values.size());
 
-    while (it1 != m_values.end())
-    {
-        *it1 += *it2;
-        ++it1;
-        ++it2;
-    }
+    // the values out of the span of x are unchanged
+    TransformRange(
+        {x.m_spanBegin, x.m_spanEnd},
+        m_values.data(),
+        [](auto a, auto b) { return a + b; },
+        m_values.data(),
+        x.m_values.data());
+    ExtendSpan(x.m_spanBegin, x.m_spanEnd);
 }
 
 void
 SpectrumValue::Add(double s)
 {
-    auto it1 = m_values.begin();
-
-    while (it1 != m_values.end())
-    {
-        *it1 += s;
-        ++it1;
-    }
+    SetFullSpan();
+    TransformRange(
+        {m_spanBegin, m_spanEnd},
+        m_values.data(),
+        [](auto a, auto b) { return a + b; },
+        m_values.data(),
+        s);
 }
 
 void
 SpectrumValue::Subtract(const SpectrumValue& x)
 {
-    auto it1 = m_values.begin();
-    auto it2 = x.m_values.begin();
-
     NS_ASSERT(m_spectrumModel == x.m_spectrumModel);
     NS_ASSERT(m_values.size() == x.m_values.size());
 
-    while (it1 != m_values.end())
-    {
-        *it1 -= *it2;
-        ++it1;
-        ++it2;
-    }
+    // the values out of the span of x are unchanged
+    TransformRange(
+        {x.m_spanBegin, x.m_spanEnd},
+        m_values.data(),
+        [](auto a, auto b) { return a - b; },
+        m_values.data(),
+        x.m_values.data());
+    ExtendSpan(x.m_spanBegin, x.m_spanEnd);
 }
 
 void
@@ -140,79 +464,156 @@ SpectrumValue::Subtract(double s)
 }
 
 void
-SpectrumValue::Multiply(const SpectrumValue& x)
+SpectrumValue::SubtractFrom(const SpectrumValue& x)
 {
-    auto it1 = m_values.begin();
-    auto it2 = x.m_values.begin();
+    NS_ASSERT(m_spectrumModel == x.m_spectrumModel);
+    NS_ASSERT(m_values.size() == x.m_values.size());
 
+    ExtendSpan(x.m_spanBegin, x.m_spanEnd);
+    TransformRange(
+        {m_spanBegin, m_spanEnd},
+        m_values.data(),
+        [](auto a, auto b) { return a - b; },
+        x.m_values.data(),
+        m_values.data());
+}
+
+void
+SpectrumValue::Multiply(const SpectrumValue& x)
+{
     NS_ASSERT(m_spectrumModel == x.m_spectrumModel);
     NS_ASSERT(m_values.size() == x.m_values.size());
 
-    while (it1 != m_values.end())
-    {
-        *it1 *= *it2;
-        ++it1;
-        ++it2;
-    }
+    // the product of the values out of both spans is zero
+    ExtendSpan(x.m_spanBegin, x.m_spanEnd);
+    TransformRange(
+        {m_spanBegin, m_spanEnd},
+        m_values.data(),
+        [](auto a, auto b) { return a * b; },
+        m_values.data(),
+        x.m_values.data());
 }
 
 void
 SpectrumValue::Multiply(double s)
 {
-    auto it1 = m_values.begin();
-
-    while (it1 != m_values.end())
+    if (!std::isfinite(s))
     {
-        *it1 *= s;
-        ++it1;
+        SetFullSpan();
     }
+    TransformRange(
+        {m_spanBegin, m_spanEnd},
+        m_values.data(),
+        [](auto a, auto b) { return a * b; },
+        m_values.data(),
+        s);
 }
 
 void
 SpectrumValue::Divide(const SpectrumValue& x)
 {
-    auto it1 = m_values.begin();
-    auto it2 = x.m_values.begin();
-
     NS_ASSERT(m_spectrumModel == x.m_spectrumModel);
     NS_ASSERT(m_values.size() == x.m_values.size());
 
-    while (it1 != m_values.end())
-    {
-        *it1 /= *it2;
-        ++it1;
-        ++it2;
-    }
+    SetFullSpan();
+    TransformRange(
+        {m_spanBegin, m_spanEnd},
+        m_values.data(),
+        [](auto a, auto b) { return a / b; },
+        m_values.data(),
+        x.m_values.data());
 }
 
 void
 SpectrumValue::Divide(double s)
 {
     NS_LOG_FUNCTION(this << s);
-    auto it1 = m_values.begin();
-
-    while (it1 != m_values.end())
+    if (s == 0 || std::isnan(s))
     {
-        *it1 /= s;
-        ++it1;
+        SetFullSpan();
     }
+    TransformRange(
+        {m_spanBegin, m_spanEnd},
+        m_values.data(),
+        [](auto a, auto b) { return a / b; },
+        m_values.data(),
+        s);
 }
 
 void
 SpectrumValue::ChangeSign()
 {
-    auto it1 = m_values.begin();
+    Multiply(-1.0);
+}
 
-    while (it1 != m_values.end())
+SpectrumValue&
+SpectrumValue::AddDifference(const SpectrumValue& x, const SpectrumValue& y)
+{
+    NS_ASSERT(m_spectrumModel == x.m_spectrumModel && m_spectrumModel == y.m_spectrumModel);
+    NS_ASSERT(m_values.size() == x.m_values.size() && m_values.size() == y.m_values.size());
+
+    // the values out of the spans of x and y are unchanged
+    const auto range = Union({x.m_spanBegin, x.m_spanEnd}, {y.m_spanBegin, y.m_spanEnd});
+    TransformRange(
+        range,
+        m_values.data(),
+        [](auto a, auto b, auto c) { return a + (b - c); },
+        m_values.data(),
+        x.m_values.data(),
+        y.m_values.data());
+    ExtendSpan(range.first, range.second);
+    return *this;
+}
+
+SpectrumValue&
+SpectrumValue::AddScaled(const SpectrumValue& x, double a)
+{
+    NS_ASSERT(m_spectrumModel == x.m_spectrumModel);
+    NS_ASSERT(m_values.size() == x.m_values.size());
+
+    // the values out of the span of x are unchanged, unless a is not finite
+    BandRange range{x.m_spanBegin, x.m_spanEnd};
+    if (!std::isfinite(a))
     {
-        *it1 = -(*it1);
-        ++it1;
+        SetFullSpan();
+        range = {m_spanBegin, m_spanEnd};
     }
+    TransformRange(
+        range,
+        m_values.data(),
+        [](auto v, auto b, auto c) { return v + b * c; },
+        m_values.data(),
+        x.m_values.data(),
+        a);
+    ExtendSpan(range.first, range.second);
+    return *this;
+}
+
+SpectrumValue&
+SpectrumValue::AssignRatio(const SpectrumValue& num, const SpectrumValue& den)
+{
+    NS_ASSERT(num.m_spectrumModel == den.m_spectrumModel);
+    NS_ASSERT(num.m_values.size() == den.m_values.size());
+
+    if (m_values.size() != num.m_values.size())
+    {
+        m_values.resize(num.m_values.size());
+    }
+    m_spectrumModel = num.m_spectrumModel;
+    SetFullSpan();
+    TransformRange(
+        {m_spanBegin, m_spanEnd},
+        m_values.data(),
+        [](auto a, auto b) { return a / b; },
+        num.m_values.data(),
+        den.m_values.data());
+    return *this;
 }
 
 void
 SpectrumValue::ShiftLeft(int n)
 {
+    SetFullSpan();
     int i = 0;
     while (i < (int)m_values.size() - n)
     {
@@ -229,6 +630,7 @@ SpectrumValue::ShiftLeft(int n)
 void
 SpectrumValue::ShiftRight(int n)
 {
+    SetFullSpan();
     int i = m_values.size() - 1;
     while (i - n >= 0)
     {
@@ -246,6 +648,7 @@ void
 SpectrumValue::Pow(double exp)
 {
     NS_LOG_FUNCTION(this << exp);
+    SetFullSpan();
     auto it1 = m_values.begin();
 
     while (it1 != m_values.end())
@@ -259,6 +662,7 @@ void
 SpectrumValue::Exp(double base)
 {
     NS_LOG_FUNCTION(this << base);
+    SetFullSpan();
     auto it1 = m_values.begin();
 
     while (it1 != m_values.end())
@@ -272,6 +676,7 @@ void
 SpectrumValue::Log10()
 {
     NS_LOG_FUNCTION(this);
+    SetFullSpan();
     auto it1 = m_values.begin();
 
     while (it1 != m_values.end())
@@ -285,6 +690,7 @@ void
 SpectrumValue::Log2()
 {
     NS_LOG_FUNCTION(this);
+    SetFullSpan();
     auto it1 = m_values.begin();
 
     while (it1 != m_values.end())
@@ -298,6 +704,7 @@ void
 SpectrumValue::Log()
 {
     NS_LOG_FUNCTION(this);
+    SetFullSpan();
     auto it1 = m_values.begin();
 
     while (it1 != m_values.end())
@@ -311,11 +718,9 @@ double
 Norm(const SpectrumValue& x)
 {
     double s = 0;
-    auto it1 = x.ConstValuesBegin();
-    while (it1 != x.ConstValuesEnd())
+    for (auto i = x.m_spanBegin; i < x.m_spanEnd; ++i)
     {
-        s += (*it1) * (*it1);
-        ++it1;
+        s += x.m_values[i] * x.m_values[i];
     }
     return std::sqrt(s);
 }
@@ -324,11 +729,9 @@ double
 Sum(const SpectrumValue& x)
 {
     double s = 0;
-    auto it1 = x.ConstValuesBegin();
-    while (it1 != x.ConstValuesEnd())
+    for (auto i = x.m_spanBegin; i < x.m_spanEnd; ++i)
     {
-        s += (*it1);
-        ++it1;
+        s += x.m_values[i];
     }
     return s;
 }
@@ -349,28 +752,21 @@ Prod(const SpectrumValue& x)
 double
 Integral(const SpectrumValue& arg)
 {
+    NS_ASSERT(arg.m_values.size() == arg.m_spectrumModel->GetNumBands());
     double i = 0;
-    auto vit = arg.ConstValuesBegin();
-    auto bit = arg.ConstBandsBegin();
-    while (vit != arg.ConstValuesEnd())
+    auto bit = arg.ConstBandsBegin() + arg.m_spanBegin;
+    for (auto j = arg.m_spanBegin; j < arg.m_spanEnd; ++j)
     {
-        NS_ASSERT(bit != arg.ConstBandsEnd());
-        i += (*vit) * (bit->fh - bit->fl);
-        ++vit;
+        i += arg.m_values[j] * (bit->fh - bit->fl);
         ++bit;
     }
-    NS_ASSERT(bit == arg.ConstBandsEnd());
     return i;
 }
 
 Ptr<SpectrumValue>
 SpectrumValue::Copy() const
 {
-    Ptr<SpectrumValue> p = Create<SpectrumValue>(m_spectrumModel);
-    *p = *this;
-    return p;
-
-    //  return Copy<SpectrumValue> (*this)
+    return Create<SpectrumValue>(*this);
 }
 
 /**
@@ -439,9 +835,8 @@ operator+(double lhs, const SpectrumValue& rhs)
 SpectrumValue
 operator-(const SpectrumValue& lhs, const SpectrumValue& rhs)
 {
-    SpectrumValue res = rhs;
-    res.ChangeSign();
-    res.Add(lhs);
+    SpectrumValue res = lhs;
+    res.Subtract(rhs);
     return res;
 }
 
@@ -509,6 +904,102 @@ operator/(double lhs, const SpectrumValue& rhs)
     return res;
 }
 
+SpectrumValue
+operator+(SpectrumValue&& lhs, const SpectrumValue& rhs)
+{
+    SpectrumValue res = std::move(lhs);
+    res.Add(rhs);
+    return res;
+}
+
+SpectrumValue
+operator+(const SpectrumValue& lhs, SpectrumValue&& rhs)
+{
+    SpectrumValue res = std::move(rhs);
+    res.Add(lhs);
+    return res;
+}
+
+SpectrumValue
+operator+(SpectrumValue&& lhs, SpectrumValue&& rhs)
+{
+    SpectrumValue res = std::move(lhs);
+    res.Add(rhs);
+    return res;
+}
+
+SpectrumValue
+operator-(SpectrumValue&& lhs, const SpectrumValue& rhs)
+{
+    SpectrumValue res = std::move(lhs);
+    res.Subtract(rhs);
+    return res;
+}
+
+SpectrumValue
+operator-(const SpectrumValue& lhs, SpectrumValue&& rhs)
+{
+    SpectrumValue res = std::move(rhs);
+    res.SubtractFrom(lhs);
+    return res;
+}
+
+SpectrumValue
+operator-(SpectrumValue&& lhs, SpectrumValue&& rhs)
+{
+    SpectrumValue res = std::move(lhs);
+    res.Subtract(rhs);
+    return res;
+}
+
+SpectrumValue
+operator*(SpectrumValue&& lhs, const SpectrumValue& rhs)
+{
+    SpectrumValue res = std::move(lhs);
+    res.Multiply(rhs);
+    return res;
+}
+
+SpectrumValue
+operator*(const SpectrumValue& lhs, SpectrumValue&& rhs)
+{
+    SpectrumValue res = std::move(rhs);
+    res.Multiply(lhs);
+    return res;
+}
+
+SpectrumValue
+operator*(SpectrumValue&& lhs, SpectrumValue&& rhs)
+{
+    SpectrumValue res = std::move(lhs);
+    res.Multiply(rhs);
+    return res;
+}
+
+SpectrumValue
+operator/(SpectrumValue&& lhs, const SpectrumValue& rhs)
+{
+    SpectrumValue res = std::move(lhs);
+    res.Divide(rhs);
+    return res;
+}
+
+SpectrumValue
+operator/(const SpectrumValue& lhs, SpectrumValue&& rhs)
+{
+    SpectrumValue res = std::move(rhs);
+    res.AssignRatio(lhs, res);
+    return res;
+}
+
+SpectrumValue
+operator/(SpectrumValue&& lhs, SpectrumValue&& rhs)
+{
+    SpectrumValue res = std::move(lhs);
+    res.Divide(rhs);
+    return res;
+}
+
 SpectrumValue
 operator+(const SpectrumValue& rhs)
 {
@@ -622,13 +1113,8 @@ SpectrumValue::operator/=(double rhs)
 SpectrumValue&
 SpectrumValue::operator=(double rhs)
 {
-    auto it1 = m_values.begin();
-
-    while (it1 != m_values.end())
-    {
-        *it1 = rhs;
-        ++it1;
-    }
+    std::fill(m_values.begin(), m_values.end(), rhs);
+    SetFullSpan();
     return *this;
 }
 
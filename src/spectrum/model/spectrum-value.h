@@ -71,7 +71,35 @@ class SpectrumValue : public SimpleRefCount<SpectrumValue>
     SpectrumValue();
 
     /**
-     * Access value at given frequency index
+     * Copy constructor
+     * @param other the SpectrumValue to copy
+     */
+    SpectrumValue(const SpectrumValue& other) = default;
+
+    /**
+     * Move constructor
+     * @param other the SpectrumValue to move
+     */
+    SpectrumValue(SpectrumValue&& other) = default;
+
+    /**
+     * Copy assignment operator. The span of *this is extended to the span of the
+     * given SpectrumValue, but it is never shrunk (see GetSpanBegin).
+     * @param other the SpectrumValue to copy
+     * @return a reference to *this
+     */
+    SpectrumValue& operator=(const SpectrumValue& other);
+
+    /**
+     * Move assignment operator
+     * @param other the SpectrumValue to move
+     * @return a reference to *this
+     */
+    SpectrumValue& operator=(SpectrumValue&& other) = default;
+
+    /**
+     * Access value at given frequency index. The span is extended to all the bands,
+     * since the returned reference may be used to modify the value.
      *
      * @param index the given frequency index
      *
@@ -158,6 +186,7 @@ class SpectrumValue : public SimpleRefCount<SpectrumValue>
             values.size() == m_spectrumModel->GetNumBands(),
             "Values size does not correspond to the SpectrumModel in use by this SpectrumValue.");
         m_values = values;
+        SetFullSpan();
     }
 
     /**
@@ -170,6 +199,7 @@ class SpectrumValue : public SimpleRefCount<SpectrumValue>
             values.size() == m_spectrumModel->GetNumBands(),
             "Values size does not correspond to the SpectrumModel in use by this SpectrumValue.");
         m_values = std::move(values);
+        SetFullSpan();
     }
 
     /**
@@ -179,6 +209,7 @@ class SpectrumValue : public SimpleRefCount<SpectrumValue>
      */
     inline Values& GetValues()
     {
+        SetFullSpan();
         return m_values;
     }
 
@@ -199,6 +230,61 @@ class SpectrumValue : public SimpleRefCount<SpectrumValue>
      */
     const double& ValuesAt(uint32_t pos) const;
 
+    /**
+     * @brief Get the first band of the span of this SpectrumValue.
+     *
+     * The span is the range of bands [GetSpanBegin (), GetSpanEnd ()) outside of which
+     * all the values are known to be zero. The arithmetic operations, the conversions
+     * performed by SpectrumConverter, the propagation loss models and the functions such
+     * as Integral only process the bands in the span of their operands, so that a signal
+     * occupying a few bands of a wide SpectrumModel costs as much as a signal on a narrow
+     * SpectrumModel. The results do not depend on the span.
+     *
+     * The span is conservative: it may include bands whose value is zero. A SpectrumValue
+     * is created with an empty span, and any non-const accessor (operator[], the non-const
+     * iterators and GetValues) extends the span to all the bands, so that the values can be
+     * modified through the returned reference or iterator at any later time. The span is
+     * only shrunk by an explicit call to TrimSpan; the assignments and the arithmetic
+     * operations never shrink it.
+     *
+     * @return the index of the first band of the span
+     */
+    std::size_t GetSpanBegin() const;
+
+    /**
+     * @brief Get the end of the span of this SpectrumValue (see GetSpanBegin).
+     * @return the index following the last band of the span
+     */
+    std::size_t GetSpanEnd() const;
+
+    /**
+     * @brief Shrink the span to the smallest range of bands including all the non-zero values.
+     *
+     * This requires a pass over the values of the span, hence it is worth calling it on the
+     * PSDs that are reused many times (e.g., the transmit PSD templates) once they have
+     * been filled through the non-const accessors. The values must not be modified through
+     * a reference or an iterator obtained before the call to this function.
+     */
+    void TrimSpan();
+
+    /**
+     * @brief Modify the values in the span of this SpectrumValue.
+     *
+     * The values out of the span are zero and are left unchanged, hence, unlike when the
+     * values are modified through the non-const accessors, the span is not extended.
+     *
+     * @tparam F the type of the function
+     * @param f the function, called with the index and a reference to each value of the span
+     */
+    template <typename F>
+    void ModifySpanValues(F f)
+    {
+        for (auto i = m_spanBegin; i < m_spanEnd; ++i)
+        {
+            f(i, m_values[i]);
+        }
+    }
+
     /**
      *  addition operator
      *
@@ -319,6 +405,31 @@ class SpectrumValue : public SimpleRefCount<SpectrumValue>
      */
     friend SpectrumValue operator/(double lhs, const SpectrumValue& rhs);
 
+    /**
+     * Component-by-component operators taking at least one temporary operand.
+     * The result is computed in the storage of the temporary operand, so that
+     * chained expressions such as a - b + c allocate a single SpectrumValue.
+     *
+     * @param lhs Left Hand Side of the operator
+     * @param rhs Right Hand Side of the operator
+     *
+     * @return the value of the operation
+     * @{
+     */
+    friend SpectrumValue operator+(SpectrumValue&& lhs, const SpectrumValue& rhs);
+    friend SpectrumValue operator+(const SpectrumValue& lhs, SpectrumValue&& rhs);
+    friend SpectrumValue operator+(SpectrumValue&& lhs, SpectrumValue&& rhs);
+    friend SpectrumValue operator-(SpectrumValue&& lhs, const SpectrumValue& rhs);
+    friend SpectrumValue operator-(const SpectrumValue& lhs, SpectrumValue&& rhs);
+    friend SpectrumValue operator-(SpectrumValue&& lhs, SpectrumValue&& rhs);
+    friend SpectrumValue operator*(SpectrumValue&& lhs, const SpectrumValue& rhs);
+    friend SpectrumValue operator*(const SpectrumValue& lhs, SpectrumValue&& rhs);
+    friend SpectrumValue operator*(SpectrumValue&& lhs, SpectrumValue&& rhs);
+    friend SpectrumValue operator/(SpectrumValue&& lhs, const SpectrumValue& rhs);
+    friend SpectrumValue operator/(const SpectrumValue& lhs, SpectrumValue&& rhs);
+    friend SpectrumValue operator/(SpectrumValue&& lhs, SpectrumValue&& rhs);
+    /** @} */
+
     /**
      * Compare two spectrum values
      *
@@ -463,6 +574,40 @@ class SpectrumValue : public SimpleRefCount<SpectrumValue>
      */
     SpectrumValue& operator=(double rhs);
 
+    /**
+     * Add the difference of two SpectrumValues to *this, component by component,
+     * i.e., *this += x - y, in a single pass and without any temporary.
+     *
+     * @param x the minuend
+     * @param y the subtrahend
+     *
+     * @return a reference to *this
+     */
+    SpectrumValue& AddDifference(const SpectrumValue& x, const SpectrumValue& y);
+
+    /**
+     * Add a SpectrumValue multiplied by a scalar to *this, component by component,
+     * i.e., *this += x * a, in a single pass and without any temporary.
+     *
+     * @param x the SpectrumValue to scale
+     * @param a the scale factor
+     *
+     * @return a reference to *this
+     */
+    SpectrumValue& AddScaled(const SpectrumValue& x, double a);
+
+    /**
+     * Assign the ratio of two SpectrumValues to *this, component by component,
+     * i.e., *this = num / den, without any temporary. Either operand may be *this.
+     * *this takes the SpectrumModel of the operands.
+     *
+     * @param num the numerator
+     * @param den the denominator
+     *
+     * @return a reference to *this
+     */
+    SpectrumValue& AssignRatio(const SpectrumValue& num, const SpectrumValue& den);
+
     /**
      *
      * @param x the operand
@@ -602,6 +747,11 @@ class SpectrumValue : public SimpleRefCount<SpectrumValue>
      * @param s flat value
      */
     void Divide(double s);
+    /**
+     * Subtracts the current elements from a SpectrumValue (element by element subtraction)
+     * @param x SpectrumValue
+     */
+    void SubtractFrom(const SpectrumValue& x);
     /**
      * Change the values sign
      */
@@ -642,6 +792,22 @@ class SpectrumValue : public SimpleRefCount<SpectrumValue>
      */
     void Log();
 
+    /**
+     * Extend the span to include the given range of bands
+     * @param begin the index of the first band of the range
+     * @param end the index following the last band of the range
+     */
+    void ExtendSpan(std::size_t begin, std::size_t end);
+
+    /**
+     * Extend the span to all the bands
+     */
+    inline void SetFullSpan()
+    {
+        m_spanBegin = 0;
+        m_spanEnd = m_values.size();
+    }
+
     Ptr<const SpectrumModel> m_spectrumModel; //!< The spectrum model
 
     /**
@@ -652,6 +818,9 @@ class SpectrumValue : public SimpleRefCount<SpectrumValue>
      *
      */
     Values m_values;
+
+    std::size_t m_spanBegin{0}; //!< the first band of the span of the values
+    std::size_t m_spanEnd{0};   //!< the index following the last band of the span of the values
 };
 
 std::ostream& operator<<(std::ostream& os, const SpectrumValue& pvf);
@@ -1128,6 +1128,16 @@ ThreeGppChannelModel::GetTypeId()
                           TimeValue(MilliSeconds(0)),
                           MakeTimeAccessor(&ThreeGppChannelModel::m_updatePeriod),
                           MakeTimeChecker())
+            .AddAttribute("CoherenceDistance",
+                          "If positive, the channel parameters are not updated when the "
+                          "UpdatePeriod expires as long as both nodes moved less than this "
+                          "distance (in meters) since their generation. A reasonable value is the "
+                          "correlation distance for spatial consistency of the scenario (see 3GPP "
+                          "TR 38.901, Table 7.6.3.1-2). If zero, the parameters are always updated "
+                          "when the UpdatePeriod expires.",
+                          DoubleValue(0.0),
+                          MakeDoubleAccessor(&ThreeGppChannelModel::m_coherenceDistance),
+                          MakeDoubleChecker<double>(0.0))
             // attributes for the blockage model
             .AddAttribute("Blockage",
                           "Enable blockage model A (sec 7.6.4.1)",
@@ -2421,7 +2431,9 @@ ThreeGppChannelModel::GetThreeGppTable(const Ptr<const MobilityModel> aMob,
 
 bool
 ThreeGppChannelModel::ChannelParamsNeedsUpdate(Ptr<const ThreeGppChannelParams> channelParams,
-                                               Ptr<const ChannelCondition> channelCondition) const
+                                               Ptr<const ChannelCondition> channelCondition,
+                                               Ptr<const MobilityModel> aMob,
+                                               Ptr<const MobilityModel> bMob) const
 {
     NS_LOG_FUNCTION(this);
 
@@ -2440,7 +2452,30 @@ ThreeGppChannelModel::ChannelParamsNeedsUpdate(Ptr<const ThreeGppChannelParams>
     {
         NS_LOG_DEBUG("Generation time " << channelParams->m_generatedTime.As(Time::NS) << " now "
                                         << Now().As(Time::NS));
-        update = true;
+        bool withinCoherenceDistance = false;
+
+        // the large and small scale parameters are spatially consistent, hence they
+        // can be kept as long as both nodes are within the coherence distance of the
+        // positions at which the parameters were generated (unless the channel
+        // condition changed)
+        if (m_coherenceDistance > 0)
+        {
+            bool aIsFirst = aMob->GetObject<Node>()->GetId() == channelParams->m_nodeIds.first;
+            const auto& aPosition = aIsFirst ? channelParams->m_nodePositions.first
+                                             : channelParams->m_nodePositions.second;
+            const auto& bPosition = aIsFirst ? channelParams->m_nodePositions.second
+                                             : channelParams->m_nodePositions.first;
+            double displacement = std::max(CalculateDistance(aMob->GetPosition(), aPosition),
+                                           CalculateDistance(bMob->GetPosition(), bPosition));
+            if (displacement < m_coherenceDistance)
+            {
+                NS_LOG_DEBUG("Within the coherence distance, displacement " << displacement
+                                                                            << " m");
+                withinCoherenceDistance = true;
+            }
+        }
+
+        update |= !withinCoherenceDistance;
     }
 
     return update;
@@ -2500,7 +2535,7 @@ ThreeGppChannelModel::GetChannel(Ptr<const MobilityModel> aMob,
     {
         channelParams = m_channelParamsMap[channelParamsKey];
         // check if it has to be updated
-        updateParams = ChannelParamsNeedsUpdate(channelParams, condition);
+        updateParams = ChannelParamsNeedsUpdate(channelParams, condition, aMob, bMob);
     }
     else
     {
@@ -2590,6 +2625,7 @@ ThreeGppChannelModel::GenerateChannelParameters(const Ptr<const ChannelCondition
     channelParams->m_generatedTime = Simulator::Now();
     channelParams->m_nodeIds =
         std::make_pair(aMob->GetObject<Node>()->GetId(), bMob->GetObject<Node>()->GetId());
+    channelParams->m_nodePositions = std::make_pair(aMob->GetPosition(), bMob->GetPosition());
     channelParams->m_losCondition = channelCondition->GetLosCondition();
     channelParams->m_o2iCondition = channelCondition->GetO2iCondition();
 
@@ -3407,115 +3443,119 @@ ThreeGppChannelModel::GetNewChannel(Ptr<const ThreeGppChannelParams> channelPara
         }
     }
 
-    // The following for loops computes the channel coefficients
-    // Keeps track of how many sub-clusters have been added up to now
-    uint8_t numSubClustersAdded = 0;
-    for (uint8_t nIndex = 0; nIndex < channelParams->m_reducedClusterNumber; nIndex++)
+    // The channel coefficients are computed as matrix products, one per cluster (or
+    // sub-cluster of the two strongest clusters, see 7.5-28): hUsn(u, s, n) =
+    // sum_m raysU(u, m, n) * raysS(m, s, n), where raysU(u, m, n) is the response of the
+    // receive element u to the ray m of the cluster n, weighted by the cached component of
+    // the ray and by the power of the cluster, and raysS(m, s, n) is the response of the
+    // transmit element s to the same ray. The responses of the elements are the phase
+    // shifts "rxPhaseDiff" and "txPhaseDiff", computed once per element and per ray.
+    // NOTE Doppler is computed in the CalcBeamformingGain function and is
+    // simplified to only account for the center angle of each cluster.
+    const uint8_t numClusters = channelParams->m_reducedClusterNumber;
+    const uint8_t numRays = table3gpp->m_raysPerCluster;
+    std::vector<Vector> rayDirectionsA; // directions of arrival of the rays, cluster by cluster
+    std::vector<Vector> rayDirectionsD; // directions of departure of the rays, cluster by cluster
+    rayDirectionsA.reserve(numClusters * numRays);
+    rayDirectionsD.reserve(numClusters * numRays);
+    for (uint8_t nIndex = 0; nIndex < numClusters; nIndex++)
+    {
+        for (uint8_t mIndex = 0; mIndex < numRays; mIndex++)
+        {
+            // lambda_0 is accounted in the antenna spacing of the element locations
+            rayDirectionsA.emplace_back(sinCosA[nIndex][mIndex],
+                                        sinSinA[nIndex][mIndex],
+                                        cosZoA[nIndex][mIndex]);
+            rayDirectionsD.emplace_back(sinCosD[nIndex][mIndex],
+                                        sinSinD[nIndex][mIndex],
+                                        cosZoD[nIndex][mIndex]);
+        }
+    }
+    const auto uResponse = uAntenna->GetArrayResponse(rayDirectionsA);
+    const auto sResponse = sAntenna->GetArrayResponse(rayDirectionsD);
+
+    // the transmit elements are processed by polarization, since the cached component
+    // of the rays depends on the polarizations of both the elements
+    std::vector<std::vector<size_t>> sIndicesByPol(sAntenna->GetNumPols());
+    for (size_t sIndex = 0; sIndex < sSize; sIndex++)
+    {
+        sIndicesByPol[sAntenna->GetElemPol(sIndex)].push_back(sIndex);
+    }
+
+    for (uint8_t polSa = 0; polSa < sAntenna->GetNumPols(); ++polSa)
     {
-        for (size_t uIndex = 0; uIndex < uSize; uIndex++)
+        const auto& sIndices = sIndicesByPol[polSa];
+        std::vector<const Complex2DVector*> raysPreCompU; // cached components by polarization
+        for (uint8_t polUa = 0; polUa < uAntenna->GetNumPols(); ++polUa)
         {
-            Vector uLoc = uAntenna->GetElementLocation(uIndex);
+            raysPreCompU.push_back(&raysPreComp[std::make_pair(polSa, polUa)]);
+        }
+        Complex3DVector raysU(uSize, numRays, numOverallCluster);
+        Complex3DVector raysS(numRays, sIndices.size(), numOverallCluster);
 
-            for (size_t sIndex = 0; sIndex < sSize; sIndex++)
+        // Keeps track of how many sub-clusters have been added up to now
+        uint8_t numSubClustersAdded = 0;
+        for (uint8_t nIndex = 0; nIndex < numClusters; nIndex++)
+        {
+            const bool isStrongest =
+                (nIndex == channelParams->m_cluster1st || nIndex == channelParams->m_cluster2nd);
+            const double clusterAmplitude =
+                sqrt(channelParams->m_clusterPower[nIndex] / table3gpp->m_raysPerCluster);
+            for (uint8_t mIndex = 0; mIndex < numRays; mIndex++)
             {
-                Vector sLoc = sAntenna->GetElementLocation(sIndex);
                 // Compute the N-2 weakest cluster, assuming 0 slant angle and a
-                // polarization slant angle configured in the array (7.5-22)
-                if (nIndex != channelParams->m_cluster1st && nIndex != channelParams->m_cluster2nd)
+                // polarization slant angle configured in the array (7.5-22), and
+                // split the two strongest clusters into three sub-clusters (7.5-28)
+                // ZML:Just remind me that the angle offsets for the 3 subclusters were not
+                // generated correctly.
+                size_t page = nIndex;
+                if (isStrongest)
                 {
-                    std::complex<double> rays(0, 0);
-                    for (uint8_t mIndex = 0; mIndex < table3gpp->m_raysPerCluster; mIndex++)
+                    switch (mIndex)
                     {
-                        // lambda_0 is accounted in the antenna spacing uLoc and sLoc.
-                        double rxPhaseDiff =
-                            2 * M_PI *
-                            (sinCosA[nIndex][mIndex] * uLoc.x + sinSinA[nIndex][mIndex] * uLoc.y +
-                             cosZoA[nIndex][mIndex] * uLoc.z);
-
-                        double txPhaseDiff =
-                            2 * M_PI *
-                            (sinCosD[nIndex][mIndex] * sLoc.x + sinSinD[nIndex][mIndex] * sLoc.y +
-                             cosZoD[nIndex][mIndex] * sLoc.z);
-                        // NOTE Doppler is computed in the CalcBeamformingGain function and is
-                        // simplified to only account for the center angle of each cluster.
-                        rays += raysPreComp[std::make_pair(sAntenna->GetElemPol(sIndex),
-                                                           uAntenna->GetElemPol(uIndex))](nIndex,
-                                                                                          mIndex) *
-                                std::complex<double>(cos(rxPhaseDiff), sin(rxPhaseDiff)) *
-                                std::complex<double>(cos(txPhaseDiff), sin(txPhaseDiff));
+                    case 9:
+                    case 10:
+                    case 11:
+                    case 12:
+                    case 17:
+                    case 18:
+                        page = numClusters + numSubClustersAdded;
+                        break;
+                    case 13:
+                    case 14:
+                    case 15:
+                    case 16:
+                        page = numClusters + numSubClustersAdded + 1;
+                        break;
+                    default: // case 1,2,3,4,5,6,7,8,19,20
+                        break;
                     }
-                    rays *=
-                        sqrt(channelParams->m_clusterPower[nIndex] / table3gpp->m_raysPerCluster);
-                    hUsn(uIndex, sIndex, nIndex) = rays;
                 }
-                else //(7.5-28)
+                const size_t ray = nIndex * numRays + mIndex;
+                for (size_t uIndex = 0; uIndex < uSize; uIndex++)
                 {
-                    std::complex<double> raysSub1(0, 0);
-                    std::complex<double> raysSub2(0, 0);
-                    std::complex<double> raysSub3(0, 0);
-
-                    for (uint8_t mIndex = 0; mIndex < table3gpp->m_raysPerCluster; mIndex++)
-                    {
-                        // ZML:Just remind me that the angle offsets for the 3 subclusters were not
-                        // generated correctly.
-                        double rxPhaseDiff =
-                            2 * M_PI *
-                            (sinCosA[nIndex][mIndex] * uLoc.x + sinSinA[nIndex][mIndex] * uLoc.y +
-                             cosZoA[nIndex][mIndex] * uLoc.z);
-
-                        double txPhaseDiff =
-                            2 * M_PI *
-                            (sinCosD[nIndex][mIndex] * sLoc.x + sinSinD[nIndex][mIndex] * sLoc.y +
-                             cosZoD[nIndex][mIndex] * sLoc.z);
-
-                        std::complex<double> raySub =
-                            raysPreComp[std::make_pair(sAntenna->GetElemPol(sIndex),
-                                                       uAntenna->GetElemPol(uIndex))](nIndex,
-                                                                                      mIndex) *
-                            std::complex<double>(cos(rxPhaseDiff), sin(rxPhaseDiff)) *
-                            std::complex<double>(cos(txPhaseDiff), sin(txPhaseDiff));
-
-                        switch (mIndex)
-                        {
-                        case 9:
-                        case 10:
-                        case 11:
-                        case 12:
-                        case 17:
-                        case 18:
-                            raysSub2 += raySub;
-                            break;
-                        case 13:
-                        case 14:
-                        case 15:
-                        case 16:
-                            raysSub3 += raySub;
-                            break;
-                        default: // case 1,2,3,4,5,6,7,8,19,20
-                            raysSub1 += raySub;
-                            break;
-                        }
-                    }
-                    raysSub1 *=
-                        sqrt(channelParams->m_clusterPower[nIndex] / table3gpp->m_raysPerCluster);
-                    raysSub2 *=
-                        sqrt(channelParams->m_clusterPower[nIndex] / table3gpp->m_raysPerCluster);
-                    raysSub3 *=
-                        sqrt(channelParams->m_clusterPower[nIndex] / table3gpp->m_raysPerCluster);
-                    hUsn(uIndex, sIndex, nIndex) = raysSub1;
-                    hUsn(uIndex,
-                         sIndex,
-                         channelParams->m_reducedClusterNumber + numSubClustersAdded) = raysSub2;
-                    hUsn(uIndex,
-                         sIndex,
-                         channelParams->m_reducedClusterNumber + numSubClustersAdded + 1) =
-                        raysSub3;
+                    raysU(uIndex, mIndex, page) =
+                        (*raysPreCompU[uAntenna->GetElemPol(uIndex)])(nIndex, mIndex) *
+                        clusterAmplitude * uResponse(uIndex, ray);
+                }
+                for (size_t i = 0; i < sIndices.size(); i++)
+                {
+                    raysS(mIndex, i, page) = sResponse(sIndices[i], ray);
                 }
             }
+            if (isStrongest)
+            {
+                numSubClustersAdded += 2;
+            }
         }
-        if (nIndex == channelParams->m_cluster1st || nIndex == channelParams->m_cluster2nd)
+
+        const auto hUsnPol = raysU * raysS;
+        for (size_t nIndex = 0; nIndex < numOverallCluster; nIndex++)
         {
-            numSubClustersAdded += 2;
+            for (size_t i = 0; i < sIndices.size(); i++)
+            {
+                std::copy_n(&hUsnPol(0, i, nIndex), uSize, &hUsn(0, sIndices[i], nIndex));
+            }
         }
     }
 
@@ -3534,47 +3574,53 @@ ThreeGppChannelModel::GetNewChannel(Ptr<const ThreeGppChannelParams> channelPara
         const double sinSAngleAz = sin(sAngle.GetAzimuth());
         const double cosSAngleAz = cos(sAngle.GetAzimuth());
 
-        for (size_t uIndex = 0; uIndex < uSize; uIndex++)
+        // the phase shifts "rxPhaseDiff" and "txPhaseDiff" of the elements for the LOS ray
+        const auto uLosResponse = uAntenna->GetArrayResponse(
+            {Vector(sinUAngleIncl * cosUAngleAz, sinUAngleIncl * sinUAngleAz, cosUAngleIncl)});
+        const auto sLosResponse = sAntenna->GetArrayResponse(
+            {Vector(sinSAngleIncl * cosSAngleAz, sinSAngleIncl * sinSAngleAz, cosSAngleIncl)});
+
+        // the field patterns only depend on the polarization of the elements
+        std::vector<std::pair<double, double>> uFieldPatterns;
+        std::vector<std::pair<double, double>> sFieldPatterns;
+        for (uint8_t polUa = 0; polUa < uAntenna->GetNumPols(); ++polUa)
         {
-            Vector uLoc = uAntenna->GetElementLocation(uIndex);
-            double rxPhaseDiff = 2 * M_PI *
-                                 (sinUAngleIncl * cosUAngleAz * uLoc.x +
-                                  sinUAngleIncl * sinUAngleAz * uLoc.y + cosUAngleIncl * uLoc.z);
+            uFieldPatterns.push_back(uAntenna->GetElementFieldPattern(
+                Angles(uAngle.GetAzimuth(), uAngle.GetInclination()),
+                polUa));
+        }
+        for (uint8_t polSa = 0; polSa < sAntenna->GetNumPols(); ++polSa)
+        {
+            sFieldPatterns.push_back(sAntenna->GetElementFieldPattern(
+                Angles(sAngle.GetAzimuth(), sAngle.GetInclination()),
+                polSa));
+        }
 
-            for (size_t sIndex = 0; sIndex < sSize; sIndex++)
+        double kLinear = pow(10, channelParams->m_K_factor / 10.0);
+        // the LOS path should be attenuated if blockage is enabled.
+        const double losAmplitude = sqrt(kLinear / (1 + kLinear)) /
+                                    pow(10, channelParams->m_attenuation_dB[0] / 10.0);
+        const double nlosAmplitude = sqrt(1.0 / (kLinear + 1));
+        //(7.5-30) for tau = tau2...tauN, and the NLOS part of tau = tau1
+        std::transform(hUsn.GetPagePtr(0),
+                       hUsn.GetPagePtr(0) + hUsn.GetSize(),
+                       hUsn.GetPagePtr(0),
+                       [nlosAmplitude](const auto& h) { return nlosAmplitude * h; });
+
+        for (size_t sIndex = 0; sIndex < sSize; sIndex++)
+        {
+            auto [txFieldPatternPhi, txFieldPatternTheta] =
+                sFieldPatterns[sAntenna->GetElemPol(sIndex)];
+            for (size_t uIndex = 0; uIndex < uSize; uIndex++)
             {
-                Vector sLoc = sAntenna->GetElementLocation(sIndex);
-                std::complex<double> ray(0, 0);
-                double txPhaseDiff =
-                    2 * M_PI *
-                    (sinSAngleIncl * cosSAngleAz * sLoc.x + sinSAngleIncl * sinSAngleAz * sLoc.y +
-                     cosSAngleIncl * sLoc.z);
-
-                auto [rxFieldPatternPhi, rxFieldPatternTheta] = uAntenna->GetElementFieldPattern(
-                    Angles(uAngle.GetAzimuth(), uAngle.GetInclination()),
-                    uAntenna->GetElemPol(uIndex));
-                auto [txFieldPatternPhi, txFieldPatternTheta] = sAntenna->GetElementFieldPattern(
-                    Angles(sAngle.GetAzimuth(), sAngle.GetInclination()),
-                    sAntenna->GetElemPol(sIndex));
-
-                ray = (rxFieldPatternTheta * txFieldPatternTheta -
-                       rxFieldPatternPhi * txFieldPatternPhi) *
-                      phaseDiffDueToDistance *
-                      std::complex<double>(cos(rxPhaseDiff), sin(rxPhaseDiff)) *
-                      std::complex<double>(cos(txPhaseDiff), sin(txPhaseDiff));
-
-                double kLinear = pow(10, channelParams->m_K_factor / 10.0);
-                // the LOS path should be attenuated if blockage is enabled.
-                hUsn(uIndex, sIndex, 0) =
-                    sqrt(1.0 / (kLinear + 1)) * hUsn(uIndex, sIndex, 0) +
-                    sqrt(kLinear / (1 + kLinear)) * ray /
-                        pow(10,
-                            channelParams->m_attenuation_dB[0] / 10.0); //(7.5-30) for tau = tau1
-                for (size_t nIndex = 1; nIndex < hUsn.GetNumPages(); nIndex++)
-                {
-                    hUsn(uIndex, sIndex, nIndex) *=
-                        sqrt(1.0 / (kLinear + 1)); //(7.5-30) for tau = tau2...tauN
-                }
+                auto [rxFieldPatternPhi, rxFieldPatternTheta] =
+                    uFieldPatterns[uAntenna->GetElemPol(uIndex)];
+                std::complex<double> ray = (rxFieldPatternTheta * txFieldPatternTheta -
+                                            rxFieldPatternPhi * txFieldPatternPhi) *
+                                           phaseDiffDueToDistance * uLosResponse(uIndex, 0) *
+                                           sLosResponse(sIndex, 0);
+
+                hUsn(uIndex, sIndex, 0) += losAmplitude * ray; //(7.5-30) for tau = tau1
             }
         }
     }
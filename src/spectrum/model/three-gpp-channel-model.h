@@ -185,6 +185,10 @@ class ThreeGppChannelModel : public MatrixBasedChannelModel
         DoubleVector m_attenuation_dB;      //!< vector that stores the attenuation of the blockage
         uint8_t m_cluster1st;               //!< index of the first strongest cluster
         uint8_t m_cluster2nd;               //!< index of the second strongest cluster
+        std::pair<Vector, Vector>
+            m_nodePositions; //!< positions of the nodes in m_nodeIds when the parameters were
+                             //!< generated, used to check if they moved beyond the coherence
+                             //!< distance
     };
 
     /**
@@ -314,13 +318,21 @@ class ThreeGppChannelModel : public MatrixBasedChannelModel
         const DoubleVector& clusterZOA) const;
 
     /**
-     * Check if the channel params has to be updated
+     * Check if the channel params has to be updated. The parameters are updated if the
+     * channel condition changed or if the update period expired. If a coherence distance
+     * is set, the parameters are kept after the expiration of the update period as long as
+     * both nodes moved less than the coherence distance since their generation and the
+     * channel condition did not change.
      * @param channelParams channel params
      * @param channelCondition the channel condition
+     * @param aMob the mobility model of node a
+     * @param bMob the mobility model of node b
      * @return true if the channel params has to be updated, false otherwise
      */
     bool ChannelParamsNeedsUpdate(Ptr<const ThreeGppChannelParams> channelParams,
-                                  Ptr<const ChannelCondition> channelCondition) const;
+                                  Ptr<const ChannelCondition> channelCondition,
+                                  Ptr<const MobilityModel> aMob,
+                                  Ptr<const MobilityModel> bMob) const;
 
     /**
      * Check if the channel matrix has to be updated (it needs update when the channel params
@@ -368,6 +380,9 @@ class ThreeGppChannelModel : public MatrixBasedChannelModel
     Ptr<UniformRandomVariable> m_uniformRvDoppler; //!< uniform random variable, used to compute the
                                                    //!< additional Doppler contribution
 
+    double m_coherenceDistance; //!< the displacement (in meters) below which the channel
+                                //!< parameters are kept after the update period expires
+
     // parameters for the blockage model
     bool m_blockage;               //!< enables the blockage model A
     uint16_t m_numNonSelfBlocking; //!< number of non-self-blocking regions
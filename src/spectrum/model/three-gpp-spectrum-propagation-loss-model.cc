@@ -118,25 +118,36 @@ ThreeGppSpectrumPropagationLossModel::CalcLongTerm(
                                       << " s ports: " << sAnt->GetNumPorts()
                                       << " u ports: " << uAnt->GetNumPorts());
     NS_ASSERT_MSG((sAnt != nullptr) && (uAnt != nullptr), "Improper call to the method");
-    size_t numClusters = params->m_channel.GetNumPages();
-    // create and initialize the size of the longTerm 3D matrix
-    Ptr<MatrixBasedChannelModel::Complex3DVector> longTerm =
-        Create<MatrixBasedChannelModel::Complex3DVector>(uAnt->GetNumPorts(),
-                                                         sAnt->GetNumPorts(),
-                                                         numClusters);
     // Calculate long term uW * Husn * sW, the result is a matrix
     // with the dimensions #uPorts, #sPorts, #cluster
-    for (auto sPortIdx = 0; sPortIdx < sAnt->GetNumPorts(); sPortIdx++)
-    {
-        for (auto uPortIdx = 0; uPortIdx < uAnt->GetNumPorts(); uPortIdx++)
+    // The sub-array partition model is adopted for TXRU virtualization,
+    // as described in Section 5.2.2 of 3GPP TR 36.897,
+    // and so equal beam weights are used for all the ports: the weights of each port
+    // are placed in a row (column) of uWeights (sWeights), at the indices of the elements of
+    // the port, so that the long term of all the clusters is computed by a single batched
+    // matrix product (see CalculateLongTermComponent for the computation of an element)
+    auto getPortWeights = [](Ptr<const PhasedArrayModel> ant,
+                             const PhasedArrayModel::ComplexVector& w,
+                             bool byRow) {
+        const size_t numPorts = ant->GetNumPorts();
+        const size_t numElems = w.GetSize();
+        ComplexMatrixArray weights = byRow ? ComplexMatrixArray(numPorts, numElems)
+                                           : ComplexMatrixArray(numElems, numPorts);
+        for (size_t portIdx = 0; portIdx < numPorts; portIdx++)
         {
-            for (size_t cIndex = 0; cIndex < numClusters; cIndex++)
+            const auto start = ant->ArrayIndexFromPortIndex(portIdx, 0);
+            for (size_t elemIdx = 0; elemIdx < ant->GetNumElemsPerPort(); elemIdx++)
             {
-                longTerm->Elem(uPortIdx, sPortIdx, cIndex) =
-                    CalculateLongTermComponent(params, sAnt, uAnt, sPortIdx, uPortIdx, cIndex);
+                const auto index = ant->ArrayIndexFromPortIndex(portIdx, elemIdx);
+                (byRow ? weights(portIdx, index) : weights(index, portIdx)) = w[index - start];
             }
         }
-    }
+        return weights;
+    };
+    const auto uWeights = getPortWeights(uAnt, uW, true);
+    const auto sWeights = getPortWeights(sAnt, sW, false);
+    auto longTerm = Create<MatrixBasedChannelModel::Complex3DVector>(
+        params->m_channel.MultiplyByLeftAndRightMatrix(uWeights, sWeights));
     return longTerm;
 }
 
@@ -205,9 +216,40 @@ ThreeGppSpectrumPropagationLossModel::CalcBeamformingGain(
     uint8_t numRxPorts,
     bool isReverse) const
 
+{
+    NS_LOG_FUNCTION(this);
+    std::function<void()> task;
+    auto rxParams = PrepareBeamformingGain(params,
+                                           longTerm,
+                                           channelMatrix,
+                                           channelParams,
+                                           sSpeed,
+                                           uSpeed,
+                                           numTxPorts,
+                                           numRxPorts,
+                                           isReverse,
+                                           task);
+    task();
+    return rxParams;
+}
+
+Ptr<SpectrumSignalParameters>
+ThreeGppSpectrumPropagationLossModel::PrepareBeamformingGain(
+    Ptr<const SpectrumSignalParameters> params,
+    Ptr<const MatrixBasedChannelModel::Complex3DVector> longTerm,
+    Ptr<const MatrixBasedChannelModel::ChannelMatrix> channelMatrix,
+    Ptr<const MatrixBasedChannelModel::ChannelParams> channelParams,
+    const Vector& sSpeed,
+    const Vector& uSpeed,
+    uint8_t numTxPorts,
+    uint8_t numRxPorts,
+    bool isReverse,
+    std::function<void()>& task) const
 {
     NS_LOG_FUNCTION(this);
     Ptr<SpectrumSignalParameters> rxParams = params->Copy();
+    // the spectrum channel matrix is set by the task, which must not release a shared object
+    rxParams->spectrumChannelMatrix = nullptr;
     size_t numCluster = channelMatrix->m_channel.GetNumPages();
     // compute the doppler term
     // NOTE the update of Doppler is simplified by only taking the center angle of
@@ -270,44 +312,55 @@ ThreeGppSpectrumPropagationLossModel::CalcBeamformingGain(
 
     NS_ASSERT(numCluster <= doppler.GetSize());
 
-    // set the channel matrix
-    rxParams->spectrumChannelMatrix = GenSpectrumChannelMatrix(rxParams->psd,
-                                                               longTerm,
-                                                               channelMatrix,
-                                                               channelParams,
-                                                               doppler,
-                                                               numTxPorts,
-                                                               numRxPorts,
-                                                               isReverse);
-
-    NS_ASSERT_MSG(rxParams->psd->GetValuesN() == rxParams->spectrumChannelMatrix->GetNumPages(),
+    auto delayDoppler = CalcDelayDopplerTerms(*rxParams->psd, *channelParams, doppler, numCluster);
+
+    // the task only accesses the objects that are specific to this reception, without
+    // copying any Ptr, so that the tasks of several receptions can be run concurrently
+    task = [rxParams,
+            longTerm,
+            delayDoppler = std::move(delayDoppler),
+            numTxPorts,
+            numRxPorts,
+            isReverse]() {
+        rxParams->spectrumChannelMatrix = CalcSpectrumChannelMatrix(*rxParams->psd,
+                                                                    *longTerm,
+                                                                    delayDoppler,
+                                                                    numTxPorts,
+                                                                    numRxPorts,
+                                                                    isReverse);
+        ApplySpectrumChannelMatrix(*rxParams);
+    };
+    return rxParams;
+}
+
+void
+ThreeGppSpectrumPropagationLossModel::ApplySpectrumChannelMatrix(SpectrumSignalParameters& rxParams)
+{
+    NS_ASSERT_MSG(rxParams.psd->GetValuesN() == rxParams.spectrumChannelMatrix->GetNumPages(),
                   "RX PSD and the spectrum channel matrix should have the same number of RBs ");
 
     // Calculate RX PSD from the spectrum channel matrix H and
     // the precoding matrix P as: PSD = (H*P)^h * (H*P)
-    Ptr<const ComplexMatrixArray> p;
-    if (!rxParams->precodingMatrix)
+    ComplexMatrixArray defaultPrecoding;
+    const ComplexMatrixArray* p = PeekPointer(rxParams.precodingMatrix);
+    if (!p)
     {
         // When the precoding matrix P is not set, we create one with a single column
         ComplexMatrixArray page =
-            ComplexMatrixArray(rxParams->spectrumChannelMatrix->GetNumCols(), 1, 1);
+            ComplexMatrixArray(rxParams.spectrumChannelMatrix->GetNumCols(), 1, 1);
         // Initialize it to the inverse square of the number of txPorts
-        page.Elem(0, 0, 0) = 1.0 / sqrt(rxParams->spectrumChannelMatrix->GetNumCols());
-        for (size_t rowI = 0; rowI < rxParams->spectrumChannelMatrix->GetNumCols(); rowI++)
+        page.Elem(0, 0, 0) = 1.0 / sqrt(rxParams.spectrumChannelMatrix->GetNumCols());
+        for (size_t rowI = 0; rowI < rxParams.spectrumChannelMatrix->GetNumCols(); rowI++)
         {
             page.Elem(rowI, 0, 0) = page.Elem(0, 0, 0);
         }
         // Replicate vector to match the number of RBGs
-        p = Create<const ComplexMatrixArray>(
-            page.MakeNCopies(rxParams->spectrumChannelMatrix->GetNumPages()));
-    }
-    else
-    {
-        p = rxParams->precodingMatrix;
+        defaultPrecoding = page.MakeNCopies(rxParams.spectrumChannelMatrix->GetNumPages());
+        p = &defaultPrecoding;
     }
     // When we have the precoding matrix P, we first do
     // H(rxPorts,txPorts,numRbs) x P(txPorts,txStreams,numRbs) = HxP(rxPorts,txStreams,numRbs)
-    MatrixBasedChannelModel::Complex3DVector hP = *rxParams->spectrumChannelMatrix * *p;
+    MatrixBasedChannelModel::Complex3DVector hP = *rxParams.spectrumChannelMatrix * *p;
 
     // Then (HxP)^h dimensions are (txStreams, rxPorts, numRbs)
     // MatrixBasedChannelModel::Complex3DVector hPHerm = hP.HermitianTranspose();
@@ -316,20 +369,21 @@ ThreeGppSpectrumPropagationLossModel::CalcBeamformingGain(
     // MatrixBasedChannelModel::Complex3DVector psd = hPHerm * hP;
 
     // And the received psd is the Trace(PSD).
-    // To avoid wasting computations, we only compute the main diagonal of hPHerm*hP
-    for (uint32_t rbIdx = 0; rbIdx < rxParams->psd->GetValuesN(); ++rbIdx)
+    // To avoid wasting computations, we only compute the main diagonal of hPHerm*hP,
+    // and only for the RBs in the span of the PSD, since the other RBs have zero power
+    auto& psd = *rxParams.psd;
+    for (auto rbIdx = psd.GetSpanBegin(); rbIdx < psd.GetSpanEnd(); ++rbIdx)
     {
-        (*rxParams->psd)[rbIdx] = 0.0;
+        psd[rbIdx] = 0.0;
         for (size_t rxPort = 0; rxPort < hP.GetNumRows(); ++rxPort)
         {
             for (size_t txStream = 0; txStream < hP.GetNumCols(); ++txStream)
             {
-                (*rxParams->psd)[rbIdx] +=
+                psd[rbIdx] +=
                     std::real(std::conj(hP(rxPort, txStream, rbIdx)) * hP(rxPort, txStream, rbIdx));
             }
         }
     }
-    return rxParams;
 }
 
 Ptr<MatrixBasedChannelModel::Complex3DVector>
@@ -344,56 +398,88 @@ ThreeGppSpectrumPropagationLossModel::GenSpectrumChannelMatrix(
     bool isReverse) const
 {
     size_t numCluster = channelMatrix->m_channel.GetNumPages();
-    auto numRb = inPsd->GetValuesN();
-
-    auto directionalLongTerm = isReverse ? longTerm->Transpose() : (*longTerm);
+    return CalcSpectrumChannelMatrix(
+        *inPsd,
+        *longTerm,
+        CalcDelayDopplerTerms(*inPsd, *channelParams, doppler, numCluster),
+        numTxPorts,
+        numRxPorts,
+        isReverse);
+}
 
-    Ptr<MatrixBasedChannelModel::Complex3DVector> chanSpct =
-        Create<MatrixBasedChannelModel::Complex3DVector>(numRxPorts, numTxPorts, (uint16_t)numRb);
+ComplexMatrixArray
+ThreeGppSpectrumPropagationLossModel::CalcDelayDopplerTerms(
+    const SpectrumValue& inPsd,
+    const MatrixBasedChannelModel::ChannelParams& channelParams,
+    const PhasedArrayModel::ComplexVector& doppler,
+    size_t numCluster)
+{
+    auto numRb = inPsd.GetValuesN();
 
     // Precompute the delay until numRb, numCluster or RB width changes
     // Whenever the channelParams is updated, the number of numRbs, numClusters
     // and RB width (12*SCS) are reset, ensuring these values are updated too
-    double rbWidth = inPsd->ConstBandsBegin()->fh - inPsd->ConstBandsBegin()->fl;
+    double rbWidth = inPsd.ConstBandsBegin()->fh - inPsd.ConstBandsBegin()->fl;
 
-    if (channelParams->m_cachedDelaySincos.GetNumRows() != numRb ||
-        channelParams->m_cachedDelaySincos.GetNumCols() != numCluster ||
-        channelParams->m_cachedRbWidth != rbWidth)
+    if (channelParams.m_cachedDelaySincos.GetNumRows() != numRb ||
+        channelParams.m_cachedDelaySincos.GetNumCols() != numCluster ||
+        channelParams.m_cachedRbWidth != rbWidth)
     {
-        channelParams->m_cachedRbWidth = rbWidth;
-        channelParams->m_cachedDelaySincos = ComplexMatrixArray(numRb, numCluster);
-        auto sbit = inPsd->ConstBandsBegin(); // band iterator
+        channelParams.m_cachedRbWidth = rbWidth;
+        channelParams.m_cachedDelaySincos = ComplexMatrixArray(numRb, numCluster);
+        auto sbit = inPsd.ConstBandsBegin(); // band iterator
         for (unsigned i = 0; i < numRb; i++)
         {
             double fsb = (*sbit).fc; // center frequency of the sub-band
             for (std::size_t cIndex = 0; cIndex < numCluster; cIndex++)
             {
-                double delay = -2 * M_PI * fsb * (channelParams->m_delay[cIndex]);
-                channelParams->m_cachedDelaySincos(i, cIndex) =
+                double delay = -2 * M_PI * fsb * (channelParams.m_delay[cIndex]);
+                channelParams.m_cachedDelaySincos(i, cIndex) =
                     std::complex<double>(cos(delay), sin(delay));
             }
             sbit++;
         }
     }
 
-    // Compute the product between the doppler and the delay sincos
-    auto delaySincosCopy = channelParams->m_cachedDelaySincos;
-    for (size_t iRb = 0; iRb < inPsd->GetValuesN(); iRb++)
+    // Compute the product between the doppler and the delay sincos. The RBs out of the
+    // span of the PSD have zero power, hence their channel is not computed
+    auto delaySincosCopy = channelParams.m_cachedDelaySincos;
+    for (size_t iRb = inPsd.GetSpanBegin(); iRb < inPsd.GetSpanEnd(); iRb++)
     {
         for (std::size_t cIndex = 0; cIndex < numCluster; cIndex++)
         {
             delaySincosCopy(iRb, cIndex) *= doppler[cIndex];
         }
     }
+    return delaySincosCopy;
+}
+
+Ptr<MatrixBasedChannelModel::Complex3DVector>
+ThreeGppSpectrumPropagationLossModel::CalcSpectrumChannelMatrix(
+    const SpectrumValue& inPsd,
+    const MatrixBasedChannelModel::Complex3DVector& longTerm,
+    const ComplexMatrixArray& delayDoppler,
+    uint8_t numTxPorts,
+    uint8_t numRxPorts,
+    bool isReverse)
+{
+    size_t numCluster = delayDoppler.GetNumCols();
+    auto numRb = inPsd.GetValuesN();
+
+    auto directionalLongTerm = isReverse ? longTerm.Transpose() : longTerm;
+
+    Ptr<MatrixBasedChannelModel::Complex3DVector> chanSpct =
+        Create<MatrixBasedChannelModel::Complex3DVector>(numRxPorts, numTxPorts, (uint16_t)numRb);
 
     // If "params" (ChannelMatrix) and longTerm were computed for the reverse direction (e.g. this
     // is a DL transmission but params and longTerm were last updated during UL), then the elements
     // in longTerm start from different offsets.
 
-    auto vit = inPsd->ValuesBegin(); // psd iterator
-    size_t iRb = 0;
+    const auto spanEnd = inPsd.GetSpanEnd();
+    auto vit = inPsd.ConstValuesBegin() + inPsd.GetSpanBegin(); // psd iterator
+    size_t iRb = inPsd.GetSpanBegin();
     // Compute the frequency-domain channel matrix
-    while (vit != inPsd->ValuesEnd())
+    while (iRb < spanEnd)
     {
         if ((*vit) != 0.00)
         {
@@ -406,7 +492,7 @@ ThreeGppSpectrumPropagationLossModel::GenSpectrumChannelMatrix(
                     for (size_t cIndex = 0; cIndex < numCluster; cIndex++)
                     {
                         subsbandGain += directionalLongTerm(rxPortIdx, txPortIdx, cIndex) *
-                                        delaySincosCopy(iRb, cIndex);
+                                        delayDoppler(iRb, cIndex);
                     }
                     // Multiply with the square root of the input PSD so that the norm (absolute
                     // value squared) of chanSpct will be the output PSD
@@ -462,10 +548,12 @@ ThreeGppSpectrumPropagationLossModel::GetLongTerm(
         NS_LOG_DEBUG("found the long term component in the map");
         longTerm = m_longTermMap[longTermId]->m_longTerm;
 
-        // check if the channel matrix has been updated
+        // check if the channel matrix has been updated (a new realization may be generated
+        // at the same time as the previous one, e.g., after a change of the antenna setup)
         // or the s beam has been changed
         // or the u beam has been changed
-        update = (m_longTermMap[longTermId]->m_channel->m_generatedTime !=
+        update = (m_longTermMap[longTermId]->m_channel != channelMatrix ||
+                  m_longTermMap[longTermId]->m_channel->m_generatedTime !=
                       channelMatrix->m_generatedTime ||
                   m_longTermMap[longTermId]->m_sW != sW || m_longTermMap[longTermId]->m_uW != uW);
     }
@@ -501,6 +589,29 @@ ThreeGppSpectrumPropagationLossModel::DoCalcRxPowerSpectralDensity(
     Ptr<const MobilityModel> b,
     Ptr<const PhasedArrayModel> aPhasedArrayModel,
     Ptr<const PhasedArrayModel> bPhasedArrayModel) const
+{
+    std::function<void()> task;
+    auto rxParams = DoPrepareRxPowerSpectralDensity(spectrumSignalParams,
+                                                    a,
+                                                    b,
+                                                    aPhasedArrayModel,
+                                                    bPhasedArrayModel,
+                                                    task);
+    if (task)
+    {
+        task();
+    }
+    return rxParams;
+}
+
+Ptr<SpectrumSignalParameters>
+ThreeGppSpectrumPropagationLossModel::DoPrepareRxPowerSpectralDensity(
+    Ptr<const SpectrumSignalParameters> spectrumSignalParams,
+    Ptr<const MobilityModel> a,
+    Ptr<const MobilityModel> b,
+    Ptr<const PhasedArrayModel> aPhasedArrayModel,
+    Ptr<const PhasedArrayModel> bPhasedArrayModel,
+    std::function<void()>& task) const
 {
     NS_LOG_FUNCTION(this << spectrumSignalParams << a << b << aPhasedArrayModel
                          << bPhasedArrayModel);
@@ -525,15 +636,16 @@ ThreeGppSpectrumPropagationLossModel::DoCalcRxPowerSpectralDensity(
         channelMatrix->IsReverse(aPhasedArrayModel->GetId(), bPhasedArrayModel->GetId());
 
     // apply the beamforming gain
-    return CalcBeamformingGain(spectrumSignalParams,
-                               longTerm,
-                               channelMatrix,
-                               channelParams,
-                               a->GetVelocity(),
-                               b->GetVelocity(),
-                               aPhasedArrayModel->GetNumPorts(),
-                               bPhasedArrayModel->GetNumPorts(),
-                               isReverse);
+    return PrepareBeamformingGain(spectrumSignalParams,
+                                  longTerm,
+                                  channelMatrix,
+                                  channelParams,
+                                  a->GetVelocity(),
+                                  b->GetVelocity(),
+                                  aPhasedArrayModel->GetNumPorts(),
+                                  bPhasedArrayModel->GetNumPorts(),
+                                  isReverse,
+                                  task);
 }
 
 int64_t
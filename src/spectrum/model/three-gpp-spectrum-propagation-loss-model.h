@@ -20,6 +20,7 @@
 #include <unordered_map>
 
 class ThreeGppCalcLongTermMultiPortTest;
+class ThreeGppCoherenceDistanceTest;
 class ThreeGppMimoPolarizationTest;
 
 namespace ns3
@@ -44,6 +45,7 @@ class NetDevice;
 class ThreeGppSpectrumPropagationLossModel : public PhasedArraySpectrumPropagationLossModel
 {
     friend class ::ThreeGppCalcLongTermMultiPortTest;
+    friend class ::ThreeGppCoherenceDistanceTest;
     friend class ::ThreeGppMimoPolarizationTest;
 
   public:
@@ -121,6 +123,27 @@ class ThreeGppSpectrumPropagationLossModel : public PhasedArraySpectrumPropagati
         Ptr<const PhasedArrayModel> aPhasedArrayModel,
         Ptr<const PhasedArrayModel> bPhasedArrayModel) const override;
 
+    /**
+     * @brief Computes the received PSD like DoCalcRxPowerSpectralDensity, except that the
+     * computation of the frequency-domain channel matrix and of the received PSD, which
+     * does not access any shared state, is returned as a task.
+     *
+     * @param spectrumSignalParams spectrum signal tx parameters
+     * @param a first node mobility model
+     * @param b second node mobility model
+     * @param aPhasedArrayModel the antenna array of the first node
+     * @param bPhasedArrayModel the antenna array of the second node
+     * @param task the task completing the computation
+     * @return the received PSD, which is only complete once the task has been run
+     */
+    Ptr<SpectrumSignalParameters> DoPrepareRxPowerSpectralDensity(
+        Ptr<const SpectrumSignalParameters> spectrumSignalParams,
+        Ptr<const MobilityModel> a,
+        Ptr<const MobilityModel> b,
+        Ptr<const PhasedArrayModel> aPhasedArrayModel,
+        Ptr<const PhasedArrayModel> bPhasedArrayModel,
+        std::function<void()>& task) const override;
+
   protected:
     /**
      * Data structure that stores the long term component for a tx-rx pair
@@ -159,6 +182,48 @@ class ThreeGppSpectrumPropagationLossModel : public PhasedArraySpectrumPropagati
         uint8_t numRxPorts,
         bool isReverse) const;
 
+    /**
+     * Computes the product between the delay and the Doppler terms of each cluster for
+     * each RB in the span of the given PSD. The delay terms are cached in the channel
+     * parameters.
+     * @param inPsd the input PSD
+     * @param channelParams the channel parameters, including delays
+     * @param doppler the doppler for each cluster
+     * @param numCluster the number of clusters
+     * @return the matrix of the delay and Doppler terms with dimensions numRBs * numCluster
+     */
+    static ComplexMatrixArray CalcDelayDopplerTerms(
+        const SpectrumValue& inPsd,
+        const MatrixBasedChannelModel::ChannelParams& channelParams,
+        const PhasedArrayModel::ComplexVector& doppler,
+        size_t numCluster);
+
+    /**
+     * Computes the frequency-domain channel matrix with the dimensions
+     * numRxPorts*numTxPorts*numRBs. This function does not access any shared state.
+     * @param inPsd the input PSD
+     * @param longTerm the long term component
+     * @param delayDoppler the delay and Doppler terms returned by CalcDelayDopplerTerms
+     * @param numTxPorts the number of antenna ports at the transmitter
+     * @param numRxPorts the number of antenna ports at the receiver
+     * @param isReverse true if params and longTerm were computed with RX->TX switched
+     * @return 3D spectrum channel matrix with dimensions numRxPorts * numTxPorts * numRBs
+     */
+    static Ptr<MatrixBasedChannelModel::Complex3DVector> CalcSpectrumChannelMatrix(
+        const SpectrumValue& inPsd,
+        const MatrixBasedChannelModel::Complex3DVector& longTerm,
+        const ComplexMatrixArray& delayDoppler,
+        uint8_t numTxPorts,
+        uint8_t numRxPorts,
+        bool isReverse);
+
+    /**
+     * Computes the received PSD from the spectrum channel matrix and the precoding
+     * matrix of the given parameters. This function does not access any shared state.
+     * @param rxParams the received signal parameters, whose PSD is updated
+     */
+    static void ApplySpectrumChannelMatrix(SpectrumSignalParameters& rxParams);
+
     /**
      * Get the operating frequency
      * @return the operating frequency in Hz
@@ -233,6 +298,34 @@ class ThreeGppSpectrumPropagationLossModel : public PhasedArraySpectrumPropagati
         uint8_t numRxPorts,
         bool isReverse) const;
 
+    /**
+     * @brief Prepares the computation of the beamforming gain (see CalcBeamformingGain).
+     * The computation of the spectrum channel matrix and of the received PSD, which does
+     * not access any shared state, is returned as a task.
+     * @param params SpectrumSignalParameters holding TX PSD
+     * @param longTerm the long term component
+     * @param channelMatrix the channel matrix structure
+     * @param channelParams the channel params structure
+     * @param sSpeed the speed of the first node
+     * @param uSpeed the speed of the second node
+     * @param numTxPorts the number of the ports of the first node
+     * @param numRxPorts the number of the porst of the second node
+     * @param isReverse indicator that tells whether the channel matrix is reverse
+     * @param task the task completing the computation
+     * @return the received signal parameters, which are only complete once the task has been run
+     */
+    Ptr<SpectrumSignalParameters> PrepareBeamformingGain(
+        Ptr<const SpectrumSignalParameters> params,
+        Ptr<const MatrixBasedChannelModel::Complex3DVector> longTerm,
+        Ptr<const MatrixBasedChannelModel::ChannelMatrix> channelMatrix,
+        Ptr<const MatrixBasedChannelModel::ChannelParams> channelParams,
+        const Vector& sSpeed,
+        const Vector& uSpeed,
+        uint8_t numTxPorts,
+        uint8_t numRxPorts,
+        bool isReverse,
+        std::function<void()>& task) const;
+
     int64_t DoAssignStreams(int64_t stream) override;
 
     mutable std::unordered_map<uint64_t, Ptr<const LongTerm>>
@@ -186,7 +186,6 @@ TraceFadingLossModel::DoCalcRxPowerSpectralDensity(Ptr<const SpectrumSignalParam
     }
 
     Ptr<SpectrumValue> rxPsd = Copy<SpectrumValue>(params->psd);
-    auto vit = rxPsd->ValuesBegin();
 
     // Vector aSpeedVector = a->GetVelocity ();
     // Vector bSpeedVector = b->GetVelocity ();
@@ -199,10 +198,10 @@ TraceFadingLossModel::DoCalcRxPowerSpectralDensity(Ptr<const SpectrumSignalParam
     int now_ms = static_cast<int>(Simulator::Now().GetMilliSeconds() * m_timeGranularity);
     int lastUpdate_ms = static_cast<int>(m_lastWindowUpdate.GetMilliSeconds() * m_timeGranularity);
     int index = ((*itOff).second + now_ms - lastUpdate_ms) % m_samplesNum;
-    int subChannel = 0;
-    while (vit != rxPsd->ValuesEnd())
-    {
+    // the values out of the span of the PSD are zero and are left unchanged
+    rxPsd->ModifySpanValues([&](std::size_t subChannel, double& value) {
         NS_ASSERT(subChannel < 100);
+        auto vit = &value;
         if (*vit != 0.)
         {
             double fading = m_fadingTrace.at(subChannel).at(index);
@@ -217,10 +216,7 @@ TraceFadingLossModel::DoCalcRxPowerSpectralDensity(Ptr<const SpectrumSignalParam
 
             NS_LOG_LOGIC(this << subChannel << *vit);
         }
-
-        ++vit;
-        ++subChannel;
-    }
+    });
 
     NS_LOG_LOGIC(this << *rxPsd);
     return rxPsd;
@@ -0,0 +1,225 @@
+/*
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+#include "ns3/constant-position-mobility-model.h"
+#include "ns3/double.h"
+#include "ns3/multi-model-spectrum-channel.h"
+#include "ns3/net-device.h"
+#include "ns3/simulator.h"
+#include "ns3/spectrum-model-ism2400MHz-res1MHz.h"
+#include "ns3/spectrum-phy.h"
+#include "ns3/spectrum-signal-parameters.h"
+#include "ns3/spectrum-value.h"
+#include "ns3/test.h"
+
+#include <vector>
+
+using namespace ns3;
+
+/**
+ * @ingroup spectrum-tests
+ *
+ * @brief SpectrumPhy logging the signals it receives
+ */
+class CullingTestSpectrumPhy : public SpectrumPhy
+{
+  public:
+    /**
+     * Set the identifier of the PHY and the log of the receptions
+     * @param id the identifier of the PHY
+     * @param log the log of the receptions, shared by all the PHYs
+     */
+    void Setup(uint32_t id, std::vector<uint32_t>* log)
+    {
+        m_id = id;
+        m_log = log;
+    }
+
+    /**
+     * @param model the RX spectrum model
+     */
+    void SetRxSpectrumModel(Ptr<const SpectrumModel> model)
+    {
+        m_rxSpectrumModel = model;
+    }
+
+    void SetDevice(Ptr<NetDevice> d) override
+    {
+    }
+
+    Ptr<NetDevice> GetDevice() const override
+    {
+        return nullptr;
+    }
+
+    void SetMobility(Ptr<MobilityModel> m) override
+    {
+        m_mobility = m;
+    }
+
+    Ptr<MobilityModel> GetMobility() const override
+    {
+        return m_mobility;
+    }
+
+    void SetChannel(Ptr<SpectrumChannel> c) override
+    {
+    }
+
+    Ptr<const SpectrumModel> GetRxSpectrumModel() const override
+    {
+        return m_rxSpectrumModel;
+    }
+
+    Ptr<Object> GetAntenna() const override
+    {
+        return nullptr;
+    }
+
+    void StartRx(Ptr<SpectrumSignalParameters> params) override
+    {
+        m_log->push_back(m_id);
+    }
+
+  private:
+    uint32_t m_id{0};                           //!< identifier of the PHY
+    std::vector<uint32_t>* m_log{nullptr};      //!< log of the receptions
+    Ptr<MobilityModel> m_mobility;              //!< mobility model
+    Ptr<const SpectrumModel> m_rxSpectrumModel; //!< RX spectrum model
+};
+
+/**
+ * @ingroup spectrum-tests
+ *
+ * @brief MultiModelSpectrumChannel receiver culling test
+ *
+ * Receivers using two different spectrum models are placed on a line, and
+ * the receptions of a signal are logged with and without receiver culling.
+ * With culling, only the receivers within range (and the receivers without
+ * mobility model) must receive the signal, in the same order as without
+ * culling.
+ */
+class SpectrumReceiverCullingTestCase : public TestCase
+{
+  public:
+    SpectrumReceiverCullingTestCase();
+
+  private:
+    void DoRun() override;
+
+    /**
+     * Transmit a signal from the first PHY and log the receptions.
+     * @param range the receiver culling range (m), 0 to disable culling
+     * @param movedPosition the position of PHY 15 during the transmission
+     * @return the identifiers of the receivers, in order of reception
+     */
+    std::vector<uint32_t> Transmit(double range, Vector movedPosition);
+};
+
+SpectrumReceiverCullingTestCase::SpectrumReceiverCullingTestCase()
+    : TestCase("Check that receiver culling only skips the receivers out of range")
+{
+}
+
+std::vector<uint32_t>
+SpectrumReceiverCullingTestCase::Transmit(double range, Vector movedPosition)
+{
+    std::vector<uint32_t> log;
+    auto channel = CreateObjectWithAttributes<MultiModelSpectrumChannel>("ReceiverCullingRange",
+                                                                         DoubleValue(range));
+    // receivers are processed by spectrum model UID: make sure that the order of the
+    // UIDs is the same in all the runs
+    auto ismModel = SpectrumModelIsm2400MhzRes1Mhz();
+    std::vector<double> centerFreqs{2405e6, 2415e6};
+    auto otherModel = Create<SpectrumModel>(centerFreqs);
+
+    std::vector<Ptr<CullingTestSpectrumPhy>> phys;
+    std::vector<Ptr<MobilityModel>> mobilities;
+    for (uint32_t i = 0; i < 21; i++)
+    {
+        auto phy = CreateObject<CullingTestSpectrumPhy>();
+        phy->Setup(i, &log);
+        phy->SetRxSpectrumModel(i % 3 == 0 ? otherModel : ismModel);
+        // the last PHY has no mobility model
+        if (i < 20)
+        {
+            auto mobility = CreateObject<ConstantPositionMobilityModel>();
+            mobility->SetPosition(Vector(10.0 * i, (i % 2) * 3.0, 0));
+            phy->SetMobility(mobility);
+            mobilities.push_back(mobility);
+        }
+        channel->AddRx(phy);
+        phys.push_back(phy);
+    }
+
+    auto txParams = Create<SpectrumSignalParameters>();
+    txParams->txPhy = phys[0];
+    txParams->duration = MicroSeconds(100);
+    txParams->psd = Create<SpectrumValue>(ismModel);
+    *txParams->psd = 1e-9;
+
+    channel->StartTx(txParams);
+    Simulator::Run();
+
+    // the receivers are indexed upon the first transmission, then followed
+    mobilities[15]->SetPosition(movedPosition);
+    channel->StartTx(txParams);
+    Simulator::Run();
+
+    channel->Dispose();
+    Simulator::Destroy();
+    return log;
+}
+
+void
+SpectrumReceiverCullingTestCase::DoRun()
+{
+    const double range = 55;
+    const Vector moved(30, 1, 0);
+    const auto all = Transmit(0, moved);
+    NS_TEST_ASSERT_MSG_EQ(all.size(), 2 * 20, "Unexpected number of receptions without culling");
+
+    // the expected receptions: the first transmission, then the second one
+    std::vector<uint32_t> expected;
+    for (std::size_t i = 0; i < all.size(); i++)
+    {
+        const auto id = all[i];
+        Vector position(10.0 * id, (id % 2) * 3.0, 0);
+        if (id == 15 && i >= 20)
+        {
+            position = moved;
+        }
+        if (id == 20 || CalculateDistance(position, Vector()) <= range)
+        {
+            expected.push_back(id);
+        }
+    }
+
+    const auto culled = Transmit(range, moved);
+    NS_TEST_ASSERT_MSG_EQ(culled.size(), expected.size(), "Unexpected number of receptions");
+    for (std::size_t i = 0; i < culled.size(); i++)
+    {
+        NS_TEST_EXPECT_MSG_EQ(culled[i], expected[i], "Unexpected receiver at position " << i);
+    }
+}
+
+/**
+ * @ingroup spectrum-tests
+ *
+ * @brief MultiModelSpectrumChannel receiver culling TestSuite
+ */
+class SpectrumReceiverCullingTestSuite : public TestSuite
+{
+  public:
+    SpectrumReceiverCullingTestSuite();
+};
+
+SpectrumReceiverCullingTestSuite::SpectrumReceiverCullingTestSuite()
+    : TestSuite("spectrum-receiver-culling", Type::UNIT)
+{
+    AddTestCase(new SpectrumReceiverCullingTestCase, TestCase::Duration::QUICK);
+}
+
+/// Static variable for test initialization
+static SpectrumReceiverCullingTestSuite g_spectrumReceiverCullingTestSuite;
@@ -8,9 +8,12 @@
 
 #include "spectrum-test.h"
 
+#include "ns3/constant-position-mobility-model.h"
+#include "ns3/friis-spectrum-propagation-loss.h"
 #include "ns3/log.h"
 #include "ns3/object.h"
 #include "ns3/spectrum-converter.h"
+#include "ns3/spectrum-signal-parameters.h"
 #include "ns3/spectrum-value.h"
 #include "ns3/test.h"
 
@@ -82,6 +85,184 @@ SpectrumValueTestCase::DoRun()
     NS_TEST_ASSERT_MSG_SPECTRUM_VALUE_EQ_TOL(m_a, m_b, TOLERANCE, "");
 }
 
+/**
+ * @ingroup spectrum-tests
+ *
+ * @brief Test the span of the non-zero values of a SpectrumValue
+ *
+ * Band-limited SpectrumValues are processed by the arithmetic operations, by the
+ * SpectrumConverter and by a propagation loss model, and the results are compared
+ * with those obtained for the same values whose span covers all the bands.
+ */
+class SpectrumValueSpanTestCase : public TestCase
+{
+  public:
+    SpectrumValueSpanTestCase();
+
+  private:
+    void DoRun() override;
+
+    /**
+     * Check the span of a SpectrumValue
+     * @param v the SpectrumValue
+     * @param begin the expected first band of the span
+     * @param end the expected end of the span
+     * @param name the name of the SpectrumValue
+     */
+    void CheckSpan(const SpectrumValue& v, std::size_t begin, std::size_t end, std::string name);
+
+    /**
+     * @param v a SpectrumValue
+     * @return a copy of the given SpectrumValue whose span covers all the bands
+     */
+    static SpectrumValue GetDense(SpectrumValue v);
+};
+
+SpectrumValueSpanTestCase::SpectrumValueSpanTestCase()
+    : TestCase("Check the span of the non-zero values of band-limited SpectrumValues")
+{
+}
+
+void
+SpectrumValueSpanTestCase::CheckSpan(const SpectrumValue& v,
+                                     std::size_t begin,
+                                     std::size_t end,
+                                     std::string name)
+{
+    NS_TEST_EXPECT_MSG_EQ(v.GetSpanBegin(), begin, "Unexpected span begin for " << name);
+    NS_TEST_EXPECT_MSG_EQ(v.GetSpanEnd(), end, "Unexpected span end for " << name);
+}
+
+SpectrumValue
+SpectrumValueSpanTestCase::GetDense(SpectrumValue v)
+{
+    v.ValuesBegin();
+    return v;
+}
+
+void
+SpectrumValueSpanTestCase::DoRun()
+{
+    std::vector<double> freqs;
+    for (int i = 0; i < 100; i++)
+    {
+        freqs.push_back(5e9 + i * 1e6);
+    }
+    Ptr<SpectrumModel> model = Create<SpectrumModel>(freqs);
+
+    SpectrumValue a(model);
+    CheckSpan(a, 0, 0, "new value");
+    for (std::size_t i = 10; i < 20; i++)
+    {
+        a[i] = 1e-9 * i;
+    }
+    // the span is only shrunk on demand
+    CheckSpan(a, 0, 100, "a");
+    a.TrimSpan();
+    CheckSpan(a, 10, 20, "trimmed a");
+    SpectrumValue b(model);
+    for (std::size_t i = 50; i < 60; i++)
+    {
+        b[i] = 1e-10 * i;
+    }
+    b.TrimSpan();
+    CheckSpan(b, 50, 60, "trimmed b");
+    const auto denseA = GetDense(a);
+    const auto denseB = GetDense(b);
+    CheckSpan(denseA, 0, 100, "dense a");
+
+    NS_TEST_EXPECT_MSG_EQ(Integral(a), Integral(denseA), "Unexpected integral");
+    NS_TEST_EXPECT_MSG_EQ(Sum(a), Sum(denseA), "Unexpected sum");
+    NS_TEST_EXPECT_MSG_EQ(Norm(a), Norm(denseA), "Unexpected norm");
+
+    // the span of a sum covers the spans of the operands
+    auto sum = a + b;
+    CheckSpan(sum, 10, 60, "a + b");
+    NS_TEST_EXPECT_MSG_EQ((sum == denseA + denseB), true, "Unexpected a + b");
+    sum -= a;
+    CheckSpan(sum, 10, 60, "a + b - a");
+    NS_TEST_EXPECT_MSG_EQ((sum == denseA + denseB - denseA), true, "Unexpected a + b - a");
+    sum.TrimSpan();
+    CheckSpan(sum, 50, 60, "trimmed a + b - a");
+    NS_TEST_EXPECT_MSG_EQ((sum == denseB), true, "Unexpected trimmed a + b - a");
+
+    auto diff = b;
+    diff.AddDifference(a, b);
+    CheckSpan(diff, 10, 60, "b + (a - b)");
+    NS_TEST_EXPECT_MSG_EQ((diff == denseA), true, "Unexpected b + (a - b)");
+
+    auto scaled = a;
+    scaled.AddScaled(b, 2);
+    CheckSpan(scaled, 10, 60, "a + b * 2");
+    NS_TEST_EXPECT_MSG_EQ((scaled == denseA + denseB * 2), true, "Unexpected a + b * 2");
+
+    // multiplying by a (finite) flat value does not change the span, unlike adding it
+    CheckSpan(a * 3, 10, 20, "a * 3");
+    NS_TEST_EXPECT_MSG_EQ((a * 3 == denseA * 3), true, "Unexpected a * 3");
+    CheckSpan(a / 3, 10, 20, "a / 3");
+    NS_TEST_EXPECT_MSG_EQ((a / 3 == denseA / 3), true, "Unexpected a / 3");
+    CheckSpan(-a, 10, 20, "-a");
+    CheckSpan(a + 1, 0, 100, "a + 1");
+    NS_TEST_EXPECT_MSG_EQ((a + 1 == denseA + 1), true, "Unexpected a + 1");
+    CheckSpan(a * a, 10, 20, "a * a");
+    NS_TEST_EXPECT_MSG_EQ((a * b == denseA * denseB), true, "Unexpected a * b");
+    CheckSpan(a / (b + 1), 0, 100, "a / (b + 1)");
+    NS_TEST_EXPECT_MSG_EQ((a / (b + 1) == denseA / (denseB + 1)), true, "Unexpected a / (b + 1)");
+
+    auto zero = a;
+    zero = 0;
+    CheckSpan(zero, 0, 100, "a = 0");
+    zero.TrimSpan();
+    CheckSpan(zero, 0, 0, "trimmed a = 0");
+
+    // assignments extend the span, but never shrink it
+    auto assigned = a;
+    assigned = b;
+    CheckSpan(assigned, 10, 60, "a = b");
+    NS_TEST_EXPECT_MSG_EQ((assigned == denseB), true, "Unexpected a = b");
+    assigned = denseA;
+    assigned = b;
+    CheckSpan(assigned, 0, 100, "dense a = b");
+    NS_TEST_EXPECT_MSG_EQ((assigned == denseB), true, "Unexpected dense a = b");
+
+    // modifying the values in the span does not extend it
+    auto modified = a;
+    modified.ModifySpanValues([](std::size_t, double& value) { value *= 2; });
+    CheckSpan(modified, 10, 20, "a modified in its span");
+    NS_TEST_EXPECT_MSG_EQ((modified == denseA * 2), true, "Unexpected a modified in its span");
+
+    // conversion to a model whose bands are five times wider
+    std::vector<double> coarseFreqs;
+    for (int i = 0; i < 20; i++)
+    {
+        coarseFreqs.push_back(5e9 + 2e6 + i * 5e6);
+    }
+    Ptr<SpectrumModel> coarseModel = Create<SpectrumModel>(coarseFreqs);
+    SpectrumConverter converter(model, coarseModel);
+    auto converted = converter.Convert(Create<SpectrumValue>(a));
+    CheckSpan(*converted, 2, 4, "converted a");
+    NS_TEST_EXPECT_MSG_EQ((*converted == *converter.Convert(Create<SpectrumValue>(denseA))),
+                          true,
+                          "Unexpected converted a");
+    CheckSpan(*converter.Convert(Create<SpectrumValue>(model)), 0, 0, "converted zero");
+
+    // propagation loss
+    auto params = Create<SpectrumSignalParameters>();
+    params->psd = Create<SpectrumValue>(a);
+    auto txMobility = CreateObject<ConstantPositionMobilityModel>();
+    auto rxMobility = CreateObject<ConstantPositionMobilityModel>();
+    rxMobility->SetPosition(Vector(10, 0, 0));
+    auto loss = CreateObject<FriisSpectrumPropagationLossModel>();
+    auto rxPsd = loss->CalcRxPowerSpectralDensity(params, txMobility, rxMobility);
+    CheckSpan(*rxPsd, 10, 20, "received a");
+    params->psd = Create<SpectrumValue>(denseA);
+    NS_TEST_EXPECT_MSG_EQ((*rxPsd == *loss->CalcRxPowerSpectralDensity(params,
+                                                                       txMobility,
+                                                                       rxMobility)),
+                          true,
+                          "Unexpected received a");
+}
+
 /**
  * @ingroup spectrum-tests
  *
@@ -265,6 +446,71 @@ SpectrumValueTestSuite::SpectrumValueTestSuite()
     tv1rs3 = v1 >> 3;
     AddTestCase(new SpectrumValueTestCase(tv1rs3, v1rs3, "tv1rs3 = v1 >> 3"),
                 TestCase::Duration::QUICK);
+
+    // fused operations and operations on temporaries, with enough bands to use both the
+    // vectorized kernels (if enabled) and the scalar code for the remaining bands
+    std::vector<double> moreFreqs;
+    for (int i = 1; i <= 37; i++)
+    {
+        moreFreqs.push_back(i);
+    }
+    Ptr<SpectrumModel> g = Create<SpectrumModel>(moreFreqs);
+
+    SpectrumValue x(g);
+    SpectrumValue y(g);
+    SpectrumValue z(g);
+    SpectrumValue diff(g);
+    SpectrumValue scaled(g);
+    SpectrumValue ratio(g);
+    SpectrumValue sinr(g);
+    SpectrumValue revDiff(g);
+    SpectrumValue revRatio(g);
+    SpectrumValue chain(g);
+    for (std::size_t i = 0; i < moreFreqs.size(); i++)
+    {
+        x[i] = 1.0 + 0.5 * i;
+        y[i] = 0.25 * i - 3.0;
+        z[i] = 2.0 + 0.01 * i * i;
+        diff[i] = z[i] + x[i] - y[i];
+        scaled[i] = z[i] + x[i] * doubleValue;
+        ratio[i] = x[i] / z[i];
+        sinr[i] = x[i] / (y[i] - x[i] + z[i]);
+        revDiff[i] = x[i] - y[i] * z[i];
+        revRatio[i] = x[i] / (y[i] + z[i]);
+        chain[i] = (y[i] + z[i]) * (x[i] - y[i]) + x[i] * z[i];
+    }
+
+    SpectrumValue tdiff = z;
+    tdiff.AddDifference(x, y);
+    AddTestCase(new SpectrumValueTestCase(tdiff, diff, "tdiff = z + (x - y)"),
+                TestCase::Duration::QUICK);
+
+    SpectrumValue tscaled = z;
+    tscaled.AddScaled(x, doubleValue);
+    AddTestCase(new SpectrumValueTestCase(tscaled, scaled, "tscaled = z + x * doubleValue"),
+                TestCase::Duration::QUICK);
+
+    SpectrumValue tratio;
+    tratio.AssignRatio(x, z);
+    AddTestCase(new SpectrumValueTestCase(tratio, ratio, "tratio = x div z"),
+                TestCase::Duration::QUICK);
+
+    SpectrumValue tsinr = z;
+    tsinr.AddDifference(y, x);
+    tsinr.AssignRatio(x, tsinr);
+    AddTestCase(new SpectrumValueTestCase(tsinr, sinr, "tsinr = x div (y - x + z) in place"),
+                TestCase::Duration::QUICK);
+    AddTestCase(new SpectrumValueTestCase(x / (y - x + z), sinr, "x div (y - x + z)"),
+                TestCase::Duration::QUICK);
+    AddTestCase(new SpectrumValueTestCase(x - y * z, revDiff, "x - (y * z)"),
+                TestCase::Duration::QUICK);
+    AddTestCase(new SpectrumValueTestCase(x / (y + z), revRatio, "x div (y + z)"),
+                TestCase::Duration::QUICK);
+    AddTestCase(new SpectrumValueTestCase((y + z) * (x - y) + x * z,
+                                          chain,
+                                          "(y + z) * (x - y) + x * z"),
+                TestCase::Duration::QUICK);
+    AddTestCase(new SpectrumValueSpanTestCase(), TestCase::Duration::QUICK);
 }
 
 /**
@@ -9,15 +9,20 @@
 #include "ns3/channel-condition-model.h"
 #include "ns3/config.h"
 #include "ns3/constant-position-mobility-model.h"
+#include "ns3/constant-velocity-mobility-model.h"
 #include "ns3/double.h"
 #include "ns3/ism-spectrum-value-helper.h"
 #include "ns3/isotropic-antenna-model.h"
 #include "ns3/log.h"
+#include "ns3/multi-model-spectrum-channel.h"
 #include "ns3/node-container.h"
 #include "ns3/pointer.h"
+#include "ns3/propagation-delay-model.h"
 #include "ns3/rng-seed-manager.h"
 #include "ns3/simple-net-device.h"
 #include "ns3/simulator.h"
+#include "ns3/spectrum-model-ism2400MHz-res1MHz.h"
+#include "ns3/spectrum-phy.h"
 #include "ns3/spectrum-signal-parameters.h"
 #include "ns3/string.h"
 #include "ns3/test.h"
@@ -27,6 +32,7 @@
 #include "ns3/uinteger.h"
 #include "ns3/uniform-planar-array.h"
 
+#include <complex>
 #include <valarray>
 
 using namespace ns3;
@@ -1450,6 +1456,549 @@ ThreeGppMimoPolarizationTest::DoRun()
     Simulator::Destroy();
 }
 
+/**
+ * @ingroup spectrum-tests
+ *
+ * @brief SpectrumPhy equipped with a phased array, storing the PSDs it receives
+ */
+class ThreeGppTestSpectrumPhy : public SpectrumPhy
+{
+  public:
+    /**
+     * Constructor
+     * @param antenna the phased array of the PHY
+     * @param mobility the mobility model of the PHY
+     * @param rxPsds where to store the received PSDs, shared by all the PHYs
+     */
+    ThreeGppTestSpectrumPhy(Ptr<PhasedArrayModel> antenna,
+                            Ptr<MobilityModel> mobility,
+                            std::vector<SpectrumValue>* rxPsds)
+        : m_antenna(antenna),
+          m_mobility(mobility),
+          m_rxPsds(rxPsds)
+    {
+    }
+
+    void SetDevice(Ptr<NetDevice> d) override
+    {
+    }
+
+    Ptr<NetDevice> GetDevice() const override
+    {
+        return nullptr;
+    }
+
+    void SetMobility(Ptr<MobilityModel> m) override
+    {
+        m_mobility = m;
+    }
+
+    Ptr<MobilityModel> GetMobility() const override
+    {
+        return m_mobility;
+    }
+
+    void SetChannel(Ptr<SpectrumChannel> c) override
+    {
+    }
+
+    Ptr<const SpectrumModel> GetRxSpectrumModel() const override
+    {
+        return SpectrumModelIsm2400MhzRes1Mhz();
+    }
+
+    Ptr<Object> GetAntenna() const override
+    {
+        return m_antenna;
+    }
+
+    void StartRx(Ptr<SpectrumSignalParameters> params) override
+    {
+        m_rxPsds->push_back(*params->psd);
+    }
+
+  private:
+    Ptr<PhasedArrayModel> m_antenna;      //!< the phased array
+    Ptr<MobilityModel> m_mobility;        //!< the mobility model
+    std::vector<SpectrumValue>* m_rxPsds; //!< the received PSDs
+};
+
+/**
+ * @ingroup spectrum-tests
+ *
+ * Test case checking that the signals delivered by a MultiModelSpectrumChannel
+ * using the ThreeGppSpectrumPropagationLossModel do not depend on the number of
+ * threads computing the receptions (RxComputationThreads attribute), including
+ * zero, i.e., when the losses are computed after the propagation delay. The check
+ * is made with static nodes and no propagation delay model, and with moving nodes
+ * and a propagation delay model, where the Doppler effect depends on the time at
+ * which the losses are computed.
+ */
+class ThreeGppParallelRxComputationTest : public TestCase
+{
+  public:
+    /**
+     * Constructor
+     */
+    ThreeGppParallelRxComputationTest();
+
+  private:
+    void DoRun() override;
+
+    /**
+     * Transmit two signals to a set of receivers and store the received PSDs
+     * @param nThreads the number of threads computing the receptions
+     * @param moving whether the nodes move and a propagation delay model is used
+     * @return the received PSDs, in order of reception
+     */
+    std::vector<SpectrumValue> Transmit(uint32_t nThreads, bool moving);
+};
+
+ThreeGppParallelRxComputationTest::ThreeGppParallelRxComputationTest()
+    : TestCase("Check that the receptions computed by multiple threads are deterministic")
+{
+}
+
+std::vector<SpectrumValue>
+ThreeGppParallelRxComputationTest::Transmit(uint32_t nThreads, bool moving)
+{
+    RngSeedManager::SetSeed(1);
+    RngSeedManager::SetRun(1);
+
+    auto channelModel = CreateObject<ThreeGppChannelModel>();
+    channelModel->SetAttribute("Frequency", DoubleValue(2.4e9));
+    channelModel->SetAttribute("Scenario", StringValue("UMa"));
+    channelModel->SetAttribute("ChannelConditionModel",
+                               PointerValue(CreateObject<AlwaysLosChannelConditionModel>()));
+    channelModel->AssignStreams(1);
+    auto lossModel = CreateObject<ThreeGppSpectrumPropagationLossModel>();
+    lossModel->SetChannelModel(channelModel);
+
+    auto channel = CreateObjectWithAttributes<MultiModelSpectrumChannel>("RxComputationThreads",
+                                                                         UintegerValue(nThreads));
+    channel->AddPhasedArraySpectrumPropagationLossModel(lossModel);
+    if (moving)
+    {
+        channel->SetPropagationDelayModel(CreateObject<ConstantSpeedPropagationDelayModel>());
+    }
+
+    std::vector<SpectrumValue> rxPsds;
+    std::vector<Ptr<SpectrumPhy>> phys;
+    NodeContainer nodes;
+    nodes.Create(6);
+    for (uint32_t i = 0; i < nodes.GetN(); i++)
+    {
+        Ptr<MobilityModel> mobility;
+        if (moving)
+        {
+            auto velocityMobility = CreateObject<ConstantVelocityMobilityModel>();
+            velocityMobility->SetPosition(Vector(20.0 * i, 5.0 * (i % 2), 10.0));
+            velocityMobility->SetVelocity(Vector(30.0, -10.0 * i, 0.0));
+            mobility = velocityMobility;
+        }
+        else
+        {
+            mobility = CreateObject<ConstantPositionMobilityModel>();
+            mobility->SetPosition(Vector(20.0 * i, 5.0 * (i % 2), 10.0));
+        }
+        nodes.Get(i)->AggregateObject(mobility);
+        auto antenna = CreateObjectWithAttributes<UniformPlanarArray>(
+            "NumColumns",
+            UintegerValue(2),
+            "NumRows",
+            UintegerValue(2),
+            "AntennaElement",
+            PointerValue(CreateObject<IsotropicAntennaModel>()));
+        antenna->SetBeamformingVector(antenna->GetBeamformingVector(Angles(0.0, M_PI / 2)));
+        auto phy = Create<ThreeGppTestSpectrumPhy>(antenna, mobility, &rxPsds);
+        channel->AddRx(phy);
+        phys.push_back(phy);
+    }
+
+    for (uint32_t i = 0; i < 2; i++)
+    {
+        auto txParams = Create<SpectrumSignalParameters>();
+        txParams->txPhy = phys[i];
+        txParams->duration = MicroSeconds(100);
+        txParams->psd = Create<SpectrumValue>(SpectrumModelIsm2400MhzRes1Mhz());
+        for (uint32_t band = 10; band < 30; band++)
+        {
+            (*txParams->psd)[band] = 1e-9;
+        }
+        Simulator::Schedule(MilliSeconds(i), &SpectrumChannel::StartTx, channel, txParams);
+    }
+    Simulator::Run();
+
+    channel->Dispose();
+    Simulator::Destroy();
+    return rxPsds;
+}
+
+void
+ThreeGppParallelRxComputationTest::DoRun()
+{
+    for (bool moving : {false, true})
+    {
+        const auto expected = Transmit(0, moving);
+        NS_TEST_ASSERT_MSG_EQ(expected.size(), 2 * 5, "Unexpected number of receptions");
+        for (uint32_t nThreads : {1, 4})
+        {
+            const auto rxPsds = Transmit(nThreads, moving);
+            NS_TEST_ASSERT_MSG_EQ(rxPsds.size(),
+                                  expected.size(),
+                                  "Unexpected number of receptions with " << nThreads
+                                                                          << " threads");
+            for (std::size_t i = 0; i < rxPsds.size(); i++)
+            {
+                NS_TEST_ASSERT_MSG_EQ((rxPsds[i] == expected[i]),
+                                      true,
+                                      "Reception " << i << " differs with " << nThreads
+                                                   << " threads (moving nodes: " << moving
+                                                   << ")");
+            }
+        }
+    }
+}
+
+/**
+ * @ingroup spectrum-tests
+ *
+ * Test case for the ThreeGppChannelModel class.
+ * It checks that, when the CoherenceDistance attribute is set, the channel parameters
+ * and matrix are kept after the expiration of the update period as long as the nodes
+ * moved less than the coherence distance and the channel condition does not change,
+ * and that the long term component is recomputed whenever a new channel matrix is
+ * generated.
+ */
+class ThreeGppCoherenceDistanceTest : public TestCase
+{
+  public:
+    /**
+     * Constructor
+     */
+    ThreeGppCoherenceDistanceTest();
+
+  private:
+    /**
+     * Build the test scenario
+     */
+    void DoRun() override;
+
+    /**
+     * Move the second node and check whether the channel matrix and the long term
+     * component are updated
+     * @param displacement the displacement of the second node along the x-axis
+     * @param update whether the channel matrix should be updated
+     */
+    void MoveAndCheck(double displacement, bool update);
+
+    Ptr<ThreeGppChannelModel> m_channelModel;                       //!< the channel model
+    Ptr<ThreeGppSpectrumPropagationLossModel> m_lossModel;          //!< the spectrum loss model
+    Ptr<MobilityModel> m_txMob;                                     //!< the tx mobility model
+    Ptr<MobilityModel> m_rxMob;                                     //!< the rx mobility model
+    Ptr<PhasedArrayModel> m_txAntenna;                              //!< the tx antenna array
+    Ptr<PhasedArrayModel> m_rxAntenna;                              //!< the rx antenna array
+    Ptr<const MatrixBasedChannelModel::ChannelMatrix> m_channel;    //!< the current channel
+    Ptr<const MatrixBasedChannelModel::Complex3DVector> m_longTerm; //!< the current long term
+};
+
+ThreeGppCoherenceDistanceTest::ThreeGppCoherenceDistanceTest()
+    : TestCase("Check that the channel is kept within the coherence distance")
+{
+}
+
+void
+ThreeGppCoherenceDistanceTest::MoveAndCheck(double displacement, bool update)
+{
+    auto position = m_rxMob->GetPosition();
+    position.x += displacement;
+    m_rxMob->SetPosition(position);
+
+    auto channel = m_channelModel->GetChannel(m_txMob, m_rxMob, m_txAntenna, m_rxAntenna);
+    auto longTerm = m_lossModel->GetLongTerm(channel, m_txAntenna, m_rxAntenna);
+    if (m_channel)
+    {
+        NS_TEST_ASSERT_MSG_EQ((channel != m_channel),
+                              update,
+                              Simulator::Now().As(Time::MS)
+                                  << ": the channel matrix is not correctly updated");
+        NS_TEST_ASSERT_MSG_EQ((longTerm != m_longTerm),
+                              update,
+                              Simulator::Now().As(Time::MS)
+                                  << ": the long term component is not correctly updated");
+    }
+    m_channel = channel;
+    m_longTerm = longTerm;
+}
+
+void
+ThreeGppCoherenceDistanceTest::DoRun()
+{
+    m_channelModel = CreateObject<ThreeGppChannelModel>();
+    m_channelModel->SetAttribute("Frequency", DoubleValue(3.5e9));
+    m_channelModel->SetAttribute("Scenario", StringValue("UMa"));
+    m_channelModel->SetAttribute("ChannelConditionModel",
+                                 PointerValue(CreateObject<AlwaysLosChannelConditionModel>()));
+    m_channelModel->SetAttribute("UpdatePeriod", TimeValue(MilliSeconds(10)));
+    m_channelModel->SetAttribute("CoherenceDistance", DoubleValue(5.0));
+    m_lossModel = CreateObject<ThreeGppSpectrumPropagationLossModel>();
+    m_lossModel->SetChannelModel(m_channelModel);
+
+    NodeContainer nodes;
+    nodes.Create(2);
+    m_txMob = CreateObject<ConstantPositionMobilityModel>();
+    m_txMob->SetPosition(Vector(0.0, 0.0, 10.0));
+    m_rxMob = CreateObject<ConstantPositionMobilityModel>();
+    m_rxMob->SetPosition(Vector(100.0, 0.0, 1.6));
+    nodes.Get(0)->AggregateObject(m_txMob);
+    nodes.Get(1)->AggregateObject(m_rxMob);
+
+    m_txAntenna = CreateObjectWithAttributes<UniformPlanarArray>(
+        "NumColumns",
+        UintegerValue(2),
+        "NumRows",
+        UintegerValue(2),
+        "AntennaElement",
+        PointerValue(CreateObject<IsotropicAntennaModel>()));
+    m_rxAntenna = CreateObjectWithAttributes<UniformPlanarArray>(
+        "NumColumns",
+        UintegerValue(2),
+        "NumRows",
+        UintegerValue(2),
+        "AntennaElement",
+        PointerValue(CreateObject<IsotropicAntennaModel>()));
+    m_txAntenna->SetBeamformingVector(m_txAntenna->GetBeamformingVector(Angles(0.0, M_PI / 2)));
+    m_rxAntenna->SetBeamformingVector(m_rxAntenna->GetBeamformingVector(Angles(M_PI, M_PI / 2)));
+
+    // generate the channel
+    Simulator::Schedule(MilliSeconds(1),
+                        &ThreeGppCoherenceDistanceTest::MoveAndCheck,
+                        this,
+                        0.0,
+                        true);
+    // the beamforming vectors were set before the channel generation, hence the antenna
+    // setup is still flagged as changed and the channel is regenerated
+    Simulator::Schedule(MilliSeconds(2),
+                        &ThreeGppCoherenceDistanceTest::MoveAndCheck,
+                        this,
+                        0.0,
+                        true);
+    // the update period expired, but the node moved less than the coherence distance
+    Simulator::Schedule(MilliSeconds(20),
+                        &ThreeGppCoherenceDistanceTest::MoveAndCheck,
+                        this,
+                        2.0,
+                        false);
+    // the node moved more than the coherence distance since the channel generation
+    Simulator::Schedule(MilliSeconds(40),
+                        &ThreeGppCoherenceDistanceTest::MoveAndCheck,
+                        this,
+                        4.0,
+                        true);
+    // a change of the antenna setup regenerates the channel at the same time instant
+    Simulator::Schedule(MilliSeconds(41), [this]() {
+        m_txAntenna->SetAttribute("BearingAngle", DoubleValue(0.1));
+    });
+    Simulator::Schedule(MilliSeconds(41),
+                        &ThreeGppCoherenceDistanceTest::MoveAndCheck,
+                        this,
+                        0.0,
+                        true);
+    // the update period expired and the coherence distance is disabled
+    Simulator::Schedule(MilliSeconds(55), [this]() {
+        m_channelModel->SetAttribute("CoherenceDistance", DoubleValue(0.0));
+    });
+    Simulator::Schedule(MilliSeconds(55),
+                        &ThreeGppCoherenceDistanceTest::MoveAndCheck,
+                        this,
+                        0.0,
+                        true);
+    // the update period expired and the node moved less than the coherence distance, but
+    // the channel condition changed
+    Simulator::Schedule(MilliSeconds(70), [this]() {
+        m_channelModel->SetAttribute("CoherenceDistance", DoubleValue(5.0));
+        m_channelModel->SetAttribute("ChannelConditionModel",
+                                     PointerValue(CreateObject<NeverLosChannelConditionModel>()));
+    });
+    Simulator::Schedule(MilliSeconds(70),
+                        &ThreeGppCoherenceDistanceTest::MoveAndCheck,
+                        this,
+                        1.0,
+                        true);
+
+    Simulator::Run();
+    Simulator::Destroy();
+}
+
+/**
+ * @ingroup spectrum-tests
+ *
+ * Test case for the ThreeGppChannelModel class.
+ * It checks that, with the default value of the CoherenceDistance attribute, the channel
+ * matrix is updated at the same time instants and takes the same values as before the
+ * introduction of the attribute, i.e., the coherence distance does not alter the
+ * generation of the channel nor the consumption of random variates.
+ */
+class ThreeGppDefaultChannelUpdateTest : public TestCase
+{
+  public:
+    /**
+     * Constructor
+     */
+    ThreeGppDefaultChannelUpdateTest();
+
+  private:
+    /**
+     * Build the test scenario
+     */
+    void DoRun() override;
+
+    /**
+     * Move the second node, retrieve the channel matrix and check whether it is updated
+     * and the value of its entry for the last elements of both arrays and the first cluster
+     * @param displacement the displacement of the second node along the x-axis
+     * @param update whether the channel matrix should be updated
+     * @param expected the expected value of the entry of the channel matrix
+     */
+    void MoveAndCheck(double displacement, bool update, std::complex<double> expected);
+
+    Ptr<ThreeGppChannelModel> m_channelModel;                    //!< the channel model
+    Ptr<MobilityModel> m_txMob;                                  //!< the tx mobility model
+    Ptr<MobilityModel> m_rxMob;                                  //!< the rx mobility model
+    Ptr<PhasedArrayModel> m_txAntenna;                           //!< the tx antenna array
+    Ptr<PhasedArrayModel> m_rxAntenna;                           //!< the rx antenna array
+    Ptr<const MatrixBasedChannelModel::ChannelMatrix> m_channel; //!< the current channel
+};
+
+ThreeGppDefaultChannelUpdateTest::ThreeGppDefaultChannelUpdateTest()
+    : TestCase("Check that the default channel updates are not affected by the coherence distance")
+{
+}
+
+void
+ThreeGppDefaultChannelUpdateTest::MoveAndCheck(double displacement,
+                                               bool update,
+                                               std::complex<double> expected)
+{
+    auto position = m_rxMob->GetPosition();
+    position.x += displacement;
+    m_rxMob->SetPosition(position);
+
+    auto channel = m_channelModel->GetChannel(m_txMob, m_rxMob, m_txAntenna, m_rxAntenna);
+    if (m_channel)
+    {
+        NS_TEST_ASSERT_MSG_EQ((channel != m_channel),
+                              update,
+                              Simulator::Now().As(Time::MS)
+                                  << ": the channel matrix is not correctly updated");
+    }
+    const auto entry = channel->m_channel(3, 3, 0);
+    NS_TEST_EXPECT_MSG_EQ_TOL(entry.real(),
+                              expected.real(),
+                              1e-6,
+                              Simulator::Now().As(Time::MS) << ": unexpected channel matrix");
+    NS_TEST_EXPECT_MSG_EQ_TOL(entry.imag(),
+                              expected.imag(),
+                              1e-6,
+                              Simulator::Now().As(Time::MS) << ": unexpected channel matrix");
+    m_channel = channel;
+}
+
+void
+ThreeGppDefaultChannelUpdateTest::DoRun()
+{
+    RngSeedManager::SetSeed(1);
+    RngSeedManager::SetRun(1);
+
+    m_channelModel = CreateObject<ThreeGppChannelModel>();
+    m_channelModel->SetAttribute("Frequency", DoubleValue(3.5e9));
+    m_channelModel->SetAttribute("Scenario", StringValue("UMa"));
+    m_channelModel->SetAttribute("ChannelConditionModel",
+                                 PointerValue(CreateObject<AlwaysLosChannelConditionModel>()));
+    m_channelModel->SetAttribute("UpdatePeriod", TimeValue(MilliSeconds(10)));
+    m_channelModel->AssignStreams(1);
+
+    NodeContainer nodes;
+    nodes.Create(2);
+    m_txMob = CreateObject<ConstantPositionMobilityModel>();
+    m_txMob->SetPosition(Vector(0.0, 0.0, 10.0));
+    m_rxMob = CreateObject<ConstantPositionMobilityModel>();
+    m_rxMob->SetPosition(Vector(100.0, 0.0, 1.6));
+    nodes.Get(0)->AggregateObject(m_txMob);
+    nodes.Get(1)->AggregateObject(m_rxMob);
+
+    m_txAntenna = CreateObjectWithAttributes<UniformPlanarArray>(
+        "NumColumns",
+        UintegerValue(2),
+        "NumRows",
+        UintegerValue(2),
+        "AntennaElement",
+        PointerValue(CreateObject<IsotropicAntennaModel>()));
+    m_rxAntenna = CreateObjectWithAttributes<UniformPlanarArray>(
+        "NumColumns",
+        UintegerValue(2),
+        "NumRows",
+        UintegerValue(2),
+        "AntennaElement",
+        PointerValue(CreateObject<IsotropicAntennaModel>()));
+
+    // generate the channel
+    Simulator::Schedule(MilliSeconds(1),
+                        &ThreeGppDefaultChannelUpdateTest::MoveAndCheck,
+                        this,
+                        0.0,
+                        true,
+                        std::complex<double>(0.181861948, 0.939951704));
+    // the antenna setup is flagged as changed since the creation of the arrays, hence the
+    // channel matrix is regenerated (with the same parameters)
+    Simulator::Schedule(MilliSeconds(2),
+                        &ThreeGppDefaultChannelUpdateTest::MoveAndCheck,
+                        this,
+                        0.0,
+                        true,
+                        std::complex<double>(0.181861948, 0.939951704));
+    // the node moved, but the update period did not expire
+    Simulator::Schedule(MilliSeconds(5),
+                        &ThreeGppDefaultChannelUpdateTest::MoveAndCheck,
+                        this,
+                        1.0,
+                        false,
+                        std::complex<double>(0.181861948, 0.939951704));
+    // the update period expired, the coherence distance being disabled by default
+    Simulator::Schedule(MilliSeconds(20),
+                        &ThreeGppDefaultChannelUpdateTest::MoveAndCheck,
+                        this,
+                        1.0,
+                        true,
+                        std::complex<double>(0.962904803, -0.255274443));
+    // a change of the antenna setup regenerates the channel
+    Simulator::Schedule(MilliSeconds(21), [this]() {
+        m_txAntenna->SetAttribute("BearingAngle", DoubleValue(0.1));
+    });
+    Simulator::Schedule(MilliSeconds(21),
+                        &ThreeGppDefaultChannelUpdateTest::MoveAndCheck,
+                        this,
+                        0.0,
+                        true,
+                        std::complex<double>(0.837748636, -0.539105408));
+    Simulator::Schedule(MilliSeconds(22),
+                        &ThreeGppDefaultChannelUpdateTest::MoveAndCheck,
+                        this,
+                        0.0,
+                        false,
+                        std::complex<double>(0.837748636, -0.539105408));
+    // the update period expired
+    Simulator::Schedule(MilliSeconds(40),
+                        &ThreeGppDefaultChannelUpdateTest::MoveAndCheck,
+                        this,
+                        1.0,
+                        true,
+                        std::complex<double>(-0.296001447, 0.971063649));
+
+    Simulator::Run();
+    Simulator::Destroy();
+}
+
 /**
  * @ingroup spectrum-tests
  *
@@ -1486,6 +2035,9 @@ ThreeGppChannelTestSuite::ThreeGppChannelTestSuite()
     AddTestCase(new ThreeGppSpectrumPropagationLossModelTest(4, 2, 2, 1),
                 TestCase::Duration::QUICK);
     AddTestCase(new ThreeGppCalcLongTermMultiPortTest(), TestCase::Duration::QUICK);
+    AddTestCase(new ThreeGppParallelRxComputationTest(), TestCase::Duration::QUICK);
+    AddTestCase(new ThreeGppCoherenceDistanceTest(), TestCase::Duration::QUICK);
+    AddTestCase(new ThreeGppDefaultChannelUpdateTest(), TestCase::Duration::QUICK);
 
     /**
      *  The TX and RX antennas are configured face-to-face.
@@ -0,0 +1,84 @@
+//
+// SPDX-License-Identifier: GPL-2.0-only
+//
+
+#include "count-min-sketch.h"
+#include "sketch-hash.h"
+
+#include "ns3/assert.h"
+
+#include <algorithm>
+#include <limits>
+
+namespace ns3
+{
+
+CountMinSketch::CountMinSketch(uint32_t width, uint32_t depth)
+    : m_counters(static_cast<std::size_t>(width) * depth, 0),
+      m_width(width),
+      m_depth(depth),
+      m_total(0)
+{
+    NS_ASSERT_MSG(width > 0 && depth > 0, "The sketch must have at least one counter");
+}
+
+CountMinSketch::CountMinSketch()
+    : CountMinSketch(2048, 4)
+{
+}
+
+uint32_t
+CountMinSketch::GetIndex(uint64_t key, uint32_t row) const
+{
+    // a different seed per row makes the row hashes independent
+    uint64_t h = Mix64(key + (row + 1) * 0x9e3779b97f4a7c15ULL);
+    return row * m_width + static_cast<uint32_t>(h % m_width);
+}
+
+void
+CountMinSketch::Add(uint64_t key, uint64_t count)
+{
+    for (uint32_t row = 0; row < m_depth; row++)
+    {
+        m_counters[GetIndex(key, row)] += count;
+    }
+    m_total += count;
+}
+
+uint64_t
+CountMinSketch::Estimate(uint64_t key) const
+{
+    uint64_t estimate = std::numeric_limits<uint64_t>::max();
+    for (uint32_t row = 0; row < m_depth; row++)
+    {
+        estimate = std::min(estimate, m_counters[GetIndex(key, row)]);
+    }
+    return estimate;
+}
+
+uint64_t
+CountMinSketch::GetTotal() const
+{
+    return m_total;
+}
+
+uint32_t
+CountMinSketch::GetWidth() const
+{
+    return m_width;
+}
+
+uint32_t
+CountMinSketch::GetDepth() const
+{
+    return m_depth;
+}
+
+void
+CountMinSketch::Clear()
+{
+    std::fill(m_counters.begin(), m_counters.end(), 0);
+    m_total = 0;
+}
+
+} // namespace ns3
@@ -0,0 +1,88 @@
+//
+// SPDX-License-Identifier: GPL-2.0-only
+//
+
+#ifndef NS3_COUNT_MIN_SKETCH_H
+#define NS3_COUNT_MIN_SKETCH_H
+
+#include <stdint.h>
+#include <vector>
+
+namespace ns3
+{
+
+/**
+ * @brief Count-min sketch, a fixed-size summary of a multiset of keys.
+ *
+ * The sketch is a matrix of counters with \a depth rows and \a width
+ * columns.  Adding a key increments one counter per row, selected by a
+ * per-row hash of the key; the count of a key is estimated as the minimum
+ * of its counters.  Estimates never underestimate the true count and,
+ * with probability at least 1 - exp(-depth), they overestimate it by at
+ * most e * N / width, where N is the total count added to the sketch.
+ *
+ * The memory used by the sketch does not depend on the number of
+ * distinct keys.
+ */
+class CountMinSketch
+{
+  public:
+    /**
+     * @brief Constructor
+     * @param width number of counters per row
+     * @param depth number of rows
+     */
+    CountMinSketch(uint32_t width, uint32_t depth);
+    CountMinSketch();
+
+    /**
+     * @brief Add a count to a key
+     * @param key the key
+     * @param count the count to add
+     */
+    void Add(uint64_t key, uint64_t count = 1);
+
+    /**
+     * @brief Estimate the count of a key
+     * @param key the key
+     * @return the estimated count, which is never smaller than the true count
+     */
+    uint64_t Estimate(uint64_t key) const;
+
+    /**
+     * @return the sum of all the counts added to the sketch
+     */
+    uint64_t GetTotal() const;
+
+    /**
+     * @return the number of counters per row
+     */
+    uint32_t GetWidth() const;
+
+    /**
+     * @return the number of rows
+     */
+    uint32_t GetDepth() const;
+
+    /**
+     * Clear the sketch content.
+     */
+    void Clear();
+
+  private:
+    /**
+     * @param key the key
+     * @param row the row index
+     * @return the index in m_counters of the counter of the key in the given row
+     */
+    uint32_t GetIndex(uint64_t key, uint32_t row) const;
+
+    std::vector<uint64_t> m_counters; //!< counters, stored row by row
+    uint32_t m_width;                 //!< number of counters per row
+    uint32_t m_depth;                 //!< number of rows
+    uint64_t m_total;                 //!< sum of all the added counts
+};
+
+} // namespace ns3
+
+#endif /* NS3_COUNT_MIN_SKETCH_H */
@@ -0,0 +1,164 @@
+//
+// SPDX-License-Identifier: GPL-2.0-only
+//
+
+#include "dd-sketch.h"
+
+#include "ns3/assert.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace ns3
+{
+
+DdSketch::DdSketch(double relativeAccuracy, uint32_t maxBins)
+    : m_offset(0),
+      m_maxBins(maxBins),
+      m_relativeAccuracy(relativeAccuracy),
+      m_logGamma(std::log((1 + relativeAccuracy) / (1 - relativeAccuracy)))
+{
+    NS_ASSERT_MSG(relativeAccuracy > 0 && relativeAccuracy < 1,
+                  "Invalid relative accuracy " << relativeAccuracy);
+    NS_ASSERT_MSG(maxBins > 0, "The sketch must have at least one bin");
+    Clear();
+}
+
+DdSketch::DdSketch()
+    : DdSketch(0.01)
+{
+}
+
+int32_t
+DdSketch::GetBinIndex(double value) const
+{
+    return static_cast<int32_t>(std::ceil(std::log(value) / m_logGamma));
+}
+
+void
+DdSketch::AddValue(double value)
+{
+    m_count++;
+    m_sum += value;
+    m_min = std::min(m_min, value);
+    m_max = std::max(m_max, value);
+
+    if (value <= 0)
+    {
+        m_zeroCount++;
+        return;
+    }
+
+    int32_t index = GetBinIndex(value);
+    if (m_bins.empty())
+    {
+        m_bins.push_back(0);
+        m_offset = index;
+    }
+    else if (index < m_offset)
+    {
+        auto nBins = static_cast<int32_t>(m_bins.size());
+        if (m_offset + nBins - index > static_cast<int32_t>(m_maxBins))
+        {
+            // no room below: the value is counted in the lowest bin
+            index = m_offset;
+        }
+        else
+        {
+            m_bins.insert(m_bins.begin(), m_offset - index, 0);
+            m_offset = index;
+        }
+    }
+    else if (index >= m_offset + static_cast<int32_t>(m_bins.size()))
+    {
+        m_bins.resize(index - m_offset + 1, 0);
+        if (m_bins.size() > m_maxBins)
+        {
+            // collapse the lowest bins into the lowest bin that is kept
+            std::size_t excess = m_bins.size() - m_maxBins;
+            uint64_t collapsed = 0;
+            for (std::size_t i = 0; i <= excess; i++)
+            {
+                collapsed += m_bins[i];
+            }
+            m_bins.erase(m_bins.begin(), m_bins.begin() + excess);
+            m_bins.front() = collapsed;
+            m_offset += excess;
+        }
+    }
+    m_bins[index - m_offset]++;
+}
+
+double
+DdSketch::GetQuantile(double quantile) const
+{
+    NS_ASSERT_MSG(quantile >= 0 && quantile <= 1, "Invalid quantile " << quantile);
+    if (m_count == 0)
+    {
+        return 0;
+    }
+
+    auto rank = static_cast<uint64_t>(quantile * (m_count - 1));
+    if (rank < m_zeroCount)
+    {
+        return std::max(m_min, 0.0);
+    }
+    uint64_t cumulative = m_zeroCount;
+    for (std::size_t i = 0; i < m_bins.size(); i++)
+    {
+        cumulative += m_bins[i];
+        if (cumulative > rank)
+        {
+            // value in the middle of the bin, in the relative sense
+            int32_t index = m_offset + static_cast<int32_t>(i);
+            double value = 2 * std::exp(index * m_logGamma) / (1 + std::exp(m_logGamma));
+            return std::clamp(value, m_min, m_max);
+        }
+    }
+    return m_max;
+}
+
+uint64_t
+DdSketch::GetCount() const
+{
+    return m_count;
+}
+
+double
+DdSketch::GetSum() const
+{
+    return m_sum;
+}
+
+double
+DdSketch::GetMin() const
+{
+    return m_min;
+}
+
+double
+DdSketch::GetMax() const
+{
+    return m_max;
+}
+
+double
+DdSketch::GetRelativeAccuracy() const
+{
+    return m_relativeAccuracy;
+}
+
+void
+DdSketch::Clear()
+{
+    m_bins.clear();
+    m_offset = 0;
+    m_zeroCount = 0;
+    m_count = 0;
+    m_sum = 0;
+    m_min = std::numeric_limits<double>::max();
+    m_max = std::numeric_limits<double>::lowest();
+}
+
+} // namespace ns3
@@ -0,0 +1,110 @@
+//
+// SPDX-License-Identifier: GPL-2.0-only
+//
+
+#ifndef NS3_DD_SKETCH_H
+#define NS3_DD_SKETCH_H
+
+#include <stdint.h>
+#include <vector>
+
+namespace ns3
+{
+
+/**
+ * @brief DDSketch, a quantile sketch with relative-error guarantees.
+ *
+ * Positive values are counted in logarithmically sized bins: bin \a i
+ * holds the values in (gamma^(i-1), gamma^i], with
+ * gamma = (1 + alpha) / (1 - alpha), where alpha is the relative accuracy.
+ * Any quantile is then returned with a relative error of at most alpha.
+ * Values that are not positive (e.g., a null jitter) are counted
+ * separately and returned as zero.
+ *
+ * The bins are stored contiguously.  When more than \a maxBins bins would
+ * be needed, the lowest bins are collapsed together, so that the accuracy
+ * guarantee is preserved for the highest quantiles, which are usually the
+ * ones of interest for delays.  With the default parameters (1% accuracy
+ * and 2048 bins), the guarantee holds over more than 17 orders of
+ * magnitude.
+ *
+ * See C. Masson, J. E. Rim and H. K. Lee, "DDSketch: A Fast and
+ * Fully-Mergeable Quantile Sketch with Relative-Error Guarantees",
+ * PVLDB 12(12), 2019.
+ */
+class DdSketch
+{
+  public:
+    /**
+     * @brief Constructor
+     * @param relativeAccuracy the relative accuracy alpha of the quantiles, in (0, 1)
+     * @param maxBins the maximum number of bins
+     */
+    DdSketch(double relativeAccuracy, uint32_t maxBins = 2048);
+    DdSketch();
+
+    /**
+     * @brief Add a value to the sketch
+     * @param value the value to add
+     */
+    void AddValue(double value);
+
+    /**
+     * @brief Estimate a quantile of the added values
+     * @param quantile the quantile, in [0, 1]
+     * @return the estimated quantile, or zero if the sketch is empty
+     */
+    double GetQuantile(double quantile) const;
+
+    /**
+     * @return the number of values added to the sketch
+     */
+    uint64_t GetCount() const;
+
+    /**
+     * @return the sum of the values added to the sketch
+     */
+    double GetSum() const;
+
+    /**
+     * @return the smallest value added to the sketch
+     */
+    double GetMin() const;
+
+    /**
+     * @return the largest value added to the sketch
+     */
+    double GetMax() const;
+
+    /**
+     * @return the relative accuracy of the quantiles
+     */
+    double GetRelativeAccuracy() const;
+
+    /**
+     * Clear the sketch content.
+     */
+    void Clear();
+
+  private:
+    /**
+     * @param value a positive value
+     * @return the index of the bin holding the value
+     */
+    int32_t GetBinIndex(double value) const;
+
+    std::vector<uint64_t> m_bins; //!< bin counts, m_bins[0] being the bin of index m_offset
+    int32_t m_offset;             //!< index of the bin stored in m_bins[0]
+    uint32_t m_maxBins;           //!< maximum number of bins
+    double m_relativeAccuracy;    //!< relative accuracy
+    double m_logGamma;            //!< logarithm of gamma
+    uint64_t m_zeroCount;         //!< number of values that are not positive
+    uint64_t m_count;             //!< number of added values
+    double m_sum;                 //!< sum of the added values
+    double m_min;                 //!< smallest added value
+    double m_max;                 //!< largest added value
+};
+
+} // namespace ns3
+
+#endif /* NS3_DD_SKETCH_H */
@@ -0,0 +1,87 @@
+//
+// SPDX-License-Identifier: GPL-2.0-only
+//
+
+#include "hyper-log-log.h"
+#include "sketch-hash.h"
+
+#include "ns3/assert.h"
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+
+namespace ns3
+{
+
+HyperLogLog::HyperLogLog(uint8_t precision)
+    : m_registers(1U << precision, 0),
+      m_precision(precision)
+{
+    NS_ASSERT_MSG(precision >= 4 && precision <= 18, "Invalid precision " << +precision);
+}
+
+HyperLogLog::HyperLogLog()
+    : HyperLogLog(12)
+{
+}
+
+void
+HyperLogLog::Add(uint64_t key)
+{
+    uint64_t h = Mix64(key);
+    auto index = static_cast<uint32_t>(h >> (64 - m_precision));
+    // position of the leftmost set bit of the remaining bits, capped when they are all zero
+    uint64_t w = h << m_precision;
+    auto rank = static_cast<uint8_t>(w == 0 ? 64 - m_precision + 1 : std::countl_zero(w) + 1);
+    m_registers[index] = std::max(m_registers[index], rank);
+}
+
+double
+HyperLogLog::Estimate() const
+{
+    const double m = m_registers.size();
+    double sum = 0;
+    uint32_t zeros = 0;
+    for (auto reg : m_registers)
+    {
+        sum += std::ldexp(1.0, -reg);
+        zeros += (reg == 0 ? 1 : 0);
+    }
+    double alpha;
+    switch (m_registers.size())
+    {
+    case 16:
+        alpha = 0.673;
+        break;
+    case 32:
+        alpha = 0.697;
+        break;
+    case 64:
+        alpha = 0.709;
+        break;
+    default:
+        alpha = 0.7213 / (1 + 1.079 / m);
+    }
+    double estimate = alpha * m * m / sum;
+    if (estimate <= 2.5 * m && zeros > 0)
+    {
+        // small range correction (linear counting)
+        estimate = m * std::log(m / zeros);
+    }
+    return estimate;
+}
+
+uint32_t
+HyperLogLog::GetNRegisters() const
+{
+    return m_registers.size();
+}
+
+void
+HyperLogLog::Clear()
+{
+    std::fill(m_registers.begin(), m_registers.end(), 0);
+}
+
+} // namespace ns3
@@ -0,0 +1,63 @@
+//
+// SPDX-License-Identifier: GPL-2.0-only
+//
+
+#ifndef NS3_HYPER_LOG_LOG_H
+#define NS3_HYPER_LOG_LOG_H
+
+#include <stdint.h>
+#include <vector>
+
+namespace ns3
+{
+
+/**
+ * @brief HyperLogLog estimator of the number of distinct keys.
+ *
+ * Each key is hashed; the first \a precision bits of the hash select one of
+ * 2^precision registers, which keeps the maximum position of the leftmost
+ * set bit among the remaining bits of the hashes it received.  The number
+ * of distinct keys is estimated from the harmonic mean of the registers,
+ * with linear counting used for small cardinalities.  The relative
+ * standard error is about 1.04 / sqrt(2^precision), regardless of the
+ * number of keys, and each register takes a single byte.
+ */
+class HyperLogLog
+{
+  public:
+    /**
+     * @brief Constructor
+     * @param precision number of hash bits used to select the register (between 4 and 18)
+     */
+    HyperLogLog(uint8_t precision);
+    HyperLogLog();
+
+    /**
+     * @brief Add a key
+     * @param key the key
+     */
+    void Add(uint64_t key);
+
+    /**
+     * @return the estimated number of distinct keys added so far
+     */
+    double Estimate() const;
+
+    /**
+     * @return the number of registers
+     */
+    uint32_t GetNRegisters() const;
+
+    /**
+     * Clear the estimator content.
+     */
+    void Clear();
+
+  private:
+    std::vector<uint8_t> m_registers; //!< registers
+    uint8_t m_precision;              //!< number of hash bits used to select the register
+};
+
+} // namespace ns3
+
+#endif /* NS3_HYPER_LOG_LOG_H */
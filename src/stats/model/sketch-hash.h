@@ -0,0 +1,33 @@
+//
+// SPDX-License-Identifier: GPL-2.0-only
+//
+
+#ifndef NS3_SKETCH_HASH_H
+#define NS3_SKETCH_HASH_H
+
+// This header is used by the implementation of the sketches and is not installed.
+
+#include <stdint.h>
+
+namespace ns3
+{
+
+/**
+ * 64-bit mixing function (finalizer of SplitMix64)
+ * @param x the value to mix
+ * @return the mixed value
+ */
+inline uint64_t
+Mix64(uint64_t x)
+{
+    x ^= x >> 30;
+    x *= 0xbf58476d1ce4e5b9ULL;
+    x ^= x >> 27;
+    x *= 0x94d049bb133111ebULL;
+    x ^= x >> 31;
+    return x;
+}
+
+} // namespace ns3
+
+#endif /* NS3_SKETCH_HASH_H */
@@ -0,0 +1,195 @@
+//
+// SPDX-License-Identifier: GPL-2.0-only
+//
+
+#include "ns3/count-min-sketch.h"
+#include "ns3/dd-sketch.h"
+#include "ns3/hyper-log-log.h"
+#include "ns3/test.h"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+using namespace ns3;
+
+/**
+ * @ingroup stats-tests
+ *
+ * @brief Count-min sketch Test
+ */
+class CountMinSketchTestCase : public TestCase
+{
+  public:
+    CountMinSketchTestCase();
+
+  private:
+    void DoRun() override;
+};
+
+CountMinSketchTestCase::CountMinSketchTestCase()
+    : TestCase("Count-min sketch")
+{
+}
+
+void
+CountMinSketchTestCase::DoRun()
+{
+    const uint32_t width = 1024;
+    const uint32_t nKeys = 10000;
+    CountMinSketch sketch(width, 5);
+
+    // key k is added k % 7 + 1 times
+    for (uint32_t k = 0; k < nKeys; k++)
+    {
+        sketch.Add(k, k % 7 + 1);
+    }
+    sketch.Add(123456789, 5000);
+    NS_TEST_EXPECT_MSG_EQ(sketch.GetTotal(), 39994 + 5000, "Unexpected total count");
+
+    // the estimates never underestimate, and overestimate by at most e * N / width
+    // with high probability
+    uint32_t outOfBounds = 0;
+    const double bound = std::exp(1.0) * sketch.GetTotal() / width;
+    for (uint32_t k = 0; k < nKeys; k++)
+    {
+        uint64_t estimate = sketch.Estimate(k);
+        NS_TEST_ASSERT_MSG_GT_OR_EQ(estimate, k % 7 + 1, "Underestimated count of key " << k);
+        if (estimate - (k % 7 + 1) > bound)
+        {
+            outOfBounds++;
+        }
+    }
+    NS_TEST_EXPECT_MSG_LT(outOfBounds, nKeys / 100, "Too many estimates out of bounds");
+    NS_TEST_EXPECT_MSG_GT_OR_EQ(sketch.Estimate(123456789), 5000, "Underestimated heavy hitter");
+    NS_TEST_EXPECT_MSG_LT(sketch.Estimate(123456789), 5000 + bound, "Overestimated heavy hitter");
+
+    sketch.Clear();
+    NS_TEST_EXPECT_MSG_EQ(sketch.GetTotal(), 0, "Sketch not cleared");
+    NS_TEST_EXPECT_MSG_EQ(sketch.Estimate(42), 0, "Sketch not cleared");
+}
+
+/**
+ * @ingroup stats-tests
+ *
+ * @brief HyperLogLog Test
+ */
+class HyperLogLogTestCase : public TestCase
+{
+  public:
+    HyperLogLogTestCase();
+
+  private:
+    void DoRun() override;
+};
+
+HyperLogLogTestCase::HyperLogLogTestCase()
+    : TestCase("HyperLogLog")
+{
+}
+
+void
+HyperLogLogTestCase::DoRun()
+{
+    HyperLogLog hll(12);
+    NS_TEST_EXPECT_MSG_EQ(hll.GetNRegisters(), 4096, "Unexpected number of registers");
+    NS_TEST_EXPECT_MSG_EQ_TOL(hll.Estimate(), 0, 1e-9, "Empty estimator");
+
+    // the standard error with 4096 registers is about 1.6%; check within 5%
+    for (uint32_t n : {100, 1000, 10000, 200000})
+    {
+        hll.Clear();
+        for (uint32_t k = 0; k < n; k++)
+        {
+            hll.Add(k);
+            hll.Add(k); // duplicates must not be counted
+        }
+        NS_TEST_EXPECT_MSG_EQ_TOL(hll.Estimate(), n, 0.05 * n, "Bad estimate for " << n << " keys");
+    }
+}
+
+/**
+ * @ingroup stats-tests
+ *
+ * @brief DDSketch Test
+ */
+class DdSketchTestCase : public TestCase
+{
+  public:
+    DdSketchTestCase();
+
+  private:
+    void DoRun() override;
+};
+
+DdSketchTestCase::DdSketchTestCase()
+    : TestCase("DDSketch")
+{
+}
+
+void
+DdSketchTestCase::DoRun()
+{
+    const double accuracy = 0.01;
+    DdSketch sketch(accuracy);
+    NS_TEST_EXPECT_MSG_EQ_TOL(sketch.GetQuantile(0.5), 0, 1e-9, "Empty sketch");
+
+    // values spanning several orders of magnitude, as delays do
+    std::vector<double> values;
+    for (uint32_t i = 1; i <= 10000; i++)
+    {
+        values.push_back(1e-6 * std::pow(1.001, i));
+    }
+    values.push_back(0); // e.g., a null jitter
+    for (auto v : values)
+    {
+        sketch.AddValue(v);
+    }
+    std::sort(values.begin(), values.end());
+
+    NS_TEST_EXPECT_MSG_EQ(sketch.GetCount(), values.size(), "Unexpected count");
+    NS_TEST_EXPECT_MSG_EQ_TOL(sketch.GetMin(), 0, 1e-12, "Unexpected min");
+    NS_TEST_EXPECT_MSG_EQ_TOL(sketch.GetQuantile(0), 0, 1e-12, "Unexpected 0-quantile");
+    for (double q : {0.1, 0.5, 0.9, 0.99, 0.999, 1.0})
+    {
+        double exact = values[static_cast<std::size_t>(q * (values.size() - 1))];
+        NS_TEST_EXPECT_MSG_EQ_TOL(sketch.GetQuantile(q),
+                                  exact,
+                                  accuracy * exact,
+                                  "Quantile " << q << " out of the accuracy bound");
+    }
+
+    // with few bins, the lowest values are collapsed but the highest quantiles stay accurate
+    DdSketch small(accuracy, 64);
+    for (auto v : values)
+    {
+        small.AddValue(v);
+    }
+    double exact = values[static_cast<std::size_t>(0.99 * (values.size() - 1))];
+    NS_TEST_EXPECT_MSG_EQ_TOL(small.GetQuantile(0.99),
+                              exact,
+                              accuracy * exact,
+                              "High quantile out of the accuracy bound after collapsing");
+    NS_TEST_EXPECT_MSG_EQ_TOL(small.GetMax(), values.back(), 1e-12, "Unexpected max");
+}
+
+/**
+ * @ingroup stats-tests
+ *
+ * @brief Sketch TestSuite
+ */
+class SketchTestSuite : public TestSuite
+{
+  public:
+    SketchTestSuite();
+};
+
+SketchTestSuite::SketchTestSuite()
+    : TestSuite("stats-sketches", Type::UNIT)
+{
+    AddTestCase(new CountMinSketchTestCase, TestCase::Duration::QUICK);
+    AddTestCase(new HyperLogLogTestCase, TestCase::Duration::QUICK);
+    AddTestCase(new DdSketchTestCase, TestCase::Duration::QUICK);
+}
+
+static SketchTestSuite g_sketchTestSuite; //!< Static variable for test initialization
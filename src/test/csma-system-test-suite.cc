@@ -13,6 +13,7 @@
 #include "ns3/callback.h"
 #include "ns3/config.h"
 #include "ns3/csma-helper.h"
+#include "ns3/csma-net-device.h"
 #include "ns3/csma-star-helper.h"
 #include "ns3/data-rate.h"
 #include "ns3/inet-socket-address.h"
@@ -35,7 +36,9 @@
 #include "ns3/test.h"
 #include "ns3/uinteger.h"
 
+#include <set>
 #include <string>
+#include <vector>
 
 using namespace ns3;
 
@@ -1220,6 +1223,133 @@ CsmaStarTestCase::DoRun()
                           "Hub node did not receive the proper number of packets");
 }
 
+/**
+ * @ingroup system-tests-csma
+ *
+ * @brief CSMA packet train test.
+ *
+ * A burst of packets is broadcast on a CSMA channel whose propagation delay
+ * is shorter than the interframe gap (96 bit times), so that the sender
+ * never backs off.
+ * Sending the packets as trains must not change their reception times,
+ * while reducing the number of transmissions.
+ */
+class CsmaPacketTrainTestCase : public TestCase
+{
+  public:
+    CsmaPacketTrainTestCase();
+    ~CsmaPacketTrainTestCase() override;
+
+  private:
+    void DoRun() override;
+
+    /**
+     * Send a burst of packets from the first of three nodes
+     * @param nPackets the number of packets of the burst
+     * @param txBatchSize the value of the TxBatchSize attribute of the devices
+     */
+    void SendBurst(uint32_t nPackets, uint32_t txBatchSize);
+
+    /**
+     * Callback called when a packet is received by a device.
+     * @param dev The receiving device.
+     * @param p The received packet.
+     * @param protocol The protocol number (unused).
+     * @param sender The sender address (unused).
+     * @return True.
+     */
+    bool Receive(Ptr<NetDevice> dev, Ptr<const Packet> p, uint16_t protocol, const Address& sender);
+
+    /**
+     * Sink called when a packet has been completely transmitted.
+     * @param p The transmitted packet (unused).
+     */
+    void PhyTxEnd(Ptr<const Packet> p);
+
+    std::vector<std::pair<uint32_t, Time>> m_rx; //!< (receiving node, time) of receptions
+    std::set<Time> m_txEndTimes;                 //!< distinct times of the PhyTxEnd trace
+};
+
+// Add some help text to this case to describe what it is intended to test
+CsmaPacketTrainTestCase::CsmaPacketTrainTestCase()
+    : TestCase("Packet trains on Carrier Sense Multiple Access (CSMA) networks")
+{
+}
+
+CsmaPacketTrainTestCase::~CsmaPacketTrainTestCase()
+{
+}
+
+bool
+CsmaPacketTrainTestCase::Receive(Ptr<NetDevice> dev,
+                                 Ptr<const Packet> p,
+                                 uint16_t protocol,
+                                 const Address& sender)
+{
+    m_rx.emplace_back(dev->GetNode()->GetId(), Simulator::Now());
+    return true;
+}
+
+void
+CsmaPacketTrainTestCase::PhyTxEnd(Ptr<const Packet> p)
+{
+    m_txEndTimes.insert(Simulator::Now());
+}
+
+void
+CsmaPacketTrainTestCase::SendBurst(uint32_t nPackets, uint32_t txBatchSize)
+{
+    m_rx.clear();
+    m_txEndTimes.clear();
+
+    NodeContainer nodes;
+    nodes.Create(3);
+
+    CsmaHelper csma;
+    csma.SetChannelAttribute("DataRate", DataRateValue(DataRate("100Mbps")));
+    csma.SetChannelAttribute("Delay", TimeValue(NanoSeconds(500)));
+    csma.SetDeviceAttribute("TxBatchSize", UintegerValue(txBatchSize));
+    NetDeviceContainer devices = csma.Install(nodes);
+
+    for (uint32_t i = 1; i < devices.GetN(); i++)
+    {
+        devices.Get(i)->SetReceiveCallback(MakeCallback(&CsmaPacketTrainTestCase::Receive, this));
+    }
+    devices.Get(0)->TraceConnectWithoutContext(
+        "PhyTxEnd",
+        MakeCallback(&CsmaPacketTrainTestCase::PhyTxEnd, this));
+
+    for (uint32_t i = 0; i < nPackets; i++)
+    {
+        Simulator::Schedule(Seconds(1),
+                            &CsmaNetDevice::Send,
+                            DynamicCast<CsmaNetDevice>(devices.Get(0)),
+                            Create<Packet>(100 + i),
+                            devices.Get(0)->GetBroadcast(),
+                            0x800);
+    }
+
+    Simulator::Run();
+    Simulator::Destroy();
+}
+
+void
+CsmaPacketTrainTestCase::DoRun()
+{
+    const uint32_t nPackets = 10;
+
+    SendBurst(nPackets, 1);
+    NS_TEST_ASSERT_MSG_EQ(m_rx.size(), 2 * nPackets, "Unexpected number of received packets");
+    NS_TEST_EXPECT_MSG_EQ(m_txEndTimes.size(), nPackets, "Unexpected number of transmissions");
+    auto rx = m_rx;
+
+    SendBurst(nPackets, 4);
+    NS_TEST_ASSERT_MSG_EQ(m_rx.size(), 2 * nPackets, "Unexpected number of received packets");
+    // the first packet is sent alone, the remaining nine in trains of 4, 4 and 1
+    NS_TEST_EXPECT_MSG_EQ(m_txEndTimes.size(), 4, "Unexpected number of transmissions");
+    NS_TEST_EXPECT_MSG_EQ((m_rx == rx), true, "Packet trains changed the reception times");
+}
+
 /**
  * @ingroup system-tests-csma
  *
@@ -1239,6 +1369,7 @@ CsmaSystemTestSuite::CsmaSystemTestSuite()
     AddTestCase(new CsmaMulticastTestCase, TestCase::Duration::QUICK);
     AddTestCase(new CsmaOneSubnetTestCase, TestCase::Duration::QUICK);
     AddTestCase(new CsmaPacketSocketTestCase, TestCase::Duration::QUICK);
+    AddTestCase(new CsmaPacketTrainTestCase, TestCase::Duration::QUICK);
     AddTestCase(new CsmaPingTestCase, TestCase::Duration::QUICK);
     AddTestCase(new CsmaRawIpSocketTestCase, TestCase::Duration::QUICK);
     AddTestCase(new CsmaStarTestCase, TestCase::Duration::QUICK);
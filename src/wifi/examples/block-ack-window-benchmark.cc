@@ -0,0 +1,134 @@
+//
+// SPDX-License-Identifier: GPL-2.0-only
+//
+
+//
+// Benchmark of the block ack window with the 1024-MPDU windows used by EHT.
+//
+// Each iteration emulates the reception of an A-MPDU filling the window by a
+// recipient: the elements of the scoreboard corresponding to the MPDUs that are
+// not lost are set, the bitmap of the BlockAck frame is built from the scoreboard
+// and the window is advanced past the MPDUs received in order (the originator is
+// assumed to retransmit the lost MPDUs in the next A-MPDU). The bitmap is built
+// one MPDU at a time in the first phase and by copying the scoreboard as a whole
+// in the second phase. The number of BlockAck frames built per second is printed
+// for each phase, together with a checksum of the bitmaps, which must be the same
+// for both phases.
+//
+// Usage example:
+//
+//     ./ns3 run "block-ack-window-benchmark --winSize=1024 --lossProb=0.05"
+//
+
+#include "ns3/abort.h"
+#include "ns3/block-ack-window.h"
+#include "ns3/command-line.h"
+#include "ns3/ctrl-headers.h"
+#include "ns3/random-variable-stream.h"
+#include "ns3/rng-seed-manager.h"
+#include "ns3/wifi-utils.h"
+
+#include <chrono>
+#include <iostream>
+#include <vector>
+
+using namespace ns3;
+
+int
+main(int argc, char* argv[])
+{
+    uint16_t winSize = 1024;
+    double lossProb = 0.05;
+    uint32_t nIterations = 20000;
+
+    CommandLine cmd(__FILE__);
+    cmd.AddValue("winSize", "Size of the block ack window", winSize);
+    cmd.AddValue("lossProb", "Probability that an MPDU is lost", lossProb);
+    cmd.AddValue("nIterations", "Number of BlockAck frames built per phase", nIterations);
+    cmd.Parse(argc, argv);
+
+    NS_ABORT_MSG_IF(winSize == 0 || winSize > 1024, "Invalid window size: " << winSize);
+
+    // the bitmap of the BlockAck frame is the smallest one covering the window
+    uint8_t bitmapLen = 128;
+    for (const uint8_t len : {8, 32, 64})
+    {
+        if (winSize <= len * 8)
+        {
+            bitmapLen = len;
+            break;
+        }
+    }
+
+    RngSeedManager::SetSeed(1);
+
+    std::cout << "window size: " << winSize << ", bitmap length: " << +bitmapLen
+              << " bytes, iterations: " << nIterations << std::endl;
+
+    for (const std::string phase : {"per-MPDU", "bulk"})
+    {
+        RngSeedManager::SetRun(1);
+        auto random = CreateObject<UniformRandomVariable>();
+        random->SetStream(1);
+
+        BlockAckWindow scoreboard;
+        scoreboard.Init(0, winSize);
+        CtrlBAckResponseHeader blockAck;
+        blockAck.SetType({BlockAckType::COMPRESSED, {bitmapLen}});
+        uint64_t checksum = 0;
+        std::chrono::steady_clock::duration elapsed{};
+
+        for (uint32_t i = 0; i < nIterations; i++)
+        {
+            // draw the lost MPDUs in advance, so that only the window operations are timed
+            std::vector<bool> lost(winSize);
+            for (uint16_t j = 0; j < winSize; j++)
+            {
+                lost[j] = (random->GetValue() < lossProb);
+            }
+
+            const auto start = std::chrono::steady_clock::now();
+
+            for (uint16_t j = 0; j < winSize; j++)
+            {
+                if (!lost[j])
+                {
+                    scoreboard.At(j) = true;
+                }
+            }
+            const auto ssn = scoreboard.GetWinStart();
+            blockAck.SetStartingSequence(ssn);
+            if (phase == "per-MPDU")
+            {
+                blockAck.ResetBitmap();
+                for (uint16_t j = 0; j < winSize; j++)
+                {
+                    if (scoreboard.At(j))
+                    {
+                        blockAck.SetReceivedPacket((ssn + j) % SEQNO_SPACE_SIZE);
+                    }
+                }
+            }
+            else
+            {
+                auto bitmap = blockAck.GetBitmap();
+                scoreboard.CopyTo(bitmap);
+                blockAck.SetBitmap(std::move(bitmap));
+            }
+            scoreboard.Advance(scoreboard.GetNSetFromStart());
+
+            elapsed += std::chrono::steady_clock::now() - start;
+
+            for (const auto byte : blockAck.GetBitmap())
+            {
+                checksum = checksum * 31 + byte;
+            }
+        }
+
+        const auto seconds = std::chrono::duration<double>(elapsed).count();
+        std::cout << phase << ": " << nIterations / seconds << " BlockAcks/s, " << seconds
+                  << " s, checksum " << checksum << std::endl;
+    }
+
+    return 0;
+}
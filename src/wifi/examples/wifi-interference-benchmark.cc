@@ -0,0 +1,232 @@
+//
+// SPDX-License-Identifier: GPL-2.0-only
+//
+
+//
+// Benchmark of the InterferenceHelper for wide channels split into many bands.
+//
+// The InterferenceHelper is driven directly (no PHY is simulated), the way a
+// SpectrumWifiPhy operating on a wide channel drives it: the PHY tracks one
+// band per RU of the channel (e.g., several hundred bands for a 320 MHz EHT
+// channel) and every received signal has a power in each of these bands.
+// Each PPDU is received while a few interfering signals overlap with it; at
+// the end of the PPDU, the SNR and the PER of each MPDU of each of the
+// nRus RUs are computed, as for a DL OFDMA reception of A-MPDUs.
+//
+// The wall-clock time spent in the InterferenceHelper is printed at the end,
+// together with checksums of the computed SNRs and PERs, which must not
+// depend on the implementation of the InterferenceHelper.
+//
+// Usage example:
+//
+//     ./ns3 run "wifi-interference-benchmark --nBands=300 --nPpdus=2000"
+//
+
+#include "ns3/command-line.h"
+#include "ns3/he-phy.h"
+#include "ns3/interference-helper.h"
+#include "ns3/nstime.h"
+#include "ns3/packet.h"
+#include "ns3/rng-seed-manager.h"
+#include "ns3/random-variable-stream.h"
+#include "ns3/simulator.h"
+#include "ns3/table-based-error-rate-model.h"
+#include "ns3/wifi-mac-header.h"
+#include "ns3/wifi-phy.h"
+#include "ns3/wifi-ppdu.h"
+#include "ns3/wifi-psdu.h"
+#include "ns3/wifi-spectrum-value-helper.h"
+#include "ns3/wifi-utils.h"
+
+#include <chrono>
+#include <iostream>
+
+using namespace ns3;
+
+/// Benchmark parameters and state
+struct Benchmark
+{
+    uint32_t nBands{300};       ///< number of bands tracked by the interference helper
+    uint32_t nRus{16};          ///< number of RUs whose PER is computed for each PPDU
+    uint32_t nMpdus{8};         ///< number of MPDUs per RU
+    uint32_t nInterferers{4};   ///< number of interfering signals per PPDU
+    Time ppduDuration{MilliSeconds(1)};            ///< duration of the PPDUs
+    Ptr<InterferenceHelper> interference;          ///< the interference helper
+    std::vector<WifiSpectrumBandInfo> bands;       ///< the tracked bands
+    Ptr<UniformRandomVariable> random;             ///< random variable for the signals
+    double snrSum{0};                              ///< checksum of the SNRs
+    double perSum{0};                              ///< checksum of the PERs
+    std::chrono::steady_clock::duration elapsed{}; ///< time spent in the interference helper
+};
+
+/**
+ * Create a PPDU with the given TXVECTOR.
+ * @param txVector the TXVECTOR
+ * @return the PPDU
+ */
+static Ptr<const WifiPpdu>
+CreatePpdu(const WifiTxVector& txVector)
+{
+    WifiMacHeader hdr;
+    hdr.SetType(WIFI_MAC_QOSDATA);
+    hdr.SetQosTid(0);
+    return Create<WifiPpdu>(Create<WifiPsdu>(Create<Packet>(1000), hdr),
+                            txVector,
+                            WifiPhyOperatingChannel());
+}
+
+/**
+ * Get the power received in each band from a signal.
+ * @param b the benchmark
+ * @param total the total received power
+ * @return the power received in each band
+ */
+static RxPowerWattPerChannelBand
+GetRxPower(Benchmark& b, Watt_u total)
+{
+    RxPowerWattPerChannelBand rxPower;
+    for (const auto& band : b.bands)
+    {
+        rxPower.emplace(band, total / b.nBands);
+    }
+    return rxPower;
+}
+
+/**
+ * Add an interfering signal.
+ * @param b the benchmark
+ * @param ppdu the interfering PPDU
+ * @param duration the duration of the signal
+ */
+static void
+AddInterferer(Benchmark* b, Ptr<const WifiPpdu> ppdu, Time duration)
+{
+    auto rxPower = GetRxPower(*b, Watt_u{b->random->GetValue(1e-12, 1e-10)});
+    auto start = std::chrono::steady_clock::now();
+    b->interference->Add(ppdu, duration, rxPower, WIFI_SPECTRUM_6_GHZ);
+    b->elapsed += std::chrono::steady_clock::now() - start;
+}
+
+/**
+ * Compute the SNR and PER of every MPDU of every RU of the received PPDU,
+ * then end its reception.
+ * @param b the benchmark
+ * @param event the event of the received PPDU
+ */
+static void
+EndReceive(Benchmark* b, Ptr<Event> event)
+{
+    auto start = std::chrono::steady_clock::now();
+    const auto& txVector = event->GetPpdu()->GetTxVector();
+    const auto payloadDuration =
+        b->ppduDuration - WifiPhy::CalculatePhyPreambleAndHeaderDuration(txVector);
+    const auto mpduDuration = payloadDuration / b->nMpdus;
+    for (uint32_t ru = 0; ru < b->nRus; ru++)
+    {
+        const auto& band = b->bands[(ru * b->nBands) / b->nRus];
+        for (uint32_t mpdu = 0; mpdu < b->nMpdus; mpdu++)
+        {
+            auto snrPer =
+                b->interference->CalculatePayloadSnrPer(event,
+                                                        txVector.GetChannelWidth(),
+                                                        band,
+                                                        SU_STA_ID,
+                                                        {mpduDuration * mpdu,
+                                                         mpduDuration * (mpdu + 1)});
+            b->snrSum += snrPer.snr;
+            b->perSum += snrPer.per;
+        }
+    }
+    b->interference->NotifyRxEnd(Simulator::Now(), WIFI_SPECTRUM_6_GHZ);
+    b->elapsed += std::chrono::steady_clock::now() - start;
+}
+
+/**
+ * Start the reception of a PPDU and schedule the interfering signals.
+ * @param b the benchmark
+ * @param ppdu the received PPDU
+ * @param interferer the interfering PPDU
+ */
+static void
+StartReceive(Benchmark* b, Ptr<const WifiPpdu> ppdu, Ptr<const WifiPpdu> interferer)
+{
+    auto rxPower = GetRxPower(*b, Watt_u{1e-8});
+    auto start = std::chrono::steady_clock::now();
+    auto event = b->interference->Add(ppdu, b->ppduDuration, rxPower, WIFI_SPECTRUM_6_GHZ);
+    b->interference->NotifyRxStart(WIFI_SPECTRUM_6_GHZ);
+    b->elapsed += std::chrono::steady_clock::now() - start;
+
+    for (uint32_t i = 0; i < b->nInterferers; i++)
+    {
+        const auto offset = MicroSeconds(b->random->GetInteger(0, 900));
+        const auto duration = MicroSeconds(b->random->GetInteger(50, 300));
+        Simulator::Schedule(offset, &AddInterferer, b, interferer, duration);
+    }
+    Simulator::Schedule(b->ppduDuration, &EndReceive, b, event);
+}
+
+int
+main(int argc, char* argv[])
+{
+    Benchmark b;
+    uint32_t nPpdus = 2000;
+
+    CommandLine cmd(__FILE__);
+    cmd.AddValue("nBands", "Number of bands tracked by the interference helper", b.nBands);
+    cmd.AddValue("nRus", "Number of RUs whose PER is computed for each PPDU", b.nRus);
+    cmd.AddValue("nMpdus", "Number of MPDUs per RU", b.nMpdus);
+    cmd.AddValue("nInterferers", "Number of interfering signals per PPDU", b.nInterferers);
+    cmd.AddValue("nPpdus", "Number of received PPDUs", nPpdus);
+    cmd.Parse(argc, argv);
+
+    RngSeedManager::SetSeed(1);
+    b.random = CreateObject<UniformRandomVariable>();
+    b.interference = CreateObject<InterferenceHelper>();
+    b.interference->SetErrorRateModel(CreateObject<TableBasedErrorRateModel>());
+    b.interference->SetNoiseFigure(DbToRatio(dB_u{7}));
+    b.interference->SetNumberOfReceiveAntennas(1);
+
+    // contiguous bands covering a 320 MHz channel in the 6 GHz band
+    const auto bandWidth = MHz_u{320} / b.nBands;
+    for (uint32_t i = 0; i < b.nBands; i++)
+    {
+        WifiSpectrumBandInfo band;
+        band.indices.emplace_back(i, i);
+        band.frequencies.emplace_back(MHzToHz(MHz_u{5955} + i * bandWidth),
+                                      MHzToHz(MHz_u{5955} + (i + 1) * bandWidth));
+        b.bands.push_back(band);
+        b.interference->AddBand(b.bands.back());
+    }
+
+    WifiTxVector txVector(HePhy::GetHeMcs7(),
+                          0,
+                          WIFI_PREAMBLE_HE_SU,
+                          NanoSeconds(800),
+                          1,
+                          1,
+                          0,
+                          MHz_u{20},
+                          true);
+    auto ppdu = CreatePpdu(txVector);
+    auto interferer = CreatePpdu(txVector);
+
+    for (uint32_t i = 0; i < nPpdus; i++)
+    {
+        Simulator::Schedule(b.ppduDuration * i + MicroSeconds(10) * i,
+                            &StartReceive,
+                            &b,
+                            ppdu,
+                            interferer);
+    }
+    Simulator::Run();
+
+    const auto elapsed = std::chrono::duration<double>(b.elapsed).count();
+    std::cout << "bands: " << b.nBands << ", PPDUs: " << nPpdus
+              << ", PER computations: " << nPpdus * b.nRus * b.nMpdus
+              << ", elapsed: " << elapsed << " s" << std::endl;
+    std::cout.precision(12);
+    std::cout << "SNR checksum: " << b.snrSum << ", PER checksum: " << b.perSum << std::endl;
+
+    Simulator::Destroy();
+    return 0;
+}
@@ -0,0 +1,165 @@
+//
+// SPDX-License-Identifier: GPL-2.0-only
+//
+
+//
+// Benchmark of the WifiMacQueueContainer with a large number of stations.
+//
+// The container is driven directly (no MAC is simulated), the way a WifiMacQueue
+// of an AP serving many stations drives it. Every millisecond, MPDUs addressed
+// to randomly selected stations and TIDs are enqueued with a lifetime of
+// maxDelay, the MPDUs at the head of the queues of a few randomly selected
+// stations are dequeued (as if they were transmitted) and all the MPDUs whose
+// lifetime expired are extracted from the container and removed. The offered
+// load exceeds the served load, hence a significant fraction of the MPDUs
+// expires while queued.
+//
+// The wall-clock time spent in the container is printed at the end, together
+// with the number of enqueued, dequeued and expired MPDUs, which must not depend
+// on the implementation of the container.
+//
+// Usage example:
+//
+//     ./ns3 run "wifi-mac-queue-benchmark --nStations=1000 --duration=2"
+//
+
+#include "ns3/command-line.h"
+#include "ns3/mac48-address.h"
+#include "ns3/nstime.h"
+#include "ns3/packet.h"
+#include "ns3/random-variable-stream.h"
+#include "ns3/rng-seed-manager.h"
+#include "ns3/simulator.h"
+#include "ns3/wifi-mac-header.h"
+#include "ns3/wifi-mac-queue-container.h"
+#include "ns3/wifi-mpdu.h"
+
+#include <chrono>
+#include <functional>
+#include <iostream>
+#include <vector>
+
+using namespace ns3;
+
+/// Benchmark parameters and state
+struct Benchmark
+{
+    uint32_t nStations{1000};                      ///< number of stations
+    uint32_t nEnqueuedPerMs{200};                  ///< number of MPDUs enqueued every ms
+    uint32_t nServedPerMs{20};                     ///< number of stations served every ms
+    uint32_t nDequeuedPerStation{8};               ///< max number of MPDUs dequeued per station
+    Time maxDelay{MilliSeconds(100)};              ///< lifetime of the MPDUs
+    Mac48Address apAddress;                        ///< address of the AP
+    std::vector<Mac48Address> staAddresses;        ///< addresses of the stations
+    WifiMacQueueContainer container;               ///< the MAC queue container
+    Ptr<UniformRandomVariable> random;             ///< random variable
+    uint64_t nEnqueued{0};                         ///< number of enqueued MPDUs
+    uint64_t nDequeued{0};                         ///< number of dequeued MPDUs
+    uint64_t nExpired{0};                          ///< number of expired MPDUs
+    std::chrono::steady_clock::duration elapsed{}; ///< time spent in the container
+};
+
+/**
+ * Enqueue, dequeue and remove the expired MPDUs for one millisecond and
+ * schedule the next round.
+ *
+ * @param b the benchmark
+ * @param end the end of the simulation
+ */
+void
+Round(Benchmark& b, Time end)
+{
+    // create the MPDUs in advance, so that only the container operations are timed
+    std::vector<Ptr<WifiMpdu>> mpdus;
+    for (uint32_t i = 0; i < b.nEnqueuedPerMs; i++)
+    {
+        WifiMacHeader header(WIFI_MAC_QOSDATA);
+        header.SetAddr1(b.staAddresses[b.random->GetInteger(0, b.nStations - 1)]);
+        header.SetAddr2(b.apAddress);
+        header.SetQosTid(b.random->GetInteger(0, 7));
+        mpdus.push_back(Create<WifiMpdu>(Create<Packet>(1000), header));
+    }
+    std::vector<WifiContainerQueueId> servedQueues;
+    for (uint32_t i = 0; i < b.nServedPerMs; i++)
+    {
+        servedQueues.emplace_back(WIFI_QOSDATA_QUEUE,
+                                  WIFI_UNICAST,
+                                  b.staAddresses[b.random->GetInteger(0, b.nStations - 1)],
+                                  b.random->GetInteger(0, 7));
+    }
+
+    const auto start = std::chrono::steady_clock::now();
+
+    for (const auto& mpdu : mpdus)
+    {
+        auto queueId = WifiMacQueueContainer::GetQueueId(mpdu);
+        auto it = b.container.insert(b.container.GetQueue(queueId).cend(), mpdu);
+        it->deleter = [](auto mpdu) {};
+        b.container.SetExpiryTime(it, Simulator::Now() + b.maxDelay);
+        b.nEnqueued++;
+    }
+    for (const auto& queueId : servedQueues)
+    {
+        const auto& queue = b.container.GetQueue(queueId);
+        for (uint32_t i = 0; i < b.nDequeuedPerStation && !queue.empty(); i++)
+        {
+            b.container.erase(queue.cbegin());
+            b.nDequeued++;
+        }
+    }
+    b.container.ExtractAllExpiredMpdus();
+    for (auto [it, last] = b.container.GetAllExpiredMpdus(); it != last;)
+    {
+        it = b.container.erase(it);
+        b.nExpired++;
+    }
+
+    b.elapsed += std::chrono::steady_clock::now() - start;
+
+    if (Simulator::Now() + MilliSeconds(1) < end)
+    {
+        Simulator::Schedule(MilliSeconds(1), &Round, std::ref(b), end);
+    }
+}
+
+int
+main(int argc, char* argv[])
+{
+    Benchmark b;
+    double duration = 2; // seconds
+
+    CommandLine cmd(__FILE__);
+    cmd.AddValue("nStations", "Number of stations", b.nStations);
+    cmd.AddValue("nEnqueuedPerMs", "Number of MPDUs enqueued every ms", b.nEnqueuedPerMs);
+    cmd.AddValue("nServedPerMs", "Number of stations served every ms", b.nServedPerMs);
+    cmd.AddValue("nDequeuedPerStation",
+                 "Max number of MPDUs dequeued per served station",
+                 b.nDequeuedPerStation);
+    cmd.AddValue("maxDelay", "Lifetime of the MPDUs", b.maxDelay);
+    cmd.AddValue("duration", "Simulated time in seconds", duration);
+    cmd.Parse(argc, argv);
+
+    RngSeedManager::SetSeed(1);
+    RngSeedManager::SetRun(1);
+
+    b.apAddress = Mac48Address::Allocate();
+    for (uint32_t i = 0; i < b.nStations; i++)
+    {
+        b.staAddresses.push_back(Mac48Address::Allocate());
+    }
+    b.random = CreateObject<UniformRandomVariable>();
+    b.random->SetStream(1);
+
+    Simulator::ScheduleNow(&Round, std::ref(b), Seconds(duration));
+    Simulator::Run();
+    Simulator::Destroy();
+
+    const auto elapsed = std::chrono::duration<double>(b.elapsed).count();
+    std::cout << "stations: " << b.nStations << ", enqueued: " << b.nEnqueued
+              << ", dequeued: " << b.nDequeued << ", expired: " << b.nExpired
+              << ", still queued: " << b.nEnqueued - b.nDequeued - b.nExpired << std::endl;
+    std::cout << "time spent in the container: " << elapsed << " s, "
+              << (b.nEnqueued + b.nDequeued + b.nExpired) / elapsed << " ops/s" << std::endl;
+
+    return 0;
+}
@@ -46,6 +46,13 @@
 // can be configured to place the OBSS within or outside of carrier sense range.
 // The command-line options 'enableTwoBss' and 'distanceTwoBss' can be used
 // to optionally enable and configure the second BSS.
+//
+// The reception records can also be written to a compact binary file by means of the
+// 'binaryTrace' command-line option; such a file can be converted to CSV format with the
+// wifi-phy-rx-trace-reader.py script found in this directory:
+//
+// ./ns3 run "wifi-phy-rx-trace-example --binaryTrace=wifi-phy-rx-trace-example.bin"
+// python3 src/wifi/examples/wifi-phy-rx-trace-reader.py wifi-phy-rx-trace-example.bin
 
 #include "ns3/command-line.h"
 #include "ns3/config.h"
@@ -137,6 +144,7 @@ main(int argc, char* argv[])
     Time interval = Seconds(1);
     bool verbose = true;
     bool logging = false;
+    std::string binaryTrace;
 
     CommandLine cmd(__FILE__);
     cmd.AddValue("packetSize", "size of application packet sent", packetSize);
@@ -147,6 +155,7 @@ main(int argc, char* argv[])
     cmd.AddValue("distanceTwoBss", "distance between BSS (meters)", distanceTwoBss);
     cmd.AddValue("logging", "enable all wifi module log components", logging);
     cmd.AddValue("verbose", "enable this program's log components", verbose);
+    cmd.AddValue("binaryTrace", "name of the binary file to write records to", binaryTrace);
     cmd.Parse(argc, argv);
 
     if (numPackets == 0)
@@ -296,6 +305,11 @@ main(int argc, char* argv[])
     WifiPhyRxTraceHelper rxTraceHelper;
     // Enable trace helper only on one BSS
     rxTraceHelper.Enable(c);
+    if (!binaryTrace.empty())
+    {
+        // keep the records in memory as well, since they are printed below
+        rxTraceHelper.EnableBinaryOutput(binaryTrace, true);
+    }
     rxTraceHelper.Start(MilliSeconds(999)); // 1 ms before applications
     // The last packet will be sent at time 1 sec. + (numPackets - 1) * interval
     // Configure the stop time to be 1 sec. later than this.
@@ -0,0 +1,156 @@
+#
+# SPDX-License-Identifier: GPL-2.0-only
+#
+
+"""
+Read a binary Wi-Fi PHY reception trace file, as written by the WifiPhyRxTraceHelper
+(see WifiPhyRxTraceHelper::EnableBinaryOutput), and print its records in CSV format.
+
+Usage:
+
+    python3 wifi-phy-rx-trace-reader.py wifi-phy-rx-trace.bin > records.csv
+
+The read_trace() function can also be imported to load the columns of a file, e.g., into
+numpy arrays or pandas data frames.
+"""
+
+import array
+import struct
+import sys
+
+## Magic string at the beginning of the file
+MAGIC = b"ns3-wprx"
+## Supported version of the file format
+VERSION = 1
+## Names and array type codes of the columns of a block, in the order they are stored
+COLUMNS = [
+    ("start_ns", "q"),
+    ("end_ns", "q"),
+    ("rssi_dbm", "f"),
+    ("ppdu_uid", "Q"),
+    ("receiver_id", "I"),
+    ("receiver_device_id", "H"),
+    ("link_id", "B"),
+    ("sender_id", "I"),
+    ("sender_device_id", "H"),
+    ("reason", "B"),
+    ("n_mpdus", "H"),
+    ("n_successful_mpdus", "H"),
+    ("n_overlapping_ppdus", "H"),
+    ("mac_type", "B"),
+    ("addr1", "I"),
+    ("addr2", "I"),
+]
+## Value stored for absent addresses
+NO_ADDRESS = 0xFFFFFFFF
+## Names of the WifiPhyRxfailureReason values (UNKNOWN, i.e., 0, means that the PPDU was not
+## dropped)
+REASONS = [
+    "",
+    "UNSUPPORTED_SETTINGS",
+    "CHANNEL_SWITCHING",
+    "RXING",
+    "TXING",
+    "SLEEPING",
+    "POWERED_OFF",
+    "TRUNCATED_TX",
+    "BUSY_DECODING_PREAMBLE",
+    "PREAMBLE_DETECT_FAILURE",
+    "RECEPTION_ABORTED_BY_TX",
+    "L_SIG_FAILURE",
+    "HT_SIG_FAILURE",
+    "SIG_A_FAILURE",
+    "SIG_B_FAILURE",
+    "U_SIG_FAILURE",
+    "EHT_SIG_FAILURE",
+    "PREAMBLE_DETECTION_PACKET_SWITCH",
+    "FRAME_CAPTURE_PACKET_SWITCH",
+    "OBSS_PD_CCA_RESET",
+    "PPDU_TOO_LATE",
+    "FILTERED",
+    "DMG_HEADER_FAILURE",
+    "DMG_ALLOCATION_ENDED",
+    "SIGNAL_DETECTION_ABORTED_BY_TX",
+]
+
+
+def _read_exactly(f, size):
+    """! Read the given number of bytes from the given file.
+    @param f The file object.
+    @param size The number of bytes.
+    @return The bytes read.
+    """
+    data = f.read(size)
+    if len(data) != size:
+        raise ValueError("Truncated Wi-Fi PHY reception trace file")
+    return data
+
+
+def read_trace(filename):
+    """! Read all the records of the given file.
+    @param filename The name of the file.
+    @return A tuple made of the address dictionary (a list of strings, indexed by the values
+    of the addr1 and addr2 columns) and a dictionary mapping each column name to an array.
+    """
+    dictionary = []
+    columns = {name: array.array(code) for name, code in COLUMNS}
+    for name, code in COLUMNS:
+        if columns[name].itemsize != struct.calcsize("<" + code):
+            raise RuntimeError("Unsupported size of array type code " + code)
+
+    with open(filename, "rb") as f:
+        header = _read_exactly(f, len(MAGIC) + 4)
+        if header[: len(MAGIC)] != MAGIC:
+            raise ValueError(filename + " is not a Wi-Fi PHY reception trace file")
+        (version,) = struct.unpack("<I", header[len(MAGIC) :])
+        if version != VERSION:
+            raise ValueError("Unsupported version (%d) of %s" % (version, filename))
+
+        while True:
+            data = f.read(4)
+            if not data:
+                break
+            if len(data) != 4:
+                raise ValueError("Truncated Wi-Fi PHY reception trace file")
+            (n_addresses,) = struct.unpack("<I", data)
+            addresses = _read_exactly(f, 6 * n_addresses)
+            for i in range(n_addresses):
+                dictionary.append(":".join("%02x" % b for b in addresses[6 * i : 6 * i + 6]))
+            (n_records,) = struct.unpack("<I", _read_exactly(f, 4))
+            for name, code in COLUMNS:
+                column = array.array(code)
+                column.frombytes(_read_exactly(f, column.itemsize * n_records))
+                if sys.byteorder == "big":
+                    column.byteswap()
+                columns[name].extend(column)
+
+    return dictionary, columns
+
+
+def main(argv):
+    if len(argv) != 2:
+        print("Usage: %s <trace file>" % argv[0], file=sys.stderr)
+        return 1
+
+    dictionary, columns = read_trace(argv[1])
+
+    def address(index):
+        return "" if index == NO_ADDRESS else dictionary[index]
+
+    def reason(value):
+        return REASONS[value] if value < len(REASONS) else str(value)
+
+    names = [name for name, _ in COLUMNS]
+    print(",".join(names))
+    for i in range(len(columns["start_ns"])):
+        row = [columns[name][i] for name in names]
+        row[names.index("rssi_dbm")] = "%.2f" % row[names.index("rssi_dbm")]
+        row[names.index("reason")] = reason(row[names.index("reason")])
+        row[names.index("addr1")] = address(row[names.index("addr1")])
+        row[names.index("addr2")] = address(row[names.index("addr2")])
+        print(",".join(str(value) for value in row))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv))
@@ -0,0 +1,185 @@
+//
+// SPDX-License-Identifier: GPL-2.0-only
+//
+
+//
+// Benchmark of the per-frame overhead of the remote station manager of an AP
+// serving a large number of stations.
+//
+// An 802.11ax AP is installed on a node and the given number of stations are
+// registered with its remote station manager, as if they had associated with
+// the AP. Then, frames addressed to randomly selected stations are "transmitted"
+// every frameInterval: for each frame, the remote station manager is asked to
+// select the TX vector and whether RTS/CTS protection is needed, and the
+// outcome of the transmission (successful with probability 1 - lossProb) is
+// reported to the remote station manager. No frame is actually transmitted.
+//
+// The wall-clock time spent in the remote station manager is printed at the end,
+// together with a checksum of the selected modes, which must not depend on the
+// implementation of the station table.
+//
+// Usage example:
+//
+//     ./ns3 run "wifi-remote-station-manager-benchmark --nStations=1000 --nFrames=200000"
+//
+
+#include "ns3/ap-wifi-mac.h"
+#include "ns3/boolean.h"
+#include "ns3/command-line.h"
+#include "ns3/mac48-address.h"
+#include "ns3/node-container.h"
+#include "ns3/nstime.h"
+#include "ns3/packet.h"
+#include "ns3/random-variable-stream.h"
+#include "ns3/rng-seed-manager.h"
+#include "ns3/simulator.h"
+#include "ns3/ssid.h"
+#include "ns3/wifi-acknowledgment.h"
+#include "ns3/wifi-helper.h"
+#include "ns3/wifi-mac-header.h"
+#include "ns3/wifi-mpdu.h"
+#include "ns3/wifi-net-device.h"
+#include "ns3/wifi-protection.h"
+#include "ns3/wifi-remote-station-manager.h"
+#include "ns3/wifi-tx-parameters.h"
+#include "ns3/yans-wifi-helper.h"
+
+#include <chrono>
+#include <functional>
+#include <iostream>
+#include <vector>
+
+using namespace ns3;
+
+/// Benchmark parameters and state
+struct Benchmark
+{
+    uint32_t nStations{1000};                      ///< number of stations
+    uint32_t nFrames{200000};                      ///< number of transmitted frames
+    double lossProb{0.1};                          ///< probability that a frame is lost
+    Time frameInterval{MicroSeconds(100)};         ///< interval between frames
+    Ptr<WifiRemoteStationManager> manager;         ///< the remote station manager of the AP
+    std::vector<Ptr<WifiMpdu>> mpdus;              ///< an MPDU addressed to each station
+    Ptr<UniformRandomVariable> random;             ///< random variable
+    uint32_t nSent{0};                             ///< number of transmitted frames
+    uint64_t checksum{0};                          ///< checksum of the selected modes
+    std::chrono::steady_clock::duration elapsed{}; ///< time spent in the station manager
+};
+
+/**
+ * Transmit a frame to a randomly selected station and schedule the next frame.
+ *
+ * @param b the benchmark
+ */
+void
+SendFrame(Benchmark& b)
+{
+    // draw the recipient and the outcome in advance, so that only the station manager is timed
+    const auto& mpdu = b.mpdus[b.random->GetInteger(0, b.nStations - 1)];
+    const auto lost = (b.random->GetValue() < b.lossProb);
+    const auto& hdr = mpdu->GetHeader();
+
+    auto start = std::chrono::steady_clock::now();
+    auto txVector = b.manager->GetDataTxVector(mpdu, MHz_u{20});
+    b.elapsed += std::chrono::steady_clock::now() - start;
+
+    // the TX parameters are prepared by the frame exchange manager, hence they are not timed
+    WifiTxParameters txParams;
+    txParams.m_txVector = txVector;
+    txParams.AddMpdu(mpdu);
+    txParams.m_txDuration = b.frameInterval / 2;
+
+    start = std::chrono::steady_clock::now();
+    const auto rts = b.manager->NeedRts(hdr, txParams);
+    if (lost)
+    {
+        b.manager->ReportDataFailed(mpdu);
+    }
+    else
+    {
+        b.manager->ReportDataOk(mpdu, 30.0, txVector.GetMode(), 30.0, txVector);
+    }
+
+    b.elapsed += std::chrono::steady_clock::now() - start;
+
+    b.checksum = b.checksum * 31 + txVector.GetMode().GetUid() + (rts ? 1 : 0);
+
+    if (++b.nSent < b.nFrames)
+    {
+        Simulator::Schedule(b.frameInterval, &SendFrame, std::ref(b));
+    }
+}
+
+int
+main(int argc, char* argv[])
+{
+    Benchmark b;
+    std::string manager{"ns3::ConstantRateWifiManager"};
+
+    CommandLine cmd(__FILE__);
+    cmd.AddValue("nStations", "Number of stations", b.nStations);
+    cmd.AddValue("nFrames", "Number of transmitted frames", b.nFrames);
+    cmd.AddValue("lossProb", "Probability that a frame is lost", b.lossProb);
+    cmd.AddValue("frameInterval", "Interval between frames", b.frameInterval);
+    cmd.AddValue("manager", "Type of the remote station manager", manager);
+    cmd.Parse(argc, argv);
+
+    RngSeedManager::SetSeed(1);
+    RngSeedManager::SetRun(1);
+
+    NodeContainer apNode(1);
+
+    WifiHelper wifi;
+    wifi.SetStandard(WIFI_STANDARD_80211ax);
+    wifi.SetRemoteStationManager(manager);
+
+    YansWifiPhyHelper phy;
+    phy.SetChannel(YansWifiChannelHelper::Default().Create());
+
+    WifiMacHelper mac;
+    mac.SetType("ns3::ApWifiMac",
+                "Ssid",
+                SsidValue(Ssid("ns-3-ssid")),
+                "BeaconGeneration",
+                BooleanValue(false));
+
+    auto apDevice = DynamicCast<WifiNetDevice>(wifi.Install(phy, mac, apNode).Get(0));
+    auto apMac = apDevice->GetMac();
+    b.manager = apDevice->GetRemoteStationManager();
+
+    // register the stations as if they had associated with the AP
+    for (uint32_t i = 0; i < b.nStations; i++)
+    {
+        const auto address = Mac48Address::Allocate();
+        b.manager->AddAllSupportedModes(address);
+        b.manager->AddStationHtCapabilities(address, apMac->GetHtCapabilities(SINGLE_LINK_OP_ID));
+        b.manager->AddStationVhtCapabilities(address,
+                                             apMac->GetVhtCapabilities(SINGLE_LINK_OP_ID));
+        b.manager->AddStationHeCapabilities(address, apMac->GetHeCapabilities(SINGLE_LINK_OP_ID));
+        b.manager->RecordWaitAssocTxOk(address);
+        b.manager->RecordGotAssocTxOk(address);
+
+        WifiMacHeader hdr(WIFI_MAC_QOSDATA);
+        hdr.SetAddr1(address);
+        hdr.SetAddr2(apMac->GetAddress());
+        hdr.SetAddr3(apMac->GetAddress());
+        hdr.SetDsFrom();
+        hdr.SetDsNotTo();
+        b.mpdus.push_back(Create<WifiMpdu>(Create<Packet>(1000), hdr));
+    }
+
+    b.random = CreateObject<UniformRandomVariable>();
+    b.random->SetStream(1);
+
+    Simulator::ScheduleNow(&SendFrame, std::ref(b));
+    Simulator::Run();
+    Simulator::Destroy();
+
+    const auto elapsed = std::chrono::duration<double>(b.elapsed).count();
+    std::cout << "stations: " << b.nStations << ", frames: " << b.nSent << ", checksum "
+              << b.checksum << std::endl;
+    std::cout << "time spent in the station manager: " << elapsed << " s, "
+              << elapsed / b.nSent * 1e9 << " ns/frame" << std::endl;
+
+    return 0;
+}
@@ -112,6 +112,19 @@ SpectrumWifiPhyHelper::ResetPhyToFreqRangeMapping()
     m_interfacesMap.clear();
 }
 
+void
+SpectrumWifiPhyHelper::SetPhyType(const std::string& type)
+{
+    const auto tid = TypeId::LookupByName(type);
+    NS_ABORT_MSG_IF(tid != SpectrumWifiPhy::GetTypeId() &&
+                        !tid.IsChildOf(SpectrumWifiPhy::GetTypeId()),
+                    type << " is not a SpectrumWifiPhy");
+    for (auto& phy : m_phys)
+    {
+        phy.SetTypeId(tid);
+    }
+}
+
 std::vector<Ptr<WifiPhy>>
 SpectrumWifiPhyHelper::Create(Ptr<Node> node, Ptr<WifiNetDevice> device) const
 {
@@ -89,6 +89,15 @@ class SpectrumWifiPhyHelper : public WifiPhyHelper
      */
     void ResetPhyToFreqRangeMapping();
 
+    /**
+     * Set the type of the PHY objects created by this helper, which must be
+     * SpectrumWifiPhy (default) or a subclass of it, e.g., AbstractWifiPhy to
+     * abstract the reception of the incoming PPDUs in large scenarios.
+     *
+     * @param type the type ID of the PHY objects
+     */
+    void SetPhyType(const std::string& type);
+
   private:
     /**
      * @param node the node on which we wish to create a wifi PHY
@@ -17,6 +17,7 @@
 #include "ns3/eht-ppdu.h"
 #include "ns3/he-configuration.h"
 #include "ns3/ht-configuration.h"
+#include "ns3/ht-frame-exchange-manager.h"
 #include "ns3/log.h"
 #include "ns3/mobility-model.h"
 #include "ns3/names.h"
@@ -1340,4 +1341,59 @@ WifiHelper::AssignStreams(NetDeviceContainer c, int64_t stream)
     return (currentStream - stream);
 }
 
+void
+WifiHelper::FastForwardAssociation(Ptr<NetDevice> apDevice, const NetDeviceContainer& staDevices)
+{
+    auto apMac = DynamicCast<ApWifiMac>(DynamicCast<WifiNetDevice>(apDevice)->GetMac());
+    NS_ABORT_MSG_IF(!apMac, "The given device is not an AP");
+
+    for (auto i = staDevices.Begin(); i != staDevices.End(); ++i)
+    {
+        auto staMac = DynamicCast<StaWifiMac>(DynamicCast<WifiNetDevice>(*i)->GetMac());
+        NS_ABORT_MSG_IF(!staMac, "Device " << (*i)->GetAddress() << " is not a non-AP STA");
+        staMac->FastForwardAssociation(apMac);
+    }
+}
+
+void
+WifiHelper::FastForwardBaAgreements(Ptr<NetDevice> apDevice,
+                                    const NetDeviceContainer& staDevices,
+                                    const std::set<uint8_t>& tids,
+                                    bool downlink,
+                                    bool uplink)
+{
+    auto apMac = DynamicCast<ApWifiMac>(DynamicCast<WifiNetDevice>(apDevice)->GetMac());
+    NS_ABORT_MSG_IF(!apMac, "The given device is not an AP");
+
+    for (auto i = staDevices.Begin(); i != staDevices.End(); ++i)
+    {
+        auto staMac = DynamicCast<StaWifiMac>(DynamicCast<WifiNetDevice>(*i)->GetMac());
+        NS_ABORT_MSG_IF(!staMac || !staMac->IsAssociated(),
+                        "Device " << (*i)->GetAddress() << " is not an associated non-AP STA");
+
+        // Block Ack agreements are established by MLDs, hence any setup link can be used
+        const auto staLinkId = *staMac->GetSetupLinkIds().begin();
+        const auto apLinkId = apMac->GetLinkIdByAddress(staMac->GetBssid(staLinkId));
+        NS_ASSERT(apLinkId);
+
+        auto apFem =
+            DynamicCast<HtFrameExchangeManager>(apMac->GetFrameExchangeManager(*apLinkId));
+        auto staFem =
+            DynamicCast<HtFrameExchangeManager>(staMac->GetFrameExchangeManager(staLinkId));
+        NS_ABORT_MSG_IF(!apFem || !staFem, "Block Ack agreements require HT support");
+
+        for (const auto tid : tids)
+        {
+            if (downlink)
+            {
+                apFem->FastForwardBaAgreement(staFem, tid);
+            }
+            if (uplink)
+            {
+                staFem->FastForwardBaAgreement(apFem, tid);
+            }
+        }
+    }
+}
+
 } // namespace ns3
@@ -20,6 +20,7 @@
 
 #include <functional>
 #include <map>
+#include <set>
 #include <vector>
 
 namespace ns3
@@ -600,6 +601,41 @@ class WifiHelper
      */
     static int64_t AssignStreams(NetDeviceContainer c, int64_t stream);
 
+    /**
+     * Associate the given stations with the given AP without exchanging any frame over the
+     * air, as if the association procedure (including the multi-link setup, if both the AP
+     * and the stations are multi-link devices, and the enabling of the EMLSR mode, if
+     * requested by the EMLSR manager of the stations) had been completed before the start of
+     * the simulation. Only the links of the stations that operate on the same channel as a
+     * link of the AP are set up. All the setup links are in active mode at the start of the
+     * simulation; links requested to operate in power save mode switch to power save mode
+     * right after the start of the simulation. This method must be called after Install()
+     * and before the simulation starts.
+     *
+     * @param apDevice the AP device
+     * @param staDevices the devices of the stations to associate with the AP
+     */
+    static void FastForwardAssociation(Ptr<NetDevice> apDevice,
+                                       const NetDeviceContainer& staDevices);
+
+    /**
+     * Establish Block Ack agreements for the given TIDs between the given AP and the given
+     * stations without exchanging ADDBA Request/Response frames over the air. The stations
+     * must be associated with the AP, e.g., via FastForwardAssociation(). This method must
+     * be called before the simulation starts.
+     *
+     * @param apDevice the AP device
+     * @param staDevices the devices of the stations associated with the AP
+     * @param tids the TIDs for which Block Ack agreements are established
+     * @param downlink whether to establish Block Ack agreements in which the AP is the originator
+     * @param uplink whether to establish Block Ack agreements in which the AP is the recipient
+     */
+    static void FastForwardBaAgreements(Ptr<NetDevice> apDevice,
+                                        const NetDeviceContainer& staDevices,
+                                        const std::set<uint8_t>& tids,
+                                        bool downlink = true,
+                                        bool uplink = true);
+
   protected:
     mutable std::vector<ObjectFactory> m_stationManager; ///< station manager
     WifiStandard m_standard;                             ///< wifi standard
@@ -0,0 +1,310 @@
+/*
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+#include "wifi-phy-rx-trace-file.h"
+
+#include "ns3/abort.h"
+#include "ns3/assert.h"
+#include "ns3/log.h"
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+
+namespace ns3
+{
+
+NS_LOG_COMPONENT_DEFINE("WifiPhyRxTraceFile");
+
+namespace
+{
+
+/// Magic string at the beginning of the file
+constexpr std::array<char, 8> MAGIC{'n', 's', '3', '-', 'w', 'p', 'r', 'x'};
+
+/// Value stored for absent addresses
+constexpr uint32_t NO_ADDRESS = std::numeric_limits<uint32_t>::max();
+
+/**
+ * Append the given number of bytes of the given value to the given buffer, in little-endian
+ * byte order.
+ *
+ * @param buffer the buffer
+ * @param value the value
+ * @param size the number of bytes
+ */
+void
+AppendLe(std::vector<uint8_t>& buffer, uint64_t value, std::size_t size)
+{
+    for (std::size_t i = 0; i < size; i++)
+    {
+        buffer.push_back(static_cast<uint8_t>(value >> (8 * i)));
+    }
+}
+
+/**
+ * @param data pointer to the first byte of the value
+ * @param size the number of bytes
+ * @return the value stored in little-endian byte order at the given location
+ */
+uint64_t
+ReadLe(const uint8_t* data, std::size_t size)
+{
+    uint64_t value = 0;
+    for (std::size_t i = 0; i < size; i++)
+    {
+        value |= static_cast<uint64_t>(data[i]) << (8 * i);
+    }
+    return value;
+}
+
+/**
+ * @param value a single precision floating point value
+ * @return the bit pattern of the given value
+ */
+uint32_t
+FloatToBits(float value)
+{
+    uint32_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    return bits;
+}
+
+/**
+ * @param bits the bit pattern of a single precision floating point value
+ * @return the value
+ */
+float
+BitsToFloat(uint32_t bits)
+{
+    float value;
+    std::memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+/**
+ * Read the given number of bytes from the given stream, aborting on a truncated file.
+ *
+ * @param file the file
+ * @param size the number of bytes
+ * @return the bytes read
+ */
+std::vector<uint8_t>
+ReadBytes(std::ifstream& file, std::size_t size)
+{
+    std::vector<uint8_t> buffer(size);
+    file.read(reinterpret_cast<char*>(buffer.data()), size);
+    NS_ABORT_MSG_IF(static_cast<std::size_t>(file.gcount()) != size,
+                    "Truncated Wi-Fi PHY reception trace file");
+    return buffer;
+}
+
+} // namespace
+
+WifiPhyRxTraceFileWriter::WifiPhyRxTraceFileWriter(const std::string& filename,
+                                                   uint32_t blockSize)
+    : m_file(filename, std::ios::binary | std::ios::trunc),
+      m_blockSize(blockSize)
+{
+    NS_LOG_FUNCTION(this << filename << blockSize);
+    NS_ABORT_MSG_IF(!m_file.is_open(), "Could not open " << filename);
+    NS_ABORT_MSG_IF(m_blockSize == 0, "The block size cannot be null");
+    m_block.reserve(m_blockSize);
+
+    std::vector<uint8_t> header(MAGIC.cbegin(), MAGIC.cend());
+    AppendLe(header, VERSION, 4);
+    m_file.write(reinterpret_cast<const char*>(header.data()), header.size());
+}
+
+WifiPhyRxTraceFileWriter::~WifiPhyRxTraceFileWriter()
+{
+    NS_LOG_FUNCTION(this);
+    Flush();
+}
+
+uint32_t
+WifiPhyRxTraceFileWriter::GetAddressIndex(const std::optional<Mac48Address>& address)
+{
+    if (!address)
+    {
+        return NO_ADDRESS;
+    }
+    auto [it, inserted] = m_dictionary.emplace(*address, m_dictionary.size());
+    if (inserted)
+    {
+        m_newAddresses.push_back(*address);
+    }
+    return it->second;
+}
+
+void
+WifiPhyRxTraceFileWriter::Write(const WifiPhyRxTraceFileRecord& record)
+{
+    NS_LOG_FUNCTION(this);
+    m_block.push_back(record);
+    m_nRecords++;
+    if (m_block.size() == m_blockSize)
+    {
+        Flush();
+    }
+}
+
+void
+WifiPhyRxTraceFileWriter::Flush()
+{
+    NS_LOG_FUNCTION(this << m_block.size());
+
+    if (m_block.empty())
+    {
+        return;
+    }
+
+    // the dictionary entries must precede the block using them
+    std::vector<uint32_t> addr1(m_block.size());
+    std::vector<uint32_t> addr2(m_block.size());
+    for (std::size_t i = 0; i < m_block.size(); i++)
+    {
+        addr1[i] = GetAddressIndex(m_block[i].m_addr1);
+        addr2[i] = GetAddressIndex(m_block[i].m_addr2);
+    }
+
+    std::vector<uint8_t> buffer;
+    AppendLe(buffer, m_newAddresses.size(), 4);
+    for (const auto& address : m_newAddresses)
+    {
+        uint8_t bytes[6];
+        address.CopyTo(bytes);
+        buffer.insert(buffer.end(), bytes, bytes + 6);
+    }
+    AppendLe(buffer, m_block.size(), 4);
+
+    // append a column, given the size of its values and the function returning a value
+    auto appendColumn = [&](std::size_t size, auto&& getValue) {
+        for (std::size_t i = 0; i < m_block.size(); i++)
+        {
+            AppendLe(buffer, getValue(i), size);
+        }
+    };
+
+    appendColumn(8, [&](auto i) { return m_block[i].m_startTime.GetNanoSeconds(); });
+    appendColumn(8, [&](auto i) { return m_block[i].m_endTime.GetNanoSeconds(); });
+    appendColumn(4, [&](auto i) { return FloatToBits(m_block[i].m_rssi); });
+    appendColumn(8, [&](auto i) { return m_block[i].m_ppduUid; });
+    appendColumn(4, [&](auto i) { return m_block[i].m_receiverId; });
+    appendColumn(2, [&](auto i) { return m_block[i].m_receiverDeviceId; });
+    appendColumn(1, [&](auto i) { return m_block[i].m_linkId; });
+    appendColumn(4, [&](auto i) { return m_block[i].m_senderId; });
+    appendColumn(2, [&](auto i) { return m_block[i].m_senderDeviceId; });
+    appendColumn(1, [&](auto i) { return m_block[i].m_reason; });
+    appendColumn(2, [&](auto i) { return m_block[i].m_nMpdus; });
+    appendColumn(2, [&](auto i) { return m_block[i].m_nSuccessfulMpdus; });
+    appendColumn(2, [&](auto i) { return m_block[i].m_nOverlappingPpdus; });
+    appendColumn(1, [&](auto i) { return m_block[i].m_macType; });
+    appendColumn(4, [&](auto i) { return addr1[i]; });
+    appendColumn(4, [&](auto i) { return addr2[i]; });
+
+    m_file.write(reinterpret_cast<const char*>(buffer.data()), buffer.size());
+    m_file.flush();
+    NS_ABORT_MSG_IF(!m_file, "Error writing the Wi-Fi PHY reception trace file");
+
+    m_block.clear();
+    m_newAddresses.clear();
+}
+
+uint64_t
+WifiPhyRxTraceFileWriter::GetNRecords() const
+{
+    return m_nRecords;
+}
+
+WifiPhyRxTraceFileReader::WifiPhyRxTraceFileReader(const std::string& filename)
+    : m_file(filename, std::ios::binary)
+{
+    NS_LOG_FUNCTION(this << filename);
+    NS_ABORT_MSG_IF(!m_file.is_open(), "Could not open " << filename);
+
+    const auto header = ReadBytes(m_file, MAGIC.size() + 4);
+    NS_ABORT_MSG_IF(!std::equal(MAGIC.cbegin(), MAGIC.cend(), header.cbegin()),
+                    filename << " is not a Wi-Fi PHY reception trace file");
+    const auto version = ReadLe(header.data() + MAGIC.size(), 4);
+    NS_ABORT_MSG_IF(version != WifiPhyRxTraceFileWriter::VERSION,
+                    "Unsupported version (" << version << ") of " << filename);
+}
+
+bool
+WifiPhyRxTraceFileReader::ReadBlock()
+{
+    NS_LOG_FUNCTION(this);
+
+    if (m_file.peek() == std::ifstream::traits_type::eof())
+    {
+        return false;
+    }
+
+    const auto nAddresses = ReadLe(ReadBytes(m_file, 4).data(), 4);
+    const auto addresses = ReadBytes(m_file, 6 * nAddresses);
+    for (std::size_t i = 0; i < nAddresses; i++)
+    {
+        Mac48Address address;
+        address.CopyFrom(addresses.data() + 6 * i);
+        m_dictionary.push_back(address);
+    }
+
+    const auto nRecords = ReadLe(ReadBytes(m_file, 4).data(), 4);
+    m_block.assign(nRecords, {});
+    m_next = 0;
+
+    // read a column, given the size of its values and the function storing a value
+    auto readColumn = [&](std::size_t size, auto&& setValue) {
+        const auto column = ReadBytes(m_file, size * nRecords);
+        for (std::size_t i = 0; i < nRecords; i++)
+        {
+            setValue(m_block[i], ReadLe(column.data() + size * i, size));
+        }
+    };
+    // return the address corresponding to the given dictionary index
+    auto getAddress = [this](uint64_t index) -> std::optional<Mac48Address> {
+        if (index == NO_ADDRESS)
+        {
+            return std::nullopt;
+        }
+        NS_ABORT_MSG_IF(index >= m_dictionary.size(), "Invalid address index " << index);
+        return m_dictionary[index];
+    };
+
+    readColumn(8, [](auto& r, auto v) { r.m_startTime = NanoSeconds(static_cast<int64_t>(v)); });
+    readColumn(8, [](auto& r, auto v) { r.m_endTime = NanoSeconds(static_cast<int64_t>(v)); });
+    readColumn(4, [](auto& r, auto v) { r.m_rssi = BitsToFloat(v); });
+    readColumn(8, [](auto& r, auto v) { r.m_ppduUid = v; });
+    readColumn(4, [](auto& r, auto v) { r.m_receiverId = v; });
+    readColumn(2, [](auto& r, auto v) { r.m_receiverDeviceId = v; });
+    readColumn(1, [](auto& r, auto v) { r.m_linkId = v; });
+    readColumn(4, [](auto& r, auto v) { r.m_senderId = v; });
+    readColumn(2, [](auto& r, auto v) { r.m_senderDeviceId = v; });
+    readColumn(1, [](auto& r, auto v) { r.m_reason = static_cast<WifiPhyRxfailureReason>(v); });
+    readColumn(2, [](auto& r, auto v) { r.m_nMpdus = v; });
+    readColumn(2, [](auto& r, auto v) { r.m_nSuccessfulMpdus = v; });
+    readColumn(2, [](auto& r, auto v) { r.m_nOverlappingPpdus = v; });
+    readColumn(1, [](auto& r, auto v) { r.m_macType = static_cast<WifiMacType>(v); });
+    readColumn(4, [&](auto& r, auto v) { r.m_addr1 = getAddress(v); });
+    readColumn(4, [&](auto& r, auto v) { r.m_addr2 = getAddress(v); });
+
+    return true;
+}
+
+bool
+WifiPhyRxTraceFileReader::Read(WifiPhyRxTraceFileRecord& record)
+{
+    while (m_next == m_block.size())
+    {
+        if (!ReadBlock())
+        {
+            return false;
+        }
+    }
+    record = m_block[m_next++];
+    return true;
+}
+
+} // namespace ns3
@@ -0,0 +1,174 @@
+/*
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+#ifndef WIFI_PHY_RX_TRACE_FILE_H
+#define WIFI_PHY_RX_TRACE_FILE_H
+
+#include "ns3/mac48-address.h"
+#include "ns3/nstime.h"
+#include "ns3/wifi-mac-header.h"
+#include "ns3/wifi-phy-common.h"
+#include "ns3/wifi-units.h"
+
+#include <cstdint>
+#include <fstream>
+#include <limits>
+#include <map>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace ns3
+{
+
+/**
+ * @struct WifiPhyRxTraceFileRecord
+ * @brief A PPDU reception record, as stored in a binary Wi-Fi PHY reception trace file.
+ *
+ * This is a flattened version of the WifiPpduRxRecord, which does not hold a pointer to the PPDU
+ * and only holds the number of overlapping PPDUs, so that it can be stored with a fixed width.
+ */
+struct WifiPhyRxTraceFileRecord
+{
+    Time m_startTime;      ///< start time of the PPDU reception
+    Time m_endTime;        ///< end time of the PPDU reception
+    dBm_u m_rssi{0};       ///< received signal power (stored with single precision)
+    uint64_t m_ppduUid{0}; ///< UID of the PPDU
+
+    /// node ID of the receiver
+    uint32_t m_receiverId{std::numeric_limits<uint32_t>::max()};
+    /// device ID of the receiver
+    uint16_t m_receiverDeviceId{std::numeric_limits<uint16_t>::max()};
+    /// link ID of the receiver
+    uint8_t m_linkId{std::numeric_limits<uint8_t>::max()};
+    /// node ID of the sender, if known
+    uint32_t m_senderId{std::numeric_limits<uint32_t>::max()};
+    /// device ID of the sender, if known
+    uint16_t m_senderDeviceId{std::numeric_limits<uint16_t>::max()};
+    /// reason for the PPDU drop (UNKNOWN if the PPDU was not dropped)
+    WifiPhyRxfailureReason m_reason{WifiPhyRxfailureReason::UNKNOWN};
+
+    uint16_t m_nMpdus{0};                        ///< number of MPDUs in the PPDU
+    uint16_t m_nSuccessfulMpdus{0};              ///< number of successfully received MPDUs
+    uint16_t m_nOverlappingPpdus{0};             ///< number of overlapping PPDUs (saturated)
+    WifiMacType m_macType{WIFI_MAC_CTL_TRIGGER}; ///< type of the first MPDU
+    std::optional<Mac48Address> m_addr1;         ///< Address 1 of the first MPDU
+    std::optional<Mac48Address> m_addr2;         ///< Address 2 of the first MPDU, if present
+};
+
+/**
+ * @brief Writes PPDU reception records to a binary Wi-Fi PHY reception trace file.
+ *
+ * The file is made of a header followed by a sequence of blocks, and it is written as the
+ * records are produced, so that only one block of records is held in memory. All the values
+ * are stored in little-endian byte order. The header consists of the 8-byte magic string
+ * "ns3-wprx" followed by the format version (uint32_t). Each block consists of:
+ *
+ * - the number of MAC addresses added to the dictionary by the records of the block (uint32_t),
+ *   followed by such addresses (6 bytes each); the index of an address in the dictionary is
+ *   the order in which it appears in the file
+ * - the number N of records in the block (uint32_t)
+ * - the columns of the block, each holding N fixed-width values: start time in nanoseconds
+ *   (int64_t), end time in nanoseconds (int64_t), RSSI in dBm (float), PPDU UID (uint64_t),
+ *   receiver node ID (uint32_t), receiver device ID (uint16_t), link ID (uint8_t), sender node ID
+ *   (uint32_t), sender device ID (uint16_t), drop reason (uint8_t), number of MPDUs (uint16_t),
+ *   number of successful MPDUs (uint16_t), number of overlapping PPDUs (uint16_t), MAC type of
+ *   the first MPDU (uint8_t), dictionary index of Address 1 (uint32_t) and dictionary index of
+ *   Address 2 (uint32_t)
+ *
+ * Unknown IDs and absent addresses are stored as the maximum value of their type. Each record
+ * takes 57 bytes. WifiPhyRxTraceFileReader and the wifi-phy-rx-trace-reader.py script (in the
+ * wifi examples directory) can be used to read such files.
+ */
+class WifiPhyRxTraceFileWriter
+{
+  public:
+    /**
+     * Create the given file and write the file header.
+     *
+     * @param filename the name of the file
+     * @param blockSize the maximum number of records per block
+     */
+    WifiPhyRxTraceFileWriter(const std::string& filename, uint32_t blockSize = 4096);
+
+    /**
+     * Write the records that have not been written yet.
+     */
+    ~WifiPhyRxTraceFileWriter();
+
+    /**
+     * Add the given record to the current block, which is written to the file when full.
+     *
+     * @param record the record to write
+     */
+    void Write(const WifiPhyRxTraceFileRecord& record);
+
+    /**
+     * Write the current block to the file, if not empty.
+     */
+    void Flush();
+
+    /**
+     * @return the number of records written so far (including the ones in the current block)
+     */
+    uint64_t GetNRecords() const;
+
+    static constexpr uint32_t VERSION = 1; ///< version of the file format
+
+  private:
+    /**
+     * @param address the address (if any)
+     * @return the index of the given address in the dictionary, which is extended if needed
+     */
+    uint32_t GetAddressIndex(const std::optional<Mac48Address>& address);
+
+    std::ofstream m_file;                          ///< the output file
+    uint32_t m_blockSize;                          ///< maximum number of records per block
+    std::vector<WifiPhyRxTraceFileRecord> m_block; ///< records of the current block
+    std::map<Mac48Address, uint32_t> m_dictionary; ///< address dictionary
+    std::vector<Mac48Address> m_newAddresses;      ///< addresses added in the current block
+    uint64_t m_nRecords{0};                        ///< number of records written so far
+};
+
+/**
+ * @brief Reads PPDU reception records from a binary Wi-Fi PHY reception trace file.
+ *
+ * See WifiPhyRxTraceFileWriter for a description of the file format. The records are read one
+ * block at a time.
+ */
+class WifiPhyRxTraceFileReader
+{
+  public:
+    /**
+     * Open the given file and check its header.
+     *
+     * @param filename the name of the file
+     */
+    WifiPhyRxTraceFileReader(const std::string& filename);
+
+    /**
+     * Read the next record of the file.
+     *
+     * @param record the record to fill
+     * @return false if the end of the file has been reached, true otherwise
+     */
+    bool Read(WifiPhyRxTraceFileRecord& record);
+
+  private:
+    /**
+     * Read the next block of the file.
+     *
+     * @return false if the end of the file has been reached, true otherwise
+     */
+    bool ReadBlock();
+
+    std::ifstream m_file;                          ///< the input file
+    std::vector<Mac48Address> m_dictionary;        ///< address dictionary
+    std::vector<WifiPhyRxTraceFileRecord> m_block; ///< records of the current block
+    std::size_t m_next{0};                         ///< index of the next record in the block
+};
+
+} // namespace ns3
+
+#endif /* WIFI_PHY_RX_TRACE_FILE_H */
@@ -43,6 +43,52 @@ NS_LOG_COMPONENT_DEFINE("WifiPhyRxTraceHelper");
  */
 const uint32_t SHIFT = 16;
 
+namespace
+{
+
+/**
+ * Convert a completed PPDU reception record to the format stored in binary trace files.
+ *
+ * @param record The completed PPDU reception record.
+ * @param deviceId The device ID of the receiver.
+ * @return The record to store in a binary trace file.
+ */
+WifiPhyRxTraceFileRecord
+ToFileRecord(const WifiPpduRxRecord& record, uint32_t deviceId)
+{
+    WifiPhyRxTraceFileRecord fileRecord;
+    fileRecord.m_startTime = record.m_startTime;
+    fileRecord.m_endTime = record.m_endTime;
+    fileRecord.m_rssi = record.m_rssi;
+    fileRecord.m_ppduUid = record.m_ppdu->GetUid();
+    fileRecord.m_receiverId = record.m_receiverId;
+    fileRecord.m_receiverDeviceId = deviceId;
+    fileRecord.m_linkId = record.m_linkId;
+    fileRecord.m_senderId = record.m_senderId;
+    fileRecord.m_senderDeviceId =
+        std::min<uint32_t>(record.m_senderDeviceId, std::numeric_limits<uint16_t>::max());
+    fileRecord.m_reason = record.m_reason;
+    fileRecord.m_nSuccessfulMpdus =
+        std::count(record.m_statusPerMpdu.cbegin(), record.m_statusPerMpdu.cend(), true);
+    fileRecord.m_nOverlappingPpdus = std::min<std::size_t>(record.m_overlappingPpdu.size(),
+                                                           std::numeric_limits<uint16_t>::max());
+
+    if (const auto psdu = record.m_ppdu->GetPsdu(); psdu && psdu->GetNMpdus() > 0)
+    {
+        const auto& hdr = psdu->GetHeader(0);
+        fileRecord.m_nMpdus = psdu->GetNMpdus();
+        fileRecord.m_macType = hdr.GetType();
+        fileRecord.m_addr1 = hdr.GetAddr1();
+        if (!hdr.IsCts() && !hdr.IsAck())
+        {
+            fileRecord.m_addr2 = hdr.GetAddr2();
+        }
+    }
+    return fileRecord;
+}
+
+} // namespace
+
 WifiPhyRxTraceHelper::WifiPhyRxTraceHelper()
 {
     NS_LOG_FUNCTION(this);
@@ -157,6 +203,15 @@ WifiPhyRxTraceHelper::Enable(NodeContainer nodes,
     }
 }
 
+void
+WifiPhyRxTraceHelper::EnableBinaryOutput(const std::string& filename, bool keepRecords)
+{
+    NS_LOG_FUNCTION(this << filename << keepRecords);
+    NS_ABORT_MSG_IF(!m_traceSink, "Enable() must be called before EnableBinaryOutput()");
+    m_traceSink->EnableBinaryOutput(filename, keepRecords);
+    Simulator::ScheduleDestroy(&WifiPhyRxTraceSink::FlushBinaryOutput, m_traceSink);
+}
+
 void
 WifiPhyRxTraceHelper::PrintStatistics() const
 {
@@ -336,6 +391,12 @@ WifiPhyRxTraceSink::UniqueTagGenerator::GenerateUniqueTag(uint64_t ppduUid)
     return tag;
 }
 
+void
+WifiPhyRxTraceSink::UniqueTagGenerator::ReleaseTag(uint64_t tag)
+{
+    usedTags.erase(tag);
+}
+
 bool
 operator==(const WifiPpduRxRecord& lhs, const WifiPpduRxRecord& rhs)
 {
@@ -500,6 +561,19 @@ WifiPhyRxTraceSink::EndTx(uint32_t nodeId, uint32_t deviceId, WifiPpduRxRecord p
     // Erase the item from rxTagToPpduRecord
     m_rxTagToPpduRecord.erase(ppduRecord.m_rxTag);
     NS_LOG_INFO("Size of m_rxTagToPpduRecord: " << m_rxTagToPpduRecord.size());
+
+    // Release the per-transmission state, so that memory usage does not grow with time
+    m_rxTagToListOfOverlappingPpduRecords.erase(ppduRecord.m_rxTag);
+    if (auto it = m_ppduUidToTxTag.find(ppduRecord.m_ppdu->GetUid());
+        it != m_ppduUidToTxTag.end() && it->second == ppduRecord.m_rxTag)
+    {
+        m_ppduUidToTxTag.erase(it);
+    }
+    if (!m_keepRecords)
+    {
+        // the tags of the records kept in memory must remain unique
+        m_tagGenerator.ReleaseTag(ppduRecord.m_rxTag);
+    }
 }
 
 void
@@ -519,6 +593,12 @@ WifiPhyRxTraceSink::PhyRxEnd(uint32_t nodeId, uint32_t deviceId, uint64_t rxTag,
     {
         ppduRecord.m_overlappingPpdu.emplace_back(it);
     }
+    m_rxTagToListOfOverlappingPpduRecords.erase(rxTag);
+    if (auto& pidToRxId = m_nodeDeviceLinkPidToRxId[nodeId][deviceId][ppduRecord.m_linkId];
+        pidToRxId.contains(ppduUid) && pidToRxId.at(ppduUid) == rxTag)
+    {
+        pidToRxId.erase(ppduUid);
+    }
 
     NS_LOG_INFO("Remove reception record at " << nodeId << ":" << deviceId << ":"
                                               << +ppduRecord.m_linkId << " UID " << rxTag);
@@ -543,14 +623,75 @@ WifiPhyRxTraceSink::PhyRxEnd(uint32_t nodeId, uint32_t deviceId, uint64_t rxTag,
     {
         NS_LOG_INFO("Adding PPDU record for " << ppduRecord.m_receiverId << " " << deviceId << " "
                                               << +ppduRecord.m_linkId);
-        m_completedRecords[ppduRecord.m_receiverId][deviceId][ppduRecord.m_linkId].emplace_back(
+        CountStatisticsForRecord(
+            m_statistics[ppduRecord.m_receiverId][deviceId][ppduRecord.m_linkId],
             ppduRecord);
+        if (m_writer)
+        {
+            m_writer->Write(ToFileRecord(ppduRecord, deviceId));
+        }
+        if (m_keepRecords)
+        {
+            m_completedRecords[ppduRecord.m_receiverId][deviceId][ppduRecord.m_linkId]
+                .emplace_back(ppduRecord);
+        }
     }
     else
     {
         NS_LOG_DEBUG("Not adding PPDU record (statistics not started) for "
                      << ppduRecord.m_receiverId << " " << deviceId << " " << ppduRecord.m_linkId);
     }
+    if (!m_keepRecords)
+    {
+        m_tagGenerator.ReleaseTag(rxTag);
+    }
+}
+
+void
+WifiPhyRxTraceSink::EnableBinaryOutput(const std::string& filename, bool keepRecords)
+{
+    NS_LOG_FUNCTION(this << filename << keepRecords);
+    m_writer = std::make_unique<WifiPhyRxTraceFileWriter>(filename);
+    m_keepRecords = keepRecords;
+}
+
+void
+WifiPhyRxTraceSink::FlushBinaryOutput()
+{
+    NS_LOG_FUNCTION(this);
+    if (m_writer)
+    {
+        m_writer->Flush();
+    }
+}
+
+std::optional<uint64_t>
+WifiPhyRxTraceSink::FindRxTag(uint32_t nodeId,
+                              uint32_t deviceId,
+                              uint8_t linkId,
+                              uint64_t ppduUid) const
+{
+    auto nodeIt = m_nodeDeviceLinkPidToRxId.find(nodeId);
+    if (nodeIt == m_nodeDeviceLinkPidToRxId.end())
+    {
+        return std::nullopt;
+    }
+    auto deviceIt = nodeIt->second.find(deviceId);
+    if (deviceIt == nodeIt->second.end())
+    {
+        return std::nullopt;
+    }
+    auto linkIt = deviceIt->second.find(linkId);
+    if (linkIt == deviceIt->second.end())
+    {
+        return std::nullopt;
+    }
+    auto pidIt = linkIt->second.find(ppduUid);
+    if (pidIt == linkIt->second.end())
+    {
+        return std::nullopt;
+    }
+    return pidIt->second;
 }
 
 bool
@@ -652,10 +793,14 @@ WifiPhyRxTraceSink::PhySignalArrival(std::string context,
     // Associate this received PPDU with a record previously stored on the transmit side, if present
     bool hasTxTag = false;
     WifiPpduRxRecord txPpduRecord;
-    if (m_ppduUidToTxTag.contains(ppdu->GetUid()))
+    if (auto txTagIt = m_ppduUidToTxTag.find(ppdu->GetUid()); txTagIt != m_ppduUidToTxTag.end())
     {
         hasTxTag = true;
-        txPpduRecord = m_rxTagToPpduRecord[m_ppduUidToTxTag[ppdu->GetUid()]];
+        if (auto recordIt = m_rxTagToPpduRecord.find(txTagIt->second);
+            recordIt != m_rxTagToPpduRecord.end())
+        {
+            txPpduRecord = recordIt->second;
+        }
         NS_LOG_DEBUG("Arrival RxNodeID: " << nodeId << " SenderID: " << txPpduRecord.m_senderId
                                           << " Received on LinkID: " << +linkId
                                           << " Frame Sent on LinkId: " << +txPpduRecord.m_linkId);
@@ -740,15 +885,16 @@ WifiPhyRxTraceSink::PhyPpduDrop(std::string context,
     uint32_t nodeId = ContextToNodeId(context);
     uint32_t deviceId = ContextToDeviceId(context);
     uint8_t linkId = ContextToLinkId(context);
-    WifiPpduRxRecord ppduRecord =
-        m_rxTagToPpduRecord[m_nodeDeviceLinkPidToRxId[nodeId][deviceId][linkId][ppdu->GetUid()]];
+    const auto rxTag = FindRxTag(nodeId, deviceId, linkId, ppdu->GetUid());
+    auto recordIt = rxTag ? m_rxTagToPpduRecord.find(*rxTag) : m_rxTagToPpduRecord.end();
 
-    if (ppduRecord.m_ppdu == nullptr)
+    if (recordIt == m_rxTagToPpduRecord.end())
     {
         NS_LOG_DEBUG("Frame being dropped was not observed on SignalArrival trace. Means it was "
                      "received on a wrong link configuration");
         return;
     }
+    WifiPpduRxRecord ppduRecord = recordIt->second;
     ppduRecord.m_reason = reason;
 
     std::vector<bool> outcome;
@@ -781,10 +927,10 @@ WifiPhyRxTraceSink::PpduOutcome(std::string context,
     uint32_t deviceId = ContextToDeviceId(context);
     uint8_t linkId = ContextToLinkId(context);
 
-    WifiPpduRxRecord ppduRecord =
-        m_rxTagToPpduRecord[m_nodeDeviceLinkPidToRxId[nodeId][deviceId][linkId][ppdu->GetUid()]];
+    const auto rxTag = FindRxTag(nodeId, deviceId, linkId, ppdu->GetUid());
+    auto recordIt = rxTag ? m_rxTagToPpduRecord.find(*rxTag) : m_rxTagToPpduRecord.end();
 
-    if (ppduRecord.m_ppdu)
+    if (recordIt != m_rxTagToPpduRecord.end())
     {
         NS_LOG_DEBUG("Found an expected frame in the outcome");
     }
@@ -793,6 +939,7 @@ WifiPhyRxTraceSink::PpduOutcome(std::string context,
         NS_LOG_DEBUG("Frame to be processed was not observed on SignalArrival trace");
         return;
     }
+    WifiPpduRxRecord ppduRecord = recordIt->second;
     // Save the reception status per MPDU in the PPDU record
     ppduRecord.m_statusPerMpdu = statusMpdu;
 
@@ -823,7 +970,8 @@ WifiPhyRxTraceSink::CountStatisticsForRecord(WifiPhyTraceStatistics& statistics,
                 shouldCount = false;
                 break;
             }
-            if (!(*it) && (record.m_receiverId == m_macAddressToNodeId.at(hdr.GetAddr1())))
+            if (!(*it) && (m_macAddressToNodeId.contains(hdr.GetAddr1())) &&
+                (record.m_receiverId == m_macAddressToNodeId.at(hdr.GetAddr1())))
             {
                 // Failed MPDU
                 statistics.m_failedMpdus++;
@@ -931,16 +1079,13 @@ WifiPhyRxTraceSink::CountStatistics() const
 {
     NS_LOG_FUNCTION(this);
     WifiPhyTraceStatistics statistics;
-    for (const auto& nodeMap : m_completedRecords)
+    for (const auto& nodeMap : m_statistics)
     {
         for (const auto& deviceMap : nodeMap.second)
         {
             for (const auto& linkMap : deviceMap.second)
             {
-                for (const auto& record : linkMap.second)
-                {
-                    CountStatisticsForRecord(statistics, record);
-                }
+                statistics = statistics + linkMap.second;
             }
         }
     }
@@ -952,19 +1097,15 @@ WifiPhyRxTraceSink::CountStatistics(uint32_t nodeId, uint32_t deviceId, uint8_t
 {
     NS_LOG_FUNCTION(this << nodeId << deviceId << linkId);
     WifiPhyTraceStatistics statistics;
-    if (m_completedRecords.contains(nodeId))
+    if (m_statistics.contains(nodeId))
     {
-        auto mapOfDevices = m_completedRecords.at(nodeId);
+        const auto& mapOfDevices = m_statistics.at(nodeId);
         if (mapOfDevices.contains(deviceId))
         {
             const auto& mapOfLinks = mapOfDevices.at(deviceId);
             if (mapOfLinks.contains(linkId))
             {
-                auto vectorOfRecords = mapOfLinks.at(linkId);
-                for (const auto& record : vectorOfRecords)
-                {
-                    CountStatisticsForRecord(statistics, record);
-                }
+                statistics = mapOfLinks.at(linkId);
             }
         }
     }
@@ -1035,6 +1176,7 @@ WifiPhyRxTraceSink::Reset()
 {
     m_completedRecords.clear();
     m_records.clear();
+    m_statistics.clear();
 }
 
 // Return a single vector with all completed records
@@ -12,11 +12,13 @@
 #include "ns3/phy-entity.h"
 #include "ns3/ptr.h"
 #include "ns3/wifi-phy-common.h"
+#include "ns3/wifi-phy-rx-trace-file.h"
 #include "ns3/wifi-phy-state.h"
 #include "ns3/wifi-ppdu.h"
 
 #include <functional>
 #include <map>
+#include <memory>
 #include <optional>
 #include <set>
 #include <string>
@@ -26,6 +28,7 @@
 class TestWifiPhyRxTraceHelper;
 class TestWifiPhyRxTraceHelperMloStr;
 class TestWifiPhyRxTraceHelperYans;
+class TestWifiPhyRxTraceHelperBinaryOutput;
 
 namespace ns3
 {
@@ -112,12 +115,17 @@ struct WifiPpduRxRecord
  * Statistics are only compiled for unicast data (WIFI_MAC_DATA and WIFI_MAC_QOSDATA), although
  * PPDU records are kept for all frame types because it is possible for non-data frames to
  * collide with data frames.
+ *
+ * For long simulations, the completed PPDU records can be streamed to a compact binary file
+ * (see EnableBinaryOutput()) instead of being kept in memory; statistics are available in
+ * both cases.
  */
 class WifiPhyRxTraceHelper
 {
     friend class ::TestWifiPhyRxTraceHelper;
     friend class ::TestWifiPhyRxTraceHelperMloStr;
     friend class ::TestWifiPhyRxTraceHelperYans;
+    friend class ::TestWifiPhyRxTraceHelperBinaryOutput;
 
   public:
     /**
@@ -138,6 +146,18 @@ class WifiPhyRxTraceHelper
      */
     void Enable(NetDeviceContainer devices);
 
+    /**
+     * Write the completed PPDU reception records to the given binary file (see
+     * WifiPhyRxTraceFileWriter for a description of the format) as they are produced. This
+     * method must be called after Enable(). The records still held in memory are written when
+     * Simulator::Destroy() is called.
+     *
+     * @param filename The name of the file.
+     * @param keepRecords Whether the completed records are also kept in memory, so that they
+     *                    can be accessed through GetPpduRecords().
+     */
+    void EnableBinaryOutput(const std::string& filename, bool keepRecords = false);
+
     /**
      * Retrieves current statistics of successful and failed data PPDUs and MPDUs receptions,
      * for all nodes, devices, and links that have been enabled.
@@ -305,6 +325,12 @@ class WifiPhyRxTraceSink : public Object
          */
         uint64_t GenerateUniqueTag(uint64_t ppduUid);
 
+        /**
+         * Release a tag that is no longer used, so that it can be generated again.
+         * @param tag The tag to release.
+         */
+        void ReleaseTag(uint64_t tag);
+
       private:
         uint64_t counter{0};         ///< Counter to help generate unique tags.
         std::set<uint64_t> usedTags; ///< Set of already used tags.
@@ -377,6 +403,18 @@ class WifiPhyRxTraceSink : public Object
      */
     void Reset();
 
+    /**
+     * Write the completed PPDU records to the given binary file as they are produced.
+     * @param filename The name of the file.
+     * @param keepRecords Whether the completed records are also kept in memory.
+     */
+    void EnableBinaryOutput(const std::string& filename, bool keepRecords);
+
+    /**
+     * Write the completed PPDU records held by the binary file writer (if any) to the file.
+     */
+    void FlushBinaryOutput();
+
     /**
      * Translates a context string to a link ID, facilitating the association of events with
      * specific links in the network.
@@ -670,6 +708,31 @@ class WifiPhyRxTraceSink : public Object
     void CountStatisticsForRecord(WifiPhyTraceStatistics& statistics,
                                   const WifiPpduRxRecord& record) const;
 
+    /**
+     * Look up the tag of the ongoing reception of the given PPDU by the given node, device, and
+     * link.
+     * @param nodeId Node identifier.
+     * @param deviceId Device identifier.
+     * @param linkId Link identifier.
+     * @param ppduUid The UID of the PPDU.
+     * @return The reception tag, if found.
+     */
+    std::optional<uint64_t> FindRxTag(uint32_t nodeId,
+                                      uint32_t deviceId,
+                                      uint8_t linkId,
+                                      uint64_t ppduUid) const;
+
+    /**
+     * Statistics accumulated during the collection period, indexed by node, device, and link.
+     * They are updated when a PPDU record is completed, so that they do not depend on the
+     * completed records being kept in memory.
+     */
+    std::map<uint32_t, std::map<uint32_t, std::map<uint8_t, WifiPhyTraceStatistics>>>
+        m_statistics;
+
+    std::unique_ptr<WifiPhyRxTraceFileWriter> m_writer; ///< Writer of the binary trace file
+    bool m_keepRecords{true}; ///< Whether completed records are kept in memory
+
 }; // class WifiPhyRxTraceSink
 
 // Non-member function declarations
@@ -0,0 +1,210 @@
+/*
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+#include "abstract-wifi-phy.h"
+
+#include "interference-helper.h"
+#include "wifi-spectrum-phy-interface.h"
+#include "wifi-utils.h"
+
+#include "ns3/enum.h"
+#include "ns3/he-ru.h"
+#include "ns3/log.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace ns3
+{
+
+NS_LOG_COMPONENT_DEFINE("AbstractWifiPhy");
+
+NS_OBJECT_ENSURE_REGISTERED(AbstractWifiPhy);
+
+TypeId
+AbstractWifiPhy::GetTypeId()
+{
+    static TypeId tid =
+        TypeId("ns3::AbstractWifiPhy")
+            .SetParent<SpectrumWifiPhy>()
+            .SetGroupName("Wifi")
+            .AddConstructor<AbstractWifiPhy>()
+            .AddAttribute("EffectiveSnrMapping",
+                          "The method used to map the SNRs of the subbands of an RU onto the "
+                          "effective SNR of the PSDU transmitted over the RU",
+                          EnumValue(AbstractWifiPhy::EESM),
+                          MakeEnumAccessor<EffectiveSnrMapping>(&AbstractWifiPhy::m_mapping),
+                          MakeEnumChecker(AbstractWifiPhy::EESM,
+                                          "Eesm",
+                                          AbstractWifiPhy::MIESM,
+                                          "Miesm"));
+    return tid;
+}
+
+AbstractWifiPhy::AbstractWifiPhy()
+{
+    NS_LOG_FUNCTION(this);
+}
+
+AbstractWifiPhy::~AbstractWifiPhy()
+{
+    NS_LOG_FUNCTION(this);
+}
+
+void
+AbstractWifiPhy::DoDispose()
+{
+    NS_LOG_FUNCTION(this);
+    m_subbands.clear();
+    SpectrumWifiPhy::DoDispose();
+}
+
+void
+AbstractWifiPhy::DoChannelSwitch()
+{
+    NS_LOG_FUNCTION(this);
+    SpectrumWifiPhy::DoChannelSwitch();
+    m_subbands.clear();
+}
+
+bool
+AbstractWifiPhy::IsRxAbstractionEnabled() const
+{
+    return true;
+}
+
+double
+AbstractWifiPhy::GetEesmBeta(WifiMode mode)
+{
+    // calibration factors commonly used for the EESM of convolutionally and LDPC
+    // coded OFDM, which mostly depend on the constellation
+    switch (mode.GetConstellationSize())
+    {
+    case 2:
+        return 1.0;
+    case 4:
+        return 1.6;
+    case 16:
+        return 6.0;
+    case 64:
+        return 20.0;
+    case 256:
+        return 60.0;
+    case 1024:
+        return 200.0;
+    default:
+        return 700.0;
+    }
+}
+
+double
+AbstractWifiPhy::GetEffectiveSnr(const std::vector<double>& snrs,
+                                 EffectiveSnrMapping mapping,
+                                 WifiMode mode)
+{
+    NS_ASSERT(!snrs.empty());
+    if (snrs.size() == 1)
+    {
+        return snrs.front();
+    }
+    double sum = 0;
+    switch (mapping)
+    {
+    case EESM: {
+        // factor out the lowest SNR so that the exponentials do not underflow
+        const auto beta = GetEesmBeta(mode);
+        const auto minSnr = *std::min_element(snrs.cbegin(), snrs.cend());
+        for (const auto snr : snrs)
+        {
+            sum += std::exp(-(snr - minSnr) / beta);
+        }
+        return minSnr - beta * std::log(sum / snrs.size());
+    }
+    case MIESM:
+        for (const auto snr : snrs)
+        {
+            sum += std::log1p(snr);
+        }
+        return std::expm1(sum / snrs.size());
+    default:
+        NS_ABORT_MSG("Unknown effective SNR mapping " << mapping);
+    }
+    return 0;
+}
+
+const std::vector<WifiSpectrumBandInfo>&
+AbstractWifiPhy::GetSubbands(const WifiSpectrumBandInfo& band) const
+{
+    auto [it, inserted] = m_subbands.try_emplace(band);
+    if (inserted)
+    {
+        for (const auto& [ruBand, ru] : m_currentSpectrumPhyInterface->GetHeRuBands())
+        {
+            if (ru.GetRuType() != HeRu::RU_26_TONE)
+            {
+                continue;
+            }
+            const auto& ruFrequencies = ruBand.frequencies.front();
+            if (std::any_of(band.frequencies.cbegin(),
+                            band.frequencies.cend(),
+                            [&ruFrequencies](const auto& frequencies) {
+                                return ruFrequencies.first >= frequencies.first &&
+                                       ruFrequencies.second <= frequencies.second;
+                            }))
+            {
+                it->second.push_back(ruBand);
+            }
+        }
+        if (it->second.empty())
+        {
+            it->second.push_back(band);
+        }
+        NS_LOG_DEBUG("Band " << band << " has " << it->second.size() << " subband(s)");
+    }
+    return it->second;
+}
+
+std::vector<PhyEntity::SnrPer>
+AbstractWifiPhy::CalculateMpdusSnrPer(Ptr<Event> event,
+                                      MHz_u channelWidth,
+                                      const WifiSpectrumBandInfo& band,
+                                      uint16_t staId,
+                                      const std::vector<std::pair<Time, Time>>& mpduWindows) const
+{
+    NS_LOG_FUNCTION(this << *event << channelWidth << band << staId << mpduWindows.size());
+    NS_ASSERT(!mpduWindows.empty());
+    const auto& txVector = event->GetPpdu()->GetTxVector();
+    const auto& subbands = GetSubbands(band);
+    const auto subbandWidth =
+        (subbands.size() == 1) ? channelWidth : HeRu::GetBandwidth(HeRu::RU_26_TONE);
+
+    // the noise and interference is averaged over the whole PSDU, so that the SNR of each
+    // subband is computed once per PPDU
+    const std::pair<Time, Time> psduWindow{mpduWindows.front().first, mpduWindows.back().second};
+    std::vector<double> snrs;
+    snrs.reserve(subbands.size());
+    for (const auto& subband : subbands)
+    {
+        snrs.push_back(m_interference->CalculatePayloadAverageSnr(event,
+                                                                  subbandWidth,
+                                                                  subband,
+                                                                  staId,
+                                                                  psduWindow));
+    }
+    const auto snr = GetEffectiveSnr(snrs, m_mapping, txVector.GetMode(staId));
+    NS_LOG_DEBUG("Effective SNR(dB)=" << RatioToDb(snr) << " over " << snrs.size()
+                                      << " subband(s)");
+
+    std::vector<PhyEntity::SnrPer> snrPers;
+    snrPers.reserve(mpduWindows.size());
+    for (const auto& [start, stop] : mpduWindows)
+    {
+        const auto csr =
+            m_interference->CalculatePayloadChunkSuccessRate(snr, stop - start, txVector, staId);
+        snrPers.emplace_back(snr, 1.0 - csr);
+    }
+    return snrPers;
+}
+
+} // namespace ns3
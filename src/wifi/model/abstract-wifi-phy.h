@@ -0,0 +1,112 @@
+/*
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+#ifndef ABSTRACT_WIFI_PHY_H
+#define ABSTRACT_WIFI_PHY_H
+
+#include "spectrum-wifi-phy.h"
+
+#include <map>
+#include <vector>
+
+namespace ns3
+{
+
+/**
+ * @brief Link-to-system level abstraction of a SpectrumWifiPhy
+ * @ingroup wifi
+ *
+ * This PHY receives signals from a spectrum channel and tracks the interference
+ * over the bands of the operating channel (including the bands of the RUs) like
+ * SpectrumWifiPhy, but it abstracts the reception of the incoming PPDUs to reduce
+ * the number of events and of interference computations:
+ *
+ * - the preamble and the PHY header fields are processed at once at the start of
+ *   the Data field, instead of at the end of each field;
+ * - the MPDUs of a received PSDU are all processed at the end of the PPDU, instead
+ *   of at the end of each MPDU.
+ *
+ * The SNR of the PSDU is computed once per PPDU and per RU, by mapping the SNRs of
+ * the 26-tone subbands of the RU (or of the channel, for non-MU PPDUs), where the
+ * noise and interference power is averaged over the payload, onto an effective SNR
+ * with either the Exponential Effective SINR Mapping (EESM) or the Mutual
+ * Information Effective SINR Mapping (MIESM). The PER of each MPDU is then given
+ * by the error rate model at the effective SNR.
+ *
+ * The MAC layer is not aware of the abstraction: the PHY can be swapped with a
+ * SpectrumWifiPhy through SpectrumWifiPhyHelper::SetPhyType.
+ */
+class AbstractWifiPhy : public SpectrumWifiPhy
+{
+  public:
+    /**
+     * @brief Get the type ID.
+     * @return the object TypeId
+     */
+    static TypeId GetTypeId();
+
+    AbstractWifiPhy();
+    ~AbstractWifiPhy() override;
+
+    /// Methods to map the SNRs of the subbands onto an effective SNR
+    enum EffectiveSnrMapping : uint8_t
+    {
+        EESM = 0,
+        MIESM
+    };
+
+    /**
+     * Map the SNRs of a set of subbands onto an effective SNR.
+     *
+     * With EESM, the effective SNR is -beta * ln(mean(exp(-SNR_i / beta))), where the
+     * calibration factor beta depends on the constellation of the given mode (\see
+     * GetEesmBeta). With MIESM, the effective SNR is the SNR whose Gaussian-input
+     * capacity log2(1 + SNR) equals the mean capacity of the subbands.
+     *
+     * @param snrs the SNR of each subband in linear scale
+     * @param mapping the mapping to use
+     * @param mode the mode used to transmit over the subbands
+     * @return the effective SNR in linear scale
+     */
+    static double GetEffectiveSnr(const std::vector<double>& snrs,
+                                  EffectiveSnrMapping mapping,
+                                  WifiMode mode);
+
+    /**
+     * @param mode the mode used to transmit over the subbands
+     * @return the EESM calibration factor for the constellation of the given mode
+     */
+    static double GetEesmBeta(WifiMode mode);
+
+  protected:
+    void DoDispose() override;
+    void DoChannelSwitch() override;
+
+    bool IsRxAbstractionEnabled() const override;
+    std::vector<PhyEntity::SnrPer> CalculateMpdusSnrPer(
+        Ptr<Event> event,
+        MHz_u channelWidth,
+        const WifiSpectrumBandInfo& band,
+        uint16_t staId,
+        const std::vector<std::pair<Time, Time>>& mpduWindows) const override;
+
+  private:
+    /**
+     * Get the 26-tone RU bands tracked by the interference helper that lie within the
+     * given band. The given band is returned if there is no such RU band.
+     *
+     * @param band the band
+     * @return the subbands of the given band
+     */
+    const std::vector<WifiSpectrumBandInfo>& GetSubbands(const WifiSpectrumBandInfo& band) const;
+
+    EffectiveSnrMapping m_mapping; //!< the effective SNR mapping
+
+    mutable std::map<WifiSpectrumBandInfo, std::vector<WifiSpectrumBandInfo>>
+        m_subbands; //!< the subbands of each band used to receive a PSDU on the current channel
+};
+
+} // namespace ns3
+
+#endif /* ABSTRACT_WIFI_PHY_H */
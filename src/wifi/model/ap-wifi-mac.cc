@@ -1476,8 +1476,8 @@ ApWifiMac::SetAid(MgtAssocResponseHeader& assoc, const LinkIdStaAddrMap& linkIdS
     }
 }
 
-void
-ApWifiMac::SendAssocResp(Mac48Address to, bool isReassoc, uint8_t linkId)
+Ptr<WifiMpdu>
+ApWifiMac::GetAssocRespMpdu(Mac48Address to, bool isReassoc, uint8_t linkId)
 {
     NS_LOG_FUNCTION(this << to << isReassoc << +linkId);
     WifiMacHeader hdr;
@@ -1508,9 +1508,19 @@ ApWifiMac::SendAssocResp(Mac48Address to, bool isReassoc, uint8_t linkId)
     Ptr<Packet> packet = Create<Packet>();
     packet->AddHeader(assoc);
 
+    return Create<WifiMpdu>(packet, hdr);
+}
+
+void
+ApWifiMac::SendAssocResp(Mac48Address to, bool isReassoc, uint8_t linkId)
+{
+    NS_LOG_FUNCTION(this << to << isReassoc << +linkId);
+
+    auto mpdu = GetAssocRespMpdu(to, isReassoc, linkId);
+
     if (!GetQosSupported())
     {
-        GetTxop()->Queue(Create<WifiMpdu>(packet, hdr));
+        GetTxop()->Queue(mpdu);
     }
     // "A QoS STA that transmits a Management frame determines access category used
     // for medium access in transmission of the Management frame as follows
@@ -1521,11 +1531,11 @@ ApWifiMac::SendAssocResp(Mac48Address to, bool isReassoc, uint8_t linkId)
     //   shall be selected." (Sec. 10.2.3.2 of 802.11-2020)
     else if (!GetWifiRemoteStationManager(linkId)->GetQosSupported(to))
     {
-        GetBEQueue()->Queue(Create<WifiMpdu>(packet, hdr));
+        GetBEQueue()->Queue(mpdu);
     }
     else
     {
-        GetVOQueue()->Queue(Create<WifiMpdu>(packet, hdr));
+        GetVOQueue()->Queue(mpdu);
     }
 }
 
@@ -1723,63 +1733,7 @@ ApWifiMac::TxOk(Ptr<const WifiMpdu> mpdu)
 
     if (hdr.IsAssocResp() || hdr.IsReassocResp())
     {
-        MgtAssocResponseHeader assocResp;
-        mpdu->GetPacket()->PeekHeader(assocResp);
-        auto aid = assocResp.GetAssociationId();
-
-        auto linkId = GetLinkIdByAddress(hdr.GetAddr2());
-        NS_ABORT_MSG_IF(!linkId.has_value(), "No link ID matching the TA");
-
-        if (GetWifiRemoteStationManager(*linkId)->IsWaitAssocTxOk(hdr.GetAddr1()))
-        {
-            NS_LOG_DEBUG("AP=" << hdr.GetAddr2() << " associated with STA=" << hdr.GetAddr1());
-            GetWifiRemoteStationManager(*linkId)->RecordGotAssocTxOk(hdr.GetAddr1());
-            m_assocLogger(aid, hdr.GetAddr1());
-        }
-
-        if (auto staMldAddress =
-                GetWifiRemoteStationManager(*linkId)->GetMldAddress(hdr.GetAddr1());
-            staMldAddress.has_value())
-        {
-            /**
-             * The STA is affiliated with an MLD. From Sec. 35.3.7.1.4 of 802.11be D3.0:
-             * When a link becomes enabled for a non-AP STA that is affiliated with a non-AP MLD
-             * after successful association with an AP MLD with (Re)Association Request/Response
-             * frames transmitted on another link [...], the power management mode of the non-AP
-             * STA, immediately after the acknowledgement of the (Re)Association Response frame
-             * [...], is power save mode, and its power state is doze.
-             *
-             * Thus, STAs operating on all the links but the link used to establish association
-             * transition to power save mode.
-             */
-            for (uint8_t i = 0; i < GetNLinks(); i++)
-            {
-                auto stationManager = GetWifiRemoteStationManager(i);
-                if (auto staAddress = stationManager->GetAffiliatedStaAddress(*staMldAddress);
-                    staAddress.has_value() && i != *linkId &&
-                    stationManager->IsWaitAssocTxOk(*staAddress))
-                {
-                    NS_LOG_DEBUG("AP=" << GetFrameExchangeManager(i)->GetAddress()
-                                       << " associated with STA=" << *staAddress);
-                    stationManager->RecordGotAssocTxOk(*staAddress);
-                    m_assocLogger(aid, *staAddress);
-                    StaSwitchingToPsMode(*staAddress, i);
-                }
-            }
-
-            // Apply the negotiated TID-to-Link Mapping (if any) for DL direction
-            ApplyTidLinkMapping(*staMldAddress, WifiDirection::DOWNLINK);
-        }
-
-        if (auto extendedCapabilities =
-                GetWifiRemoteStationManager(*linkId)->GetStationExtendedCapabilities(
-                    hdr.GetAddr1());
-            m_gcrManager)
-        {
-            const auto isGcrCapable =
-                extendedCapabilities && extendedCapabilities->m_robustAvStreaming;
-            m_gcrManager->NotifyStaAssociated(hdr.GetAddr1(), isGcrCapable);
-        }
+        AssocRespAcked(mpdu, true);
     }
     else if (hdr.IsAction())
     {
@@ -1802,6 +1756,76 @@ ApWifiMac::TxOk(Ptr<const WifiMpdu> mpdu)
     }
 }
 
+void
+ApWifiMac::AssocRespAcked(Ptr<const WifiMpdu> mpdu, bool otherLinksInPsMode)
+{
+    NS_LOG_FUNCTION(this << *mpdu << otherLinksInPsMode);
+    const WifiMacHeader& hdr = mpdu->GetHeader();
+    NS_ASSERT(hdr.IsAssocResp() || hdr.IsReassocResp());
+
+    MgtAssocResponseHeader assocResp;
+    mpdu->GetPacket()->PeekHeader(assocResp);
+    auto aid = assocResp.GetAssociationId();
+
+    auto linkId = GetLinkIdByAddress(hdr.GetAddr2());
+    NS_ABORT_MSG_IF(!linkId.has_value(), "No link ID matching the TA");
+
+    if (GetWifiRemoteStationManager(*linkId)->IsWaitAssocTxOk(hdr.GetAddr1()))
+    {
+        NS_LOG_DEBUG("AP=" << hdr.GetAddr2() << " associated with STA=" << hdr.GetAddr1());
+        GetWifiRemoteStationManager(*linkId)->RecordGotAssocTxOk(hdr.GetAddr1());
+        m_assocLogger(aid, hdr.GetAddr1());
+    }
+
+    if (auto staMldAddress =
+            GetWifiRemoteStationManager(*linkId)->GetMldAddress(hdr.GetAddr1());
+        staMldAddress.has_value())
+    {
+        /**
+         * The STA is affiliated with an MLD. From Sec. 35.3.7.1.4 of 802.11be D3.0:
+         * When a link becomes enabled for a non-AP STA that is affiliated with a non-AP MLD
+         * after successful association with an AP MLD with (Re)Association Request/Response
+         * frames transmitted on another link [...], the power management mode of the non-AP
+         * STA, immediately after the acknowledgement of the (Re)Association Response frame
+         * [...], is power save mode, and its power state is doze.
+         *
+         * Thus, STAs operating on all the links but the link used to establish association
+         * transition to power save mode (unless association is fast-forwarded, in which case
+         * all the STAs remain in active mode).
+         */
+        for (uint8_t i = 0; i < GetNLinks(); i++)
+        {
+            auto stationManager = GetWifiRemoteStationManager(i);
+            if (auto staAddress = stationManager->GetAffiliatedStaAddress(*staMldAddress);
+                staAddress.has_value() && i != *linkId &&
+                stationManager->IsWaitAssocTxOk(*staAddress))
+            {
+                NS_LOG_DEBUG("AP=" << GetFrameExchangeManager(i)->GetAddress()
+                                   << " associated with STA=" << *staAddress);
+                stationManager->RecordGotAssocTxOk(*staAddress);
+                m_assocLogger(aid, *staAddress);
+                if (otherLinksInPsMode)
+                {
+                    StaSwitchingToPsMode(*staAddress, i);
+                }
+            }
+        }
+
+        // Apply the negotiated TID-to-Link Mapping (if any) for DL direction
+        ApplyTidLinkMapping(*staMldAddress, WifiDirection::DOWNLINK);
+    }
+
+    if (auto extendedCapabilities =
+            GetWifiRemoteStationManager(*linkId)->GetStationExtendedCapabilities(
+                hdr.GetAddr1());
+        m_gcrManager)
+    {
+        const auto isGcrCapable =
+            extendedCapabilities && extendedCapabilities->m_robustAvStreaming;
+        m_gcrManager->NotifyStaAssociated(hdr.GetAddr1(), isGcrCapable);
+    }
+}
+
 void
 ApWifiMac::TxFailed(WifiMacDropReason timeoutReason, Ptr<const WifiMpdu> mpdu)
 {
@@ -2419,6 +2443,38 @@ ApWifiMac::ReceiveAssocRequest(const AssocReqRefVariant& assoc,
     return std::visit(recvAssocRequest, assoc);
 }
 
+Ptr<WifiMpdu>
+ApWifiMac::FastForwardAssocRequest(Ptr<const WifiMpdu> mpdu)
+{
+    NS_LOG_FUNCTION(this << *mpdu);
+    const auto& hdr = mpdu->GetHeader();
+    NS_ASSERT(hdr.IsAssocReq() || hdr.IsReassocReq());
+
+    auto linkId = GetLinkIdByAddress(hdr.GetAddr1());
+    NS_ABORT_MSG_IF(!linkId.has_value(), "No link ID matching the RA");
+
+    MgtAssocRequestHeader assocReq;
+    MgtReassocRequestHeader reassocReq;
+    AssocReqRefVariant frame = assocReq;
+    if (hdr.IsAssocReq())
+    {
+        mpdu->GetPacket()->PeekHeader(assocReq);
+    }
+    else
+    {
+        mpdu->GetPacket()->PeekHeader(reassocReq);
+        frame = reassocReq;
+    }
+    if (ReceiveAssocRequest(frame, hdr.GetAddr2(), *linkId) && GetNLinks() > 1)
+    {
+        ParseReportedStaInfo(frame, hdr.GetAddr2(), *linkId);
+    }
+
+    auto assocResp = GetAssocRespMpdu(hdr.GetAddr2(), hdr.IsReassocReq(), *linkId);
+    AssocRespAcked(assocResp, false);
+    return assocResp;
+}
+
 void
 ApWifiMac::ParseReportedStaInfo(const AssocReqRefVariant& assoc, Mac48Address from, uint8_t linkId)
 {
@@ -2514,65 +2570,13 @@ ApWifiMac::ReceiveEmlOmn(MgtEmlOmn& frame, const Mac48Address& sender, uint8_t l
             auto ackDuration =
                 WifiPhy::CalculateTxDuration(psduMap, txVector, GetLink(linkId).phy->GetPhyBand());
 
-            m_transitionTimeoutEvents[sender] = Simulator::Schedule(
-                ackDuration + ehtConfiguration->m_transitionTimeout,
-                [=, this]() {
-                    for (uint8_t id = 0; id < GetNLinks(); id++)
-                    {
-                        auto linkAddress =
-                            GetWifiRemoteStationManager(id)->GetAffiliatedStaAddress(*mldAddress);
-                        if (!linkAddress)
-                        {
-                            // this link has not been setup by the non-AP MLD
-                            continue;
-                        }
-
-                        if (!emlsrLinks.empty())
-                        {
-                            // the non-AP MLD is enabling EMLSR mode
-                            /**
-                             * After the successful transmission of the EML Operating Mode
-                             * Notification frame by the non-AP STA affiliated with the non-AP MLD,
-                             * the non-AP MLD shall operate in the EMLSR mode and the other non-AP
-                             * STAs operating on the corresponding EMLSR links shall transition to
-                             * active mode after the transition delay indicated in the Transition
-                             * Timeout subfield in the EML Capabilities subfield of the Basic
-                             * Multi-Link element or immediately after receiving an EML Operating
-                             * Mode Notification frame from one of the APs operating on the EMLSR
-                             * links and affiliated with the AP MLD (Sec. 35.3.17 of 802.11be D3.0)
-                             */
-                            auto enabled = std::find(emlsrLinks.cbegin(), emlsrLinks.cend(), id) !=
-                                           emlsrLinks.cend();
-                            if (enabled)
-                            {
-                                StaSwitchingToActiveModeOrDeassociated(*linkAddress, id);
-                            }
-                            GetWifiRemoteStationManager(id)->SetEmlsrEnabled(*linkAddress, enabled);
-                        }
-                        else
-                        {
-                            // the non-AP MLD is disabling EMLSR mode
-                            /**
-                             * After the successful transmission of the EML Operating Mode
-                             * Notification frame by the non-AP STA affiliated with the non-AP MLD,
-                             * the non-AP MLD shall disable the EMLSR mode and the other non-AP
-                             * STAs operating on the corresponding EMLSR links shall transition to
-                             * power save mode after the transition delay indicated in the
-                             * Transition Timeout subfield in the EML Capabilities subfield of the
-                             * Basic Multi-Link element or immediately after receiving an EML
-                             * Operating Mode Notification frame from one of the APs operating on
-                             * the EMLSR links and affiliated with the AP MLD. (Sec. 35.3.17 of
-                             * 802.11be D3.0)
-                             */
-                            if (id != linkId &&
-                                GetWifiRemoteStationManager(id)->GetEmlsrEnabled(*linkAddress))
-                            {
-                                StaSwitchingToPsMode(*linkAddress, id);
-                            }
-                            GetWifiRemoteStationManager(id)->SetEmlsrEnabled(*linkAddress, false);
-                        }
-                    }
-                });
+            m_transitionTimeoutEvents[sender] =
+                Simulator::Schedule(ackDuration + ehtConfiguration->m_transitionTimeout,
+                                    &ApWifiMac::ApplyEmlsrMode,
+                                    this,
+                                    *mldAddress,
+                                    emlsrLinks,
+                                    linkId);
         });
 
     // connect the callback to the PHY TX begin trace to catch the Ack and disconnect
@@ -2602,6 +2606,87 @@ ApWifiMac::ReceiveEmlOmn(MgtEmlOmn& frame, const Mac48Address& sender, uint8_t l
     ehtFem->SendEmlOmn(sender, frame);
 }
 
+void
+ApWifiMac::ApplyEmlsrMode(const Mac48Address& mldAddress,
+                          const std::list<uint8_t>& emlsrLinks,
+                          uint8_t linkId)
+{
+    NS_LOG_FUNCTION(this << mldAddress << linkId);
+
+    for (uint8_t id = 0; id < GetNLinks(); id++)
+    {
+        auto linkAddress = GetWifiRemoteStationManager(id)->GetAffiliatedStaAddress(mldAddress);
+        if (!linkAddress)
+        {
+            // this link has not been setup by the non-AP MLD
+            continue;
+        }
+
+        if (!emlsrLinks.empty())
+        {
+            // the non-AP MLD is enabling EMLSR mode
+            /**
+             * After the successful transmission of the EML Operating Mode
+             * Notification frame by the non-AP STA affiliated with the non-AP MLD,
+             * the non-AP MLD shall operate in the EMLSR mode and the other non-AP
+             * STAs operating on the corresponding EMLSR links shall transition to
+             * active mode after the transition delay indicated in the Transition
+             * Timeout subfield in the EML Capabilities subfield of the Basic
+             * Multi-Link element or immediately after receiving an EML Operating
+             * Mode Notification frame from one of the APs operating on the EMLSR
+             * links and affiliated with the AP MLD (Sec. 35.3.17 of 802.11be D3.0)
+             */
+            auto enabled =
+                std::find(emlsrLinks.cbegin(), emlsrLinks.cend(), id) != emlsrLinks.cend();
+            if (enabled)
+            {
+                StaSwitchingToActiveModeOrDeassociated(*linkAddress, id);
+            }
+            GetWifiRemoteStationManager(id)->SetEmlsrEnabled(*linkAddress, enabled);
+        }
+        else
+        {
+            // the non-AP MLD is disabling EMLSR mode
+            /**
+             * After the successful transmission of the EML Operating Mode
+             * Notification frame by the non-AP STA affiliated with the non-AP MLD,
+             * the non-AP MLD shall disable the EMLSR mode and the other non-AP
+             * STAs operating on the corresponding EMLSR links shall transition to
+             * power save mode after the transition delay indicated in the
+             * Transition Timeout subfield in the EML Capabilities subfield of the
+             * Basic Multi-Link element or immediately after receiving an EML
+             * Operating Mode Notification frame from one of the APs operating on
+             * the EMLSR links and affiliated with the AP MLD. (Sec. 35.3.17 of
+             * 802.11be D3.0)
+             */
+            if (id != linkId && GetWifiRemoteStationManager(id)->GetEmlsrEnabled(*linkAddress))
+            {
+                StaSwitchingToPsMode(*linkAddress, id);
+            }
+            GetWifiRemoteStationManager(id)->SetEmlsrEnabled(*linkAddress, false);
+        }
+    }
+}
+
+void
+ApWifiMac::FastForwardEmlOmn(const MgtEmlOmn& frame, const Mac48Address& sender, uint8_t linkId)
+{
+    NS_LOG_FUNCTION(this << frame << sender << linkId);
+
+    auto ehtConfiguration = GetEhtConfiguration();
+    NS_ABORT_MSG_IF(!ehtConfiguration || !ehtConfiguration->m_emlsrActivated,
+                    "EMLSR is not activated on the AP MLD");
+    NS_ABORT_MSG_IF(frame.m_emlControl.emlsrParamUpdateCtrl,
+                    "Unexpected EMLSR Parameter Update field");
+
+    auto mldAddress = GetWifiRemoteStationManager(linkId)->GetMldAddress(sender);
+    NS_ASSERT_MSG(mldAddress, "No MLD address stored for STA " << sender);
+    ApplyEmlsrMode(*mldAddress,
+                   frame.m_emlControl.emlsrMode == 1 ? frame.GetLinkBitmap()
+                                                     : std::list<uint8_t>{},
+                   linkId);
+}
+
 void
 ApWifiMac::DeaggregateAmsduAndForward(Ptr<const WifiMpdu> mpdu)
 {
@@ -18,6 +18,7 @@
 #include "ns3/enum.h"
 #include "ns3/pair.h"
 
+#include <list>
 #include <unordered_map>
 #include <variant>
 
@@ -197,6 +198,40 @@ class ApWifiMac : public WifiMac
     bool IsGcrBaAgreementEstablishedWithAllMembers(const Mac48Address& groupAddress,
                                                    uint8_t tid) const;
 
+    /**
+     * Get Probe Response based on the given Probe Request Multi-link Element (if any)
+     *
+     * @param linkId the ID of link the Probe Response is to be sent
+     * @param reqMle Probe Request Multi-link Element
+     * @return Probe Response header
+     */
+    MgtProbeResponseHeader GetProbeResp(uint8_t linkId,
+                                        const std::optional<MultiLinkElement>& reqMle);
+
+    /**
+     * Process the given (Re)Association Request frame, sent by a non-AP STA that is
+     * fast-forwarding its association (see StaWifiMac::FastForwardAssociation), as if it
+     * had been received, and return the (Re)Association Response frame that would be sent
+     * back. The (Re)Association Response frame is not transmitted and it is processed as if
+     * it had been acknowledged, except that the STAs operating on the links other than the
+     * one on which the (Re)Association Request is received remain in active mode.
+     *
+     * @param mpdu the MPDU containing the (Re)Association Request frame
+     * @return the MPDU containing the (Re)Association Response frame
+     */
+    Ptr<WifiMpdu> FastForwardAssocRequest(Ptr<const WifiMpdu> mpdu);
+
+    /**
+     * Enforce the configuration carried by the given EML Operating Mode Notification frame,
+     * sent by a non-AP MLD that is fast-forwarding its association, as if the frame had been
+     * received and the transition timeout had elapsed.
+     *
+     * @param frame the EML Operating Mode Notification frame
+     * @param sender the MAC address of the sender of the frame
+     * @param linkId the ID of the link over which the frame would have been received
+     */
+    void FastForwardEmlOmn(const MgtEmlOmn& frame, const Mac48Address& sender, uint8_t linkId);
+
     /// ACI-indexed map of access parameters of type unsigned integer (CWmin, CWmax and AIFSN)
     using UintAccessParamsMap = std::map<AcIndex, std::vector<uint64_t>>;
 
@@ -335,6 +370,19 @@ class ApWifiMac : public WifiMac
      */
     void ReceiveEmlOmn(MgtEmlOmn& frame, const Mac48Address& sender, uint8_t linkId);
 
+    /**
+     * Enable EMLSR mode on the given links and disable it on the other links that have been
+     * setup with the given non-AP MLD, as requested by an EML Operating Mode Notification frame.
+     *
+     * @param mldAddress the MLD address of the non-AP MLD
+     * @param emlsrLinks the IDs of the EMLSR links (empty if EMLSR mode is disabled)
+     * @param linkId the ID of the link over which the EML Operating Mode Notification frame
+     *               was received
+     */
+    void ApplyEmlsrMode(const Mac48Address& mldAddress,
+                        const std::list<uint8_t>& emlsrLinks,
+                        uint8_t linkId);
+
     /**
      * The packet we sent was successfully received by the receiver
      * (i.e. we received an Ack from the receiver).  If the packet
@@ -344,6 +392,15 @@ class ApWifiMac : public WifiMac
      * @param mpdu the MPDU that we successfully sent
      */
     void TxOk(Ptr<const WifiMpdu> mpdu);
+    /**
+     * Record that the non-AP STA(s) to which the given (Re)Association Response frame
+     * is addressed are now associated with us.
+     *
+     * @param mpdu the MPDU containing the acknowledged (Re)Association Response frame
+     * @param otherLinksInPsMode whether the STAs operating on the links other than the
+     *                           one on which the frame was sent are in power save mode
+     */
+    void AssocRespAcked(Ptr<const WifiMpdu> mpdu, bool otherLinksInPsMode);
     /**
      * The packet we sent was successfully received by the receiver
      * (i.e. we did not receive an Ack from the receiver).  If the packet
@@ -373,16 +430,6 @@ class ApWifiMac : public WifiMac
      */
     MgtProbeResponseHeader GetProbeRespProfile(uint8_t linkId) const;
 
-    /**
-     * Get Probe Response based on the given Probe Request Multi-link Element (if any)
-     *
-     * @param linkId the ID of link the Probe Response is to be sent
-     * @param reqMle Probe Request Multi-link Element
-     * @return Probe Response header
-     */
-    MgtProbeResponseHeader GetProbeResp(uint8_t linkId,
-                                        const std::optional<MultiLinkElement>& reqMle);
-
     /**
      * Send a packet prepared using the given Probe Response to the given receiver on the given
      * link.
@@ -429,6 +476,16 @@ class ApWifiMac : public WifiMac
     LinkIdStaAddrMap GetLinkIdStaAddrMap(MgtAssocResponseHeader& assoc,
                                          const Mac48Address& to,
                                          uint8_t linkId);
+    /**
+     * Get the MPDU containing the (Re)Association Response frame to send to the given
+     * station on the given link. If the station is associating, an AID is assigned to it.
+     *
+     * @param to the address of the STA we are sending an association response to
+     * @param isReassoc indicates whether it is a reassociation response
+     * @param linkId the ID of the link on which the association response must be sent
+     * @return the MPDU containing the (Re)Association Response frame
+     */
+    Ptr<WifiMpdu> GetAssocRespMpdu(Mac48Address to, bool isReassoc, uint8_t linkId);
     /**
      * Forward an association or a reassociation response packet to the DCF/EDCA.
      *
@@ -12,13 +12,51 @@
 
 #include "ns3/log.h"
 
+#include <algorithm>
+#include <bit>
+
 namespace ns3
 {
 
 NS_LOG_COMPONENT_DEFINE("BlockAckWindow");
 
+/// Number of bits in a word of the array storing the window
+static constexpr std::size_t WORD_SIZE = 64;
+
+BlockAckWindow::Reference::Reference(uint64_t& word, uint64_t mask)
+    : m_word(word),
+      m_mask(mask)
+{
+}
+
+BlockAckWindow::Reference::operator bool() const
+{
+    return (m_word & m_mask) != 0;
+}
+
+BlockAckWindow::Reference&
+BlockAckWindow::Reference::operator=(bool value)
+{
+    if (value)
+    {
+        m_word |= m_mask;
+    }
+    else
+    {
+        m_word &= ~m_mask;
+    }
+    return *this;
+}
+
+BlockAckWindow::Reference&
+BlockAckWindow::Reference::operator=(const Reference& other)
+{
+    return *this = static_cast<bool>(other);
+}
+
 BlockAckWindow::BlockAckWindow()
     : m_winStart(0),
+      m_winSize(0),
       m_head(0)
 {
 }
@@ -28,14 +66,15 @@ BlockAckWindow::Init(uint16_t winStart, uint16_t winSize)
 {
     NS_LOG_FUNCTION(this << winStart << winSize);
     m_winStart = winStart;
-    m_window.assign(winSize, false);
+    m_words.assign((winSize + WORD_SIZE - 1) / WORD_SIZE, 0);
+    m_winSize = winSize;
     m_head = 0;
 }
 
 void
 BlockAckWindow::Reset(uint16_t winStart)
 {
-    Init(winStart, m_window.size());
+    Init(winStart, m_winSize);
 }
 
 uint16_t
@@ -47,29 +86,31 @@ BlockAckWindow::GetWinStart() const
 uint16_t
 BlockAckWindow::GetWinEnd() const
 {
-    return (m_winStart + m_window.size() - 1) % SEQNO_SPACE_SIZE;
+    return (m_winStart + m_winSize - 1) % SEQNO_SPACE_SIZE;
 }
 
 std::size_t
 BlockAckWindow::GetWinSize() const
 {
-    return m_window.size();
+    return m_winSize;
 }
 
-std::vector<bool>::reference
+BlockAckWindow::Reference
 BlockAckWindow::At(std::size_t distance)
 {
-    NS_ASSERT(distance < m_window.size());
+    NS_ASSERT(distance < m_winSize);
 
-    return m_window.at((m_head + distance) % m_window.size());
+    const auto pos = (m_head + distance) % (m_words.size() * WORD_SIZE);
+    return Reference(m_words[pos / WORD_SIZE], uint64_t{1} << (pos % WORD_SIZE));
 }
 
-std::vector<bool>::const_reference
+bool
 BlockAckWindow::At(std::size_t distance) const
 {
-    NS_ASSERT(distance < m_window.size());
+    NS_ASSERT(distance < m_winSize);
 
-    return m_window.at((m_head + distance) % m_window.size());
+    const auto pos = (m_head + distance) % (m_words.size() * WORD_SIZE);
+    return (m_words[pos / WORD_SIZE] & (uint64_t{1} << (pos % WORD_SIZE))) != 0;
 }
 
 void
@@ -77,18 +118,91 @@ BlockAckWindow::Advance(std::size_t count)
 {
     NS_LOG_FUNCTION(this << count);
 
-    if (count >= m_window.size())
+    if (count >= m_winSize)
     {
         Reset((m_winStart + count) % SEQNO_SPACE_SIZE);
         return;
     }
 
-    for (std::size_t i = 0; i < count; i++)
+    // the bits following the window are cleared, hence clearing the bits leaving the
+    // window is enough to have the bits entering the window cleared
+    Clear(m_head, count);
+    m_head = (m_head + count) % (m_words.size() * WORD_SIZE);
+    m_winStart = (m_winStart + count) % SEQNO_SPACE_SIZE;
+}
+
+std::size_t
+BlockAckWindow::GetNSetFromStart() const
+{
+    for (std::size_t distance = 0; distance < m_winSize; distance += WORD_SIZE)
     {
-        m_window[m_head] = false;
-        m_head = (m_head + 1) % m_window.size();
+        if (const auto word = GetWord(distance); word != ~uint64_t{0})
+        {
+            return std::min<std::size_t>(distance + std::countr_one(word), m_winSize);
+        }
+    }
+    return m_winSize;
+}
+
+std::size_t
+BlockAckWindow::Count() const
+{
+    std::size_t count = 0;
+    for (const auto word : m_words)
+    {
+        count += std::popcount(word);
+    }
+    return count;
+}
+
+void
+BlockAckWindow::CopyTo(std::vector<uint8_t>& bitmap) const
+{
+    for (std::size_t i = 0; i < bitmap.size(); i += sizeof(uint64_t))
+    {
+        auto word = (i * 8 < m_winSize ? GetWord(i * 8) : 0);
+        for (std::size_t j = i; j < std::min(i + sizeof(uint64_t), bitmap.size()); j++)
+        {
+            bitmap[j] = static_cast<uint8_t>(word);
+            word >>= 8;
+        }
+    }
+}
+
+uint64_t
+BlockAckWindow::GetWord(std::size_t distance) const
+{
+    NS_ASSERT(distance < m_winSize);
+
+    const auto pos = (m_head + distance) % (m_words.size() * WORD_SIZE);
+    const auto index = pos / WORD_SIZE;
+    const auto offset = pos % WORD_SIZE;
+    auto word = m_words[index] >> offset;
+    if (offset > 0)
+    {
+        word |= m_words[(index + 1) % m_words.size()] << (WORD_SIZE - offset);
+    }
+    if (const auto nLeft = m_winSize - distance; nLeft < WORD_SIZE)
+    {
+        // clear the bits beyond the window, which may be set because the array wraps around
+        word &= (uint64_t{1} << nLeft) - 1;
+    }
+    return word;
+}
+
+void
+BlockAckWindow::Clear(std::size_t pos, std::size_t count)
+{
+    while (count > 0)
+    {
+        const auto index = pos / WORD_SIZE;
+        const auto offset = pos % WORD_SIZE;
+        const auto n = std::min(count, WORD_SIZE - offset);
+        const auto mask = (n == WORD_SIZE ? ~uint64_t{0} : ((uint64_t{1} << n) - 1) << offset);
+        m_words[index] &= ~mask;
+        pos = (index + 1) % m_words.size() * WORD_SIZE;
+        count -= n;
     }
-    m_winStart = (m_winStart + count) % SEQNO_SPACE_SIZE;
 }
 
 } // namespace ns3
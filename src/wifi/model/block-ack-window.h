@@ -9,6 +9,7 @@
 #ifndef BLOCK_ACK_WINDOW_H
 #define BLOCK_ACK_WINDOW_H
 
+#include <cstddef>
 #include <cstdint>
 #include <vector>
 
@@ -24,10 +25,14 @@ namespace ns3
  * a given number of positions. This class can be used to implement both
  * an originator's window and a recipient's window.
  *
- * The window is implemented as a vector of bool and managed as a circular
- * queue. The window is moved forward by advancing the head of the queue and
- * clearing the elements that become part of the tail of the queue. Hence,
- * no element is required to be shifted when the window moves forward.
+ * The window is implemented as an array of 64-bit words, which is managed as a
+ * circular queue of bits. The window is moved forward by advancing the head of
+ * the queue and clearing the elements that become part of the tail of the queue.
+ * Hence, no element is required to be shifted when the window moves forward.
+ * The number of bits in the array is the window size rounded up to a multiple
+ * of 64; the bits that are not part of the window are always cleared, so that
+ * the elements of the window can be counted, searched and copied a word at a
+ * time, which matters for the large windows (up to 1024 MPDUs) used by EHT.
  *
  * Example:
  *
@@ -46,6 +51,44 @@ namespace ns3
 class BlockAckWindow
 {
   public:
+    /**
+     * Proxy class to access an element of the window, which is stored as a bit
+     * of the underlying array of words.
+     */
+    class Reference
+    {
+      public:
+        /**
+         * Constructor
+         *
+         * @param word the word storing the element
+         * @param mask the mask selecting the element in the word
+         */
+        Reference(uint64_t& word, uint64_t mask);
+        /**
+         * @return the value of the element
+         */
+        operator bool() const;
+        /**
+         * Set the value of the element.
+         *
+         * @param value the value of the element
+         * @return a reference to this object
+         */
+        Reference& operator=(bool value);
+        /**
+         * Set the value of the element to the value of another element.
+         *
+         * @param other the other element
+         * @return a reference to this object
+         */
+        Reference& operator=(const Reference& other);
+
+      private:
+        uint64_t& m_word; ///< the word storing the element
+        uint64_t m_mask;  ///< the mask selecting the element in the word
+    };
+
     /**
      * Constructor
      */
@@ -91,28 +134,68 @@ class BlockAckWindow
      * @return a reference to the element in the window having the given distance
      *         from the current winStart
      */
-    std::vector<bool>::reference At(std::size_t distance);
+    Reference At(std::size_t distance);
     /**
-     * Get a const reference to the element in the window having the given distance from
+     * Get the value of the element in the window having the given distance from
      * the current winStart. Note that the given distance must be less than the
      * window size.
      *
      * @param distance the given distance
-     * @return a const reference to the element in the window having the given distance
+     * @return the value of the element in the window having the given distance
      *         from the current winStart
      */
-    std::vector<bool>::const_reference At(std::size_t distance) const;
+    bool At(std::size_t distance) const;
     /**
      * Advance the current winStart by the given number of positions.
      *
      * @param count the number of positions the current winStart must be advanced by
      */
     void Advance(std::size_t count);
+    /**
+     * Get the number of consecutive elements that are set, starting from the
+     * element at winStart. The window can be advanced by this number of positions
+     * to make winStart point to the first element that is not set.
+     *
+     * @return the number of consecutive elements that are set, starting from winStart
+     */
+    std::size_t GetNSetFromStart() const;
+    /**
+     * @return the number of elements in the window that are set
+     */
+    std::size_t Count() const;
+    /**
+     * Copy the window into the given bitmap, so that bit i of the bitmap (bit i % 8
+     * of the byte i / 8) is set if and only if the element having distance i from
+     * the current winStart is set. The size of the bitmap is not changed; the bits
+     * of the bitmap that are beyond the window are cleared.
+     *
+     * @param bitmap the bitmap
+     */
+    void CopyTo(std::vector<uint8_t>& bitmap) const;
 
   private:
-    uint16_t m_winStart;        ///< window start (sequence number)
-    std::vector<bool> m_window; ///< window
-    std::size_t m_head;         ///< index of winStart in the vector
+    /**
+     * Get the 64 elements of the window starting at the given distance from the
+     * current winStart, packed in a word (the element at the given distance is the
+     * least significant bit). The elements beyond the window are cleared.
+     *
+     * @param distance the given distance
+     * @return the word packing the 64 elements starting at the given distance
+     */
+    uint64_t GetWord(std::size_t distance) const;
+    /**
+     * Clear the given number of bits of the array, starting at the given position.
+     * The bits to clear may wrap around the end of the array.
+     *
+     * @param pos the position of the first bit to clear
+     * @param count the number of bits to clear
+     */
+    void Clear(std::size_t pos, std::size_t count);
+
+    uint16_t m_winStart;           ///< window start (sequence number)
+    std::vector<uint64_t> m_words; ///< array of words storing the window
+    std::size_t m_winSize;         ///< window size
+    std::size_t m_head;            ///< index of the bit storing winStart in the array
 };
 
 } // namespace ns3
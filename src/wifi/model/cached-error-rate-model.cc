@@ -0,0 +1,216 @@
+/*
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+#include "cached-error-rate-model.h"
+
+#include "nist-error-rate-model.h"
+#include "wifi-tx-vector.h"
+#include "wifi-utils.h"
+
+#include "ns3/double.h"
+#include "ns3/log.h"
+#include "ns3/pointer.h"
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <limits>
+
+namespace ns3
+{
+
+NS_LOG_COMPONENT_DEFINE("CachedErrorRateModel");
+
+NS_OBJECT_ENSURE_REGISTERED(CachedErrorRateModel);
+
+static const double MIN_ERROR_PER_BIT = 1e-300; //!< lowest error rate per bit in the tables
+static const double MAX_ERROR_PER_BIT = 1e3;    //!< highest error rate per bit in the tables
+
+TypeId
+CachedErrorRateModel::GetTypeId()
+{
+    static TypeId tid =
+        TypeId("ns3::CachedErrorRateModel")
+            .SetParent<ErrorRateModel>()
+            .SetGroupName("Wifi")
+            .AddConstructor<CachedErrorRateModel>()
+            .AddAttribute("ErrorRateModel",
+                          "The error rate model whose chunk success rates are cached. If "
+                          "not set, a NistErrorRateModel is created for this object.",
+                          PointerValue(),
+                          MakePointerAccessor(&CachedErrorRateModel::m_errorRateModel),
+                          MakePointerChecker<ErrorRateModel>())
+            .AddAttribute("SnrResolution",
+                          "The SNR step (dB) between two entries of the lookup tables",
+                          DoubleValue(0.05),
+                          MakeDoubleAccessor(&CachedErrorRateModel::m_snrResolution),
+                          MakeDoubleChecker<dB_u>(1e-3))
+            .AddAttribute("MinSnr",
+                          "The lowest SNR (dB) in the lookup tables. Lower SNR values are "
+                          "handed over to the wrapped error rate model.",
+                          DoubleValue(-10.0),
+                          MakeDoubleAccessor(&CachedErrorRateModel::m_minSnr),
+                          MakeDoubleChecker<dB_u>())
+            .AddAttribute("MaxSnr",
+                          "The highest SNR (dB) in the lookup tables. Higher SNR values are "
+                          "handed over to the wrapped error rate model.",
+                          DoubleValue(60.0),
+                          MakeDoubleAccessor(&CachedErrorRateModel::m_maxSnr),
+                          MakeDoubleChecker<dB_u>());
+    return tid;
+}
+
+CachedErrorRateModel::CachedErrorRateModel()
+{
+    NS_LOG_FUNCTION(this);
+}
+
+CachedErrorRateModel::~CachedErrorRateModel()
+{
+    NS_LOG_FUNCTION(this);
+}
+
+void
+CachedErrorRateModel::NotifyConstructionCompleted()
+{
+    NS_LOG_FUNCTION(this);
+    // every object wraps its own error rate model, unless one is given
+    if (!m_errorRateModel)
+    {
+        m_errorRateModel = CreateObject<NistErrorRateModel>();
+    }
+    ErrorRateModel::NotifyConstructionCompleted();
+}
+
+void
+CachedErrorRateModel::DoDispose()
+{
+    NS_LOG_FUNCTION(this);
+    m_tables.clear();
+    m_errorRateModel = nullptr;
+    ErrorRateModel::DoDispose();
+}
+
+bool
+CachedErrorRateModel::IsAwgn() const
+{
+    return m_errorRateModel->IsAwgn();
+}
+
+int64_t
+CachedErrorRateModel::AssignStreams(int64_t stream)
+{
+    return m_errorRateModel->AssignStreams(stream);
+}
+
+void
+CachedErrorRateModel::Flush()
+{
+    NS_LOG_FUNCTION(this);
+    m_tables.clear();
+}
+
+std::size_t
+CachedErrorRateModel::GetNTables() const
+{
+    return m_tables.size();
+}
+
+uint64_t
+CachedErrorRateModel::GetTableKey(WifiMode mode,
+                                  const WifiTxVector& txVector,
+                                  uint8_t bucket,
+                                  uint8_t numRxAntennas,
+                                  WifiPpduField field,
+                                  uint16_t staId)
+{
+    // the PHY rate of a PHY header chunk only depends on the channel width, whereas the
+    // PHY rate of a payload chunk depends on the guard interval, the number of spatial
+    // streams and, for MU PPDUs, the RU size
+    uint64_t nss = 0;
+    uint64_t ruType = 0;
+    if (!(txVector.IsMu() && staId == SU_STA_ID) && mode == txVector.GetMode(staId))
+    {
+        nss = txVector.GetNss(staId);
+        ruType = txVector.IsMu() ? txVector.GetRu(staId).GetRuType() + 1 : 0;
+    }
+    const auto guardInterval =
+        static_cast<uint64_t>(txVector.GetGuardInterval().GetNanoSeconds() / 100);
+    NS_ASSERT(nss < 16 && ruType < 16 && guardInterval < 256 && numRxAntennas < 16 &&
+              field < 16 && bucket < 64);
+
+    uint64_t key = mode.GetUid();
+    key = (key << 16) | static_cast<uint16_t>(txVector.GetChannelWidth());
+    key = (key << 8) | guardInterval;
+    key = (key << 4) | nss;
+    key = (key << 4) | ruType;
+    key = (key << 1) | (txVector.IsLdpc() ? 1 : 0);
+    key = (key << 4) | numRxAntennas;
+    key = (key << 4) | field;
+    key = (key << 6) | bucket;
+    return key;
+}
+
+double
+CachedErrorRateModel::ComputeEntry(WifiMode mode,
+                                   const WifiTxVector& txVector,
+                                   std::size_t index,
+                                   uint64_t nbits,
+                                   uint8_t numRxAntennas,
+                                   WifiPpduField field,
+                                   uint16_t staId) const
+{
+    const auto snr = DbToRatio(m_minSnr + index * m_snrResolution);
+    const auto csr =
+        m_errorRateModel
+            ->GetChunkSuccessRate(mode, txVector, snr, nbits, numRxAntennas, field, staId);
+    const auto errorPerBit = -std::log(csr) / nbits;
+    return std::log(std::clamp(errorPerBit, MIN_ERROR_PER_BIT, MAX_ERROR_PER_BIT));
+}
+
+double
+CachedErrorRateModel::DoGetChunkSuccessRate(WifiMode mode,
+                                            const WifiTxVector& txVector,
+                                            double snr,
+                                            uint64_t nbits,
+                                            uint8_t numRxAntennas,
+                                            WifiPpduField field,
+                                            uint16_t staId) const
+{
+    NS_LOG_FUNCTION(this << mode << txVector << snr << nbits << +numRxAntennas << field << staId);
+    const auto position = (RatioToDb(snr) - m_minSnr) / m_snrResolution;
+    const auto nEntries = static_cast<std::size_t>((m_maxSnr - m_minSnr) / m_snrResolution) + 1;
+    if (nbits == 0 || !(position >= 0) || position >= nEntries - 1)
+    {
+        return m_errorRateModel
+            ->GetChunkSuccessRate(mode, txVector, snr, nbits, numRxAntennas, field, staId);
+    }
+
+    // chunks with nbits in [2^bucket, 2^(bucket+1)) share the table computed for 2^bucket bits
+    const auto bucket = static_cast<uint8_t>(std::bit_width(nbits) - 1);
+    auto [it, inserted] =
+        m_tables.try_emplace(GetTableKey(mode, txVector, bucket, numRxAntennas, field, staId));
+    auto& table = it->second;
+    if (inserted)
+    {
+        NS_LOG_DEBUG("New lookup table for mode " << mode << " and " << (1ULL << bucket)
+                                                  << " bits");
+        table.assign(nEntries, std::numeric_limits<double>::quiet_NaN());
+    }
+
+    const auto index = static_cast<std::size_t>(position);
+    for (auto i : {index, index + 1})
+    {
+        if (std::isnan(table[i]))
+        {
+            table[i] =
+                ComputeEntry(mode, txVector, i, 1ULL << bucket, numRxAntennas, field, staId);
+        }
+    }
+    const auto weight = position - index;
+    const auto logErrorPerBit = table[index] + weight * (table[index + 1] - table[index]);
+    return std::exp(-static_cast<double>(nbits) * std::exp(logErrorPerBit));
+}
+
+} // namespace ns3
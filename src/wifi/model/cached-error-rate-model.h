@@ -0,0 +1,122 @@
+/*
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+#ifndef CACHED_ERROR_RATE_MODEL_H
+#define CACHED_ERROR_RATE_MODEL_H
+
+#include "error-rate-model.h"
+#include "wifi-units.h"
+
+#include <unordered_map>
+#include <vector>
+
+namespace ns3
+{
+
+/**
+ * @ingroup wifi
+ * @brief Error rate model caching the chunk success rates of another error rate model
+ *
+ * This model wraps another error rate model and stores the chunk success rates
+ * computed by the latter into lookup tables indexed by SNR, quantized in steps of
+ * SnrResolution dB between MinSnr and MaxSnr. A table is kept per mode, per set of
+ * TXVECTOR parameters determining the PHY rate of the chunk (channel width, guard
+ * interval, number of spatial streams and RU size), per coding, number of RX antennas,
+ * PPDU field and chunk size, where chunk sizes are grouped by powers of two.
+ *
+ * The tables store the success rate per bit, as log(-log(CSR) / nbits), which is
+ * linearly interpolated between the two nearest SNR values. The entries of a table
+ * are computed by the wrapped model the first time they are needed. The result is
+ * exact (up to the interpolation) for the models whose chunk success rate has the
+ * form (1 - p(SNR))^nbits, such as NistErrorRateModel and YansErrorRateModel. SNR
+ * values outside the tabulated range are handed over to the wrapped model.
+ */
+class CachedErrorRateModel : public ErrorRateModel
+{
+  public:
+    /**
+     * @brief Get the type ID.
+     * @return the object TypeId
+     */
+    static TypeId GetTypeId();
+
+    CachedErrorRateModel();
+    ~CachedErrorRateModel() override;
+
+    bool IsAwgn() const override;
+    int64_t AssignStreams(int64_t stream) override;
+
+    /**
+     * Discard all the lookup tables.
+     */
+    void Flush();
+
+    /**
+     * @return the number of lookup tables
+     */
+    std::size_t GetNTables() const;
+
+  protected:
+    void NotifyConstructionCompleted() override;
+    void DoDispose() override;
+
+  private:
+    double DoGetChunkSuccessRate(WifiMode mode,
+                                 const WifiTxVector& txVector,
+                                 double snr,
+                                 uint64_t nbits,
+                                 uint8_t numRxAntennas,
+                                 WifiPpduField field,
+                                 uint16_t staId) const override;
+
+    /**
+     * Get the key of the lookup table used for a chunk.
+     *
+     * @param mode the Wi-Fi mode applicable to the chunk
+     * @param txVector TXVECTOR of the overall transmission
+     * @param bucket the index of the group of chunk sizes
+     * @param numRxAntennas the number of active RX antennas
+     * @param field the PPDU field to which the chunk belongs to
+     * @param staId the station ID for MU
+     * @return the key of the lookup table
+     */
+    static uint64_t GetTableKey(WifiMode mode,
+                                const WifiTxVector& txVector,
+                                uint8_t bucket,
+                                uint8_t numRxAntennas,
+                                WifiPpduField field,
+                                uint16_t staId);
+
+    /**
+     * Compute an entry of a lookup table with the wrapped model.
+     *
+     * @param mode the Wi-Fi mode applicable to the chunk
+     * @param txVector TXVECTOR of the overall transmission
+     * @param index the index of the entry, i.e. of the SNR
+     * @param nbits the number of bits of the chunk size group
+     * @param numRxAntennas the number of active RX antennas
+     * @param field the PPDU field to which the chunk belongs to
+     * @param staId the station ID for MU
+     * @return the entry of the lookup table
+     */
+    double ComputeEntry(WifiMode mode,
+                        const WifiTxVector& txVector,
+                        std::size_t index,
+                        uint64_t nbits,
+                        uint8_t numRxAntennas,
+                        WifiPpduField field,
+                        uint16_t staId) const;
+
+    Ptr<ErrorRateModel> m_errorRateModel; //!< the wrapped error rate model
+    dB_u m_snrResolution;                 //!< the SNR step between the table entries
+    dB_u m_minSnr;                        //!< the SNR of the first table entry
+    dB_u m_maxSnr;                        //!< the SNR of the last table entry
+
+    mutable std::unordered_map<uint64_t, std::vector<double>>
+        m_tables; //!< the lookup tables, each with NaN for the entries not computed yet
+};
+
+} // namespace ns3
+
+#endif /* CACHED_ERROR_RATE_MODEL_H */
@@ -1165,6 +1165,21 @@ CtrlBAckResponseHeader::GetBitmap(std::size_t index) const
     return m_baInfo[index].m_bitmap;
 }
 
+void
+CtrlBAckResponseHeader::SetBitmap(std::vector<uint8_t> bitmap, std::size_t index)
+{
+    NS_ASSERT_MSG(m_baType.m_variant == BlockAckType::MULTI_STA || index == 0,
+                  "index can only be non null for Multi-STA Block Ack");
+    NS_ASSERT(index < m_baInfo.size());
+    NS_ASSERT_MSG(m_baType.m_variant != BlockAckType::BASIC,
+                  "Cannot set the bitmap of a Basic Block Ack");
+    NS_ASSERT_MSG(bitmap.size() == m_baType.m_bitmapLen[index],
+                  "Bitmap size (" << bitmap.size() << ") differs from bitmap length ("
+                                  << +m_baType.m_bitmapLen[index] << ")");
+
+    m_baInfo[index].m_bitmap = std::move(bitmap);
+}
+
 void
 CtrlBAckResponseHeader::ResetBitmap(std::size_t index)
 {
@@ -441,6 +441,16 @@ class CtrlBAckResponseHeader : public Header
      * @return a const reference to the bitmap from the BlockAck response header
      */
     const std::vector<uint8_t>& GetBitmap(std::size_t index = 0) const;
+    /**
+     * Set the bitmap of the BlockAck response header. For Multi-STA Block Acks, set
+     * the bitmap included in the Per AID TID Info subfield identified by <i>index</i>.
+     * The given bitmap must have the size of the current bitmap and is meant to be
+     * used by the BlockAck variants having one bit per MPDU (i.e., all but Basic).
+     *
+     * @param bitmap the bitmap
+     * @param index the index of the Per AID TID Info subfield (Multi-STA Block Ack only)
+     */
+    void SetBitmap(std::vector<uint8_t> bitmap, std::size_t index = 0);
 
     /**
      * Reset the bitmap to 0. For Multi-STA Block Acks, reset the bitmap included
@@ -393,6 +393,35 @@ EmlsrManager::SetEmlsrLinks(const std::set<uint8_t>& linkIds)
     }
 }
 
+std::optional<MgtEmlOmn>
+EmlsrManager::FastForwardEmlsrMode(Ptr<const WifiMpdu> assocReq)
+{
+    NS_LOG_FUNCTION(this << *assocReq);
+
+    // store padding delay and transition delay advertised in AssocReq, as if it was acked
+    TxOk(assocReq);
+
+    if (!GetStaMac()->IsAssociated() || !GetTransitionTimeout())
+    {
+        NS_LOG_DEBUG("The AP MLD does not support EMLSR");
+        return std::nullopt;
+    }
+
+    ComputeOperatingChannels();
+
+    if (!m_nextEmlsrLinks || m_nextEmlsrLinks->empty())
+    {
+        NS_LOG_DEBUG("No EMLSR links configured");
+        return std::nullopt;
+    }
+
+    // make the EMLSR links effective immediately, as if the EML Operating Mode Notification
+    // frame had been acknowledged and the transition timeout had elapsed
+    auto frame = GetEmlOmn();
+    ChangeEmlsrMode();
+    return frame;
+}
+
 void
 EmlsrManager::NotifyMgtFrameReceived(Ptr<const WifiMpdu> mpdu, uint8_t linkId)
 {
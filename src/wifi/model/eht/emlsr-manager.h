@@ -167,6 +167,18 @@ class EmlsrManager : public Object
      */
     void SetEmlsrLinks(const std::set<uint8_t>& linkIds);
 
+    /**
+     * Enable EMLSR mode on the links set via SetEmlsrLinks() without sending an EML
+     * Operating Mode Notification frame. This method is called by the non-AP MLD after
+     * fast-forwarding ML setup with an AP MLD (see StaWifiMac::FastForwardAssociation).
+     *
+     * @param assocReq the MPDU containing the Association Request frame that would have
+     *                 been sent to the AP MLD
+     * @return the EML Operating Mode Notification frame that would have been sent, if EMLSR
+     *         mode has been enabled
+     */
+    std::optional<MgtEmlOmn> FastForwardEmlsrMode(Ptr<const WifiMpdu> assocReq);
+
     /**
      * @return the set of links on which EMLSR mode is enabled
      */
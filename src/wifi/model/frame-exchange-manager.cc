@@ -395,8 +395,7 @@ FrameExchangeManager::StartTransmission(Ptr<Txop> dcf, MHz_u allowedWidth)
     NS_ASSERT(m_protectionManager);
     NS_ASSERT(m_ackManager);
     WifiTxParameters txParams;
-    txParams.m_txVector =
-        GetWifiRemoteStationManager()->GetDataTxVector(mpdu->GetHeader(), m_allowedWidth);
+    txParams.m_txVector = GetWifiRemoteStationManager()->GetDataTxVector(mpdu, m_allowedWidth);
     txParams.AddMpdu(mpdu);
     UpdateTxDuration(mpdu->GetHeader().GetAddr1(), txParams);
     txParams.m_protection = m_protectionManager->TryAddMpdu(mpdu, txParams);
@@ -1615,7 +1615,13 @@ HeFrameExchangeManager::SetTargetRssi(CtrlTriggerHeader& trigger) const
         auto itAidAddr = staList.find(userInfo.GetAid12());
         NS_ASSERT(itAidAddr != staList.end());
         auto optRssi = GetMostRecentRssi(itAidAddr->second);
-        NS_ASSERT(optRssi);
+        if (!optRssi)
+        {
+            // no frame received yet from the station on this link (e.g., the association
+            // has been fast-forwarded), hence request the station to use its max TX power
+            userInfo.SetUlTargetRssiMaxTxPower();
+            continue;
+        }
         auto rssi = static_cast<int8_t>(*optRssi);
         rssi = (rssi >= -20)
                    ? -20
@@ -80,7 +80,8 @@ class HeFrameExchangeManager : public VhtFrameExchangeManager
     /**
      * Set the UL Target RSSI subfield of every User Info fields of the given
      * Trigger Frame to the most recent RSSI observed from the corresponding
-     * station.
+     * station. If no RSSI has been observed yet from a station, the UL Target
+     * RSSI subfield indicates that the station shall transmit at its maximum power.
      *
      * @param trigger the given Trigger Frame
      */
@@ -424,6 +424,7 @@ HePhy::DoAbortCurrentReception(WifiPhyRxfailureReason reason)
             endMpduEvent.Cancel();
         }
         m_endOfMpduEvents.clear();
+        m_pendingMpdusMap.clear();
     }
     else
     {
@@ -446,6 +447,18 @@ HePhy::DoResetReceive(Ptr<Event> event)
     m_beginMuPayloadRxEvents.clear();
 }
 
+WifiPpduField
+HePhy::GetFirstNonAbstractedField(Ptr<const WifiPpdu> ppdu) const
+{
+    if (ppdu->GetType() == WIFI_PPDU_TYPE_DL_MU || ppdu->GetType() == WIFI_PPDU_TYPE_UL_MU)
+    {
+        // the HE portion of MU PPDUs is received as a separate signal, which can only be
+        // associated with the PPDU under reception once the PHY header has been processed
+        return WIFI_PPDU_FIELD_TRAINING;
+    }
+    return VhtPhy::GetFirstNonAbstractedField(ppdu);
+}
+
 Ptr<Event>
 HePhy::DoGetEvent(Ptr<const WifiPpdu> ppdu, RxPowerWattPerChannelBand& rxPowersW)
 {
@@ -464,6 +464,7 @@ class HePhy : public VhtPhy
     PhyFieldRxStatus ProcessSig(Ptr<Event> event,
                                 PhyFieldRxStatus status,
                                 WifiPpduField field) override;
+    WifiPpduField GetFirstNonAbstractedField(Ptr<const WifiPpdu> ppdu) const override;
     Ptr<Event> DoGetEvent(Ptr<const WifiPpdu> ppdu, RxPowerWattPerChannelBand& rxPowersW) override;
     bool IsConfigSupported(Ptr<const WifiPpdu> ppdu) const override;
     Time DoStartReceivePayload(Ptr<Event> event) override;
@@ -112,6 +112,15 @@ RrMultiUserScheduler::DoInitialize()
     {
         m_staListDl.insert({ac.first, {}});
     }
+    // stations may have associated before this object is initialized (e.g., if the
+    // association has been fast-forwarded), hence the trace above was not fired for them
+    for (const auto linkId : m_apMac->GetLinkIds())
+    {
+        for (const auto& [aid, address] : m_apMac->GetStaList(linkId))
+        {
+            NotifyStationAssociated(aid, address);
+        }
+    }
     MultiUserScheduler::DoInitialize();
 }
 
@@ -123,6 +132,7 @@ RrMultiUserScheduler::DoDispose()
     m_staListUl.clear();
     m_candidates.clear();
     m_txParams.Clear();
+    m_ruAllocationPlans.clear();
     m_apMac->TraceDisconnectWithoutContext(
         "AssociatedSta",
         MakeCallback(&RrMultiUserScheduler::NotifyStationAssociated, this));
@@ -175,16 +185,13 @@ RrMultiUserScheduler::GetTxVectorForUlMu(std::function<bool(const MasterInfo&)>
     NS_LOG_FUNCTION(this);
 
     // determine RUs to allocate to stations
-    auto count = std::min<std::size_t>(m_nStations, m_staListUl.size());
-    std::size_t nCentral26TonesRus;
-    HeRu::GetEqualSizedRusForStations(m_allowedWidth, count, nCentral26TonesRus);
+    const auto& plan =
+        GetRuAllocationPlan(m_allowedWidth,
+                            std::min<std::size_t>(m_nStations, m_staListUl.size()));
+    auto count = plan.nRus;
+    auto nCentral26TonesRus = (m_useCentral26TonesRus ? plan.nCentral26TonesRus : 0);
     NS_ASSERT(count >= 1);
 
-    if (!m_useCentral26TonesRus)
-    {
-        nCentral26TonesRus = 0;
-    }
-
     Ptr<HeConfiguration> heConfiguration = m_apMac->GetHeConfiguration();
     NS_ASSERT(heConfiguration);
 
@@ -747,18 +754,14 @@ RrMultiUserScheduler::TrySendingDlMuPpdu()
         return TxFormat::SU_TX;
     }
 
-    std::size_t count =
-        std::min(static_cast<std::size_t>(m_nStations), m_staListDl[primaryAc].size());
-    std::size_t nCentral26TonesRus;
-    HeRu::RuType ruType =
-        HeRu::GetEqualSizedRusForStations(m_allowedWidth, count, nCentral26TonesRus);
+    const auto& plan =
+        GetRuAllocationPlan(m_allowedWidth,
+                            std::min<std::size_t>(m_nStations, m_staListDl[primaryAc].size()));
+    auto count = plan.nRus;
+    auto nCentral26TonesRus = (m_useCentral26TonesRus ? plan.nCentral26TonesRus : 0);
+    auto ruType = plan.ruType;
     NS_ASSERT(count >= 1);
 
-    if (!m_useCentral26TonesRus)
-    {
-        nCentral26TonesRus = 0;
-    }
-
     uint8_t currTid = wifiAcList.at(primaryAc).GetHighTid();
 
     Ptr<WifiMpdu> mpdu = m_edca->PeekNextMpdu(m_linkId);
@@ -830,6 +833,15 @@ RrMultiUserScheduler::TrySendingDlMuPpdu()
         {
             AcIndex ac = QosUtilsMapTidToAc(tid);
             NS_ASSERT(ac >= primaryAc);
+            // the MAC queue keeps track of the bytes queued for every receiver and TID
+            // while frames are enqueued and dequeued, hence stations without backlog
+            // can be skipped without looking up BA agreements and peeking frames
+            if (m_apMac->GetTxopQueue(ac)->GetNBytes(
+                    {WIFI_QOSDATA_QUEUE, WIFI_UNICAST, staIt->address, tid}) == 0)
+            {
+                NS_LOG_DEBUG("No frames to send to " << staIt->address << " with TID=" << +tid);
+                continue;
+            }
             // check that a BA agreement is established with the receiver for the
             // considered TID, since ack sequences for DL MU PPDUs require block ack
             if (m_apMac->GetBaAgreementEstablishedAsOriginator(staIt->address, tid))
@@ -846,7 +858,7 @@ RrMultiUserScheduler::TrySendingDlMuPpdu()
                     // An RU of the computed size is tentatively assigned to the candidate
                     // station, so that the TX duration can be correctly computed.
                     WifiTxVector suTxVector =
-                        GetWifiRemoteStationManager(m_linkId)->GetDataTxVector(mpdu->GetHeader(),
+                        GetWifiRemoteStationManager(m_linkId)->GetDataTxVector(mpdu,
                                                                                m_allowedWidth);
 
                     WifiTxVector txVectorCopy = m_txParams.m_txVector;
@@ -913,12 +925,11 @@ RrMultiUserScheduler::FinalizeTxVector(WifiTxVector& txVector)
     NS_ASSERT(txVector.GetHeMuUserInfoMap().size() == m_candidates.size());
 
     // compute how many stations can be granted an RU and the RU size
-    std::size_t nRusAssigned = m_candidates.size();
-    std::size_t nCentral26TonesRus;
-    HeRu::RuType ruType =
-        HeRu::GetEqualSizedRusForStations(m_allowedWidth, nRusAssigned, nCentral26TonesRus);
+    const auto& plan = GetRuAllocationPlan(m_allowedWidth, m_candidates.size());
+    std::size_t nRusAssigned = plan.nRus;
+    std::size_t nCentral26TonesRus = plan.nCentral26TonesRus;
 
-    NS_LOG_DEBUG(nRusAssigned << " stations are being assigned a " << ruType << " RU");
+    NS_LOG_DEBUG(nRusAssigned << " stations are being assigned a " << plan.ruType << " RU");
 
     if (!m_useCentral26TonesRus || m_candidates.size() == nRusAssigned)
     {
@@ -935,10 +946,8 @@ RrMultiUserScheduler::FinalizeTxVector(WifiTxVector& txVector)
     std::swap(heMuUserInfoMap, txVector.GetHeMuUserInfoMap());
 
     auto candidateIt = m_candidates.begin(); // iterator over the list of candidate receivers
-    auto ruSet = HeRu::GetRusOfType(m_allowedWidth, ruType);
-    auto ruSetIt = ruSet.begin();
-    auto central26TonesRus = HeRu::GetCentral26TonesRus(m_allowedWidth, ruType);
-    auto central26TonesRusIt = central26TonesRus.begin();
+    auto ruSetIt = plan.rus.cbegin();
+    auto central26TonesRusIt = plan.central26TonesRus.cbegin();
 
     for (std::size_t i = 0; i < nRusAssigned + nCentral26TonesRus; i++)
     {
@@ -957,6 +966,24 @@ RrMultiUserScheduler::FinalizeTxVector(WifiTxVector& txVector)
     m_candidates.erase(candidateIt, m_candidates.end());
 }
 
+const RrMultiUserScheduler::RuAllocationPlan&
+RrMultiUserScheduler::GetRuAllocationPlan(MHz_u width, std::size_t nStations)
+{
+    NS_LOG_FUNCTION(this << width << nStations);
+
+    auto [it, inserted] = m_ruAllocationPlans.try_emplace({width, nStations});
+    if (inserted)
+    {
+        auto& plan = it->second;
+        plan.nRus = nStations;
+        plan.ruType =
+            HeRu::GetEqualSizedRusForStations(width, plan.nRus, plan.nCentral26TonesRus);
+        plan.rus = HeRu::GetRusOfType(width, plan.ruType);
+        plan.central26TonesRus = HeRu::GetCentral26TonesRus(width, plan.ruType);
+    }
+    return it->second;
+}
+
 void
 RrMultiUserScheduler::UpdateCredits(std::list<MasterInfo>& staList,
                                     Time txDuration,
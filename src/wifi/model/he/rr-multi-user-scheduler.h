@@ -13,6 +13,8 @@
 
 #include <functional>
 #include <list>
+#include <map>
+#include <vector>
 
 namespace ns3
 {
@@ -163,6 +165,31 @@ class RrMultiUserScheduler : public MultiUserScheduler
                        Time txDuration,
                        const WifiTxVector& txVector);
 
+    /**
+     * Plan for the allocation of equal-sized RUs (and possibly central 26-tone RUs)
+     * to a given number of candidate stations over a given channel width
+     */
+    struct RuAllocationPlan
+    {
+        HeRu::RuType ruType;                         //!< type of the equal-sized RUs
+        std::size_t nRus;                            //!< number of stations assigned an RU
+        std::size_t nCentral26TonesRus;              //!< number of available central 26-tone RUs
+        std::vector<HeRu::RuSpec> rus;               //!< the RUs of the given type
+        std::vector<HeRu::RuSpec> central26TonesRus; //!< the available central 26-tone RUs
+    };
+
+    /**
+     * Get the plan for the allocation of equal-sized RUs to the given number of
+     * candidate stations over the given channel width. Plans only depend on the
+     * channel width and on the number of candidate stations, hence they are
+     * computed once and then reused.
+     *
+     * @param width the channel width
+     * @param nStations the number of candidate stations
+     * @return the RU allocation plan
+     */
+    const RuAllocationPlan& GetRuAllocationPlan(MHz_u width, std::size_t nStations);
+
     /**
      * Information stored for candidate stations
      */
@@ -184,6 +211,8 @@ class RrMultiUserScheduler : public MultiUserScheduler
     WifiMacHeader m_triggerMacHdr;         //!< MAC header for Trigger Frame
     Time m_triggerTxDuration{0};           //!< Trigger Frame TX duration
     WifiTxParameters m_txParams;           //!< TX parameters
+    std::map<std::pair<MHz_u, std::size_t>, RuAllocationPlan>
+        m_ruAllocationPlans; //!< RU allocation plans indexed by channel width and number of STAs
 };
 
 } // namespace ns3
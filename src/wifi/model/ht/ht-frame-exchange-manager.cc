@@ -180,6 +180,39 @@ HtFrameExchangeManager::NeedSetupGcrBlockAck(const WifiMacHeader& header)
     return std::nullopt;
 }
 
+MgtAddBaRequestHeader
+HtFrameExchangeManager::GetAddBaRequestHeader(uint8_t tid,
+                                              uint16_t startingSeq,
+                                              uint16_t timeout,
+                                              bool immediateBAck,
+                                              std::optional<Mac48Address> gcrGroupAddr) const
+{
+    MgtAddBaRequestHeader reqHdr;
+    reqHdr.SetAmsduSupport(true);
+    if (immediateBAck)
+    {
+        reqHdr.SetImmediateBlockAck();
+    }
+    else
+    {
+        reqHdr.SetDelayedBlockAck();
+    }
+    reqHdr.SetTid(tid);
+    /* For now we don't use buffer size field in the ADDBA request frame. The recipient
+     * will choose how many packets it can receive under block ack.
+     */
+    reqHdr.SetBufferSize(0);
+    reqHdr.SetTimeout(timeout);
+    // set the starting sequence number for the BA agreement
+    reqHdr.SetStartingSequence(startingSeq);
+
+    if (gcrGroupAddr)
+    {
+        reqHdr.SetGcrGroupAddress(*gcrGroupAddr);
+    }
+    return reqHdr;
+}
+
 bool
 HtFrameExchangeManager::SendAddBaRequest(Mac48Address dest,
                                          uint8_t tid,
@@ -210,29 +243,7 @@ HtFrameExchangeManager::SendAddBaRequest(Mac48Address dest,
 
     Ptr<Packet> packet = Create<Packet>();
     // Setting ADDBARequest header
-    MgtAddBaRequestHeader reqHdr;
-    reqHdr.SetAmsduSupport(true);
-    if (immediateBAck)
-    {
-        reqHdr.SetImmediateBlockAck();
-    }
-    else
-    {
-        reqHdr.SetDelayedBlockAck();
-    }
-    reqHdr.SetTid(tid);
-    /* For now we don't use buffer size field in the ADDBA request frame. The recipient
-     * will choose how many packets it can receive under block ack.
-     */
-    reqHdr.SetBufferSize(0);
-    reqHdr.SetTimeout(timeout);
-    // set the starting sequence number for the BA agreement
-    reqHdr.SetStartingSequence(startingSeq);
-
-    if (gcrGroupAddr)
-    {
-        reqHdr.SetGcrGroupAddress(*gcrGroupAddr);
-    }
+    auto reqHdr = GetAddBaRequestHeader(tid, startingSeq, timeout, immediateBAck, gcrGroupAddr);
 
     GetBaManager(tid)->CreateOriginatorAgreement(reqHdr, dest);
 
@@ -246,8 +257,7 @@ HtFrameExchangeManager::SendAddBaRequest(Mac48Address dest,
     mpdu->GetHeader().SetSequenceNumber(sequence);
 
     WifiTxParameters txParams;
-    txParams.m_txVector =
-        GetWifiRemoteStationManager()->GetDataTxVector(mpdu->GetHeader(), m_allowedWidth);
+    txParams.m_txVector = GetWifiRemoteStationManager()->GetDataTxVector(mpdu, m_allowedWidth);
     if (!TryAddMpdu(mpdu, txParams, availableTime))
     {
         NS_LOG_DEBUG("Not enough time to send the ADDBA Request frame");
@@ -260,18 +270,11 @@ HtFrameExchangeManager::SendAddBaRequest(Mac48Address dest,
     return true;
 }
 
-void
-HtFrameExchangeManager::SendAddBaResponse(const MgtAddBaRequestHeader& reqHdr,
-                                          Mac48Address originator)
+MgtAddBaResponseHeader
+HtFrameExchangeManager::AcceptAddBaRequest(const MgtAddBaRequestHeader& reqHdr,
+                                           Mac48Address originator)
 {
     NS_LOG_FUNCTION(this << originator);
-    WifiMacHeader hdr;
-    hdr.SetType(WIFI_MAC_MGT_ACTION);
-    hdr.SetAddr1(originator);
-    hdr.SetAddr2(m_self);
-    hdr.SetAddr3(m_bssid);
-    hdr.SetDsNotFrom();
-    hdr.SetDsNotTo();
 
     MgtAddBaResponseHeader respHdr;
     StatusCode code;
@@ -300,15 +303,6 @@ HtFrameExchangeManager::SendAddBaResponse(const MgtAddBaRequestHeader& reqHdr,
         respHdr.SetGcrGroupAddress(*gcrGroupAddr);
     }
 
-    WifiActionHeader actionHdr;
-    WifiActionHeader::ActionValue action;
-    action.blockAck = WifiActionHeader::BLOCK_ACK_ADDBA_RESPONSE;
-    actionHdr.SetAction(WifiActionHeader::BLOCK_ACK, action);
-
-    Ptr<Packet> packet = Create<Packet>();
-    packet->AddHeader(respHdr);
-    packet->AddHeader(actionHdr);
-
     // Get the MLD address of the originator, if an ML setup was performed
     if (auto originatorMld = GetWifiRemoteStationManager()->GetMldAddress(originator))
     {
@@ -336,6 +330,40 @@ HtFrameExchangeManager::SendAddBaResponse(const MgtAddBaRequestHeader& reqHdr,
                                 reqHdr.GetGcrGroupAddress());
     }
 
+    return respHdr;
+}
+
+void
+HtFrameExchangeManager::SendAddBaResponse(const MgtAddBaRequestHeader& reqHdr,
+                                          Mac48Address originator)
+{
+    NS_LOG_FUNCTION(this << originator);
+    WifiMacHeader hdr;
+    hdr.SetType(WIFI_MAC_MGT_ACTION);
+    hdr.SetAddr1(originator);
+    hdr.SetAddr2(m_self);
+    hdr.SetAddr3(m_bssid);
+    hdr.SetDsNotFrom();
+    hdr.SetDsNotTo();
+
+    auto respHdr = AcceptAddBaRequest(reqHdr, originator);
+    auto tid = respHdr.GetTid();
+
+    WifiActionHeader actionHdr;
+    WifiActionHeader::ActionValue action;
+    action.blockAck = WifiActionHeader::BLOCK_ACK_ADDBA_RESPONSE;
+    actionHdr.SetAction(WifiActionHeader::BLOCK_ACK, action);
+
+    Ptr<Packet> packet = Create<Packet>();
+    packet->AddHeader(respHdr);
+    packet->AddHeader(actionHdr);
+
+    // Get the MLD address of the originator, if an ML setup was performed
+    if (auto originatorMld = GetWifiRemoteStationManager()->GetMldAddress(originator))
+    {
+        originator = *originatorMld;
+    }
+
     auto mpdu = Create<WifiMpdu>(packet, hdr);
 
     /*
@@ -366,6 +394,46 @@ HtFrameExchangeManager::SendAddBaResponse(const MgtAddBaRequestHeader& reqHdr,
     m_mac->GetQosTxop(tid)->Queue(mpdu);
 }
 
+void
+HtFrameExchangeManager::FastForwardBaAgreement(Ptr<HtFrameExchangeManager> recipientFem,
+                                               uint8_t tid)
+{
+    NS_LOG_FUNCTION(this << recipientFem << +tid);
+
+    const auto recipientAddr = recipientFem->GetAddress();
+    const auto recipient =
+        GetWifiRemoteStationManager()->GetMldAddress(recipientAddr).value_or(recipientAddr);
+
+    NS_ABORT_MSG_IF(!m_mac->GetHtConfiguration() ||
+                        (!GetWifiRemoteStationManager()->GetHtSupported(recipient) &&
+                         !GetWifiRemoteStationManager()->GetStationHe6GhzCapabilities(recipient)),
+                    "Block Ack agreements cannot be established with " << recipient);
+
+    if (auto agreement = GetBaManager(tid)->GetAgreementAsOriginator(recipient, tid);
+        agreement && !agreement->get().IsReset())
+    {
+        NS_LOG_DEBUG("Block Ack agreement with " << recipient << " for TID " << +tid
+                                                 << " already exists");
+        return;
+    }
+
+    auto edca = m_mac->GetQosTxop(tid);
+    auto reqHdr = GetAddBaRequestHeader(tid,
+                                        m_txMiddle->GetNextSeqNumberByTidAndAddress(tid, recipient),
+                                        edca->GetBlockAckInactivityTimeout(),
+                                        true,
+                                        std::nullopt);
+    GetBaManager(tid)->CreateOriginatorAgreement(reqHdr, recipient);
+
+    // the ADDBA Request frame is directly handed to the recipient, which returns the ADDBA
+    // Response frame it would send back
+    auto respHdr = recipientFem->AcceptAddBaRequest(reqHdr, m_self);
+
+    edca->GotAddBaResponse(respHdr, recipient);
+    GetBaManager(tid)->SetBlockAckInactivityCallback(
+        MakeCallback(&HtFrameExchangeManager::SendDelbaFrame, this));
+}
+
 void
 HtFrameExchangeManager::SendDelbaFrame(Mac48Address addr,
                                        uint8_t tid,
@@ -660,8 +728,7 @@ HtFrameExchangeManager::SendMpduFromBaManager(Ptr<WifiMpdu> mpdu,
     // The m_txVector field of the TX parameters is set to the BlockAckReq TxVector
     // a few lines below.
     WifiTxParameters txParams;
-    txParams.m_txVector =
-        GetWifiRemoteStationManager()->GetDataTxVector(mpdu->GetHeader(), m_allowedWidth);
+    txParams.m_txVector = GetWifiRemoteStationManager()->GetDataTxVector(mpdu, m_allowedWidth);
 
     if (!TryAddMpdu(mpdu, txParams, availableTime))
     {
@@ -692,7 +759,7 @@ HtFrameExchangeManager::SendDataFrame(Ptr<WifiMpdu> peekedItem,
     Ptr<QosTxop> edca = m_mac->GetQosTxop(peekedItem->GetHeader().GetQosTid());
     WifiTxParameters txParams;
     txParams.m_txVector =
-        GetWifiRemoteStationManager()->GetDataTxVector(peekedItem->GetHeader(), m_allowedWidth);
+        GetWifiRemoteStationManager()->GetDataTxVector(peekedItem, m_allowedWidth);
     Ptr<WifiMpdu> mpdu =
         edca->GetNextMpdu(m_linkId, peekedItem, txParams, availableTime, initialFrame);
 
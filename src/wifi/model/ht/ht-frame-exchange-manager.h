@@ -131,6 +131,18 @@ class HtFrameExchangeManager : public QosFrameExchangeManager
      */
     void SendAddBaResponse(const MgtAddBaRequestHeader& reqHdr, Mac48Address originator);
 
+    /**
+     * Establish a Block Ack agreement for the given TID with the device whose frame exchange
+     * manager is given, without exchanging ADDBA Request/Response frames over the air. This
+     * device is the originator of the Block Ack agreement. The two devices must be associated
+     * with each other. This method is meant to be called before the simulation starts, to skip
+     * the setup phase of scenarios where the setup phase is not of interest.
+     *
+     * @param recipientFem the frame exchange manager of the recipient
+     * @param tid the TID of the Block Ack agreement
+     */
+    void FastForwardBaAgreement(Ptr<HtFrameExchangeManager> recipientFem, uint8_t tid);
+
     /**
      * Sends DELBA frame to cancel a block ack agreement with STA
      * addressed by <i>addr</i> for TID <i>tid</i>.
@@ -343,6 +355,34 @@ class HtFrameExchangeManager : public QosFrameExchangeManager
                           Time availableTime,
                           std::optional<Mac48Address> gcrGroupAddr = std::nullopt);
 
+    /**
+     * Get the header of an ADDBA Request frame to be sent to establish a Block Ack agreement.
+     *
+     * @param tid traffic ID.
+     * @param startingSeq the BA agreement starting sequence number
+     * @param timeout timeout value.
+     * @param immediateBAck flag to indicate whether immediate BlockAck is used.
+     * @param gcrGroupAddr the GCR Group Address (only if the Block Ack agreement is being
+     *                     set up for the GCR service)
+     * @return the header of the ADDBA Request frame
+     */
+    MgtAddBaRequestHeader GetAddBaRequestHeader(uint8_t tid,
+                                                uint16_t startingSeq,
+                                                uint16_t timeout,
+                                                bool immediateBAck,
+                                                std::optional<Mac48Address> gcrGroupAddr) const;
+
+    /**
+     * Accept the given ADDBA Request: create the Block Ack agreement as recipient and return
+     * the header of the ADDBA Response frame to send back to the originator.
+     *
+     * @param reqHdr the received ADDBA Request header.
+     * @param originator the MAC address of the originator.
+     * @return the header of the ADDBA Response frame
+     */
+    MgtAddBaResponseHeader AcceptAddBaRequest(const MgtAddBaRequestHeader& reqHdr,
+                                              Mac48Address originator);
+
     /**
      * Create a BlockAck frame with header equal to <i>blockAck</i> and start its transmission.
      *
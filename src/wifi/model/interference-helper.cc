@@ -134,11 +134,6 @@ InterferenceHelper::NiChange::NiChange(Watt_u power, Ptr<Event> event)
 {
 }
 
-InterferenceHelper::NiChange::~NiChange()
-{
-    m_event = nullptr;
-}
-
 Watt_u
 InterferenceHelper::NiChange::GetPower() const
 {
@@ -157,6 +152,142 @@ InterferenceHelper::NiChange::GetEvent() const
     return m_event;
 }
 
+/****************************************************************
+ *       Time-sorted flat sequence of SNIR change events
+ ****************************************************************/
+
+InterferenceHelper::NiChanges::iterator
+InterferenceHelper::NiChanges::begin()
+{
+    return m_items.begin() + m_head;
+}
+
+InterferenceHelper::NiChanges::iterator
+InterferenceHelper::NiChanges::end()
+{
+    return m_items.end();
+}
+
+InterferenceHelper::NiChanges::const_iterator
+InterferenceHelper::NiChanges::begin() const
+{
+    return m_items.cbegin() + m_head;
+}
+
+InterferenceHelper::NiChanges::const_iterator
+InterferenceHelper::NiChanges::end() const
+{
+    return m_items.cend();
+}
+
+InterferenceHelper::NiChanges::const_iterator
+InterferenceHelper::NiChanges::cbegin() const
+{
+    return begin();
+}
+
+InterferenceHelper::NiChanges::const_iterator
+InterferenceHelper::NiChanges::cend() const
+{
+    return end();
+}
+
+std::size_t
+InterferenceHelper::NiChanges::size() const
+{
+    return m_items.size() - m_head;
+}
+
+bool
+InterferenceHelper::NiChanges::empty() const
+{
+    return size() == 0;
+}
+
+void
+InterferenceHelper::NiChanges::clear()
+{
+    m_items.clear();
+    m_head = 0;
+}
+
+void
+InterferenceHelper::NiChanges::reserve(std::size_t n)
+{
+    m_items.reserve(m_head + n);
+}
+
+InterferenceHelper::NiChanges::iterator
+InterferenceHelper::NiChanges::upper_bound(Time moment)
+{
+    return std::upper_bound(begin(), end(), moment, [](Time t, const value_type& item) {
+        return t < item.first;
+    });
+}
+
+InterferenceHelper::NiChanges::const_iterator
+InterferenceHelper::NiChanges::upper_bound(Time moment) const
+{
+    return std::upper_bound(begin(), end(), moment, [](Time t, const value_type& item) {
+        return t < item.first;
+    });
+}
+
+InterferenceHelper::NiChanges::iterator
+InterferenceHelper::NiChanges::find(Time moment)
+{
+    auto it = std::lower_bound(begin(), end(), moment, [](const value_type& item, Time t) {
+        return item.first < t;
+    });
+    return (it != end() && it->first == moment) ? it : end();
+}
+
+InterferenceHelper::NiChanges::const_iterator
+InterferenceHelper::NiChanges::find(Time moment) const
+{
+    auto it = std::lower_bound(begin(), end(), moment, [](const value_type& item, Time t) {
+        return item.first < t;
+    });
+    return (it != end() && it->first == moment) ? it : end();
+}
+
+InterferenceHelper::NiChanges::iterator
+InterferenceHelper::NiChanges::insert(Time moment, const NiChange& change)
+{
+    return m_items.insert(upper_bound(moment), {moment, change});
+}
+
+void
+InterferenceHelper::NiChanges::push_back(Time moment, const NiChange& change)
+{
+    NS_ASSERT(empty() || m_items.back().first <= moment);
+    m_items.emplace_back(moment, change);
+}
+
+void
+InterferenceHelper::NiChanges::PruneUpTo(iterator last)
+{
+    const auto lastIndex = static_cast<std::size_t>(last - m_items.begin());
+    NS_ASSERT(lastIndex >= m_head && lastIndex < m_items.size());
+    if (lastIndex == m_head)
+    {
+        return;
+    }
+    // move the first NiChange in place of the last pruned one, then release the events
+    // of the pruned NiChange objects
+    m_items[lastIndex] = std::move(m_items[m_head]);
+    for (auto i = m_head; i < lastIndex; ++i)
+    {
+        m_items[i].second = NiChange(Watt_u{0}, nullptr);
+    }
+    m_head = lastIndex;
+    if (m_head > m_items.size() / 2)
+    {
+        m_items.erase(m_items.begin(), m_items.begin() + m_head);
+        m_head = 0;
+    }
+}
+
 /****************************************************************
  *       The actual InterferenceHelper
  ****************************************************************/
@@ -187,9 +318,9 @@ void
 InterferenceHelper::DoDispose()
 {
     NS_LOG_FUNCTION(this);
-    for (auto it : m_niChanges)
+    for (auto& [band, niChanges] : m_niChanges)
     {
-        it.second.clear();
+        niChanges.clear();
     }
     m_niChanges.clear();
     m_firstPowers.clear();
@@ -350,32 +481,49 @@ InterferenceHelper::AppendEvent(Ptr<Event> event,
                                 bool isStartHePortionRxing)
 {
     NS_LOG_FUNCTION(this << event << freqRange << isStartHePortionRxing);
+    const auto rxing = (m_rxing.contains(freqRange) && m_rxing.at(freqRange));
+    // the bands of the event and the tracked bands are sorted in the same order: walk them in
+    // lockstep rather than looking up each band of the event
+    auto niIt = m_niChanges.begin();
+    auto firstPowerIt = m_firstPowers.begin();
     for (const auto& [band, power] : event->GetRxPowerPerBand())
     {
-        auto niIt = m_niChanges.find(band);
-        NS_ABORT_IF(niIt == m_niChanges.end());
+        niIt = std::find_if_not(niIt, m_niChanges.end(), [&band](const auto& bandChanges) {
+            return bandChanges.first < band;
+        });
+        NS_ABORT_IF(niIt == m_niChanges.end() || band < niIt->first);
+        firstPowerIt = std::find_if_not(firstPowerIt,
+                                        m_firstPowers.end(),
+                                        [&band](const auto& bandPower) {
+                                            return bandPower.first < band;
+                                        });
+        NS_ASSERT(firstPowerIt != m_firstPowers.end() && !(band < firstPowerIt->first));
+        auto& niChanges = niIt->second;
         Watt_u previousPowerStart{0.0};
         Watt_u previousPowerEnd{0.0};
         auto previousPowerPosition = GetPreviousPosition(event->GetStartTime(), niIt);
         previousPowerStart = previousPowerPosition->second.GetPower();
         previousPowerEnd = GetPreviousPosition(event->GetEndTime(), niIt)->second.GetPower();
-        if (const auto rxing = (m_rxing.contains(freqRange) && m_rxing.at(freqRange)); !rxing)
+        if (!rxing)
         {
-            m_firstPowers.find(band)->second = previousPowerStart;
+            firstPowerIt->second = previousPowerStart;
             // Always leave the first zero power noise event in the list
-            niIt->second.erase(++(niIt->second.begin()), ++previousPowerPosition);
+            niChanges.PruneUpTo(previousPowerPosition);
         }
         else if (isStartHePortionRxing)
         {
             // When the first HE portion is received, we need to set m_firstPowerPerBand
             // so that it takes into account interferences that arrived between the start of the
             // HE TB PPDU transmission and the start of HE TB payload.
-            m_firstPowers.find(band)->second = previousPowerStart;
+            firstPowerIt->second = previousPowerStart;
         }
-        auto first =
+        // inserting the end NiChange invalidates the iterators, hence use the offset of the
+        // start NiChange (the end NiChange is always inserted after it)
+        auto start =
             AddNiChangeEvent(event->GetStartTime(), NiChange(previousPowerStart, event), niIt);
+        const auto first = start - niChanges.begin();
         auto last = AddNiChangeEvent(event->GetEndTime(), NiChange(previousPowerEnd, event), niIt);
-        for (auto i = first; i != last; ++i)
+        for (auto i = niChanges.begin() + first; i != last; ++i)
         {
             i->second.AddPower(power);
         }
@@ -387,10 +535,13 @@ InterferenceHelper::UpdateEvent(Ptr<Event> event, const RxPowerWattPerChannelBan
 {
     NS_LOG_FUNCTION(this << event);
     // This is called for UL MU events, in order to scale power as long as UL MU PPDUs arrive
+    auto niIt = m_niChanges.begin();
     for (const auto& [band, power] : rxPower)
     {
-        auto niIt = m_niChanges.find(band);
-        NS_ABORT_IF(niIt == m_niChanges.end());
+        niIt = std::find_if_not(niIt, m_niChanges.end(), [&band](const auto& bandChanges) {
+            return bandChanges.first < band;
+        });
+        NS_ABORT_IF(niIt == m_niChanges.end() || band < niIt->first);
         auto first = GetPreviousPosition(event->GetStartTime(), niIt);
         auto last = GetPreviousPosition(event->GetEndTime(), niIt);
         for (auto i = first; i != last; ++i)
@@ -435,7 +586,7 @@ InterferenceHelper::CalculateSnr(Watt_u signal,
 
 Watt_u
 InterferenceHelper::CalculateNoiseInterferenceW(Ptr<Event> event,
-                                                NiChangesPerBand& nis,
+                                                NiChanges& ni,
                                                 const WifiSpectrumBandInfo& band) const
 {
     NS_LOG_FUNCTION(this << band);
@@ -444,12 +595,15 @@ InterferenceHelper::CalculateNoiseInterferenceW(Ptr<Event> event,
     auto noiseInterference = firstPower_it->second;
     auto niIt = m_niChanges.find(band);
     NS_ABORT_IF(niIt == m_niChanges.end());
+    const auto& niChanges = niIt->second;
     const auto now = Simulator::Now();
-    auto it = niIt->second.find(event->GetStartTime());
+    const auto start = niChanges.find(event->GetStartTime());
+    NS_ABORT_IF(start == niChanges.end());
+    auto it = start;
     const auto muMimoPower = (event->GetPpdu()->GetType() == WIFI_PPDU_TYPE_UL_MU)
                                  ? CalculateMuMimoPowerW(event, band)
                                  : Watt_u{0.0};
-    for (; it != niIt->second.end() && it->first < now; ++it)
+    for (; it != niChanges.end() && it->first < now; ++it)
     {
         if (IsSameMuMimoTransmission(event, it->second.GetEvent()) &&
             (event != it->second.GetEvent()))
@@ -465,20 +619,23 @@ InterferenceHelper::CalculateNoiseInterferenceW(Ptr<Event> event,
             noiseInterference = Watt_u{0.0};
         }
     }
-    it = niIt->second.find(event->GetStartTime());
-    NS_ABORT_IF(it == niIt->second.end());
-    for (; it != niIt->second.end() && it->second.GetEvent() != event; ++it)
+    for (it = start; it != niChanges.end() && it->second.GetEvent() != event; ++it)
     {
         ;
     }
-    NiChanges ni;
-    ni.emplace(event->GetStartTime(), NiChange(Watt_u{0}, event));
-    while (++it != niIt->second.end() && it->second.GetEvent() != event)
+    NS_ABORT_IF(it == niChanges.end());
+    // the NiChange objects between the start and the end of the event are already sorted
+    const auto last = std::find_if(std::next(it), niChanges.end(), [&event](const auto& change) {
+        return change.second.GetEvent() == event;
+    });
+    ni.clear();
+    ni.reserve(std::distance(it, last) + 1);
+    ni.push_back(event->GetStartTime(), NiChange(Watt_u{0}, event));
+    for (++it; it != last; ++it)
     {
-        ni.insert(*it);
+        ni.push_back(it->first, it->second);
     }
-    ni.emplace(event->GetEndTime(), NiChange(Watt_u{0}, event));
-    nis.insert({band, ni});
+    ni.push_back(event->GetEndTime(), NiChange(Watt_u{0}, event));
     NS_ASSERT_MSG(noiseInterference >= Watt_u{0.0},
                   "CalculateNoiseInterferenceW returns negative value " << noiseInterference);
     return noiseInterference;
@@ -567,15 +724,14 @@ InterferenceHelper::CalculatePayloadChunkSuccessRate(double snir,
 double
 InterferenceHelper::CalculatePayloadPer(Ptr<const Event> event,
                                         MHz_u channelWidth,
-                                        NiChangesPerBand* nis,
+                                        const NiChanges& ni,
                                         const WifiSpectrumBandInfo& band,
                                         uint16_t staId,
                                         std::pair<Time, Time> window) const
 {
     NS_LOG_FUNCTION(this << channelWidth << band << staId << window.first << window.second);
     double psr = 1.0; /* Packet Success Rate */
-    const auto& niIt = nis->find(band)->second;
-    auto j = niIt.cbegin();
+    auto j = ni.cbegin();
     auto previous = j->first;
     Watt_u muMimoPower{0.0};
     const auto payloadMode = event->GetPpdu()->GetTxVector().GetMode(staId);
@@ -596,7 +752,7 @@ InterferenceHelper::CalculatePayloadPer(Ptr<const Event> event,
     NS_ABORT_IF(!m_firstPowers.contains(band));
     auto noiseInterference = m_firstPowers.at(band);
     auto power = event->GetRxPower(band);
-    while (++j != niIt.cend())
+    while (++j != ni.cend())
     {
         Time current = j->first;
         NS_LOG_DEBUG("previous= " << previous << ", current=" << current);
@@ -648,15 +804,14 @@ InterferenceHelper::CalculatePayloadPer(Ptr<const Event> event,
 double
 InterferenceHelper::CalculatePhyHeaderSectionPsr(
     Ptr<const Event> event,
-    NiChangesPerBand* nis,
+    const NiChanges& ni,
     MHz_u channelWidth,
     const WifiSpectrumBandInfo& band,
     PhyEntity::PhyHeaderSections phyHeaderSections) const
 {
     NS_LOG_FUNCTION(this << band);
     double psr = 1.0; /* Packet Success Rate */
-    auto niIt = nis->find(band)->second;
-    auto j = niIt.begin();
+    auto j = ni.cbegin();
 
     NS_ASSERT(!phyHeaderSections.empty());
     Time stopLastSection;
@@ -669,7 +824,7 @@ InterferenceHelper::CalculatePhyHeaderSectionPsr(
     NS_ABORT_IF(!m_firstPowers.contains(band));
     auto noiseInterference = m_firstPowers.at(band);
     const auto power = event->GetRxPower(band);
-    while (++j != niIt.end())
+    while (++j != ni.cend())
     {
         auto current = j->first;
         NS_LOG_DEBUG("previous= " << previous << ", current=" << current);
@@ -711,19 +866,18 @@ InterferenceHelper::CalculatePhyHeaderSectionPsr(
 
 double
 InterferenceHelper::CalculatePhyHeaderPer(Ptr<const Event> event,
-                                          NiChangesPerBand* nis,
+                                          const NiChanges& ni,
                                           MHz_u channelWidth,
                                           const WifiSpectrumBandInfo& band,
                                           WifiPpduField header) const
 {
     NS_LOG_FUNCTION(this << band << header);
-    auto niIt = nis->find(band)->second;
     auto phyEntity =
         WifiPhy::GetStaticPhyEntity(event->GetPpdu()->GetTxVector().GetModulationClass());
 
     PhyEntity::PhyHeaderSections sections;
     for (const auto& section :
-         phyEntity->GetPhyHeaderSections(event->GetPpdu()->GetTxVector(), niIt.begin()->first))
+         phyEntity->GetPhyHeaderSections(event->GetPpdu()->GetTxVector(), ni.cbegin()->first))
     {
         if (section.first == header)
         {
@@ -734,7 +888,7 @@ InterferenceHelper::CalculatePhyHeaderPer(Ptr<const Event> event,
     double psr = 1.0;
     if (!sections.empty())
     {
-        psr = CalculatePhyHeaderSectionPsr(event, nis, channelWidth, band, sections);
+        psr = CalculatePhyHeaderSectionPsr(event, ni, channelWidth, band, sections);
     }
     return 1 - psr;
 }
@@ -748,7 +902,7 @@ InterferenceHelper::CalculatePayloadSnrPer(Ptr<Event> event,
 {
     NS_LOG_FUNCTION(this << channelWidth << band << staId << relativeMpduStartStop.first
                          << relativeMpduStartStop.second);
-    NiChangesPerBand ni;
+    NiChanges ni;
     const auto noiseInterference = CalculateNoiseInterferenceW(event, ni, band);
     const auto snr = CalculateSnr(event->GetRxPower(band),
                                   noiseInterference,
@@ -759,7 +913,7 @@ InterferenceHelper::CalculatePayloadSnrPer(Ptr<Event> event,
      * all SNIR changes in the SNIR vector.
      */
     const auto per =
-        CalculatePayloadPer(event, channelWidth, &ni, band, staId, relativeMpduStartStop);
+        CalculatePayloadPer(event, channelWidth, ni, band, staId, relativeMpduStartStop);
 
     return PhyEntity::SnrPer(snr, per);
 }
@@ -770,11 +924,64 @@ InterferenceHelper::CalculateSnr(Ptr<Event> event,
                                  uint8_t nss,
                                  const WifiSpectrumBandInfo& band) const
 {
-    NiChangesPerBand ni;
+    NiChanges ni;
     const auto noiseInterference = CalculateNoiseInterferenceW(event, ni, band);
     return CalculateSnr(event->GetRxPower(band), noiseInterference, channelWidth, nss);
 }
 
+double
+InterferenceHelper::CalculatePayloadAverageSnr(Ptr<Event> event,
+                                               MHz_u channelWidth,
+                                               const WifiSpectrumBandInfo& band,
+                                               uint16_t staId,
+                                               std::pair<Time, Time> relativeStartStop) const
+{
+    NS_LOG_FUNCTION(this << channelWidth << band << staId << relativeStartStop.first
+                         << relativeStartStop.second);
+    NiChanges ni;
+    CalculateNoiseInterferenceW(event, ni, band);
+    const auto& txVector = event->GetPpdu()->GetTxVector();
+    auto j = ni.cbegin();
+    auto previous = j->first;
+    Watt_u muMimoPower{0.0};
+    auto phyPayloadStart = j->first;
+    if (event->GetPpdu()->GetType() != WIFI_PPDU_TYPE_UL_MU &&
+        event->GetPpdu()->GetType() != WIFI_PPDU_TYPE_DL_MU)
+    {
+        phyPayloadStart = j->first + WifiPhy::CalculatePhyPreambleAndHeaderDuration(txVector);
+    }
+    else
+    {
+        muMimoPower = CalculateMuMimoPowerW(event, band);
+    }
+    const auto windowStart = phyPayloadStart + relativeStartStop.first;
+    const auto windowEnd = phyPayloadStart + relativeStartStop.second;
+    NS_ASSERT(windowEnd > windowStart);
+    NS_ABORT_IF(!m_firstPowers.contains(band));
+    auto noiseInterference = m_firstPowers.at(band);
+    const auto power = event->GetRxPower(band);
+    // noise and interference energy (J) over the time window
+    double energy = 0;
+    while (++j != ni.cend() && previous < windowEnd)
+    {
+        const auto overlap = Min(windowEnd, j->first) - Max(windowStart, previous);
+        if (overlap.IsStrictlyPositive())
+        {
+            energy += noiseInterference * overlap.GetSeconds();
+        }
+        noiseInterference = j->second.GetPower() - power;
+        if (IsSameMuMimoTransmission(event, j->second.GetEvent()))
+        {
+            muMimoPower += j->second.GetEvent()->GetRxPower(band);
+        }
+        noiseInterference -= muMimoPower;
+        previous = j->first;
+    }
+    const Watt_u meanNoiseInterference{
+        std::max(energy / (windowEnd - windowStart).GetSeconds(), 0.0)};
+    return CalculateSnr(power, meanNoiseInterference, channelWidth, txVector.GetNss(staId));
+}
+
 PhyEntity::SnrPer
 InterferenceHelper::CalculatePhyHeaderSnrPer(Ptr<Event> event,
                                              MHz_u channelWidth,
@@ -782,14 +989,14 @@ InterferenceHelper::CalculatePhyHeaderSnrPer(Ptr<Event> event,
                                              WifiPpduField header) const
 {
     NS_LOG_FUNCTION(this << band << header);
-    NiChangesPerBand ni;
+    NiChanges ni;
     const auto noiseInterference = CalculateNoiseInterferenceW(event, ni, band);
     const auto snr = CalculateSnr(event->GetRxPower(band), noiseInterference, channelWidth, 1);
 
     /* calculate the SNIR at the start of the PHY header and accumulate
      * all SNIR changes in the SNIR vector.
      */
-    const auto per = CalculatePhyHeaderPer(event, &ni, channelWidth, band, header);
+    const auto per = CalculatePhyHeaderPer(event, ni, channelWidth, band, header);
 
     return PhyEntity::SnrPer(snr, per);
 }
@@ -813,7 +1020,7 @@ InterferenceHelper::GetPreviousPosition(Time moment, NiChangesPerBand::iterator
 InterferenceHelper::NiChanges::iterator
 InterferenceHelper::AddNiChangeEvent(Time moment, NiChange change, NiChangesPerBand::iterator niIt)
 {
-    return niIt->second.insert(GetNextPosition(moment, niIt), {moment, change});
+    return niIt->second.insert(moment, change);
 }
 
 void
@@ -13,6 +13,8 @@
 
 #include "ns3/object.h"
 
+#include <vector>
+
 namespace ns3
 {
 
@@ -260,6 +262,41 @@ class InterferenceHelper : public Object
                         MHz_u channelWidth,
                         uint8_t nss,
                         const WifiSpectrumBandInfo& band) const;
+    /**
+     * Calculate the SNIR of the payload over the given time window, where the noise and
+     * interference power is averaged over the time window. This is meant for PHY abstractions
+     * that evaluate the reception of a PSDU once, rather than per chunk of constant SNIR.
+     *
+     * @param event the event corresponding to the first time the corresponding PPDU arrives
+     * @param channelWidth the width of the band
+     * @param band identify the band over which the SNIR is computed
+     * @param staId the station ID of the PSDU (only used for MU)
+     * @param relativeStartStop the time window (pair of start and end times) of PHY payload to
+     * focus on
+     *
+     * @return the SNIR averaged over the time window in linear scale
+     */
+    double CalculatePayloadAverageSnr(Ptr<Event> event,
+                                      MHz_u channelWidth,
+                                      const WifiSpectrumBandInfo& band,
+                                      uint16_t staId,
+                                      std::pair<Time, Time> relativeStartStop) const;
+    /**
+     * Calculate the success rate of the payload chunk given the SINR, duration, and TXVECTOR.
+     * The duration and TXVECTOR are used to calculate how many bits are present in the payload
+     * chunk.
+     *
+     * @param snir the SINR
+     * @param duration the duration of the chunk
+     * @param txVector the TXVECTOR
+     * @param staId the station ID of the PSDU (only used for MU)
+     *
+     * @return the success rate
+     */
+    double CalculatePayloadChunkSuccessRate(double snir,
+                                            Time duration,
+                                            const WifiTxVector& txVector,
+                                            uint16_t staId = SU_STA_ID) const;
     /**
      * Calculate the SNIR at the start of the PHY header and accumulate
      * all SNIR changes in the SNIR vector.
@@ -331,22 +368,6 @@ class InterferenceHelper : public Object
                                      WifiMode mode,
                                      const WifiTxVector& txVector,
                                      WifiPpduField field) const;
-    /**
-     * Calculate the success rate of the payload chunk given the SINR, duration, and TXVECTOR.
-     * The duration and TXVECTOR are used to calculate how many bits are present in the payload
-     * chunk.
-     *
-     * @param snir the SINR
-     * @param duration the duration of the chunk
-     * @param txVector the TXVECTOR
-     * @param staId the station ID of the PSDU (only used for MU)
-     *
-     * @return the success rate
-     */
-    double CalculatePayloadChunkSuccessRate(double snir,
-                                            Time duration,
-                                            const WifiTxVector& txVector,
-                                            uint16_t staId = SU_STA_ID) const;
 
   protected:
     std::map<FrequencyRange, bool>
@@ -365,7 +386,6 @@ class InterferenceHelper : public Object
          * @param event causes this NI change
          */
         NiChange(Watt_u power, Ptr<Event> event);
-        ~NiChange();
         /**
          * Return the power
          *
@@ -391,9 +411,96 @@ class InterferenceHelper : public Object
     };
 
     /**
-     * typedef for a multimap of NiChange
+     * Time-sorted sequence of NiChange objects, stored in a flat array.
+     *
+     * NiChange objects with the same time are kept in insertion order, as in a
+     * std::multimap. The NiChange objects that expired are pruned from the front
+     * of the sequence by advancing its head, in constant time; the array is only
+     * compacted once the pruned entries make up half of it.
      */
-    using NiChanges = std::multimap<Time, NiChange>;
+    class NiChanges
+    {
+      public:
+        /// type of the NiChange objects and of their time
+        using value_type = std::pair<Time, NiChange>;
+        /// iterator over the NiChange objects
+        using iterator = std::vector<value_type>::iterator;
+        /// const iterator over the NiChange objects
+        using const_iterator = std::vector<value_type>::const_iterator;
+
+        /// @return an iterator to the first NiChange
+        iterator begin();
+        /// @return an iterator past the last NiChange
+        iterator end();
+        /// @return a const iterator to the first NiChange
+        const_iterator begin() const;
+        /// @return a const iterator past the last NiChange
+        const_iterator end() const;
+        /// @return a const iterator to the first NiChange
+        const_iterator cbegin() const;
+        /// @return a const iterator past the last NiChange
+        const_iterator cend() const;
+        /// @return the number of NiChange objects
+        std::size_t size() const;
+        /// @return whether there is no NiChange
+        bool empty() const;
+        /// Remove all the NiChange objects
+        void clear();
+        /**
+         * Reserve space for the given number of NiChange objects
+         * @param n the number of NiChange objects
+         */
+        void reserve(std::size_t n);
+
+        /**
+         * @param moment the time
+         * @return an iterator to the first NiChange that is later than moment
+         */
+        iterator upper_bound(Time moment);
+        /**
+         * @param moment the time
+         * @return a const iterator to the first NiChange that is later than moment
+         */
+        const_iterator upper_bound(Time moment) const;
+        /**
+         * @param moment the time
+         * @return an iterator to the first NiChange at the given time, or end() if none
+         */
+        iterator find(Time moment);
+        /**
+         * @param moment the time
+         * @return a const iterator to the first NiChange at the given time, or end() if none
+         */
+        const_iterator find(Time moment) const;
+
+        /**
+         * Insert a NiChange after all the NiChange objects that are not later than moment.
+         *
+         * @param moment the time of the NiChange
+         * @param change the NiChange
+         * @return an iterator to the inserted NiChange
+         */
+        iterator insert(Time moment, const NiChange& change);
+        /**
+         * Append a NiChange, which must not be earlier than the last NiChange.
+         *
+         * @param moment the time of the NiChange
+         * @param change the NiChange
+         */
+        void push_back(Time moment, const NiChange& change);
+
+        /**
+         * Remove the NiChange objects that follow the first one, up to and including
+         * the given one. The first NiChange is kept.
+         *
+         * @param last an iterator to the last NiChange to remove
+         */
+        void PruneUpTo(iterator last);
+
+      private:
+        std::vector<value_type> m_items; //!< NiChange objects, the first one at m_head
+        std::size_t m_head{0};           //!< index of the first NiChange in m_items
+    };
 
     /**
      * Map of NiChanges per band
@@ -440,13 +547,13 @@ class InterferenceHelper : public Object
      * Calculate noise and interference power.
      *
      * @param event the event
-     * @param nis the NiChanges
+     * @param ni the NiChanges of the band during the event, filled by this function
      * @param band the band
      *
      * @return noise and interference power
      */
     Watt_u CalculateNoiseInterferenceW(Ptr<Event> event,
-                                       NiChangesPerBand& nis,
+                                       NiChanges& ni,
                                        const WifiSpectrumBandInfo& band) const;
 
     /**
@@ -468,7 +575,7 @@ class InterferenceHelper : public Object
      *
      * @param event the event
      * @param channelWidth the channel width used to transmit the PSDU
-     * @param nis the NiChanges
+     * @param ni the NiChanges of the band during the event
      * @param band identify the band used by the PSDU
      * @param staId the station ID of the PSDU (only used for MU)
      * @param window time window (pair of start and end times) of PHY payload to focus on
@@ -477,7 +584,7 @@ class InterferenceHelper : public Object
      */
     double CalculatePayloadPer(Ptr<const Event> event,
                                MHz_u channelWidth,
-                               NiChangesPerBand* nis,
+                               const NiChanges& ni,
                                const WifiSpectrumBandInfo& band,
                                uint16_t staId,
                                std::pair<Time, Time> window) const;
@@ -486,7 +593,7 @@ class InterferenceHelper : public Object
      * can be divided into multiple chunks (e.g. due to interference from other transmissions).
      *
      * @param event the event
-     * @param nis the NiChanges
+     * @param ni the NiChanges of the band during the event
      * @param channelWidth the channel width for header measurement
      * @param band the band
      * @param header the PHY header to consider
@@ -494,7 +601,7 @@ class InterferenceHelper : public Object
      * @return the error rate of the HT PHY header
      */
     double CalculatePhyHeaderPer(Ptr<const Event> event,
-                                 NiChangesPerBand* nis,
+                                 const NiChanges& ni,
                                  MHz_u channelWidth,
                                  const WifiSpectrumBandInfo& band,
                                  WifiPpduField header) const;
@@ -502,7 +609,7 @@ class InterferenceHelper : public Object
      * Calculate the success rate of the PHY header sections for the provided event.
      *
      * @param event the event
-     * @param nis the NiChanges
+     * @param ni the NiChanges of the band during the event
      * @param channelWidth the channel width for header measurement
      * @param band the band
      * @param phyHeaderSections the map of PHY header sections (\see PhyEntity::PhyHeaderSections)
@@ -510,7 +617,7 @@ class InterferenceHelper : public Object
      * @return the success rate of the PHY header sections
      */
     double CalculatePhyHeaderSectionPsr(Ptr<const Event> event,
-                                        NiChangesPerBand* nis,
+                                        const NiChanges& ni,
                                         MHz_u channelWidth,
                                         const WifiSpectrumBandInfo& band,
                                         PhyEntity::PhyHeaderSections phyHeaderSections) const;
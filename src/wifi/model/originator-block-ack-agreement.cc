@@ -91,22 +91,21 @@ OriginatorBlockAckAgreement::InitTxWindow()
 bool
 OriginatorBlockAckAgreement::AllAckedMpdusInTxWindow(const std::set<uint16_t>& seqNumbers) const
 {
+    // the positions to ignore are counted as if they contained acknowledged MPDUs
     std::set<std::size_t> distances;
     for (const auto seqN : seqNumbers)
     {
-        distances.insert(GetDistance(seqN));
+        if (const auto distance = GetDistance(seqN);
+            distance < m_txWindow.GetWinSize() && !m_txWindow.At(distance))
+        {
+            distances.insert(distance);
+        }
     }
 
-    for (std::size_t i = 0; i < m_txWindow.GetWinSize(); ++i)
+    if (m_txWindow.Count() + distances.size() < m_txWindow.GetWinSize())
     {
-        if (distances.contains(i))
-        {
-            continue; // this is one of the positions to ignore
-        }
-        if (!m_txWindow.At(i))
-        {
-            return false; // this position is available or contains an unacknowledged MPDU
-        }
+        // some position is available or contains an unacknowledged MPDU
+        return false;
     }
     NS_LOG_INFO("TX window is blocked");
     return true;
@@ -115,9 +114,9 @@ OriginatorBlockAckAgreement::AllAckedMpdusInTxWindow(const std::set<uint16_t>& s
 void
 OriginatorBlockAckAgreement::AdvanceTxWindow()
 {
-    while (m_txWindow.At(0))
+    if (const auto count = m_txWindow.GetNSetFromStart(); count > 0)
     {
-        m_txWindow.Advance(1); // reset the current head -- ensures loop termination
+        m_txWindow.Advance(count);
     }
 }
 
@@ -309,41 +309,86 @@ PhyEntity::EndReceiveField(WifiPpduField field, Ptr<Event> event)
     }
     else
     {
-        Ptr<const WifiPpdu> ppdu = event->GetPpdu();
-        switch (status.actionIfFailure)
+        ProcessFieldRxFailure(event,
+                              status,
+                              GetRemainingDurationAfterField(event->GetPpdu(), field));
+    }
+}
+
+void
+PhyEntity::EndReceivePhyHeader(Ptr<Event> event)
+{
+    NS_LOG_FUNCTION(this << *event);
+    NS_ASSERT(m_wifiPhy); // no sense if no owner WifiPhy instance
+    NS_ASSERT(m_wifiPhy->m_endPhyRxEvent.IsExpired());
+    const auto& txVector = event->GetPpdu()->GetTxVector();
+    const auto firstField = GetFirstNonAbstractedField(event->GetPpdu());
+    for (auto field = WIFI_PPDU_FIELD_PREAMBLE; field != firstField;
+         field = GetNextField(field, txVector.GetPreambleType()))
+    {
+        if (field != WIFI_PPDU_FIELD_PREAMBLE)
         {
-        case ABORT:
-            // Abort reception, but consider medium as busy
-            AbortCurrentReception(status.reason);
-            if (event->GetEndTime() > (Simulator::Now() + m_state->GetDelayUntilIdle()))
-            {
-                m_wifiPhy->SwitchMaybeToCcaBusy(ppdu);
-            }
-            break;
-        case DROP:
-            // Notify drop, keep in CCA busy, and perform same processing as IGNORE case
-            if (status.reason == FILTERED)
-            {
-                // PHY-RXSTART is immediately followed by PHY-RXEND (Filtered)
-                m_wifiPhy->m_phyRxPayloadBeginTrace(
-                    txVector,
-                    NanoSeconds(0)); // this callback (equivalent to PHY-RXSTART primitive) is also
-                                     // triggered for filtered PPDUs
-            }
-            m_wifiPhy->NotifyRxPpduDrop(ppdu, status.reason);
-            m_wifiPhy->NotifyCcaBusy(ppdu, GetRemainingDurationAfterField(ppdu, field));
-        // no break
-        case IGNORE:
-            // Keep in Rx state and reset at end
-            m_endRxPayloadEvents.push_back(
-                Simulator::Schedule(GetRemainingDurationAfterField(ppdu, field),
-                                    &PhyEntity::ResetReceive,
-                                    this,
-                                    event));
-            break;
-        default:
-            NS_FATAL_ERROR("Unknown action in case of failure");
+            bool supported = DoStartReceiveField(field, event);
+            NS_ABORT_MSG_IF(!supported, "Unknown field " << field << " for this PHY entity");
+        }
+        PhyFieldRxStatus status = DoEndReceiveField(field, event);
+        if (!status.isSuccess)
+        {
+            // the remaining duration is counted from the start of the first non-abstracted
+            // field
+            ProcessFieldRxFailure(event,
+                                  status,
+                                  event->GetPpdu()->GetTxDuration() -
+                                      GetDurationUpToField(firstField, txVector));
+            return;
+        }
+    }
+    StartReceiveField(firstField, event);
+}
+
+WifiPpduField
+PhyEntity::GetFirstNonAbstractedField(Ptr<const WifiPpdu> ppdu) const
+{
+    return WIFI_PPDU_FIELD_DATA;
+}
+
+void
+PhyEntity::ProcessFieldRxFailure(Ptr<Event> event,
+                                 const PhyFieldRxStatus& status,
+                                 Time remainingDuration)
+{
+    NS_LOG_FUNCTION(this << *event << status << remainingDuration);
+    Ptr<const WifiPpdu> ppdu = event->GetPpdu();
+    switch (status.actionIfFailure)
+    {
+    case ABORT:
+        // Abort reception, but consider medium as busy
+        AbortCurrentReception(status.reason);
+        if (event->GetEndTime() > (Simulator::Now() + m_state->GetDelayUntilIdle()))
+        {
+            m_wifiPhy->SwitchMaybeToCcaBusy(ppdu);
         }
+        break;
+    case DROP:
+        // Notify drop, keep in CCA busy, and perform same processing as IGNORE case
+        if (status.reason == FILTERED)
+        {
+            // PHY-RXSTART is immediately followed by PHY-RXEND (Filtered)
+            m_wifiPhy->m_phyRxPayloadBeginTrace(
+                ppdu->GetTxVector(),
+                NanoSeconds(0)); // this callback (equivalent to PHY-RXSTART primitive) is also
+                                 // triggered for filtered PPDUs
+        }
+        m_wifiPhy->NotifyRxPpduDrop(ppdu, status.reason);
+        m_wifiPhy->NotifyCcaBusy(ppdu, remainingDuration);
+    // no break
+    case IGNORE:
+        // Keep in Rx state and reset at end
+        m_endRxPayloadEvents.push_back(
+            Simulator::Schedule(remainingDuration, &PhyEntity::ResetReceive, this, event));
+        break;
+    default:
+        NS_FATAL_ERROR("Unknown action in case of failure");
     }
 }
 
@@ -654,14 +699,23 @@ PhyEntity::ScheduleEndOfMpdus(Ptr<Event> event)
                     << i << " in " << endOfMpduDuration.As(Time::NS) << " (relativeStart="
                     << relativeStart.As(Time::NS) << ", mpduDuration=" << mpduDuration.As(Time::NS)
                     << ", remainingAmdpuDuration=" << remainingAmpduDuration.As(Time::NS) << ")");
-        m_endOfMpduEvents.push_back(Simulator::Schedule(endOfMpduDuration,
-                                                        &PhyEntity::EndOfMpdu,
-                                                        this,
-                                                        event,
-                                                        *mpdu,
-                                                        i,
-                                                        relativeStart,
-                                                        mpduDuration));
+        if (m_wifiPhy->IsRxAbstractionEnabled())
+        {
+            // the reception of all the MPDUs is evaluated at the end of the PPDU
+            m_pendingMpdusMap[{ppdu->GetUid(), staId}].push_back(
+                {*mpdu, relativeStart, mpduDuration});
+        }
+        else
+        {
+            m_endOfMpduEvents.push_back(Simulator::Schedule(endOfMpduDuration,
+                                                            &PhyEntity::EndOfMpdu,
+                                                            this,
+                                                            event,
+                                                            *mpdu,
+                                                            i,
+                                                            relativeStart,
+                                                            mpduDuration));
+        }
 
         // Prepare next iteration
         ++i;
@@ -678,15 +732,60 @@ PhyEntity::EndOfMpdu(Ptr<Event> event,
                      Time mpduDuration)
 {
     NS_LOG_FUNCTION(this << *event << mpduIndex << relativeStart << mpduDuration);
-    const auto ppdu = event->GetPpdu();
-    const auto& txVector = ppdu->GetTxVector();
-    uint16_t staId = GetStaId(ppdu);
+    uint16_t staId = GetStaId(event->GetPpdu());
 
     std::pair<bool, SignalNoiseDbm> rxInfo =
         GetReceptionStatus(mpdu, event, staId, relativeStart, mpduDuration);
     NS_LOG_DEBUG("Extracted MPDU #" << mpduIndex << ": duration: " << mpduDuration.As(Time::NS)
                                     << ", correct reception: " << rxInfo.first << ", Signal/Noise: "
                                     << rxInfo.second.signal << "/" << rxInfo.second.noise << "dBm");
+    ProcessMpduReceptionStatus(event, mpdu, rxInfo);
+}
+
+void
+PhyEntity::EndOfMpdus(Ptr<Event> event)
+{
+    NS_LOG_FUNCTION(this << *event);
+    const auto ppdu = event->GetPpdu();
+    const auto& txVector = ppdu->GetTxVector();
+    const auto staId = GetStaId(ppdu);
+    auto it = m_pendingMpdusMap.find({ppdu->GetUid(), staId});
+    NS_ASSERT(it != m_pendingMpdusMap.end());
+    const auto pendingMpdus = std::move(it->second);
+    m_pendingMpdusMap.erase(it);
+
+    std::vector<std::pair<Time, Time>> mpduWindows;
+    mpduWindows.reserve(pendingMpdus.size());
+    for (const auto& pending : pendingMpdus)
+    {
+        mpduWindows.emplace_back(pending.relativeStart, pending.relativeStart + pending.duration);
+    }
+    const auto [channelWidth, band] = GetChannelWidthAndBand(txVector, staId);
+    const auto snrPers =
+        m_wifiPhy->CalculateMpdusSnrPer(event, channelWidth, band, staId, mpduWindows);
+    NS_ASSERT(snrPers.size() == pendingMpdus.size());
+
+    for (std::size_t i = 0; i < pendingMpdus.size(); ++i)
+    {
+        const auto rxInfo = GetReceptionStatus(pendingMpdus[i].mpdu, event, staId, snrPers[i]);
+        NS_LOG_DEBUG("Extracted MPDU #" << i << ": duration: "
+                                        << pendingMpdus[i].duration.As(Time::NS)
+                                        << ", correct reception: " << rxInfo.first
+                                        << ", Signal/Noise: " << rxInfo.second.signal << "/"
+                                        << rxInfo.second.noise << "dBm");
+        ProcessMpduReceptionStatus(event, pendingMpdus[i].mpdu, rxInfo);
+    }
+}
+
+void
+PhyEntity::ProcessMpduReceptionStatus(Ptr<Event> event,
+                                      Ptr<WifiMpdu> mpdu,
+                                      const std::pair<bool, SignalNoiseDbm>& rxInfo)
+{
+    NS_LOG_FUNCTION(this << *event << *mpdu << rxInfo.first);
+    const auto ppdu = event->GetPpdu();
+    const auto& txVector = ppdu->GetTxVector();
+    uint16_t staId = GetStaId(ppdu);
 
     auto signalNoiseIt = m_signalNoiseMap.find({ppdu->GetUid(), staId});
     NS_ASSERT(signalNoiseIt != m_signalNoiseMap.end());
@@ -715,6 +814,10 @@ PhyEntity::EndReceivePayload(Ptr<Event> event)
     NS_LOG_FUNCTION(
         this << *event << ppdu->GetTxDuration() - CalculatePhyPreambleAndHeaderDuration(txVector));
     NS_ASSERT(event->GetEndTime() == Simulator::Now());
+    if (m_wifiPhy->IsRxAbstractionEnabled())
+    {
+        EndOfMpdus(event);
+    }
     const auto staId = GetStaId(ppdu);
     const auto channelWidthAndBand = GetChannelWidthAndBand(txVector, staId);
     const auto snr = m_wifiPhy->m_interference->CalculateSnr(event,
@@ -815,13 +918,23 @@ PhyEntity::GetReceptionStatus(Ptr<WifiMpdu> mpdu,
         channelWidthAndBand.second,
         staId,
         {relativeMpduStart, relativeMpduStart + mpduDuration});
+    NS_LOG_DEBUG("relativeStart = " << relativeMpduStart.As(Time::NS)
+                                    << ", duration = " << mpduDuration.As(Time::NS));
+    return GetReceptionStatus(mpdu, event, staId, snrPer);
+}
 
+std::pair<bool, SignalNoiseDbm>
+PhyEntity::GetReceptionStatus(Ptr<WifiMpdu> mpdu,
+                              Ptr<Event> event,
+                              uint16_t staId,
+                              const SnrPer& snrPer)
+{
+    NS_LOG_FUNCTION(this << *mpdu << *event << staId << snrPer.snr << snrPer.per);
+    const auto channelWidthAndBand = GetChannelWidthAndBand(event->GetPpdu()->GetTxVector(), staId);
     WifiMode mode = event->GetPpdu()->GetTxVector().GetMode(staId);
     NS_LOG_DEBUG("rate=" << (mode.GetDataRate(event->GetPpdu()->GetTxVector(), staId))
                          << ", SNR(dB)=" << RatioToDb(snrPer.snr) << ", PER=" << snrPer.per
-                         << ", size=" << mpdu->GetSize()
-                         << ", relativeStart = " << relativeMpduStart.As(Time::NS)
-                         << ", duration = " << mpduDuration.As(Time::NS));
+                         << ", size=" << mpdu->GetSize());
 
     // There are two error checks: PER and receive error model check.
     // PER check models is typical for Wi-Fi and is based on signal modulation;
@@ -958,6 +1071,7 @@ PhyEntity::NotifyInterferenceRxEndAndClear(bool reset)
     m_wifiPhy->m_interference->NotifyRxEnd(Simulator::Now(), m_wifiPhy->GetCurrentFrequencyRange());
     m_signalNoiseMap.clear();
     m_statusPerMpduMap.clear();
+    m_pendingMpdusMap.clear();
     for (const auto& endOfMpduEvent : m_endOfMpduEvents)
     {
         NS_ASSERT(endOfMpduEvent.IsExpired());
@@ -1111,6 +1225,22 @@ PhyEntity::EndPreambleDetectionPeriod(Ptr<Event> event)
                                  m_wifiPhy->m_currentEvent->GetRxPowerPerBand());
         m_wifiPhy->m_timeLastPreambleDetected = Simulator::Now();
 
+        if (m_wifiPhy->IsRxAbstractionEnabled())
+        {
+            // Process the preamble and the PHY header at once at the start of the first
+            // non-abstracted field (usually the Data field)
+            const auto durationTillField =
+                GetDurationUpToField(GetFirstNonAbstractedField(event->GetPpdu()),
+                                     event->GetPpdu()->GetTxVector()) -
+                WifiPhy::GetPreambleDetectionDuration();
+            m_wifiPhy->NotifyCcaBusy(event->GetPpdu(), durationTillField);
+            m_wifiPhy->m_endPhyRxEvent = Simulator::Schedule(durationTillField,
+                                                             &PhyEntity::EndReceivePhyHeader,
+                                                             this,
+                                                             event);
+            return;
+        }
+
         // Continue receiving preamble
         const auto durationTillEnd =
             GetDuration(WIFI_PPDU_FIELD_PREAMBLE, event->GetPpdu()->GetTxVector()) -
@@ -1171,6 +1301,7 @@ PhyEntity::CancelAllEvents()
         endMpduEvent.Cancel();
     }
     m_endOfMpduEvents.clear();
+    m_pendingMpdusMap.clear();
     for (auto& [staId, endOfMacHdrEvents] : m_endOfMacHdrEvents)
     {
         for (auto& endMacHdrEvent : endOfMacHdrEvents)
@@ -1217,6 +1348,7 @@ PhyEntity::DoAbortCurrentReception(WifiPhyRxfailureReason reason)
             endMpduEvent.Cancel();
         }
         m_endOfMpduEvents.clear();
+        m_pendingMpdusMap.clear();
         for (auto& [staId, endOfMacHdrEvents] : m_endOfMacHdrEvents)
         {
             for (auto& endMacHdrEvent : endOfMacHdrEvents)
@@ -381,6 +381,19 @@ class PhyEntity : public SimpleRefCount<PhyEntity>
      * @param event the event holding incoming PPDU's information
      */
     void EndReceiveField(WifiPpduField field, Ptr<Event> event);
+    /**
+     * End receiving the preamble and the PHY header fields at once, when the reception of
+     * the incoming PPDUs is abstracted (\see WifiPhy::IsRxAbstractionEnabled).
+     *
+     * This method calls the DoStartReceiveField and DoEndReceiveField methods for each
+     * field preceding the field returned by GetFirstNonAbstractedField, in order. If all
+     * the fields are successfully received, reception of that field is triggered. Otherwise,
+     * the indications in the \see PhyFieldRxStatus of the first field that failed are
+     * performed.
+     *
+     * @param event the event holding incoming PPDU's information
+     */
+    void EndReceivePhyHeader(Ptr<Event> event);
 
     /**
      * The last symbol of the PPDU has arrived.
@@ -573,6 +586,16 @@ class PhyEntity : public SimpleRefCount<PhyEntity>
      */
     virtual PhyFieldRxStatus DoEndReceiveField(WifiPpduField field, Ptr<Event> event);
 
+    /**
+     * Get the first field of the given PPDU that is received as usual when the reception of
+     * the incoming PPDUs is abstracted (\see WifiPhy::IsRxAbstractionEnabled). The preamble
+     * and the fields preceding it are processed at once at the start of that field.
+     *
+     * @param ppdu the incoming PPDU
+     * @return the first field that is received as usual (the Data field by default)
+     */
+    virtual WifiPpduField GetFirstNonAbstractedField(Ptr<const WifiPpdu> ppdu) const;
+
     /**
      * Get the event corresponding to the incoming PPDU.
      *
@@ -686,6 +709,20 @@ class PhyEntity : public SimpleRefCount<PhyEntity>
                                                        uint16_t staId,
                                                        Time relativeMpduStart,
                                                        Time mpduDuration);
+    /**
+     * Get the reception status for the provided MPDU given its SNR and PER.
+     *
+     * @param mpdu the arriving MPDU
+     * @param event the event holding incoming PPDU's information
+     * @param staId the station ID of the PSDU (only used for MU)
+     * @param snrPer the SNR and PER of the MPDU
+     *
+     * @return information on MPDU reception: status, signal power (dBm), and noise power (in dBm)
+     */
+    std::pair<bool, SignalNoiseDbm> GetReceptionStatus(Ptr<WifiMpdu> mpdu,
+                                                       Ptr<Event> event,
+                                                       uint16_t staId,
+                                                       const SnrPer& snrPer);
     /**
      * The last symbol of an MPDU in an A-MPDU has arrived.
      *
@@ -700,6 +737,24 @@ class PhyEntity : public SimpleRefCount<PhyEntity>
                    size_t mpduIndex,
                    Time relativeStart,
                    Time mpduDuration);
+    /**
+     * Process the reception status of an MPDU of the PSDU under reception.
+     *
+     * @param event the event holding incoming PPDU's information
+     * @param mpdu the arriving MPDU
+     * @param rxInfo information on MPDU reception: status, signal power (dBm), and noise power
+     * (in dBm)
+     */
+    void ProcessMpduReceptionStatus(Ptr<Event> event,
+                                    Ptr<WifiMpdu> mpdu,
+                                    const std::pair<bool, SignalNoiseDbm>& rxInfo);
+    /**
+     * The last symbol of the PSDU has arrived and its reception is abstracted (\see
+     * WifiPhy::IsRxAbstractionEnabled): evaluate the reception of all its MPDUs.
+     *
+     * @param event the event holding incoming PPDU's information
+     */
+    void EndOfMpdus(Ptr<Event> event);
 
     /**
      * Schedule end of MPDUs events.
@@ -708,6 +763,17 @@ class PhyEntity : public SimpleRefCount<PhyEntity>
      */
     void ScheduleEndOfMpdus(Ptr<Event> event);
 
+    /**
+     * Perform the actions indicated by the reception status of a PPDU field that failed.
+     *
+     * @param event the event holding incoming PPDU's information
+     * @param status the reception status of the field
+     * @param remainingDuration the remaining duration of the PPDU
+     */
+    void ProcessFieldRxFailure(Ptr<Event> event,
+                               const PhyFieldRxStatus& status,
+                               Time remainingDuration);
+
     /**
      * Perform amendment-specific actions when the payload is successfully received.
      *
@@ -971,6 +1037,20 @@ class PhyEntity : public SimpleRefCount<PhyEntity>
         m_signalNoiseMap; //!< Map of the latest signal power and noise power in dBm (noise power
                           //!< includes the noise figure)
 
+    /**
+     * An MPDU whose reception is evaluated at the end of the PPDU
+     */
+    struct PendingMpdu
+    {
+        Ptr<WifiMpdu> mpdu; //!< the MPDU
+        Time relativeStart; //!< the relative start time of the MPDU within the A-MPDU
+        Time duration;      //!< the duration of the MPDU
+    };
+
+    std::map<UidStaIdPair, std::vector<PendingMpdu>>
+        m_pendingMpdusMap; //!< Map of the MPDUs whose reception is evaluated at the end of the
+                           //!< PPDU when the reception of the incoming PPDUs is abstracted
+
     static uint64_t m_globalPpduUid; //!< Global counter of the PPDU UID
 };                                   // class PhyEntity
 
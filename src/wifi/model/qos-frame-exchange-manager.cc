@@ -282,8 +282,7 @@ QosFrameExchangeManager::StartFrameExchange(Ptr<QosTxop> edca,
 
     mpdu = CreateAliasIfNeeded(mpdu);
     WifiTxParameters txParams;
-    txParams.m_txVector =
-        GetWifiRemoteStationManager()->GetDataTxVector(mpdu->GetHeader(), m_allowedWidth);
+    txParams.m_txVector = GetWifiRemoteStationManager()->GetDataTxVector(mpdu, m_allowedWidth);
 
     Ptr<WifiMpdu> item = edca->GetNextMpdu(m_linkId, mpdu, txParams, availableTime, initialFrame);
 
@@ -98,6 +98,11 @@ struct MinstrelHtWifiRemoteStation : MinstrelWifiRemoteStation
     McsGroupData m_groupsTable; //!< Table of groups with stats.
     bool m_isHt;                //!< If the station is HT capable.
 
+    uint32_t m_numStatsUpdates; //!< Number of updates of the statistics table.
+    std::vector<uint16_t>
+        m_attemptedRates; //!< Rates that have been attempted since the last statistics update.
+    std::vector<uint16_t> m_ratesWithTp; //!< Rates with non-zero throughput, sorted by index.
+
     std::ofstream m_statsFile; //!< File where statistics table is written.
 };
 
@@ -459,6 +464,8 @@ MinstrelHtWifiManager::DoCreateStation() const
     station->m_ampduLen = 0;
     station->m_ampduPacketCount = 0;
 
+    station->m_numStatsUpdates = 0;
+
     // Use the variable in the station to indicate whether the device supports HT.
     // When correct information available it will be checked.
     station->m_isHt = static_cast<bool>(GetPhy()->GetDevice()->GetHtConfiguration());
@@ -574,11 +581,8 @@ MinstrelHtWifiManager::DoReportDataFailed(WifiRemoteStation* st)
     }
     else if (station->m_longRetry < CountRetries(station))
     {
-        const auto rateId = GetRateId(station->m_txrate);
-        const auto groupId = GetGroupId(station->m_txrate);
-        station->m_groupsTable[groupId]
-            .m_ratesTable[rateId]
-            .numRateAttempt++; // Increment the attempts counter for the rate used.
+        // Increment the attempts counter for the rate used.
+        AddRateAttempts(station, station->m_txrate, 0, 1);
         UpdateRate(station);
     }
 }
@@ -639,8 +643,7 @@ MinstrelHtWifiManager::DoReportDataOk(WifiRemoteStation* st,
             << ", success = " << station->m_groupsTable[groupId].m_ratesTable[rateId].numRateSuccess
             << " (before update).");
 
-        station->m_groupsTable[groupId].m_ratesTable[rateId].numRateSuccess++;
-        station->m_groupsTable[groupId].m_ratesTable[rateId].numRateAttempt++;
+        AddRateAttempts(station, station->m_txrate, 1, 1);
 
         UpdatePacketCounters(station, 1, 0);
 
@@ -746,11 +749,7 @@ MinstrelHtWifiManager::DoReportAmpduTxStatus(WifiRemoteStation* st,
 
     UpdatePacketCounters(station, nSuccessfulMpdus, nFailedMpdus);
 
-    const auto rateId = GetRateId(station->m_txrate);
-    const auto groupId = GetGroupId(station->m_txrate);
-    station->m_groupsTable[groupId].m_ratesTable[rateId].numRateSuccess += nSuccessfulMpdus;
-    station->m_groupsTable[groupId].m_ratesTable[rateId].numRateAttempt +=
-        nSuccessfulMpdus + nFailedMpdus;
+    AddRateAttempts(station, station->m_txrate, nSuccessfulMpdus, nSuccessfulMpdus + nFailedMpdus);
 
     if (nSuccessfulMpdus == 0 && station->m_longRetry < CountRetries(station))
     {
@@ -1276,6 +1275,8 @@ MinstrelHtWifiManager::FindRate(MinstrelHtWifiRemoteStation* station)
              * Also do not sample if the probability is already higher than 95%
              * to avoid wasting airtime.
              */
+            RefreshRateStats(station,
+                             station->m_groupsTable[sampleGroupId].m_ratesTable[sampleRateId]);
             const auto sampleRateInfo =
                 station->m_groupsTable[sampleGroupId].m_ratesTable[sampleRateId];
 
@@ -1384,7 +1385,6 @@ MinstrelHtWifiManager::UpdateStats(MinstrelHtWifiRemoteStation* station)
     station->m_maxTpRate2 = GetLowestIndex(station);
     station->m_maxProbRate = GetLowestIndex(station);
 
-    /// Update throughput and EWMA for each rate inside each group.
     for (std::size_t j = 0; j < m_numGroups; j++)
     {
         if (station->m_groupsTable[j].m_supported)
@@ -1395,85 +1395,86 @@ MinstrelHtWifiManager::UpdateStats(MinstrelHtWifiRemoteStation* station)
             station->m_groupsTable[j].m_maxTpRate = GetLowestIndex(station, j);
             station->m_groupsTable[j].m_maxTpRate2 = GetLowestIndex(station, j);
             station->m_groupsTable[j].m_maxProbRate = GetLowestIndex(station, j);
+        }
+    }
 
-            for (uint8_t i = 0; i < m_numRates; i++)
-            {
-                if (station->m_groupsTable[j].m_ratesTable[i].supported)
-                {
-                    station->m_groupsTable[j].m_ratesTable[i].retryUpdated = false;
-
-                    NS_LOG_DEBUG(
-                        +i << " "
-                           << GetMcsSupported(station,
-                                              station->m_groupsTable[j].m_ratesTable[i].mcsIndex)
-                           << "\t attempt="
-                           << station->m_groupsTable[j].m_ratesTable[i].numRateAttempt
-                           << "\t success="
-                           << station->m_groupsTable[j].m_ratesTable[i].numRateSuccess);
-
-                    /// If we've attempted something.
-                    if (station->m_groupsTable[j].m_ratesTable[i].numRateAttempt > 0)
-                    {
-                        station->m_groupsTable[j].m_ratesTable[i].numSamplesSkipped = 0;
-                        /**
-                         * Calculate the probability of success.
-                         * Assume probability scales from 0 to 100.
-                         */
-                        tempProb =
-                            (100 * station->m_groupsTable[j].m_ratesTable[i].numRateSuccess) /
-                            station->m_groupsTable[j].m_ratesTable[i].numRateAttempt;
-
-                        /// Bookkeeping.
-                        station->m_groupsTable[j].m_ratesTable[i].prob = tempProb;
-
-                        if (station->m_groupsTable[j].m_ratesTable[i].successHist == 0)
-                        {
-                            station->m_groupsTable[j].m_ratesTable[i].ewmaProb = tempProb;
-                        }
-                        else
-                        {
-                            station->m_groupsTable[j].m_ratesTable[i].ewmsdProb =
-                                CalculateEwmsd(station->m_groupsTable[j].m_ratesTable[i].ewmsdProb,
-                                               tempProb,
-                                               station->m_groupsTable[j].m_ratesTable[i].ewmaProb,
-                                               m_ewmaLevel);
-                            /// EWMA probability
-                            tempProb =
-                                (tempProb * (100 - m_ewmaLevel) +
-                                 station->m_groupsTable[j].m_ratesTable[i].ewmaProb * m_ewmaLevel) /
-                                100;
-                            station->m_groupsTable[j].m_ratesTable[i].ewmaProb = tempProb;
-                        }
+    /**
+     * Update throughput and EWMA for each rate that has been attempted since the last update.
+     * The statistics of the other rates are not modified, except for the per-interval
+     * statistics, which are lazily updated by RefreshRateStats().
+     */
+    for (const auto index : station->m_attemptedRates)
+    {
+        const auto j = GetGroupId(index);
+        const auto i = GetRateId(index);
+        auto& rateInfo = station->m_groupsTable[j].m_ratesTable[i];
+        NS_ASSERT(station->m_groupsTable[j].m_supported && rateInfo.supported);
+        RefreshRateStats(station, rateInfo);
 
-                        station->m_groupsTable[j].m_ratesTable[i].throughput =
-                            CalculateThroughput(station, j, i, tempProb);
+        rateInfo.retryUpdated = false;
 
-                        station->m_groupsTable[j].m_ratesTable[i].successHist +=
-                            station->m_groupsTable[j].m_ratesTable[i].numRateSuccess;
-                        station->m_groupsTable[j].m_ratesTable[i].attemptHist +=
-                            station->m_groupsTable[j].m_ratesTable[i].numRateAttempt;
-                    }
-                    else
-                    {
-                        station->m_groupsTable[j].m_ratesTable[i].numSamplesSkipped++;
-                    }
+        NS_LOG_DEBUG(+i << " " << GetMcsSupported(station, rateInfo.mcsIndex)
+                        << "\t attempt=" << rateInfo.numRateAttempt
+                        << "\t success=" << rateInfo.numRateSuccess);
 
-                    /// Bookkeeping.
-                    station->m_groupsTable[j].m_ratesTable[i].prevNumRateSuccess =
-                        station->m_groupsTable[j].m_ratesTable[i].numRateSuccess;
-                    station->m_groupsTable[j].m_ratesTable[i].prevNumRateAttempt =
-                        station->m_groupsTable[j].m_ratesTable[i].numRateAttempt;
-                    station->m_groupsTable[j].m_ratesTable[i].numRateSuccess = 0;
-                    station->m_groupsTable[j].m_ratesTable[i].numRateAttempt = 0;
+        rateInfo.numSamplesSkipped = 0;
+        /**
+         * Calculate the probability of success.
+         * Assume probability scales from 0 to 100.
+         */
+        tempProb = (100 * rateInfo.numRateSuccess) / rateInfo.numRateAttempt;
 
-                    if (station->m_groupsTable[j].m_ratesTable[i].throughput != 0)
-                    {
-                        SetBestStationThRates(station, GetIndex(j, i));
-                        SetBestProbabilityRate(station, GetIndex(j, i));
-                    }
-                }
-            }
+        /// Bookkeeping.
+        rateInfo.prob = tempProb;
+
+        if (rateInfo.successHist == 0)
+        {
+            rateInfo.ewmaProb = tempProb;
+        }
+        else
+        {
+            rateInfo.ewmsdProb =
+                CalculateEwmsd(rateInfo.ewmsdProb, tempProb, rateInfo.ewmaProb, m_ewmaLevel);
+            /// EWMA probability
+            tempProb = (tempProb * (100 - m_ewmaLevel) + rateInfo.ewmaProb * m_ewmaLevel) / 100;
+            rateInfo.ewmaProb = tempProb;
         }
+
+        rateInfo.throughput = CalculateThroughput(station, j, i, tempProb);
+
+        rateInfo.successHist += rateInfo.numRateSuccess;
+        rateInfo.attemptHist += rateInfo.numRateAttempt;
+
+        /// Bookkeeping.
+        rateInfo.prevNumRateSuccess = rateInfo.numRateSuccess;
+        rateInfo.prevNumRateAttempt = rateInfo.numRateAttempt;
+        rateInfo.numRateSuccess = 0;
+        rateInfo.numRateAttempt = 0;
+        rateInfo.lastStatsUpdate = station->m_numStatsUpdates + 1;
+
+        // keep the list of rates with non-zero throughput up to date
+        auto it = std::lower_bound(station->m_ratesWithTp.begin(),
+                                   station->m_ratesWithTp.end(),
+                                   index);
+        const auto found = (it != station->m_ratesWithTp.end() && *it == index);
+        if (rateInfo.throughput != 0 && !found)
+        {
+            station->m_ratesWithTp.insert(it, index);
+        }
+        else if (rateInfo.throughput == 0 && found)
+        {
+            station->m_ratesWithTp.erase(it);
+        }
+    }
+    station->m_attemptedRates.clear();
+    station->m_numStatsUpdates++;
+
+    // rates are visited in increasing order of index, hence ties are broken as if all the rates
+    // were visited
+    for (const auto index : station->m_ratesWithTp)
+    {
+        SetBestStationThRates(station, index);
+        SetBestProbabilityRate(station, index);
     }
 
     // Try to sample all available rates during each interval.
@@ -1492,6 +1493,41 @@ MinstrelHtWifiManager::UpdateStats(MinstrelHtWifiRemoteStation* station)
     }
 }
 
+void
+MinstrelHtWifiManager::AddRateAttempts(MinstrelHtWifiRemoteStation* station,
+                                       uint16_t index,
+                                       uint32_t nSuccess,
+                                       uint32_t nAttempts)
+{
+    NS_LOG_FUNCTION(this << station << index << nSuccess << nAttempts);
+    auto& rateInfo = station->m_groupsTable[GetGroupId(index)].m_ratesTable[GetRateId(index)];
+
+    if (rateInfo.numRateAttempt == 0 && nAttempts > 0)
+    {
+        station->m_attemptedRates.push_back(index);
+    }
+    rateInfo.numRateSuccess += nSuccess;
+    rateInfo.numRateAttempt += nAttempts;
+}
+
+void
+MinstrelHtWifiManager::RefreshRateStats(MinstrelHtWifiRemoteStation* station,
+                                        MinstrelHtRateInfo& rateInfo) const
+{
+    if (rateInfo.lastStatsUpdate == station->m_numStatsUpdates)
+    {
+        return;
+    }
+    // the rate has not been attempted in the intervals elapsed since the last update of its
+    // per-interval statistics
+    NS_ASSERT(rateInfo.lastStatsUpdate < station->m_numStatsUpdates);
+    rateInfo.numSamplesSkipped += station->m_numStatsUpdates - rateInfo.lastStatsUpdate;
+    rateInfo.prevNumRateSuccess = 0;
+    rateInfo.prevNumRateAttempt = 0;
+    rateInfo.retryUpdated = false;
+    rateInfo.lastStatsUpdate = station->m_numStatsUpdates;
+}
+
 double
 MinstrelHtWifiManager::CalculateThroughput(MinstrelHtWifiRemoteStation* station,
                                            std::size_t groupId,
@@ -1661,6 +1697,9 @@ MinstrelHtWifiManager::RateInit(MinstrelHtWifiRemoteStation* station)
     NS_LOG_FUNCTION(this << station);
 
     station->m_groupsTable = McsGroupData(m_numGroups);
+    station->m_numStatsUpdates = 0;
+    station->m_attemptedRates.clear();
+    station->m_ratesWithTp.clear();
 
     /**
      * Initialize groups supported by the receiver.
@@ -1768,6 +1807,7 @@ MinstrelHtWifiManager::RateInit(MinstrelHtWifiRemoteStation* station)
                     station->m_groupsTable[groupId].m_ratesTable[rateId].prevNumRateAttempt = 0;
                     station->m_groupsTable[groupId].m_ratesTable[rateId].prevNumRateSuccess = 0;
                     station->m_groupsTable[groupId].m_ratesTable[rateId].numSamplesSkipped = 0;
+                    station->m_groupsTable[groupId].m_ratesTable[rateId].lastStatsUpdate = 0;
                     station->m_groupsTable[groupId].m_ratesTable[rateId].successHist = 0;
                     station->m_groupsTable[groupId].m_ratesTable[rateId].attemptHist = 0;
                     station->m_groupsTable[groupId].m_ratesTable[rateId].throughput = 0;
@@ -1797,6 +1837,7 @@ MinstrelHtWifiManager::CalculateRetransmits(MinstrelHtWifiRemoteStation* station
     NS_LOG_FUNCTION(this << station << index);
     const auto groupId = GetGroupId(index);
     const auto rateId = GetRateId(index);
+    RefreshRateStats(station, station->m_groupsTable[groupId].m_ratesTable[rateId]);
     if (!station->m_groupsTable[groupId].m_ratesTable[rateId].retryUpdated)
     {
         CalculateRetransmits(station, groupId, rateId);
@@ -1954,6 +1995,7 @@ MinstrelHtWifiManager::StatsDump(MinstrelHtWifiRemoteStation* station,
         if (station->m_groupsTable[groupId].m_supported &&
             station->m_groupsTable[groupId].m_ratesTable[i].supported)
         {
+            RefreshRateStats(station, station->m_groupsTable[groupId].m_ratesTable[i]);
             of << group.type << " " << group.chWidth << "   " << group.gi << "  " << +group.streams
                << "   ";
 
@@ -124,6 +124,8 @@ struct MinstrelHtRateInfo
     uint64_t successHist;        //!< Aggregate of all transmission successes.
     uint64_t attemptHist;        //!< Aggregate of all transmission attempts.
     double throughput;           //!< Throughput of this rate (in packets per second).
+    uint32_t lastStatsUpdate;    //!< Number of statistics updates of the station the last time
+                                 //!< the per-interval statistics of this rate were updated.
 };
 
 /**
@@ -373,6 +375,32 @@ class MinstrelHtWifiManager : public WifiRemoteStationManager
                               uint16_t nSuccessfulMpdus,
                               uint16_t nFailedMpdus);
 
+    /**
+     * Update the number of transmission attempts and successes of the given rate and keep
+     * track of the rates that have been attempted since the last update of the statistics.
+     *
+     * @param station the wifi remote station
+     * @param index the index of the rate
+     * @param nSuccess the number of successful transmissions
+     * @param nAttempts the number of transmission attempts
+     */
+    void AddRateAttempts(MinstrelHtWifiRemoteStation* station,
+                         uint16_t index,
+                         uint32_t nSuccess,
+                         uint32_t nAttempts);
+
+    /**
+     * Statistics are only updated for the rates that have been attempted since the last
+     * update. The per-interval statistics (number of skipped samples, number of attempts and
+     * successes in the last interval, retry update flag) of a rate that has not been attempted
+     * in the last intervals are brought up to date by this function, which must be called
+     * before such statistics are read or modified.
+     *
+     * @param station the wifi remote station
+     * @param rateInfo the statistics of a rate of the station
+     */
+    void RefreshRateStats(MinstrelHtWifiRemoteStation* station, MinstrelHtRateInfo& rateInfo) const;
+
     /**
      * Getting the next sample from Sample Table.
      *
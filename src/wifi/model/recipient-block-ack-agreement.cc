@@ -242,15 +242,12 @@ RecipientBlockAckAgreement::FillBlockAckBitmap(CtrlBAckResponseHeader& blockAckH
         uint16_t ssn = m_scoreboard.GetWinStart();
         NS_LOG_DEBUG("SSN=" << ssn);
         blockAckHeader.SetStartingSequence(ssn, index);
-        blockAckHeader.ResetBitmap(index);
-
-        for (std::size_t i = 0; i < m_scoreboard.GetWinSize(); i++)
-        {
-            if (m_scoreboard.At(i))
-            {
-                blockAckHeader.SetReceivedPacket((ssn + i) % SEQNO_SPACE_SIZE, index);
-            }
-        }
+
+        // bit i of the bitmap refers to SSN + i, i.e., to the element of the scoreboard
+        // having distance i from WinStartR, hence the scoreboard is copied as a whole
+        auto bitmap = blockAckHeader.GetBitmap(index);
+        m_scoreboard.CopyTo(bitmap);
+        blockAckHeader.SetBitmap(std::move(bitmap), index);
     }
 }
 
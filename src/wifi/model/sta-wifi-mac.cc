@@ -10,6 +10,7 @@
 
 #include "sta-wifi-mac.h"
 
+#include "ap-wifi-mac.h"
 #include "channel-access-manager.h"
 #include "frame-exchange-manager.h"
 #include "mgt-action-headers.h"
@@ -171,7 +172,26 @@ StaWifiMac::DoInitialize()
     {
         m_emlsrManager->Initialize();
     }
-    StartScanning();
+    if (IsAssociated())
+    {
+        // association has been fast-forwarded, hence all the setup links are in active mode;
+        // switch to power save mode the links on which it was requested
+        for (const auto linkId : GetSetupLinkIds())
+        {
+            if (auto& link = GetLink(linkId); link.pmMode == WIFI_PM_POWERSAVE)
+            {
+                link.pmMode = WIFI_PM_ACTIVE;
+                Simulator::ScheduleNow(&StaWifiMac::SetPowerSaveMode,
+                                       this,
+                                       std::pair<bool, uint8_t>{true, linkId});
+            }
+        }
+        RestartBeaconWatchdog(m_beaconWatchdogEnd - Simulator::Now());
+    }
+    else
+    {
+        StartScanning();
+    }
     NS_ABORT_IF(!TraceConnectWithoutContext("AckedMpdu", MakeCallback(&StaWifiMac::TxOk, this)));
     WifiMac::DoInitialize();
 }
@@ -665,8 +685,8 @@ StaWifiMac::GetTidToLinkMappingElements(WifiTidToLinkMappingNegSupport apNegSupp
     return ret;
 }
 
-void
-StaWifiMac::SendAssociationRequest(bool isReassoc)
+Ptr<WifiMpdu>
+StaWifiMac::GetAssociationRequestMpdu(bool isReassoc)
 {
     // find the link where the (Re)Association Request has to be sent
     auto it = GetLinks().cbegin();
@@ -732,9 +752,22 @@ StaWifiMac::SendAssociationRequest(bool isReassoc)
         packet->AddHeader(std::get<MgtReassocRequestHeader>(frame));
     }
 
+    return Create<WifiMpdu>(packet, hdr);
+}
+
+void
+StaWifiMac::SendAssociationRequest(bool isReassoc)
+{
+    NS_LOG_FUNCTION(this << isReassoc);
+
+    auto mpdu = GetAssociationRequestMpdu(isReassoc);
+    const auto bssid = mpdu->GetHeader().GetAddr1();
+    const auto linkId = GetLinkIdByAddress(mpdu->GetHeader().GetAddr2());
+    NS_ASSERT(linkId.has_value());
+
     if (!GetQosSupported())
     {
-        GetTxop()->Queue(Create<WifiMpdu>(packet, hdr));
+        GetTxop()->Queue(mpdu);
     }
     // "A QoS STA that transmits a Management frame determines access category used
     // for medium access in transmission of the Management frame as follows
@@ -743,13 +776,13 @@ StaWifiMac::SendAssociationRequest(bool isReassoc)
     //   AC_BE should be selected.
     // — If category AC_BE was not selected by the previous step, category AC_VO
     //   shall be selected." (Sec. 10.2.3.2 of 802.11-2020)
-    else if (!GetWifiRemoteStationManager(linkId)->GetQosSupported(*link.bssid))
+    else if (!GetWifiRemoteStationManager(*linkId)->GetQosSupported(bssid))
     {
-        GetBEQueue()->Queue(Create<WifiMpdu>(packet, hdr));
+        GetBEQueue()->Queue(mpdu);
     }
     else
     {
-        GetVOQueue()->Queue(Create<WifiMpdu>(packet, hdr));
+        GetVOQueue()->Queue(mpdu);
     }
 
     if (m_assocRequestEvent.IsPending())
@@ -841,7 +874,132 @@ StaWifiMac::ScanningTimeout(const std::optional<ApInfo>& bestAp)
     }
 
     NS_LOG_DEBUG("Attempting to associate with AP: " << *bestAp);
-    UpdateApInfo(bestAp->m_frame, bestAp->m_apAddr, bestAp->m_bssid, bestAp->m_linkId);
+    PrepareAssociation(*bestAp);
+
+    // lambda to get beacon interval from Beacon or Probe Response
+    auto getBeaconInterval = [](auto&& frame) {
+        using T = std::decay_t<decltype(frame)>;
+        if constexpr (std::is_same_v<T, MgtBeaconHeader> ||
+                      std::is_same_v<T, MgtProbeResponseHeader>)
+        {
+            return MicroSeconds(frame.GetBeaconIntervalUs());
+        }
+        else
+        {
+            NS_ABORT_MSG("Unexpected frame type");
+            return Seconds(0);
+        }
+    };
+    Time beaconInterval = std::visit(getBeaconInterval, bestAp->m_frame);
+    Time delay = beaconInterval * m_maxMissedBeacons;
+    // restart beacon watchdog
+    RestartBeaconWatchdog(delay);
+
+    SetState(WAIT_ASSOC_RESP);
+    SendAssociationRequest(false);
+}
+
+void
+StaWifiMac::FastForwardAssociation(Ptr<ApWifiMac> apMac)
+{
+    NS_LOG_FUNCTION(this << apMac);
+    NS_ABORT_MSG_IF(IsInitialized(),
+                    "Association can only be fast-forwarded before the simulation starts");
+    NS_ABORT_MSG_IF(m_state != UNASSOCIATED, "Association has been already fast-forwarded");
+    NS_ABORT_MSG_IF(!GetSsid().IsEqual(apMac->GetSsid()), "The SSID of the AP does not match");
+
+    // find the links of the AP operating on the same channel as our links
+    std::map<uint8_t /* local link ID */, uint8_t /* AP link ID */> apLinkIds;
+    for (const auto& [id, link] : GetLinks())
+    {
+        for (uint8_t apLinkId = 0; apLinkId < apMac->GetNLinks(); apLinkId++)
+        {
+            if (apMac->GetWifiPhy(apLinkId)->GetOperatingChannel() ==
+                link->phy->GetOperatingChannel())
+            {
+                apLinkIds.emplace(id, apLinkId);
+                break;
+            }
+        }
+    }
+
+    // an EMLSR client must perform ML setup by using its main PHY
+    auto assocLinkIt = apLinkIds.cbegin();
+    if (m_emlsrManager)
+    {
+        auto mainPhyLinkId = GetLinkForPhy(m_emlsrManager->GetMainPhyId());
+        NS_ASSERT(mainPhyLinkId);
+        assocLinkIt = apLinkIds.find(*mainPhyLinkId);
+    }
+    NS_ABORT_MSG_IF(assocLinkIt == apLinkIds.cend(),
+                    "No link to associate with the AP, operating channels do not match");
+
+    const auto [linkId, apLinkId] = *assocLinkIt;
+    const auto bssid = apMac->GetFrameExchangeManager(apLinkId)->GetAddress();
+    auto probeResp = apMac->GetProbeResp(apLinkId, std::nullopt);
+
+    ApInfo apInfo{.m_bssid = bssid,
+                  .m_apAddr = bssid,
+                  .m_snr = 0,
+                  .m_frame = probeResp,
+                  .m_channel = {GetCurrentChannel(linkId)},
+                  .m_linkId = linkId};
+
+    // setup all the links operating on the same channel as a link of the AP MLD, starting
+    // with the link used to associate
+    if (GetNLinks() > 1 && probeResp.Get<MultiLinkElement>().has_value())
+    {
+        apInfo.m_setupLinks.emplace_back(ApInfo::SetupLinksInfo{linkId, apLinkId, bssid});
+        for (const auto& [id, apId] : apLinkIds)
+        {
+            if (id != linkId)
+            {
+                apInfo.m_setupLinks.emplace_back(ApInfo::SetupLinksInfo{
+                    id,
+                    apId,
+                    apMac->GetFrameExchangeManager(apId)->GetAddress()});
+            }
+        }
+    }
+
+    NS_LOG_DEBUG("Fast-forwarding association with AP: " << apInfo);
+    PrepareAssociation(apInfo);
+    SetState(WAIT_ASSOC_RESP);
+
+    auto assocReq = GetAssociationRequestMpdu(false);
+    auto assocResp = apMac->FastForwardAssocRequest(assocReq);
+
+    MgtAssocResponseHeader assocRespHdr;
+    assocResp->GetPacket()->PeekHeader(assocRespHdr);
+    NS_ABORT_MSG_IF(!assocRespHdr.GetStatusCode().IsSuccess(), "Association refused by the AP");
+
+    // the (Re)Association Response is received on the link used to send the request
+    auto assocLinkId = GetLinkIdByAddress(assocReq->GetHeader().GetAddr2());
+    NS_ASSERT(assocLinkId.has_value());
+    ReceiveAssocResp(assocResp, *assocLinkId);
+    NS_ASSERT(IsAssociated());
+
+    // the beacon watchdog is started when this object is initialized
+    m_beaconWatchdogEnd =
+        Simulator::Now() + MicroSeconds(probeResp.GetBeaconIntervalUs()) * m_maxMissedBeacons;
+
+    if (m_emlsrManager)
+    {
+        if (auto emlOmn = m_emlsrManager->FastForwardEmlsrMode(assocReq))
+        {
+            apMac->FastForwardEmlOmn(*emlOmn,
+                                     GetFrameExchangeManager(*assocLinkId)->GetAddress(),
+                                     *assocLinkId);
+        }
+    }
+}
+
+void
+StaWifiMac::PrepareAssociation(const ApInfo& apInfo)
+{
+    NS_LOG_FUNCTION(this << apInfo);
+
+    UpdateApInfo(apInfo.m_frame, apInfo.m_apAddr, apInfo.m_bssid, apInfo.m_linkId);
     // reset info on links to setup
     for (auto& [id, link] : GetLinks())
     {
@@ -850,15 +1008,15 @@ StaWifiMac::ScanningTimeout(const std::optional<ApInfo>& bestAp)
         staLink.bssid = std::nullopt;
     }
     // send Association Request on the link where the Beacon/Probe Response was received
-    GetLink(bestAp->m_linkId).sendAssocReq = true;
-    GetLink(bestAp->m_linkId).bssid = bestAp->m_bssid;
+    GetLink(apInfo.m_linkId).sendAssocReq = true;
+    GetLink(apInfo.m_linkId).bssid = apInfo.m_bssid;
     std::shared_ptr<CommonInfoBasicMle> mleCommonInfo;
     // update info on links to setup (11be MLDs only)
     const auto& mle =
         std::visit([](auto&& frame) { return frame.template Get<MultiLinkElement>(); },
-                   bestAp->m_frame);
+                   apInfo.m_frame);
     std::map<uint8_t, uint8_t> swapInfo;
-    for (const auto& [localLinkId, apLinkId, bssid] : bestAp->m_setupLinks)
+    for (const auto& [localLinkId, apLinkId, bssid] : apInfo.m_setupLinks)
     {
         NS_ASSERT_MSG(mle, "We get here only for ML setup");
         NS_LOG_DEBUG("Setting up link (local ID=" << +localLinkId << ", AP ID=" << +apLinkId
@@ -873,28 +1031,6 @@ StaWifiMac::ScanningTimeout(const std::optional<ApInfo>& bestAp)
     }
 
     SwapLinks(swapInfo);
-
-    // lambda to get beacon interval from Beacon or Probe Response
-    auto getBeaconInterval = [](auto&& frame) {
-        using T = std::decay_t<decltype(frame)>;
-        if constexpr (std::is_same_v<T, MgtBeaconHeader> ||
-                      std::is_same_v<T, MgtProbeResponseHeader>)
-        {
-            return MicroSeconds(frame.GetBeaconIntervalUs());
-        }
-        else
-        {
-            NS_ABORT_MSG("Unexpected frame type");
-            return Seconds(0);
-        }
-    };
-    Time beaconInterval = std::visit(getBeaconInterval, bestAp->m_frame);
-    Time delay = beaconInterval * m_maxMissedBeacons;
-    // restart beacon watchdog
-    RestartBeaconWatchdog(delay);
-
-    SetState(WAIT_ASSOC_RESP);
-    SendAssociationRequest(false);
 }
 
 void
@@ -1200,7 +1336,10 @@ StaWifiMac::Receive(Ptr<const WifiMpdu> mpdu, uint8_t linkId)
 
     case WIFI_MAC_MGT_ASSOCIATION_RESPONSE:
     case WIFI_MAC_MGT_REASSOCIATION_RESPONSE:
-        ReceiveAssocResp(mpdu, linkId);
+        if (ReceiveAssocResp(mpdu, linkId))
+        {
+            SetPmModeAfterAssociation(linkId);
+        }
         break;
 
     case WIFI_MAC_MGT_ACTION:
@@ -1311,7 +1450,7 @@ StaWifiMac::ReceiveProbeResp(Ptr<const WifiMpdu> mpdu, uint8_t linkId)
                                         .m_linkId = linkId});
 }
 
-void
+bool
 StaWifiMac::ReceiveAssocResp(Ptr<const WifiMpdu> mpdu, uint8_t linkId)
 {
     NS_LOG_FUNCTION(this << *mpdu << +linkId);
@@ -1320,7 +1459,7 @@ StaWifiMac::ReceiveAssocResp(Ptr<const WifiMpdu> mpdu, uint8_t linkId)
 
     if (m_state != WAIT_ASSOC_RESP)
     {
-        return;
+        return false;
     }
 
     std::optional<Mac48Address> apMldAddress;
@@ -1388,7 +1527,7 @@ StaWifiMac::ReceiveAssocResp(Ptr<const WifiMpdu> mpdu, uint8_t linkId)
         NS_LOG_DEBUG("association refused");
         SetState(REFUSED);
         StartScanning();
-        return;
+        return false;
     }
 
     // if this is an MLD, check if we can setup (other) links
@@ -1501,7 +1640,7 @@ StaWifiMac::ReceiveAssocResp(Ptr<const WifiMpdu> mpdu, uint8_t linkId)
         }
     }
 
-    SetPmModeAfterAssociation(linkId);
+    return true;
 }
 
 void
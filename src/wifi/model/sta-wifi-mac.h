@@ -25,6 +25,7 @@ class ProbeExchTest;
 namespace ns3
 {
 
+class ApWifiMac;
 class SupportedRates;
 class CapabilityInformation;
 class RandomVariableStream;
@@ -246,6 +247,22 @@ class StaWifiMac : public WifiMac
      */
     void ScanningTimeout(const std::optional<ApInfo>& bestAp);
 
+    /**
+     * Associate with the given AP without exchanging any management frame, i.e., the
+     * (Re)Association Request frame that would be sent to the AP is directly handed to
+     * the AP, which returns the (Re)Association Response frame that would be sent back,
+     * which is then processed as if it had been received. If both this device and the AP
+     * are multi-link devices, all the links of this device operating on the same channel
+     * as a link of the AP are setup. If an EMLSR Manager is installed and the AP MLD
+     * supports EMLSR, EMLSR mode is also enabled on the configured EMLSR links, without
+     * exchanging EML Operating Mode Notification frames. All the setup links are in
+     * active mode when the simulation starts. This method must be called before this
+     * object is initialized, i.e., before the simulation starts.
+     *
+     * @param apMac the MAC of the AP to associate with
+     */
+    void FastForwardAssociation(Ptr<ApWifiMac> apMac);
+
     /**
      * Return whether we are associated with an AP.
      *
@@ -448,8 +465,9 @@ class StaWifiMac : public WifiMac
      *
      * @param mpdu the MPDU containing the (Re)Association Response frame
      * @param linkId the ID of the given link
+     * @return whether the association was successfully completed
      */
-    void ReceiveAssocResp(Ptr<const WifiMpdu> mpdu, uint8_t linkId);
+    bool ReceiveAssocResp(Ptr<const WifiMpdu> mpdu, uint8_t linkId);
 
     /**
      * Update associated AP's information from the given management frame (Beacon,
@@ -478,6 +496,16 @@ class StaWifiMac : public WifiMac
         bool isReassoc,
         uint8_t linkId) const;
 
+    /**
+     * Get the MPDU containing the (Re)Association Request frame to send on the link
+     * selected to send the (Re)Association Request. The (Re)Association Request frame
+     * includes a Multi-Link Element and TID-to-Link Mapping elements, if needed.
+     *
+     * @param isReassoc whether a Reassociation Request has to be returned
+     * @return the MPDU containing the (Re)Association Request frame
+     */
+    Ptr<WifiMpdu> GetAssociationRequestMpdu(bool isReassoc);
+
     /**
      * Forward an association or reassociation request packet to the DCF.
      * The standard is not clear on the correct queue for management frames if QoS is supported.
@@ -487,6 +515,14 @@ class StaWifiMac : public WifiMac
      *
      */
     void SendAssociationRequest(bool isReassoc);
+
+    /**
+     * Store the information about the given AP and about the links to setup with the
+     * given AP, which are used to build the (Re)Association Request frame.
+     *
+     * @param apInfo the info about the AP to associate with
+     */
+    void PrepareAssociation(const ApInfo& apInfo);
     /**
      * Try to ensure that we are associated with an AP by taking an appropriate action
      * depending on the current association status.
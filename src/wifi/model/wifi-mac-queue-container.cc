@@ -14,32 +14,56 @@
 #include "ns3/mac48-address.h"
 #include "ns3/simulator.h"
 
+#include <algorithm>
 #include <vector>
 
 namespace ns3
 {
 
+WifiMacQueueContainer::QueueInfo::QueueInfo(std::pmr::memory_resource* pool)
+    : queue(pool)
+{
+}
+
+WifiMacQueueContainer::WifiMacQueueContainer()
+    : m_expiredQueue(&m_pool),
+      m_expiryWheel(EXPIRY_WHEEL_SIZE, nullptr),
+      m_wheelGranularity(MilliSeconds(1)),
+      m_wheelTime(Simulator::Now())
+{
+}
+
 void
 WifiMacQueueContainer::clear()
 {
     m_queues.clear();
     m_expiredQueue.clear();
-    m_nBytesPerQueue.clear();
+    std::fill(m_expiryWheel.begin(), m_expiryWheel.end(), nullptr);
+    m_dueQueues.clear();
+    m_wheelTime = Simulator::Now();
+}
+
+WifiMacQueueContainer::QueueInfo&
+WifiMacQueueContainer::GetQueueInfo(const WifiContainerQueueId& queueId) const
+{
+    return m_queues.try_emplace(queueId, &m_pool).first->second;
 }
 
 WifiMacQueueContainer::iterator
 WifiMacQueueContainer::insert(const_iterator pos, Ptr<WifiMpdu> item)
 {
     WifiContainerQueueId queueId = GetQueueId(item);
+    auto& info = GetQueueInfo(queueId);
 
-    NS_ABORT_MSG_UNLESS(pos == m_queues[queueId].cend() || GetQueueId(pos->mpdu) == queueId,
+    NS_ABORT_MSG_UNLESS(pos == info.queue.cend() || GetQueueId(pos->mpdu) == queueId,
                         "pos iterator does not point to the correct container queue");
     NS_ABORT_MSG_IF(!item->IsOriginal(), "Only the original copy of an MPDU can be inserted");
 
-    auto [it, ret] = m_nBytesPerQueue.insert({queueId, 0});
-    it->second += item->GetSize();
+    info.nBytes += item->GetSize();
 
-    return m_queues[queueId].emplace(pos, item);
+    auto it = info.queue.emplace(pos, item);
+    ScheduleExpiry(*it, info);
+    return it;
 }
 
 WifiMacQueueContainer::iterator
@@ -50,13 +74,26 @@ WifiMacQueueContainer::erase(const_iterator pos)
         return m_expiredQueue.erase(pos);
     }
 
-    WifiContainerQueueId queueId = GetQueueId(pos->mpdu);
-    auto it = m_nBytesPerQueue.find(queueId);
-    NS_ASSERT(it != m_nBytesPerQueue.end());
-    NS_ASSERT(it->second >= pos->mpdu->GetSize());
-    it->second -= pos->mpdu->GetSize();
+    auto it = m_queues.find(GetQueueId(pos->mpdu));
+    NS_ASSERT(it != m_queues.end());
+    auto& info = it->second;
+    NS_ASSERT(info.nBytes >= pos->mpdu->GetSize());
+    info.nBytes -= pos->mpdu->GetSize();
+    // get a non-const iterator pointing to the element to remove
+    auto elemIt = info.queue.erase(pos, pos);
+    CancelExpiry(*elemIt, info);
 
-    return m_queues[queueId].erase(pos);
+    return info.queue.erase(elemIt);
+}
+
+void
+WifiMacQueueContainer::SetExpiryTime(iterator it, Time expiryTime) const
+{
+    NS_ASSERT(!it->expired);
+    auto& info = GetQueueInfo(GetQueueId(it->mpdu));
+    CancelExpiry(*it, info);
+    it->expiryTime = expiryTime;
+    ScheduleExpiry(*it, info);
 }
 
 Ptr<WifiMpdu>
@@ -106,28 +143,148 @@ WifiMacQueueContainer::GetQueueId(Ptr<const WifiMpdu> mpdu)
 const WifiMacQueueContainer::ContainerQueue&
 WifiMacQueueContainer::GetQueue(const WifiContainerQueueId& queueId) const
 {
-    return m_queues[queueId];
+    return GetQueueInfo(queueId).queue;
 }
 
 uint32_t
 WifiMacQueueContainer::GetNBytes(const WifiContainerQueueId& queueId) const
 {
-    if (auto it = m_queues.find(queueId); it == m_queues.end() || it->second.empty())
+    if (auto it = m_queues.find(queueId); it != m_queues.end() && !it->second.queue.empty())
     {
-        return 0;
+        return it->second.nBytes;
     }
-    return m_nBytesPerQueue.at(queueId);
+    return 0;
+}
+
+std::size_t
+WifiMacQueueContainer::GetWheelSlot(Time time) const
+{
+    return (time.GetTimeStep() / m_wheelGranularity.GetTimeStep()) % EXPIRY_WHEEL_SIZE;
+}
+
+void
+WifiMacQueueContainer::ScheduleExpiry(WifiMacQueueElem& elem, QueueInfo& info) const
+{
+    NS_ASSERT(!elem.inExpiryWheel && !elem.expiryDue);
+
+    if (elem.expiryTime == Time::Max())
+    {
+        // the MPDU never expires
+        return;
+    }
+    if (elem.expiryTime <= m_wheelTime)
+    {
+        MarkDue(elem, info);
+        return;
+    }
+
+    auto& head = m_expiryWheel[GetWheelSlot(elem.expiryTime)];
+    elem.prevInWheel = nullptr;
+    elem.nextInWheel = head;
+    if (head)
+    {
+        head->prevInWheel = &elem;
+    }
+    head = &elem;
+    elem.inExpiryWheel = true;
+}
+
+void
+WifiMacQueueContainer::CancelExpiry(WifiMacQueueElem& elem, QueueInfo& info) const
+{
+    if (elem.inExpiryWheel)
+    {
+        if (elem.prevInWheel)
+        {
+            elem.prevInWheel->nextInWheel = elem.nextInWheel;
+        }
+        else
+        {
+            auto& head = m_expiryWheel[GetWheelSlot(elem.expiryTime)];
+            NS_ASSERT_MSG(head == &elem, "Expiry time modified without calling SetExpiryTime");
+            head = elem.nextInWheel;
+        }
+        if (elem.nextInWheel)
+        {
+            elem.nextInWheel->prevInWheel = elem.prevInWheel;
+        }
+        elem.prevInWheel = elem.nextInWheel = nullptr;
+        elem.inExpiryWheel = false;
+    }
+    else if (elem.expiryDue)
+    {
+        elem.expiryDue = false;
+        NS_ASSERT(info.nDueMpdus > 0);
+        if (--info.nDueMpdus == 0)
+        {
+            // remove the queue from the list of queues including due MPDUs
+            NS_ASSERT(info.dueIndex < m_dueQueues.size() && m_dueQueues[info.dueIndex] == &info);
+            m_dueQueues[info.dueIndex] = m_dueQueues.back();
+            m_dueQueues[info.dueIndex]->dueIndex = info.dueIndex;
+            m_dueQueues.pop_back();
+        }
+    }
+}
+
+void
+WifiMacQueueContainer::MarkDue(WifiMacQueueElem& elem, QueueInfo& info) const
+{
+    elem.expiryDue = true;
+    if (info.nDueMpdus++ == 0)
+    {
+        info.dueIndex = m_dueQueues.size();
+        m_dueQueues.push_back(&info);
+    }
+}
+
+void
+WifiMacQueueContainer::AdvanceExpiryWheel() const
+{
+    const Time now = Simulator::Now();
+    if (now <= m_wheelTime)
+    {
+        // all the MPDUs expiring by now have been already marked as due
+        m_wheelTime = std::min(m_wheelTime, now);
+        return;
+    }
+
+    // visit the slots from the one including the time up to which the wheel has been
+    // advanced to the one including the current time (all the slots, at most)
+    const auto nSlots = std::min<int64_t>(
+        (now.GetTimeStep() / m_wheelGranularity.GetTimeStep()) -
+            (m_wheelTime.GetTimeStep() / m_wheelGranularity.GetTimeStep()) + 1,
+        EXPIRY_WHEEL_SIZE);
+    const auto firstSlot = GetWheelSlot(m_wheelTime);
+
+    for (int64_t i = 0; i < nSlots; ++i)
+    {
+        auto elem = m_expiryWheel[(firstSlot + i) % EXPIRY_WHEEL_SIZE];
+        while (elem)
+        {
+            auto next = elem->nextInWheel;
+            // the slot also includes the MPDUs expiring in the next rounds of the wheel
+            if (elem->expiryTime <= now)
+            {
+                auto& info = m_queues.at(GetQueueId(elem->mpdu));
+                CancelExpiry(*elem, info);
+                MarkDue(*elem, info);
+            }
+            elem = next;
+        }
+    }
+    m_wheelTime = now;
 }
 
 std::pair<WifiMacQueueContainer::iterator, WifiMacQueueContainer::iterator>
 WifiMacQueueContainer::ExtractExpiredMpdus(const WifiContainerQueueId& queueId) const
 {
-    return DoExtractExpiredMpdus(m_queues[queueId]);
+    return DoExtractExpiredMpdus(GetQueueInfo(queueId));
 }
 
 std::pair<WifiMacQueueContainer::iterator, WifiMacQueueContainer::iterator>
-WifiMacQueueContainer::DoExtractExpiredMpdus(ContainerQueue& queue) const
+WifiMacQueueContainer::DoExtractExpiredMpdus(QueueInfo& info) const
 {
+    auto& queue = info.queue;
     std::optional<std::pair<WifiMacQueueContainer::iterator, WifiMacQueueContainer::iterator>> ret;
     auto firstExpiredIt = queue.begin();
     auto lastExpiredIt = firstExpiredIt;
@@ -152,16 +309,14 @@ WifiMacQueueContainer::DoExtractExpiredMpdus(ContainerQueue& queue) const
         while (lastExpiredIt != queue.end() && lastExpiredIt->expiryTime <= now &&
                lastExpiredIt->inflights.empty())
         {
+            CancelExpiry(*lastExpiredIt, info);
             lastExpiredIt->expired = true;
             // this MPDU is no longer queued
             lastExpiredIt->ac = AC_UNDEF;
             lastExpiredIt->deleter(lastExpiredIt->mpdu);
 
-            WifiContainerQueueId queueId = GetQueueId(lastExpiredIt->mpdu);
-            auto it = m_nBytesPerQueue.find(queueId);
-            NS_ASSERT(it != m_nBytesPerQueue.end());
-            NS_ASSERT(it->second >= lastExpiredIt->mpdu->GetSize());
-            it->second -= lastExpiredIt->mpdu->GetSize();
+            NS_ASSERT(info.nBytes >= lastExpiredIt->mpdu->GetSize());
+            info.nBytes -= lastExpiredIt->mpdu->GetSize();
 
             ++lastExpiredIt;
         }
@@ -185,9 +340,16 @@ WifiMacQueueContainer::ExtractAllExpiredMpdus() const
 {
     std::optional<WifiMacQueueContainer::iterator> firstExpiredIt;
 
-    for (auto& queue : m_queues)
+    AdvanceExpiryWheel();
+
+    // only the container queues including due MPDUs may include MPDUs with expired
+    // lifetime. Extracting MPDUs modifies the list of such queues, hence iterate over
+    // a copy of the list
+    auto dueQueues = m_dueQueues;
+
+    for (auto info : dueQueues)
     {
-        auto [firstIt, lastIt] = DoExtractExpiredMpdus(queue.second);
+        auto [firstIt, lastIt] = DoExtractExpiredMpdus(*info);
 
         if (firstIt != lastIt && !firstExpiredIt)
         {
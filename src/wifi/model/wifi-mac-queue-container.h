@@ -14,9 +14,11 @@
 #include "ns3/mac48-address.h"
 
 #include <list>
+#include <memory_resource>
 #include <optional>
 #include <tuple>
 #include <unordered_map>
+#include <vector>
 
 namespace ns3
 {
@@ -99,17 +101,36 @@ namespace ns3
  *
  * This container holds multiple container queues organized in an hash table
  * whose keys are WifiContainerQueueId tuples identifying the container queues.
+ * The elements of all the container queues are allocated from a pool owned by
+ * the container, so that enqueuing and dequeuing MPDUs does not allocate memory
+ * once the pool has grown to the size of the traffic backlog.
+ *
+ * The expiry times of the MPDUs are tracked by a timer wheel shared by all the
+ * container queues: every MPDU is linked in the slot of the wheel corresponding
+ * to its expiry time (see SetExpiryTime), and it is unlinked when it leaves its
+ * container queue. The MPDUs whose expiry time is reached are marked as due, so
+ * that ExtractAllExpiredMpdus only visits the container queues including at least
+ * one due MPDU, instead of all the container queues.
  */
 class WifiMacQueueContainer
 {
   public:
     /// Type of a queue held by the container
-    using ContainerQueue = std::list<WifiMacQueueElem>;
+    using ContainerQueue = std::pmr::list<WifiMacQueueElem>;
     /// iterator over elements in a container queue
     using iterator = ContainerQueue::iterator;
     /// const iterator over elements in a container queue
     using const_iterator = ContainerQueue::const_iterator;
 
+    /**
+     * Constructor.
+     */
+    WifiMacQueueContainer();
+
+    // Delete copy constructor and assignment operator to avoid misuse
+    WifiMacQueueContainer(const WifiMacQueueContainer&) = delete;
+    WifiMacQueueContainer& operator=(const WifiMacQueueContainer&) = delete;
+
     /**
      * Erase all elements from the container.
      */
@@ -132,6 +153,17 @@ class WifiMacQueueContainer
      */
     iterator erase(const_iterator pos);
 
+    /**
+     * Set the expiry time of the MPDU included in the element pointed to by the given
+     * iterator and schedule the MPDU in the expiry timer wheel. MPDUs whose expiry time
+     * is modified without calling this method (or that are never passed to this method)
+     * are considered by ExtractAllExpiredMpdus until they leave their container queue.
+     *
+     * @param it iterator pointing to the element storing the MPDU
+     * @param expiryTime the expiry time of the MPDU
+     */
+    void SetExpiryTime(iterator it, Time expiryTime) const;
+
     /**
      * Return the WifiMpdu included in the element pointed to by the given iterator.
      *
@@ -195,21 +227,92 @@ class WifiMacQueueContainer
     std::pair<iterator, iterator> GetAllExpiredMpdus() const;
 
   private:
+    /// Information about a container queue
+    struct QueueInfo
+    {
+        /**
+         * Constructor.
+         * @param pool the pool used to allocate the elements of the container queue
+         */
+        QueueInfo(std::pmr::memory_resource* pool);
+
+        ContainerQueue queue;   //!< the container queue
+        uint32_t nBytes{0};     //!< size in bytes of the container queue
+        uint32_t nDueMpdus{0};  //!< number of MPDUs in the queue marked as due
+        std::size_t dueIndex{}; //!< index of this queue in m_dueQueues, if nDueMpdus > 0
+    };
+
+    /**
+     * Get the information about the container queue identified by the given QueueId.
+     * The container queue is created if it does not exist.
+     *
+     * @param queueId the given QueueId
+     * @return the information about the container queue
+     */
+    QueueInfo& GetQueueInfo(const WifiContainerQueueId& queueId) const;
+
     /**
      * Transfer non-inflight MPDUs with expired lifetime in the given container queue to the
      * container queue storing MPDUs with expired lifetime.
      *
-     * @param queue the given container queue
+     * @param info the information about the given container queue
      * @return the range [first, last) of iterators pointing to the MPDUs transferred
      *         to the container queue storing MPDUs with expired lifetime
      */
-    std::pair<iterator, iterator> DoExtractExpiredMpdus(ContainerQueue& queue) const;
+    std::pair<iterator, iterator> DoExtractExpiredMpdus(QueueInfo& info) const;
+
+    /**
+     * Link the given element in the slot of the expiry timer wheel corresponding to the
+     * expiry time of its MPDU, or mark the MPDU as due if its expiry time is not later
+     * than the time up to which the wheel has been advanced.
+     *
+     * @param elem the given element
+     * @param info the information about the container queue storing the element
+     */
+    void ScheduleExpiry(WifiMacQueueElem& elem, QueueInfo& info) const;
+
+    /**
+     * Unlink the given element from the expiry timer wheel or, if its MPDU is marked
+     * as due, clear the mark.
+     *
+     * @param elem the given element
+     * @param info the information about the container queue storing the element
+     */
+    void CancelExpiry(WifiMacQueueElem& elem, QueueInfo& info) const;
+
+    /**
+     * Mark the MPDU included in the given element as due.
+     *
+     * @param elem the given element
+     * @param info the information about the container queue storing the element
+     */
+    void MarkDue(WifiMacQueueElem& elem, QueueInfo& info) const;
+
+    /**
+     * Advance the expiry timer wheel to the current time, marking as due all the MPDUs
+     * whose expiry time is not later than the current time.
+     */
+    void AdvanceExpiryWheel() const;
+
+    /**
+     * @param time the given time
+     * @return the slot of the expiry timer wheel corresponding to the given time
+     */
+    std::size_t GetWheelSlot(Time time) const;
+
+    /// Number of slots of the expiry timer wheel
+    static constexpr std::size_t EXPIRY_WHEEL_SIZE = 512;
 
-    mutable std::unordered_map<WifiContainerQueueId, ContainerQueue>
+    mutable std::pmr::unsynchronized_pool_resource
+        m_pool; //!< the pool the elements of the container queues are allocated from
+    mutable std::unordered_map<WifiContainerQueueId, QueueInfo>
         m_queues;                          //!< the container queues
     mutable ContainerQueue m_expiredQueue; //!< queue storing MPDUs with expired lifetime
-    mutable std::unordered_map<WifiContainerQueueId, uint32_t>
-        m_nBytesPerQueue; //!< size in bytes of the container queues
+    mutable std::vector<WifiMacQueueElem*>
+        m_expiryWheel;                  //!< the first element linked in each slot of the wheel
+    Time m_wheelGranularity;            //!< the time span of a slot of the expiry timer wheel
+    mutable Time m_wheelTime;           //!< the time up to which the wheel has been advanced
+    mutable std::vector<QueueInfo*> m_dueQueues; //!< the container queues including due MPDUs
 };
 
 } // namespace ns3
@@ -39,12 +39,19 @@ class WifiMpdu;
 struct WifiMacQueueElem
 {
     Ptr<WifiMpdu> mpdu;                         ///< MPDU stored by this element
-    Time expiryTime{0};                         ///< expiry time of the MPDU (set by WifiMacQueue)
+    Time expiryTime{0};                         ///< expiry time of the MPDU (set by WifiMacQueue
+                                                ///< via WifiMacQueueContainer::SetExpiryTime)
     AcIndex ac{AC_UNDEF};                       ///< the Access Category associated with the queue
                                                 ///< storing this element (set by WifiMacQueue)
     bool expired{false};                        ///< whether this MPDU has been marked as expired
     std::map<uint8_t, Ptr<WifiMpdu>> inflights; ///< map of MPDUs in-flight on each link
     Callback<void, Ptr<WifiMpdu>> deleter;      ///< reset the iterator stored by the MPDU
+    bool expiryDue{false};                      ///< whether the expiry time of the MPDU may have
+                                                ///< been reached (set by WifiMacQueueContainer)
+    bool inExpiryWheel{false};                  ///< whether this element is linked in a slot of
+                                                ///< the expiry timer wheel of the container
+    WifiMacQueueElem* prevInWheel{nullptr};     ///< previous element in the same wheel slot
+    WifiMacQueueElem* nextInWheel{nullptr};     ///< next element in the same wheel slot
 
     /**
      * Constructor.
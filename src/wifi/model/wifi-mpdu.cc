@@ -75,6 +75,18 @@ WifiMpdu::CreateAlias(uint8_t linkId) const
     return alias;
 }
 
+void
+WifiMpdu::SetStationIndex(uint32_t index) const
+{
+    m_stationIndex = index;
+}
+
+std::optional<uint32_t>
+WifiMpdu::GetStationIndex() const
+{
+    return m_stationIndex;
+}
+
 WifiMpdu::OriginalInfo&
 WifiMpdu::GetOriginalInfo()
 {
@@ -20,6 +20,7 @@
 #include "ns3/simulator.h"
 
 #include <list>
+#include <memory_resource>
 #include <optional>
 #include <set>
 #include <variant>
@@ -147,7 +148,7 @@ class WifiMpdu : public SimpleRefCount<WifiMpdu>
     DeaggregatedMsdusCI end() const;
 
     /// Const iterator typedef
-    typedef std::list<WifiMacQueueElem>::iterator Iterator;
+    typedef std::pmr::list<WifiMacQueueElem>::iterator Iterator;
 
     /**
      * Set the queue iterator stored by this object.
@@ -249,6 +250,19 @@ class WifiMpdu : public SimpleRefCount<WifiMpdu>
      */
     Ptr<WifiMpdu> CreateAlias(uint8_t linkId) const;
 
+    /**
+     * Store the index of the entry of the station table of a remote station manager that
+     * corresponds to the receiver of this MPDU. The index is only a hint: the remote station
+     * manager checks that the entry matches the receiver address before using it.
+     *
+     * @param index the index of the entry of the station table
+     */
+    void SetStationIndex(uint32_t index) const;
+    /**
+     * @return the index of the entry of the station table stored in this MPDU, if any
+     */
+    std::optional<uint32_t> GetStationIndex() const;
+
     /**
      * @brief Print the item contents.
      * @param os output stream in which the data should be printed.
@@ -278,6 +292,7 @@ class WifiMpdu : public SimpleRefCount<WifiMpdu>
      * Information stored by both the original copy and the aliases
      */
     WifiMacHeader m_header; //!< Wifi MAC header associated with the packet
+    mutable std::optional<uint32_t> m_stationIndex; //!< index of the receiver station entry
 
     /**
      * Information stored by the original copy only.
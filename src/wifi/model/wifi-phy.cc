@@ -37,6 +37,8 @@
 
 #include <algorithm>
 #include <numeric>
+#include <tuple>
+#include <unordered_map>
 
 #undef NS_LOG_APPEND_CONTEXT
 #define NS_LOG_APPEND_CONTEXT                                                                      \
@@ -50,6 +52,88 @@ namespace ns3
 
 NS_LOG_COMPONENT_DEFINE("WifiPhy");
 
+/**
+ * Cache of the TX durations of non-MU PPDUs, which are fully determined by the
+ * PSDU size, the frequency band and a few parameters of the TXVECTOR.
+ */
+struct WifiPhy::TxDurationCache
+{
+    /// Key of the cache
+    struct Key
+    {
+        uint32_t size;                //!< PSDU size in bytes
+        WifiPhyBand band;             //!< frequency band
+        uint16_t staId;               //!< STA-ID
+        uint32_t modeUid;             //!< UID of the transmission mode
+        WifiPreamble preamble;        //!< preamble type
+        MHz_u channelWidth;           //!< channel width
+        int64_t guardInterval;        //!< guard interval in time steps
+        uint8_t nss;                  //!< number of spatial streams
+        uint8_t ness;                 //!< number of extension spatial streams
+        bool stbc;                    //!< whether STBC is used
+        bool ldpc;                    //!< whether LDPC is used
+        bool aggregation;             //!< whether the PSDU is an A-MPDU
+        uint8_t ehtPpduType;          //!< EHT PPDU type
+        uint16_t inactiveSubchannels; //!< bitmap of the inactive 20 MHz subchannels
+
+        /// @return the fields of the key as a tuple of references
+        auto Tie() const
+        {
+            return std::tie(size,
+                            band,
+                            staId,
+                            modeUid,
+                            preamble,
+                            channelWidth,
+                            guardInterval,
+                            nss,
+                            ness,
+                            stbc,
+                            ldpc,
+                            aggregation,
+                            ehtPpduType,
+                            inactiveSubchannels);
+        }
+
+        /**
+         * @param other the other key
+         * @return whether this key equals the other key
+         */
+        bool operator==(const Key& other) const
+        {
+            return Tie() == other.Tie();
+        }
+    };
+
+    /// Hash function of the keys of the cache
+    struct KeyHash
+    {
+        /**
+         * @param key the key
+         * @return the hash of the key
+         */
+        std::size_t operator()(const Key& key) const
+        {
+            std::size_t seed = 0;
+            std::apply(
+                [&seed](const auto&... fields) {
+                    ((seed ^= std::hash<std::decay_t<decltype(fields)>>{}(fields) + 0x9e3779b9 +
+                              (seed << 6) + (seed >> 2)),
+                     ...);
+                },
+                key.Tie());
+            return seed;
+        }
+    };
+
+    /// Maximum number of TX durations in the cache, which is cleared when it gets full
+    static constexpr std::size_t MAX_SIZE = 65536;
+
+    bool enabled{true};                               //!< whether the cache is enabled
+    std::unordered_map<Key, Time, KeyHash> durations; //!< cached TX durations
+    TxDurationCacheStats stats;                       //!< hits and misses
+};
+
 /****************************************************************
  *       The actual WifiPhy class
  ****************************************************************/
@@ -468,6 +552,13 @@ WifiPhy::GetStaticPhyEntities()
     return g_staticPhyEntities;
 }
 
+WifiPhy::TxDurationCache&
+WifiPhy::GetTxDurationCache()
+{
+    static TxDurationCache g_txDurationCache;
+    return g_txDurationCache;
+}
+
 Ptr<WifiPhyStateHelper>
 WifiPhy::GetState() const
 {
@@ -1589,9 +1680,54 @@ WifiPhy::CalculateTxDuration(uint32_t size,
                              WifiPhyBand band,
                              uint16_t staId)
 {
+    auto& cache = GetTxDurationCache();
+    if (!cache.enabled || txVector.IsMu())
+    {
+        Time duration = CalculatePhyPreambleAndHeaderDuration(txVector) +
+                        GetPayloadDuration(size, txVector, band, NORMAL_MPDU, staId);
+        NS_ASSERT(duration.IsStrictlyPositive());
+        return duration;
+    }
+
+    TxDurationCache::Key key{size,
+                             band,
+                             staId,
+                             txVector.GetMode().GetUid(),
+                             txVector.GetPreambleType(),
+                             txVector.GetChannelWidth(),
+                             txVector.GetGuardInterval().GetTimeStep(),
+                             txVector.GetNss(),
+                             txVector.GetNess(),
+                             txVector.IsStbc(),
+                             txVector.IsLdpc(),
+                             txVector.IsAggregation(),
+                             txVector.GetEhtPpduType(),
+                             0};
+    const auto& inactiveSubchannels = txVector.GetInactiveSubchannels();
+    for (std::size_t i = 0; i < inactiveSubchannels.size(); ++i)
+    {
+        if (inactiveSubchannels[i])
+        {
+            key.inactiveSubchannels |= (1 << i);
+        }
+    }
+
+    if (auto it = cache.durations.find(key); it != cache.durations.end())
+    {
+        ++cache.stats.hits;
+        return it->second;
+    }
+
     Time duration = CalculatePhyPreambleAndHeaderDuration(txVector) +
                     GetPayloadDuration(size, txVector, band, NORMAL_MPDU, staId);
     NS_ASSERT(duration.IsStrictlyPositive());
+    ++cache.stats.misses;
+    if (cache.durations.size() >= TxDurationCache::MAX_SIZE)
+    {
+        // the durations are cheap to recompute, simply start over
+        cache.durations.clear();
+    }
+    cache.durations.emplace(key, duration);
     return duration;
 }
 
@@ -1612,6 +1748,34 @@ WifiPhy::CalculateTxDuration(const WifiConstPsduMap& psduMap,
         ->CalculateTxDuration(psduMap, txVector, band);
 }
 
+void
+WifiPhy::EnableTxDurationCache(bool enable)
+{
+    auto& cache = GetTxDurationCache();
+    cache.enabled = enable;
+    if (!enable)
+    {
+        cache.durations.clear();
+    }
+}
+
+WifiPhy::TxDurationCacheStats
+WifiPhy::GetTxDurationCacheStats()
+{
+    const auto& cache = GetTxDurationCache();
+    auto stats = cache.stats;
+    stats.size = cache.durations.size();
+    return stats;
+}
+
+void
+WifiPhy::ResetTxDurationCache()
+{
+    auto& cache = GetTxDurationCache();
+    cache.durations.clear();
+    cache.stats = TxDurationCacheStats{};
+}
+
 uint32_t
 WifiPhy::GetMaxPsduSize(WifiModulationClass modulation)
 {
@@ -2243,6 +2407,30 @@ WifiPhy::NotifyCcaBusy(const Ptr<const WifiPpdu> ppdu, Time duration)
     GetLatestPhyEntity()->NotifyCcaBusy(ppdu, duration, WIFI_CHANLIST_PRIMARY);
 }
 
+bool
+WifiPhy::IsRxAbstractionEnabled() const
+{
+    return false;
+}
+
+std::vector<PhyEntity::SnrPer>
+WifiPhy::CalculateMpdusSnrPer(Ptr<Event> event,
+                              MHz_u channelWidth,
+                              const WifiSpectrumBandInfo& band,
+                              uint16_t staId,
+                              const std::vector<std::pair<Time, Time>>& mpduWindows) const
+{
+    NS_LOG_FUNCTION(this << *event << channelWidth << band << staId << mpduWindows.size());
+    std::vector<PhyEntity::SnrPer> snrPers;
+    snrPers.reserve(mpduWindows.size());
+    for (const auto& window : mpduWindows)
+    {
+        snrPers.push_back(
+            m_interference->CalculatePayloadSnrPer(event, channelWidth, band, staId, window));
+    }
+    return snrPers;
+}
+
 void
 WifiPhy::AbortCurrentReception(WifiPhyRxfailureReason reason)
 {
@@ -273,6 +273,33 @@ class WifiPhy : public Object
                                     const WifiTxVector& txVector,
                                     WifiPhyBand band);
 
+    /// Counters of the cache of TX durations
+    struct TxDurationCacheStats
+    {
+        uint64_t hits{0};    //!< number of TX durations found in the cache
+        uint64_t misses{0};  //!< number of TX durations computed and stored in the cache
+        std::size_t size{0}; //!< number of TX durations currently stored in the cache
+    };
+
+    /**
+     * Enable or disable the cache of the TX durations returned by the CalculateTxDuration
+     * variant taking the PSDU size. The cache stores the exact TX durations of non-MU PPDUs,
+     * indexed by PSDU size, frequency band and the TXVECTOR parameters that determine the
+     * TX duration. The TX duration of MU PPDUs depends on the allocations of all the users,
+     * hence it is never cached. The cache is enabled by default and disabling it clears it.
+     *
+     * @param enable whether the cache of TX durations is enabled
+     */
+    static void EnableTxDurationCache(bool enable);
+    /**
+     * @return the counters of the cache of TX durations
+     */
+    static TxDurationCacheStats GetTxDurationCacheStats();
+    /**
+     * Remove all the TX durations stored in the cache and reset its counters.
+     */
+    static void ResetTxDurationCache();
+
     /**
      * @param txVector the transmission parameters used for this packet
      *
@@ -1328,6 +1355,37 @@ class WifiPhy : public Object
      */
     void NotifyCcaBusy(const Ptr<const WifiPpdu> ppdu, Time duration);
 
+    /**
+     * Return whether the reception of the incoming PPDUs is abstracted, in which case the
+     * preamble and the PHY header fields of a PPDU are processed at once at the start of
+     * the Data field and the MPDUs of a received PSDU are all processed at the end of the
+     * PPDU, instead of scheduling an event for the end of each field and of each MPDU.
+     *
+     * @return true if the reception of the incoming PPDUs is abstracted, false otherwise
+     */
+    virtual bool IsRxAbstractionEnabled() const;
+
+    /**
+     * Calculate the SNR and the PER of each MPDU of a received PSDU when the reception of
+     * the incoming PPDUs is abstracted (\see IsRxAbstractionEnabled). This method is called
+     * once at the end of the PPDU. The default implementation computes each PER as if the
+     * MPDU was processed at its own end.
+     *
+     * @param event the event holding incoming PPDU's information
+     * @param channelWidth the channel width used to transmit the PSDU
+     * @param band the band used by the PSDU
+     * @param staId the station ID of the PSDU (only used for MU)
+     * @param mpduWindows the time window (pair of start and end times) of each MPDU, relative
+     * to the start of the PHY payload
+     * @return the SNR and the PER of each MPDU
+     */
+    virtual std::vector<PhyEntity::SnrPer> CalculateMpdusSnrPer(
+        Ptr<Event> event,
+        MHz_u channelWidth,
+        const WifiSpectrumBandInfo& band,
+        uint16_t staId,
+        const std::vector<std::pair<Time, Time>>& mpduWindows) const;
+
     /**
      * Add the PHY entity to the map of supported PHY entities for the
      * given modulation class for the WifiPhy instance.
@@ -1604,6 +1662,12 @@ class WifiPhy : public Object
      */
     static std::map<WifiModulationClass, Ptr<PhyEntity>>& GetStaticPhyEntities();
 
+    struct TxDurationCache; //!< cache of TX durations (see EnableTxDurationCache)
+    /**
+     * @return the cache of TX durations shared by all the WifiPhy instances
+     */
+    static TxDurationCache& GetTxDurationCache();
+
     WifiStandard m_standard;                    //!< WifiStandard
     WifiModulationClass m_maxModClassSupported; //!< max modulation class supported
     WifiPhyBand m_band;                         //!< WifiPhyBand
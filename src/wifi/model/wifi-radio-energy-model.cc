@@ -10,6 +10,7 @@
 
 #include "wifi-tx-current-model.h"
 
+#include "ns3/boolean.h"
 #include "ns3/energy-source.h"
 #include "ns3/log.h"
 #include "ns3/pointer.h"
@@ -71,6 +72,16 @@ WifiRadioEnergyModel::GetTypeId()
                           PointerValue(),
                           MakePointerAccessor(&WifiRadioEnergyModel::m_txCurrentModel),
                           MakePointerChecker<WifiTxCurrentModel>())
+            .AddAttribute("LazyDepletionEvent",
+                          "If true, the event switching the radio off when the energy source is "
+                          "depleted is only rescheduled when the depletion time gets earlier "
+                          "(e.g., the radio moves to a state drawing more current); when it "
+                          "expires, the remaining energy is checked and the event is rescheduled "
+                          "if the source is not depleted yet. Otherwise, the event is cancelled "
+                          "and rescheduled at every state change and energy update.",
+                          BooleanValue(false),
+                          MakeBooleanAccessor(&WifiRadioEnergyModel::m_lazyDepletionEvent),
+                          MakeBooleanChecker())
             .AddTraceSource(
                 "TotalEnergyConsumption",
                 "Total energy consumption of the radio device.",
@@ -83,7 +94,8 @@ WifiRadioEnergyModel::WifiRadioEnergyModel()
     : m_source(nullptr),
       m_currentState(WifiPhyState::IDLE),
       m_lastUpdateTime(),
-      m_nPendingChangeState(0)
+      m_nPendingChangeState(0),
+      m_lazyDepletionEvent(false)
 {
     NS_LOG_FUNCTION(this);
     m_energyDepletionCallback.Nullify();
@@ -108,12 +120,7 @@ WifiRadioEnergyModel::SetEnergySource(const Ptr<energy::EnergySource> source)
     NS_LOG_FUNCTION(this << source);
     NS_ASSERT(source);
     m_source = source;
-    m_switchToOffEvent.Cancel();
-    const auto durationToOff = GetMaximumTimeInState(m_currentState);
-    m_switchToOffEvent = Simulator::Schedule(durationToOff,
-                                             &WifiRadioEnergyModel::ChangeState,
-                                             this,
-                                             static_cast<int>(WifiPhyState::OFF));
+    ScheduleSwitchToOff(m_currentState);
 }
 
 Watt_u
@@ -292,12 +299,7 @@ WifiRadioEnergyModel::ChangeState(int newState)
 
     if (newPhyState != WifiPhyState::OFF)
     {
-        m_switchToOffEvent.Cancel();
-        const auto durationToOff = GetMaximumTimeInState(newPhyState);
-        m_switchToOffEvent = Simulator::Schedule(durationToOff,
-                                                 &WifiRadioEnergyModel::ChangeState,
-                                                 this,
-                                                 static_cast<int>(WifiPhyState::OFF));
+        ScheduleSwitchToOff(newPhyState);
     }
 
     const auto duration = Simulator::Now() - m_lastUpdateTime;
@@ -367,14 +369,58 @@ WifiRadioEnergyModel::HandleEnergyChanged()
     NS_LOG_FUNCTION(this);
     NS_LOG_DEBUG("WifiRadioEnergyModel:Energy is changed!");
     if (m_currentState != WifiPhyState::OFF)
+    {
+        ScheduleSwitchToOff(m_currentState);
+    }
+}
+
+void
+WifiRadioEnergyModel::ScheduleSwitchToOff(WifiPhyState state)
+{
+    NS_LOG_FUNCTION(this << state);
+
+    // computing the remaining time may update the energy source, which may in turn schedule
+    // a new event (see HandleEnergyChanged), hence the pending event is only cancelled afterwards
+    const auto durationToOff = GetMaximumTimeInState(state);
+
+    if (!m_lazyDepletionEvent)
     {
         m_switchToOffEvent.Cancel();
-        const auto durationToOff = GetMaximumTimeInState(m_currentState);
         m_switchToOffEvent = Simulator::Schedule(durationToOff,
                                                  &WifiRadioEnergyModel::ChangeState,
                                                  this,
                                                  static_cast<int>(WifiPhyState::OFF));
+        return;
+    }
+
+    if (m_switchToOffEvent.IsPending() &&
+        TimeStep(m_switchToOffEvent.GetTs()) <= Simulator::Now() + durationToOff)
+    {
+        NS_LOG_DEBUG("Keep the depletion check scheduled at "
+                     << TimeStep(m_switchToOffEvent.GetTs()).As(Time::S));
+        return;
+    }
+    m_switchToOffEvent.Cancel();
+    m_switchToOffEvent =
+        Simulator::Schedule(durationToOff, &WifiRadioEnergyModel::CheckEnergyDepletion, this);
+}
+
+void
+WifiRadioEnergyModel::CheckEnergyDepletion()
+{
+    NS_LOG_FUNCTION(this);
+
+    if (m_currentState == WifiPhyState::OFF)
+    {
+        return;
+    }
+    if (GetMaximumTimeInState(m_currentState).IsStrictlyPositive())
+    {
+        // the radio moved to a state drawing less current after the check was scheduled
+        ScheduleSwitchToOff(m_currentState);
+        return;
     }
+    ChangeState(static_cast<int>(WifiPhyState::OFF));
 }
 
 std::shared_ptr<WifiRadioEnergyModelPhyListener>
@@ -346,6 +346,23 @@ class WifiRadioEnergyModel : public energy::DeviceEnergyModel
      */
     void SetWifiRadioState(const WifiPhyState state);
 
+    /**
+     * Schedule the event switching the radio off when the energy source is expected
+     * to be depleted, based on the remaining energy and the current drawn in the
+     * given state. If the LazyDepletionEvent attribute is true, a pending event
+     * expiring earlier is kept and a depletion check is scheduled instead of a
+     * direct switch to the OFF state.
+     *
+     * @param state the state the radio is (or is about to be) in
+     */
+    void ScheduleSwitchToOff(WifiPhyState state);
+
+    /**
+     * Switch the radio off if the energy source is depleted, otherwise reschedule
+     * the depletion check. Used when the LazyDepletionEvent attribute is true.
+     */
+    void CheckEnergyDepletion();
+
     Ptr<energy::EnergySource> m_source; ///< energy source
 
     // Member variables for current draw in different radio modes.
@@ -375,7 +392,8 @@ class WifiRadioEnergyModel : public energy::DeviceEnergyModel
     /// WifiPhy listener
     std::shared_ptr<WifiRadioEnergyModelPhyListener> m_listener;
 
-    EventId m_switchToOffEvent; ///< switch to off event
+    EventId m_switchToOffEvent; ///< switch to off event (or depletion check)
+    bool m_lazyDepletionEvent;  ///< whether the switch to off event is rescheduled lazily
 };
 
 } // namespace ns3
@@ -31,6 +31,8 @@
 #include "ns3/uinteger.h"
 #include "ns3/vht-configuration.h"
 
+#include <bit>
+
 namespace ns3
 {
 
@@ -577,10 +579,9 @@ WifiRemoteStationManager::SetPsMode(const Mac48Address& address, bool isInPsMode
 std::optional<Mac48Address>
 WifiRemoteStationManager::GetMldAddress(const Mac48Address& address) const
 {
-    if (auto stateIt = m_states.find(address);
-        stateIt != m_states.end() && stateIt->second->m_mleCommonInfo)
+    if (auto index = FindStation(address); index && m_stationTable[*index].state->m_mleCommonInfo)
     {
-        return stateIt->second->m_mleCommonInfo->m_mldMacAddress;
+        return m_stationTable[*index].state->m_mleCommonInfo->m_mldMacAddress;
     }
 
     return std::nullopt;
@@ -589,22 +590,53 @@ WifiRemoteStationManager::GetMldAddress(const Mac48Address& address) const
 std::optional<Mac48Address>
 WifiRemoteStationManager::GetAffiliatedStaAddress(const Mac48Address& mldAddress) const
 {
-    auto stateIt = m_states.find(mldAddress);
+    auto index = FindStation(mldAddress);
 
-    if (stateIt == m_states.end() || !stateIt->second->m_mleCommonInfo)
+    if (!index || !m_stationTable[*index].state->m_mleCommonInfo)
     {
         // MLD address not found
         return std::nullopt;
     }
 
-    NS_ASSERT(stateIt->second->m_mleCommonInfo->m_mldMacAddress == mldAddress);
-    return stateIt->second->m_address;
+    const auto& state = m_stationTable[*index].state;
+    NS_ASSERT(state->m_mleCommonInfo->m_mldMacAddress == mldAddress);
+    return state->m_address;
+}
+
+WifiRemoteStationManager::StationIndex
+WifiRemoteStationManager::GetStationIndex(const Mac48Address& address) const
+{
+    NS_LOG_FUNCTION(this << address);
+    if (auto index = FindStation(address))
+    {
+        return *index;
+    }
+    return AddStation(address, CreateState(address));
 }
 
 WifiTxVector
 WifiRemoteStationManager::GetDataTxVector(const WifiMacHeader& header, MHz_u allowedWidth)
 {
-    NS_LOG_FUNCTION(this << header << allowedWidth);
+    return GetDataTxVector(header, allowedWidth, std::nullopt);
+}
+
+WifiTxVector
+WifiRemoteStationManager::GetDataTxVector(Ptr<const WifiMpdu> mpdu, MHz_u allowedWidth)
+{
+    const auto& header = mpdu->GetHeader();
+    if (header.IsMgt() || header.GetAddr1().IsGroup())
+    {
+        return GetDataTxVector(header, allowedWidth, std::nullopt);
+    }
+    return GetDataTxVector(header, allowedWidth, GetStationIndex(mpdu));
+}
+
+WifiTxVector
+WifiRemoteStationManager::GetDataTxVector(const WifiMacHeader& header,
+                                          MHz_u allowedWidth,
+                                          std::optional<StationIndex> index)
+{
+    NS_LOG_FUNCTION(this << header << allowedWidth << index.has_value());
     const auto address = header.GetAddr1();
     if (!header.IsMgt() && address.IsGroup())
     {
@@ -642,7 +674,7 @@ WifiRemoteStationManager::GetDataTxVector(const WifiMacHeader& header, MHz_u all
     }
     else
     {
-        txVector = DoGetDataTxVector(Lookup(address), allowedWidth);
+        txVector = DoGetDataTxVector(index ? Lookup(*index) : Lookup(address), allowedWidth);
         txVector.SetLdpc(txVector.GetMode().GetModulationClass() < WIFI_MOD_CLASS_HT
                              ? false
                              : UseLdpcForDestination(address));
@@ -996,7 +1028,7 @@ WifiRemoteStationManager::ReportDataFailed(Ptr<const WifiMpdu> mpdu)
         m_ssrc[ac]++;
     }
     m_macTxDataFailed(mpdu->GetHeader().GetAddr1());
-    DoReportDataFailed(Lookup(mpdu->GetHeader().GetAddr1()));
+    DoReportDataFailed(Lookup(GetStationIndex(mpdu)));
 }
 
 void
@@ -1025,7 +1057,7 @@ WifiRemoteStationManager::ReportDataOk(Ptr<const WifiMpdu> mpdu,
     NS_LOG_FUNCTION(this << *mpdu << ackSnr << ackMode << dataSnr << dataTxVector);
     const WifiMacHeader& hdr = mpdu->GetHeader();
     NS_ASSERT(!hdr.GetAddr1().IsGroup());
-    WifiRemoteStation* station = Lookup(hdr.GetAddr1());
+    WifiRemoteStation* station = Lookup(GetStationIndex(mpdu));
     AcIndex ac = QosUtilsMapTidToAc((hdr.IsQosData()) ? hdr.GetQosTid() : 0);
     bool longMpdu = (mpdu->GetSize() > m_rtsCtsThreshold);
     if (longMpdu)
@@ -1064,7 +1096,7 @@ WifiRemoteStationManager::ReportFinalDataFailed(Ptr<const WifiMpdu> mpdu)
 {
     NS_LOG_FUNCTION(this << *mpdu);
     NS_ASSERT(!mpdu->GetHeader().GetAddr1().IsGroup());
-    WifiRemoteStation* station = Lookup(mpdu->GetHeader().GetAddr1());
+    WifiRemoteStation* station = Lookup(GetStationIndex(mpdu));
     AcIndex ac =
         QosUtilsMapTidToAc((mpdu->GetHeader().IsQosData()) ? mpdu->GetHeader().GetQosTid() : 0);
     station->m_state->m_info.NotifyTxFailed();
@@ -1465,18 +1497,101 @@ WifiRemoteStationManager::GetMostRecentRssi(Mac48Address address) const
     return std::nullopt;
 }
 
+std::size_t
+WifiRemoteStationManager::GetStationSlot(const Mac48Address& address) const
+{
+    uint8_t buffer[6];
+    address.CopyTo(buffer);
+    uint64_t key = 0;
+    for (const auto byte : buffer)
+    {
+        key = (key << 8) | byte;
+    }
+    // Fibonacci hashing: the most significant bits of the product depend on all the bits of
+    // the address, hence they are used to index the hash table
+    return (key * 0x9E3779B97F4A7C15ULL) >> (64 - std::countr_zero(m_stationSlots.size()));
+}
+
+std::optional<std::size_t>
+WifiRemoteStationManager::FindStation(const Mac48Address& address) const
+{
+    if (m_lastStation < m_stationTable.size() && m_stationTable[m_lastStation].address == address)
+    {
+        return m_lastStation;
+    }
+
+    if (m_stationSlots.empty())
+    {
+        return std::nullopt;
+    }
+
+    const auto mask = m_stationSlots.size() - 1;
+    for (auto slot = GetStationSlot(address);; slot = (slot + 1) & mask)
+    {
+        const auto index = m_stationSlots[slot];
+        if (index == 0)
+        {
+            return std::nullopt;
+        }
+        if (m_stationTable[index - 1].address == address)
+        {
+            m_lastStation = index - 1;
+            return m_lastStation;
+        }
+    }
+}
+
+std::size_t
+WifiRemoteStationManager::AddStation(const Mac48Address& address,
+                                     std::shared_ptr<WifiRemoteStationState> state) const
+{
+    NS_ASSERT_MSG(!FindStation(address), "Station " << address << " is already known");
+
+    auto insertSlot = [this](std::size_t index) {
+        const auto mask = m_stationSlots.size() - 1;
+        auto slot = GetStationSlot(m_stationTable[index].address);
+        while (m_stationSlots[slot] != 0)
+        {
+            slot = (slot + 1) & mask;
+        }
+        m_stationSlots[slot] = index + 1;
+    };
+
+    // keep the load factor of the hash table below one half
+    if (2 * (m_stationTable.size() + 1) > m_stationSlots.size())
+    {
+        m_stationSlots.assign(std::max<std::size_t>(16, 2 * m_stationSlots.size()), 0);
+        for (std::size_t index = 0; index < m_stationTable.size(); ++index)
+        {
+            insertSlot(index);
+        }
+    }
+
+    m_stationTable.push_back({address, std::move(state)});
+    insertSlot(m_stationTable.size() - 1);
+    return m_stationTable.size() - 1;
+}
+
 std::shared_ptr<WifiRemoteStationState>
 WifiRemoteStationManager::LookupState(Mac48Address address) const
 {
     NS_LOG_FUNCTION(this << address);
-    auto stateIt = m_states.find(address);
 
-    if (stateIt != m_states.end())
+    if (auto index = FindStation(address))
     {
         NS_LOG_DEBUG("WifiRemoteStationManager::LookupState returning existing state");
-        return stateIt->second;
+        return m_stationTable[*index].state;
     }
 
+    auto state = CreateState(address);
+    AddStation(address, state);
+    NS_LOG_DEBUG("WifiRemoteStationManager::LookupState returning new state");
+    return state;
+}
+
+std::shared_ptr<WifiRemoteStationState>
+WifiRemoteStationManager::CreateState(Mac48Address address) const
+{
     auto state = std::make_shared<WifiRemoteStationState>();
     state->m_state = WifiRemoteStationState::BRAND_NEW;
     state->m_address = address;
@@ -1498,8 +1613,6 @@ WifiRemoteStationManager::LookupState(Mac48Address address) const
     state->m_aggregation = false;
     state->m_qosSupported = false;
     state->m_isInPsMode = false;
-    const_cast<WifiRemoteStationManager*>(this)->m_states.insert({address, state});
-    NS_LOG_DEBUG("WifiRemoteStationManager::LookupState returning new state");
     return state;
 }
 
@@ -1509,20 +1622,44 @@ WifiRemoteStationManager::Lookup(Mac48Address address) const
     NS_LOG_FUNCTION(this << address);
     NS_ASSERT(!address.IsGroup());
     NS_ASSERT(address != m_wifiMac->GetAddress());
-    auto stationIt = m_stations.find(address);
+    return Lookup(GetStationIndex(address));
+}
 
-    if (stationIt != m_stations.end())
+WifiRemoteStation*
+WifiRemoteStationManager::Lookup(StationIndex index) const
+{
+    NS_ASSERT(index < m_stationTable.size());
+    auto& entry = m_stationTable[index];
+    m_lastStation = index;
+
+    if (entry.station)
     {
-        return stationIt->second;
+        return entry.station;
     }
 
     WifiRemoteStation* station = DoCreateStation();
-    station->m_state = LookupState(address).get();
+    station->m_state = entry.state.get();
     station->m_rssiAndUpdateTimePair = std::make_pair(dBm_u{0}, Seconds(0));
-    const_cast<WifiRemoteStationManager*>(this)->m_stations.insert({address, station});
+    entry.station = station;
     return station;
 }
 
+WifiRemoteStationManager::StationIndex
+WifiRemoteStationManager::GetStationIndex(Ptr<const WifiMpdu> mpdu) const
+{
+    const auto& address = mpdu->GetHeader().GetAddr1();
+    if (auto index = mpdu->GetStationIndex();
+        index && *index < m_stationTable.size() && m_stationTable[*index].address == address)
+    {
+        return *index;
+    }
+    NS_ASSERT(!address.IsGroup());
+    NS_ASSERT(address != m_wifiMac->GetAddress());
+    auto index = GetStationIndex(address);
+    mpdu->SetStationIndex(index);
+    return index;
+}
+
 void
 WifiRemoteStationManager::SetAssociationId(Mac48Address remoteAddress, uint16_t aid)
 {
@@ -1701,9 +1838,11 @@ WifiRemoteStationManager::AddStationMleCommonInfo(
     NS_LOG_FUNCTION(this << from);
     auto state = LookupState(from);
     state->m_mleCommonInfo = mleCommonInfo;
-    // insert another entry in m_states indexed by the MLD address and pointing to the same state
-    const_cast<WifiRemoteStationManager*>(this)->m_states.insert(
-        {mleCommonInfo->m_mldMacAddress, state});
+    // add another entry to the station table for the MLD address, pointing to the same state
+    if (!FindStation(mleCommonInfo->m_mldMacAddress))
+    {
+        AddStation(mleCommonInfo->m_mldMacAddress, state);
+    }
 }
 
 Ptr<const HtCapabilities>
@@ -1831,12 +1970,13 @@ void
 WifiRemoteStationManager::Reset()
 {
     NS_LOG_FUNCTION(this);
-    m_states.clear();
-    for (auto& state : m_stations)
+    for (auto& entry : m_stationTable)
     {
-        delete (state.second);
+        delete entry.station;
     }
-    m_stations.clear();
+    m_stationTable.clear();
+    m_stationSlots.clear();
+    m_lastStation = 0;
     m_bssBasicRateSet.clear();
     m_bssBasicMcsSet.clear();
     m_ssrc.fill(0);
@@ -2374,9 +2514,9 @@ WifiRemoteStationManager::GetEmlsrSupported(const Mac48Address& address) const
 bool
 WifiRemoteStationManager::GetEmlsrEnabled(const Mac48Address& address) const
 {
-    if (auto stateIt = m_states.find(address); stateIt != m_states.cend())
+    if (auto index = FindStation(address))
     {
-        return stateIt->second->m_emlsrEnabled;
+        return m_stationTable[*index].state->m_emlsrEnabled;
     }
     return false;
 }
@@ -31,6 +31,7 @@
 #include <memory>
 #include <optional>
 #include <unordered_map>
+#include <vector>
 
 namespace ns3
 {
@@ -153,14 +154,10 @@ class WifiRemoteStationManager : public Object
     };
 
     /**
-     * A map of WifiRemoteStations with Mac48Address as key
+     * Index of an entry of the table of known stations. The index of the entry corresponding
+     * to a station does not change until the station manager is reset.
      */
-    using Stations = std::unordered_map<Mac48Address, WifiRemoteStation*, WifiAddressHash>;
-    /**
-     * A map of WifiRemoteStationStates with Mac48Address as key
-     */
-    using StationStates =
-        std::unordered_map<Mac48Address, std::shared_ptr<WifiRemoteStationState>, WifiAddressHash>;
+    using StationIndex = uint32_t;
 
     /**
      * Set up PHY associated with this device since it is the object that
@@ -858,12 +855,33 @@ class WifiRemoteStationManager : public Object
      */
     std::optional<Mac48Address> GetAffiliatedStaAddress(const Mac48Address& mldAddress) const;
 
+    /**
+     * Return the index of the entry of the table of known stations corresponding to the
+     * given address, adding an entry if the station is not known yet. MAC layers can store
+     * the index (e.g., in an MPDU, via WifiMpdu::SetStationIndex) to spare the search of the
+     * table on the per-frame paths.
+     *
+     * @param address the address of the station
+     * @return the index of the entry corresponding to the address
+     */
+    StationIndex GetStationIndex(const Mac48Address& address) const;
+
     /**
      * @param header MAC header
      * @param allowedWidth the allowed width to send this packet
      * @return the TXVECTOR to use to send this packet
      */
     WifiTxVector GetDataTxVector(const WifiMacHeader& header, MHz_u allowedWidth);
+    /**
+     * Same as GetDataTxVector(const WifiMacHeader&, MHz_u), except that the recipient of
+     * an individually addressed Data frame is looked up through the station index stored
+     * in the given MPDU, which is stored in the MPDU if not present yet.
+     *
+     * @param mpdu the MPDU to send
+     * @param allowedWidth the allowed width to send the MPDU
+     * @return the TXVECTOR to use to send the MPDU
+     */
+    WifiTxVector GetDataTxVector(Ptr<const WifiMpdu> mpdu, MHz_u allowedWidth);
     /**
      * @param address remote address
      * @param allowedWidth the allowed width for the data frame being protected
@@ -1480,6 +1498,51 @@ class WifiRemoteStationManager : public Object
                                        MHz_u dataChannelWidth,
                                        uint8_t dataNss);
 
+    /**
+     * Return the index of the entry of the station table corresponding to the given address,
+     * if any. The address of the entry returned by the last successful search is compared
+     * first, given that consecutive searches are likely to concern the same station (e.g.,
+     * the TX vector is selected and the TX outcome is reported for the same recipient).
+     *
+     * @param address the address of the station
+     * @return the index of the entry corresponding to the address, if any
+     */
+    std::optional<std::size_t> FindStation(const Mac48Address& address) const;
+    /**
+     * Return the index of the entry of the station table corresponding to the receiver of
+     * the given MPDU. The index stored in the MPDU is used if it refers to the entry of the
+     * receiver (MPDUs may be handled by the station managers of distinct links); otherwise,
+     * the index is obtained from the address of the receiver and stored in the MPDU.
+     *
+     * @param mpdu the given MPDU
+     * @return the index of the entry corresponding to the receiver of the MPDU
+     */
+    StationIndex GetStationIndex(Ptr<const WifiMpdu> mpdu) const;
+    /**
+     * Add an entry to the station table for the given address, which must not be already
+     * present in the table.
+     *
+     * @param address the address of the station
+     * @param state the state of the station
+     * @return the index of the added entry
+     */
+    std::size_t AddStation(const Mac48Address& address,
+                           std::shared_ptr<WifiRemoteStationState> state) const;
+    /**
+     * Return the slot of the open addressing hash table in which the search for the given
+     * address starts.
+     *
+     * @param address the address of the station
+     * @return the slot in which the search starts
+     */
+    std::size_t GetStationSlot(const Mac48Address& address) const;
+    /**
+     * Create a new state for the station associated with the given address.
+     *
+     * @param address the address of the station
+     * @return the new state
+     */
+    std::shared_ptr<WifiRemoteStationState> CreateState(Mac48Address address) const;
     /**
      * Return the state of the station associated with the given address.
      *
@@ -1495,6 +1558,25 @@ class WifiRemoteStationManager : public Object
      * @return WifiRemoteStation corresponding to the address
      */
     WifiRemoteStation* Lookup(Mac48Address address) const;
+    /**
+     * Return the station corresponding to the given entry of the station table.
+     *
+     * @param index the index of the entry of the station table
+     * @return WifiRemoteStation corresponding to the entry
+     */
+    WifiRemoteStation* Lookup(StationIndex index) const;
+    /**
+     * Implementation of the GetDataTxVector variants.
+     *
+     * @param header MAC header
+     * @param allowedWidth the allowed width to send this packet
+     * @param index the index of the entry of the station table corresponding to the receiver
+     *              of an individually addressed Data frame, if known
+     * @return the TXVECTOR to use to send this packet
+     */
+    WifiTxVector GetDataTxVector(const WifiMacHeader& header,
+                                 MHz_u allowedWidth,
+                                 std::optional<StationIndex> index);
 
     /**
      * Actually sets the fragmentation threshold, it also checks the validity of
@@ -1547,8 +1629,27 @@ class WifiRemoteStationManager : public Object
     WifiModeList m_bssBasicRateSet; //!< basic rate set
     WifiModeList m_bssBasicMcsSet;  //!< basic MCS set
 
-    StationStates m_states; //!< States of known stations
-    Stations m_stations;    //!< Information for each known stations
+    /// An entry of the table of known stations
+    struct StationEntry
+    {
+        Mac48Address address;                          //!< the address of the station
+        std::shared_ptr<WifiRemoteStationState> state; //!< the state of the station
+        WifiRemoteStation* station{nullptr};           //!< the station, created on first use
+    };
+
+    /**
+     * Known stations. Entries are never removed (until the station manager is reset), hence
+     * the index of an entry does not change. The state of an MLD is referred to by an entry
+     * for each of the affiliated STA address and the MLD address.
+     */
+    mutable std::vector<StationEntry> m_stationTable;
+    /**
+     * Open addressing (with linear probing) hash table mapping the address of a station to
+     * the index of the corresponding entry in the station table. Each slot stores the index
+     * of the entry plus one, or zero if the slot is empty. The size is a power of two.
+     */
+    mutable std::vector<uint32_t> m_stationSlots;
+    mutable std::size_t m_lastStation{0}; //!< index of the entry returned by the last search
 
     uint32_t m_maxSsrc;                //!< Maximum STA short retry count (SSRC)
     uint32_t m_maxSlrc;                //!< Maximum STA long retry count (SLRC)
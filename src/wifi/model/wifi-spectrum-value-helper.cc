@@ -79,6 +79,113 @@ operator<(const WifiSpectrumModelId& lhs, const WifiSpectrumModelId& rhs)
 static std::map<WifiSpectrumModelId, Ptr<SpectrumModel>>
     g_wifiSpectrumModelMap; ///< static initializer for the class
 
+/// Transmit PSDs created by WifiSpectrumValueHelper
+enum class WifiTxPsdType : uint8_t
+{
+    DSSS = 0,
+    OFDM,
+    DUPLICATED_20MHZ,
+    HT_OFDM,
+    HE_OFDM,
+    HE_MU_OFDM
+};
+
+/// Key identifying a transmit PSD: the type of the PSD followed by its parameters
+using WifiTxPsdKey = std::vector<double>;
+
+static std::map<WifiTxPsdKey, Ptr<SpectrumValue>>
+    g_wifiTxPsdMap; ///< shared transmit PSD templates
+
+/// Maximum number of transmit PSD templates (the templates are discarded once reached)
+static const std::size_t WIFI_TX_PSD_MAP_MAX_SIZE = 256;
+
+/**
+ * Append a parameter of a transmit PSD to the key of the PSD.
+ * @param key the key
+ * @param value the parameter
+ */
+static void
+AppendToTxPsdKey(WifiTxPsdKey& key, double value)
+{
+    key.push_back(value);
+}
+
+/**
+ * Append a parameter of a transmit PSD to the key of the PSD.
+ * @tparam T the type of the elements of the parameter
+ * @param key the key
+ * @param values the parameter
+ */
+template <typename T>
+static void
+AppendToTxPsdKey(WifiTxPsdKey& key, const std::vector<T>& values)
+{
+    key.push_back(values.size());
+    for (const auto& value : values)
+    {
+        if constexpr (std::is_same_v<T, WifiSpectrumBandIndices>)
+        {
+            key.push_back(value.first);
+            key.push_back(value.second);
+        }
+        else
+        {
+            key.push_back(value);
+        }
+    }
+}
+
+/**
+ * @tparam Args the types of the parameters
+ * @param type the type of the transmit PSD
+ * @param args the parameters of the transmit PSD
+ * @return the key of the transmit PSD
+ */
+template <typename... Args>
+static WifiTxPsdKey
+GetTxPsdKey(WifiTxPsdType type, const Args&... args)
+{
+    WifiTxPsdKey key{static_cast<double>(type)};
+    (AppendToTxPsdKey(key, args), ...);
+    return key;
+}
+
+/**
+ * @param key the key of a transmit PSD
+ * @return the template of the transmit PSD, if any, or a null pointer otherwise
+ */
+static Ptr<SpectrumValue>
+LookupTxPsd(const WifiTxPsdKey& key)
+{
+    if (auto it = g_wifiTxPsdMap.find(key); it != g_wifiTxPsdMap.cend())
+    {
+        NS_LOG_LOGIC("Found transmit PSD template");
+        return it->second;
+    }
+    return nullptr;
+}
+
+/**
+ * Store a newly created transmit PSD as the template for the given key. The span of the
+ * PSD is trimmed to its non-zero values, so that the bands out of the occupied channel
+ * are not processed by the operations on its copies. The PSD is shared by all the callers
+ * requesting it, which must copy it before modifying it.
+ * @param key the key of the transmit PSD
+ * @param psd the transmit PSD
+ * @return the transmit PSD
+ */
+static Ptr<SpectrumValue>
+StoreTxPsd(WifiTxPsdKey&& key, Ptr<SpectrumValue> psd)
+{
+    psd->TrimSpan();
+    if (g_wifiTxPsdMap.size() >= WIFI_TX_PSD_MAP_MAX_SIZE)
+    {
+        g_wifiTxPsdMap.clear();
+    }
+    g_wifiTxPsdMap.emplace(std::move(key), psd);
+    return psd;
+}
+
 Ptr<SpectrumModel>
 WifiSpectrumValueHelper::GetSpectrumModel(const std::vector<MHz_u>& centerFrequencies,
                                           MHz_u channelWidth,
@@ -162,6 +269,11 @@ WifiSpectrumValueHelper::CreateDsssTxPowerSpectralDensity(MHz_u centerFrequency,
                                                           MHz_u guardBandwidth)
 {
     NS_LOG_FUNCTION(centerFrequency << txPower << +guardBandwidth);
+    auto key = GetTxPsdKey(WifiTxPsdType::DSSS, centerFrequency, txPower, guardBandwidth);
+    if (auto psd = LookupTxPsd(key))
+    {
+        return psd;
+    }
     MHz_u channelWidth{22}; // DSSS channels are 22 MHz wide
     Hz_u carrierSpacing{312500};
     Ptr<SpectrumValue> c = Create<SpectrumValue>(
@@ -182,7 +294,7 @@ WifiSpectrumValueHelper::CreateDsssTxPowerSpectralDensity(MHz_u centerFrequency,
             *vit = psd;
         }
     }
-    return c;
+    return StoreTxPsd(std::move(key), c);
 }
 
 Ptr<SpectrumValue>
@@ -196,6 +308,18 @@ WifiSpectrumValueHelper::CreateOfdmTxPowerSpectralDensity(MHz_u centerFrequency,
 {
     NS_LOG_FUNCTION(centerFrequency << channelWidth << txPower << guardBandwidth << minInnerBand
                                     << minOuterBand << lowestPoint);
+    auto key = GetTxPsdKey(WifiTxPsdType::OFDM,
+                           centerFrequency,
+                           channelWidth,
+                           txPower,
+                           guardBandwidth,
+                           minInnerBand,
+                           minOuterBand,
+                           lowestPoint);
+    if (auto psd = LookupTxPsd(key))
+    {
+        return psd;
+    }
     Hz_u carrierSpacing{0};
     uint32_t innerSlopeWidth = 0;
     switch (static_cast<uint16_t>(channelWidth))
@@ -255,7 +379,7 @@ WifiSpectrumValueHelper::CreateOfdmTxPowerSpectralDensity(MHz_u centerFrequency,
                               lowestPoint);
     NormalizeSpectrumMask(c, txPower);
     NS_ASSERT_MSG(std::abs(txPower - Integral(*c)) < 1e-6, "Power allocation failed");
-    return c;
+    return StoreTxPsd(std::move(key), c);
 }
 
 Ptr<SpectrumValue>
@@ -276,6 +400,19 @@ WifiSpectrumValueHelper::CreateDuplicated20MhzTxPowerSpectralDensity(
     NS_LOG_FUNCTION(printFrequencies(centerFrequencies)
                     << channelWidth << txPower << guardBandwidth << minInnerBand << minOuterBand
                     << lowestPoint);
+    auto key = GetTxPsdKey(WifiTxPsdType::DUPLICATED_20MHZ,
+                           centerFrequencies,
+                           channelWidth,
+                           txPower,
+                           guardBandwidth,
+                           minInnerBand,
+                           minOuterBand,
+                           lowestPoint,
+                           puncturedSubchannels);
+    if (auto psd = LookupTxPsd(key))
+    {
+        return psd;
+    }
     const Hz_u carrierSpacing{312500};
     Ptr<SpectrumValue> c = Create<SpectrumValue>(
         GetSpectrumModel(centerFrequencies, channelWidth, carrierSpacing, guardBandwidth));
@@ -361,7 +498,7 @@ WifiSpectrumValueHelper::CreateDuplicated20MhzTxPowerSpectralDensity(
                               puncturedSlopeWidth);
     NormalizeSpectrumMask(c, txPower);
     NS_ASSERT_MSG(std::abs(txPower - Integral(*c)) < 1e-6, "Power allocation failed");
-    return c;
+    return StoreTxPsd(std::move(key), c);
 }
 
 Ptr<SpectrumValue>
@@ -381,6 +518,18 @@ WifiSpectrumValueHelper::CreateHtOfdmTxPowerSpectralDensity(
     NS_LOG_FUNCTION(printFrequencies(centerFrequencies)
                     << channelWidth << txPower << guardBandwidth << minInnerBand << minOuterBand
                     << lowestPoint);
+    auto key = GetTxPsdKey(WifiTxPsdType::HT_OFDM,
+                           centerFrequencies,
+                           channelWidth,
+                           txPower,
+                           guardBandwidth,
+                           minInnerBand,
+                           minOuterBand,
+                           lowestPoint);
+    if (auto psd = LookupTxPsd(key))
+    {
+        return psd;
+    }
     const Hz_u carrierSpacing{312500};
     Ptr<SpectrumValue> c = Create<SpectrumValue>(
         GetSpectrumModel(centerFrequencies, channelWidth, carrierSpacing, guardBandwidth));
@@ -451,7 +600,7 @@ WifiSpectrumValueHelper::CreateHtOfdmTxPowerSpectralDensity(
                               lowestPoint);
     NormalizeSpectrumMask(c, txPower);
     NS_ASSERT_MSG(std::abs(txPower - Integral(*c)) < 1e-6, "Power allocation failed");
-    return c;
+    return StoreTxPsd(std::move(key), c);
 }
 
 Ptr<SpectrumValue>
@@ -492,6 +641,19 @@ WifiSpectrumValueHelper::CreateHeOfdmTxPowerSpectralDensity(
     NS_LOG_FUNCTION(printFrequencies(centerFrequencies)
                     << channelWidth << txPower << guardBandwidth << minInnerBand << minOuterBand
                     << lowestPoint);
+    auto key = GetTxPsdKey(WifiTxPsdType::HE_OFDM,
+                           centerFrequencies,
+                           channelWidth,
+                           txPower,
+                           guardBandwidth,
+                           minInnerBand,
+                           minOuterBand,
+                           lowestPoint,
+                           puncturedSubchannels);
+    if (auto psd = LookupTxPsd(key))
+    {
+        return psd;
+    }
     const Hz_u carrierSpacing{78125};
     Ptr<SpectrumValue> c = Create<SpectrumValue>(
         GetSpectrumModel(centerFrequencies, channelWidth, carrierSpacing, guardBandwidth));
@@ -643,7 +805,7 @@ WifiSpectrumValueHelper::CreateHeOfdmTxPowerSpectralDensity(
                               puncturedSlopeWidth);
     NormalizeSpectrumMask(c, txPower);
     NS_ASSERT_MSG(std::abs(txPower - Integral(*c)) < 1e-6, "Power allocation failed");
-    return c;
+    return StoreTxPsd(std::move(key), c);
 }
 
 Ptr<SpectrumValue>
@@ -664,6 +826,16 @@ WifiSpectrumValueHelper::CreateHeMuOfdmTxPowerSpectralDensity(
     };
     NS_LOG_FUNCTION(printFrequencies(centerFrequencies)
                     << channelWidth << txPower << guardBandwidth << printRuIndices(ru));
+    auto key = GetTxPsdKey(WifiTxPsdType::HE_MU_OFDM,
+                           centerFrequencies,
+                           channelWidth,
+                           txPower,
+                           guardBandwidth,
+                           ru);
+    if (auto psd = LookupTxPsd(key))
+    {
+        return psd;
+    }
     const Hz_u carrierSpacing{78125};
     Ptr<SpectrumValue> c = Create<SpectrumValue>(
         GetSpectrumModel(centerFrequencies, channelWidth, carrierSpacing, guardBandwidth));
@@ -686,7 +858,7 @@ WifiSpectrumValueHelper::CreateHeMuOfdmTxPowerSpectralDensity(
         *vit = allocated ? psd : 0.0;
     }
 
-    return c;
+    return StoreTxPsd(std::move(key), c);
 }
 
 void
@@ -1094,11 +1266,7 @@ WifiSpectrumValueHelper::NormalizeSpectrumMask(Ptr<SpectrumValue> c, Watt_u txPo
     double invNormalizationRatio = txPower / currentTxPower;
     NS_LOG_LOGIC("Current power: " << currentTxPower << "W vs expected power: " << txPower << "W"
                                    << " -> ratio (C/E) = " << normalizationRatio);
-    auto vit = c->ValuesBegin();
-    for (size_t i = 0; i < c->GetSpectrumModel()->GetNumBands(); i++, vit++)
-    {
-        *vit = (*vit) * invNormalizationRatio;
-    }
+    (*c) *= invNormalizationRatio;
 }
 
 Watt_u
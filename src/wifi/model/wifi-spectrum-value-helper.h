@@ -31,6 +31,12 @@ using WifiSpectrumBandIndices = std::pair<uint32_t, uint32_t>;
  *  This class defines all functions to create a spectrum model for
  *  Wi-Fi based on a a spectral model aligned with an OFDM subcarrier
  *  spacing of 312.5 KHz (model also reused for DSSS modulations)
+ *
+ *  The transmit power spectral densities are computed once per set of
+ *  parameters and the same SpectrumValue is returned by all the calls
+ *  with these parameters. Hence, the returned SpectrumValue must not be
+ *  modified; callers that need to modify it must work on a copy (see
+ *  SpectrumValue::Copy).
  */
 class WifiSpectrumValueHelper
 {
@@ -69,7 +75,7 @@ class WifiSpectrumValueHelper
      * @param centerFrequency center frequency
      * @param txPower transmit power to allocate
      * @param guardBandwidth width of the guard band
-     * @returns a pointer to a newly allocated SpectrumValue representing the DSSS Transmit Power
+     * @returns a pointer to a shared SpectrumValue representing the DSSS Transmit Power
      * Spectral Density in W/Hz
      */
     static Ptr<SpectrumValue> CreateDsssTxPowerSpectralDensity(MHz_u centerFrequency,
@@ -88,7 +94,7 @@ class WifiSpectrumValueHelper
      * @param minInnerBand the minimum relative power in the inner band
      * @param minOuterband the minimum relative power in the outer band
      * @param lowestPoint maximum relative power of the outermost subcarriers of the guard band
-     * @return a pointer to a newly allocated SpectrumValue representing the OFDM Transmit Power
+     * @return a pointer to a shared SpectrumValue representing the OFDM Transmit Power
      * Spectral Density in W/Hz for each Band
      */
     static Ptr<SpectrumValue> CreateOfdmTxPowerSpectralDensity(MHz_u centerFrequency,
@@ -111,7 +117,7 @@ class WifiSpectrumValueHelper
      * @param minOuterband the minimum relative power in the outer band
      * @param lowestPoint maximum relative power of the outermost subcarriers of the guard band
      * @param puncturedSubchannels bitmap indicating whether a 20 MHz subchannel is punctured or not
-     * @return a pointer to a newly allocated SpectrumValue representing the duplicated 20 MHz OFDM
+     * @return a pointer to a shared SpectrumValue representing the duplicated 20 MHz OFDM
      * Transmit Power Spectral Density in W/Hz for each Band
      */
     static Ptr<SpectrumValue> CreateDuplicated20MhzTxPowerSpectralDensity(
@@ -136,7 +142,7 @@ class WifiSpectrumValueHelper
      * @param minInnerBand the minimum relative power in the inner band
      * @param minOuterband the minimum relative power in the outer band
      * @param lowestPoint maximum relative power of the outermost subcarriers of the guard band
-     * @return a pointer to a newly allocated SpectrumValue representing the HT OFDM Transmit Power
+     * @return a pointer to a shared SpectrumValue representing the HT OFDM Transmit Power
      * Spectral Density in W/Hz for each Band
      */
     static Ptr<SpectrumValue> CreateHtOfdmTxPowerSpectralDensity(
@@ -161,7 +167,7 @@ class WifiSpectrumValueHelper
      * @param minOuterband the minimum relative power in the outer band
      * @param lowestPoint maximum relative power of the outermost subcarriers of the guard band
      * @param puncturedSubchannels bitmap indicating whether a 20 MHz subchannel is punctured or not
-     * @return a pointer to a newly allocated SpectrumValue representing the HE OFDM Transmit Power
+     * @return a pointer to a shared SpectrumValue representing the HE OFDM Transmit Power
      * Spectral Density in W/Hz for each Band
      */
     static Ptr<SpectrumValue> CreateHeOfdmTxPowerSpectralDensity(
@@ -187,7 +193,7 @@ class WifiSpectrumValueHelper
      * @param minOuterband the minimum relative power in the outer band
      * @param lowestPoint maximum relative power of the outermost subcarriers of the guard band
      * @param puncturedSubchannels bitmap indicating whether a 20 MHz subchannel is punctured or not
-     * @return a pointer to a newly allocated SpectrumValue representing the HE OFDM Transmit Power
+     * @return a pointer to a shared SpectrumValue representing the HE OFDM Transmit Power
      * Spectral Density in W/Hz for each Band
      */
     static Ptr<SpectrumValue> CreateHeOfdmTxPowerSpectralDensity(
@@ -210,7 +216,7 @@ class WifiSpectrumValueHelper
      * @param txPower transmit power to allocate
      * @param guardBandwidth width of the guard band
      * @param ru the RU band used by the STA
-     * @return a pointer to a newly allocated SpectrumValue representing the HE OFDM Transmit Power
+     * @return a pointer to a shared SpectrumValue representing the HE OFDM Transmit Power
      * Spectral Density on the RU used by the STA in W/Hz for each Band
      */
     static Ptr<SpectrumValue> CreateHeMuOfdmTxPowerSpectralDensity(
@@ -14,6 +14,9 @@
 #include "wifi-utils.h"
 #include "yans-wifi-phy.h"
 
+#include "ns3/boolean.h"
+#include "ns3/double.h"
+#include "ns3/grid-spatial-index.h"
 #include "ns3/log.h"
 #include "ns3/mobility-model.h"
 #include "ns3/node.h"
@@ -22,6 +25,9 @@
 #include "ns3/propagation-loss-model.h"
 #include "ns3/simulator.h"
 
+#include <algorithm>
+#include <iterator>
+
 namespace ns3
 {
 
@@ -46,11 +52,45 @@ YansWifiChannel::GetTypeId()
                           "A pointer to the propagation delay model attached to this channel.",
                           PointerValue(),
                           MakePointerAccessor(&YansWifiChannel::m_delay),
-                          MakePointerChecker<PropagationDelayModel>());
+                          MakePointerChecker<PropagationDelayModel>())
+            .AddAttribute("ReceiverCullingRange",
+                          "If strictly positive, transmissions are only delivered to the PHYs "
+                          "located within this distance (m) of the sender. The PHYs are found "
+                          "through a spatial index of their positions, which avoids computing "
+                          "the propagation loss towards all the PHYs of the channel. Note that "
+                          "the default value corresponds to considering all the PHYs. Tune this "
+                          "value with care, the range must exceed the distance at which the "
+                          "signals can be sensed.",
+                          DoubleValue(0.0),
+                          MakeDoubleAccessor(&YansWifiChannel::m_receiverCullingRange),
+                          MakeDoubleChecker<double>(0.0))
+            .AddAttribute("MaxLossDb",
+                          "The maximum loss in dB for which transmissions will be passed to "
+                          "the receiving PHY. Signals for which the PropagationLossModel "
+                          "returns a loss bigger than this value will not be propagated to "
+                          "the receiver (and will not be reported by the SignalArrival trace "
+                          "source of the receiver). Note that the default value corresponds "
+                          "to considering all signals for reception.",
+                          DoubleValue(1.0e9),
+                          MakeDoubleAccessor(&YansWifiChannel::m_maxLossDb),
+                          MakeDoubleChecker<double>())
+            .AddAttribute("CoalesceReceptions",
+                          "If true, the receptions of a PPDU that are too weak to be processed "
+                          "by the receiving PHYs and start at the same time are dispatched by "
+                          "a single event, and no event is scheduled for those whose receiving "
+                          "PHY has no sink connected to its SignalArrival trace source. This "
+                          "reduces the load of the scheduler in dense broadcast scenarios. The "
+                          "receptions that are processed by the receiving PHYs are unaffected.",
+                          BooleanValue(false),
+                          MakeBooleanAccessor(&YansWifiChannel::m_coalesceReceptions),
+                          MakeBooleanChecker());
     return tid;
 }
 
 YansWifiChannel::YansWifiChannel()
+    : m_receiverCullingRange{0.0},
+      m_maxLossDb{1.0e9},
+      m_coalesceReceptions{false}
 {
     NS_LOG_FUNCTION(this);
 }
@@ -61,6 +101,19 @@ YansWifiChannel::~YansWifiChannel()
     m_phyList.clear();
 }
 
+void
+YansWifiChannel::DoDispose()
+{
+    NS_LOG_FUNCTION(this);
+    if (m_receiverIndex)
+    {
+        m_receiverIndex->Dispose();
+        m_receiverIndex = nullptr;
+    }
+    m_unindexedPhys.clear();
+    Channel::DoDispose();
+}
+
 void
 YansWifiChannel::SetPropagationLossModel(const Ptr<PropagationLossModel> loss)
 {
@@ -81,42 +134,158 @@ YansWifiChannel::Send(Ptr<YansWifiPhy> sender, Ptr<const WifiPpdu> ppdu, dBm_u t
     NS_LOG_FUNCTION(this << sender << ppdu << txPower);
     Ptr<MobilityModel> senderMobility = sender->GetMobility();
     NS_ASSERT(senderMobility);
-    for (auto i = m_phyList.begin(); i != m_phyList.end(); i++)
+    ReceptionBatches batches;
+    auto batchesPtr = m_coalesceReceptions ? &batches : nullptr;
+    if (m_receiverCullingRange > 0)
+    {
+        for (auto i : GetPhysWithinCullingRange(senderMobility->GetPosition()))
+        {
+            SendTo(sender, senderMobility, m_phyList[i], ppdu, txPower, batchesPtr);
+        }
+    }
+    else
+    {
+        for (const auto& receiver : m_phyList)
+        {
+            SendTo(sender, senderMobility, receiver, ppdu, txPower, batchesPtr);
+        }
+    }
+
+    for (const auto& [delay, receptions] : batches)
+    {
+        NS_LOG_DEBUG(receptions.size() << " weak receptions starting after " << delay);
+        Simulator::ScheduleWithContext(Simulator::NO_CONTEXT,
+                                       delay,
+                                       &YansWifiChannel::ReceiveBatch,
+                                       receptions,
+                                       ppdu);
+    }
+}
+
+void
+YansWifiChannel::ScheduleReceive(Time delay, const Reception& reception, Ptr<const WifiPpdu> ppdu)
+{
+    const auto& [receiver, rxPower] = reception;
+    auto dstNetDevice = receiver->GetDevice();
+    uint32_t dstNode;
+    if (!dstNetDevice)
+    {
+        dstNode = 0xffffffff;
+    }
+    else
+    {
+        dstNode = dstNetDevice->GetNode()->GetId();
+    }
+
+    Simulator::ScheduleWithContext(dstNode,
+                                   delay,
+                                   &YansWifiChannel::Receive,
+                                   receiver,
+                                   ppdu,
+                                   rxPower);
+}
+
+void
+YansWifiChannel::SendTo(Ptr<YansWifiPhy> sender,
+                        Ptr<MobilityModel> senderMobility,
+                        Ptr<YansWifiPhy> receiver,
+                        Ptr<const WifiPpdu> ppdu,
+                        dBm_u txPower,
+                        ReceptionBatches* batches) const
+{
+    if (sender == receiver)
+    {
+        return;
+    }
+
+    // For now don't account for inter channel interference nor channel bonding
+    if (receiver->GetChannelNumber() != sender->GetChannelNumber())
+    {
+        return;
+    }
+
+    auto receiverMobility = receiver->GetMobility()->GetObject<MobilityModel>();
+    const auto delay = m_delay->GetDelay(senderMobility, receiverMobility);
+    const dBm_u rxPower{m_loss->CalcRxPower(txPower, senderMobility, receiverMobility)};
+    NS_LOG_DEBUG("propagation: txPower="
+                 << txPower << "dBm, rxPower=" << rxPower << "dBm, "
+                 << "distance=" << senderMobility->GetDistanceFrom(receiverMobility)
+                 << "m, delay=" << delay);
+    if (txPower - rxPower > m_maxLossDb)
+    {
+        NS_LOG_DEBUG("loss larger than " << m_maxLossDb << " dB, not propagated");
+        return;
+    }
+    if (batches && IsTooWeak(receiver, ppdu, rxPower))
     {
-        if (sender != (*i))
+        // the signal only needs to be traced, which requires no node context
+        if (receiver->IsSignalArrivalTraced())
         {
-            // For now don't account for inter channel interference nor channel bonding
-            if ((*i)->GetChannelNumber() != sender->GetChannelNumber())
-            {
-                continue;
-            }
-
-            auto receiverMobility = (*i)->GetMobility()->GetObject<MobilityModel>();
-            const auto delay = m_delay->GetDelay(senderMobility, receiverMobility);
-            const dBm_u rxPower{m_loss->CalcRxPower(txPower, senderMobility, receiverMobility)};
-            NS_LOG_DEBUG("propagation: txPower="
-                         << txPower << "dBm, rxPower=" << rxPower << "dBm, "
-                         << "distance=" << senderMobility->GetDistanceFrom(receiverMobility)
-                         << "m, delay=" << delay);
-            auto dstNetDevice = (*i)->GetDevice();
-            uint32_t dstNode;
-            if (!dstNetDevice)
-            {
-                dstNode = 0xffffffff;
-            }
-            else
-            {
-                dstNode = dstNetDevice->GetNode()->GetId();
-            }
-
-            Simulator::ScheduleWithContext(dstNode,
-                                           delay,
-                                           &YansWifiChannel::Receive,
-                                           (*i),
-                                           ppdu,
-                                           rxPower);
+            (*batches)[delay].emplace_back(receiver, rxPower);
         }
+        else
+        {
+            NS_LOG_DEBUG("signal too weak to be processed and not traced, not propagated");
+        }
+        return;
     }
+    ScheduleReceive(delay, {receiver, rxPower}, ppdu);
+}
+
+void
+YansWifiChannel::UpdateReceiverIndex() const
+{
+    if (!m_receiverIndex)
+    {
+        m_receiverIndex = CreateObjectWithAttributes<GridSpatialIndex>(
+            "CellSize",
+            DoubleValue(m_receiverCullingRange));
+        m_unindexedPhys.resize(m_phyList.size());
+        for (uint32_t i = 0; i < m_phyList.size(); i++)
+        {
+            m_unindexedPhys[i] = i;
+        }
+    }
+    // the mobility model of a PHY is only known once the PHY is initialized
+    auto it = m_unindexedPhys.begin();
+    while (it != m_unindexedPhys.end())
+    {
+        if (auto mobility = m_phyList[*it]->GetMobility())
+        {
+            m_receiverIndex->Add(*it, mobility);
+            it = m_unindexedPhys.erase(it);
+        }
+        else
+        {
+            ++it;
+        }
+    }
+}
+
+std::vector<uint32_t>
+YansWifiChannel::GetPhysWithinCullingRange(const Vector& position) const
+{
+    NS_LOG_FUNCTION(this << position);
+    NS_ASSERT(m_receiverCullingRange > 0);
+    if (!m_unindexedPhys.empty() || !m_receiverIndex)
+    {
+        UpdateReceiverIndex();
+    }
+    auto indices = m_receiverIndex->GetItemsWithinRange(position, m_receiverCullingRange);
+    NS_LOG_DEBUG(indices.size() << " PHYs out of " << m_phyList.size() << " within "
+                                << m_receiverCullingRange << " m");
+    if (m_unindexedPhys.empty())
+    {
+        return indices;
+    }
+    std::vector<uint32_t> merged;
+    merged.reserve(indices.size() + m_unindexedPhys.size());
+    std::merge(indices.cbegin(),
+               indices.cend(),
+               m_unindexedPhys.cbegin(),
+               m_unindexedPhys.cend(),
+               std::back_inserter(merged));
+    return merged;
 }
 
 void
@@ -126,10 +295,7 @@ YansWifiChannel::Receive(Ptr<YansWifiPhy> phy, Ptr<const WifiPpdu> ppdu, dBm_u r
     const auto totalRxPower = rxPower + phy->GetRxGain();
     phy->TraceSignalArrival(ppdu, totalRxPower, ppdu->GetTxDuration());
     // Do no further processing if signal is too weak
-    // Current implementation assumes constant RX power over the PPDU duration
-    // Compare received TX power per MHz to normalized RX sensitivity
-    const auto txWidth = ppdu->GetTxChannelWidth();
-    if (totalRxPower < phy->GetRxSensitivity() + RatioToDb(txWidth / MHz_u{20}))
+    if (IsTooWeak(phy, ppdu, rxPower))
     {
         NS_LOG_INFO("Received signal too weak to process: " << rxPower << " dBm");
         return;
@@ -141,6 +307,32 @@ YansWifiChannel::Receive(Ptr<YansWifiPhy> phy, Ptr<const WifiPpdu> ppdu, dBm_u r
     phy->StartReceivePreamble(ppdu, rxPowerW, ppdu->GetTxDuration());
 }
 
+bool
+YansWifiChannel::IsTooWeak(Ptr<YansWifiPhy> phy, Ptr<const WifiPpdu> ppdu, dBm_u rxPower)
+{
+    // Current implementation assumes constant RX power over the PPDU duration
+    // Compare received TX power per MHz to normalized RX sensitivity
+    const auto txWidth = ppdu->GetTxChannelWidth();
+    return rxPower + phy->GetRxGain() < phy->GetRxSensitivity() + RatioToDb(txWidth / MHz_u{20});
+}
+
+void
+YansWifiChannel::ReceiveBatch(const std::vector<Reception>& receptions, Ptr<const WifiPpdu> ppdu)
+{
+    NS_LOG_FUNCTION(receptions.size() << ppdu);
+    for (const auto& reception : receptions)
+    {
+        const auto& [receiver, rxPower] = reception;
+        if (!IsTooWeak(receiver, ppdu, rxPower))
+        {
+            // the configuration of the receiver changed while the signal was propagating
+            ScheduleReceive(Time{0}, reception, ppdu);
+            continue;
+        }
+        Receive(receiver, ppdu, rxPower);
+    }
+}
+
 std::size_t
 YansWifiChannel::GetNDevices() const
 {
@@ -158,6 +350,10 @@ YansWifiChannel::Add(Ptr<YansWifiPhy> phy)
 {
     NS_LOG_FUNCTION(this << phy);
     m_phyList.push_back(phy);
+    if (m_receiverIndex)
+    {
+        m_unindexedPhys.push_back(m_phyList.size() - 1);
+    }
 }
 
 int64_t
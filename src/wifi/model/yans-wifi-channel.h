@@ -12,16 +12,22 @@
 #include "wifi-units.h"
 
 #include "ns3/channel.h"
+#include "ns3/nstime.h"
+#include "ns3/vector.h"
+
+#include <map>
+#include <vector>
 
 namespace ns3
 {
 
+class GridSpatialIndex;
+class MobilityModel;
 class NetDevice;
 class PropagationLossModel;
 class PropagationDelayModel;
 class YansWifiPhy;
 class Packet;
-class Time;
 class WifiPpdu;
 
 /**
@@ -32,6 +38,25 @@ class WifiPpdu;
  * class and supports an ns3::PropagationLossModel and an
  * ns3::PropagationDelayModel.  By default, no propagation models are set;
  * it is the caller's responsibility to set them before using the channel.
+ *
+ * By default, every transmission is delivered to all the other PHYs on the
+ * channel. In large scenarios, the ReceiverCullingRange attribute can be set
+ * to only consider the PHYs located within the given distance of the sender;
+ * these PHYs are found through a ns3::GridSpatialIndex of the positions of
+ * the PHYs, so that the cost of a transmission does not grow with the
+ * number of PHYs that are out of range. The MaxLossDb attribute can also be
+ * set so that no reception event is scheduled for the PHYs that would
+ * receive the signal with a loss larger than the given value.
+ *
+ * In dense scenarios, most of the receptions of a PPDU are usually too weak
+ * to be processed by the receiving PHYs, which only report the arrival of the
+ * signal through their SignalArrival trace source. If the CoalesceReceptions
+ * attribute is set, no event is scheduled for such receptions if the trace
+ * source of the receiving PHY has no sink, and the other ones are dispatched
+ * by a single event per start time (i.e., per propagation delay) rather than
+ * by one event per receiving PHY. The receptions that the receiving PHYs
+ * process are still scheduled individually, because the events that the PHYs
+ * schedule in turn must have the context of their node.
  */
 class YansWifiChannel : public Channel
 {
@@ -76,6 +101,16 @@ class YansWifiChannel : public Channel
      */
     void Send(Ptr<YansWifiPhy> sender, Ptr<const WifiPpdu> ppdu, dBm_u txPower) const;
 
+    /**
+     * Get the PHYs located within the receiver culling range of the given
+     * position. The PHYs whose mobility model is not known yet are always
+     * included.
+     *
+     * @param position the position of the sender
+     * @return the indices of the PHYs in the PHY list, in increasing order
+     */
+    std::vector<uint32_t> GetPhysWithinCullingRange(const Vector& position) const;
+
     /**
      * Assign a fixed random variable stream number to the random variables
      * used by this model.  Return the number of streams (possibly zero) that
@@ -87,12 +122,55 @@ class YansWifiChannel : public Channel
      */
     int64_t AssignStreams(int64_t stream);
 
+  protected:
+    void DoDispose() override;
+
   private:
     /**
      * A vector of pointers to YansWifiPhy.
      */
     typedef std::vector<Ptr<YansWifiPhy>> PhyList;
 
+    /// The receiving PHY and the RX power of the reception of a PPDU
+    using Reception = std::pair<Ptr<YansWifiPhy>, dBm_u>;
+
+    /// The receptions of a PPDU indexed by their propagation delay
+    using ReceptionBatches = std::map<Time, std::vector<Reception>>;
+
+    /**
+     * Compute the power received by the given PHY and schedule the reception
+     * of the PPDU by this PHY, unless the PHY cannot receive it.
+     *
+     * @param sender the PHY object from which the packet is originating
+     * @param senderMobility the mobility model of the sender
+     * @param receiver the PHY to deliver the PPDU to
+     * @param ppdu the PPDU to send
+     * @param txPower the TX power associated to the packet
+     * @param batches if not null, the reception is added to these batches instead of being
+     *                scheduled, if the receiver cannot process the PPDU
+     */
+    void SendTo(Ptr<YansWifiPhy> sender,
+                Ptr<MobilityModel> senderMobility,
+                Ptr<YansWifiPhy> receiver,
+                Ptr<const WifiPpdu> ppdu,
+                dBm_u txPower,
+                ReceptionBatches* batches) const;
+
+    /**
+     * Schedule the reception of a PPDU by a PHY, in the context of the node of the PHY.
+     *
+     * @param delay the propagation delay
+     * @param reception the receiving PHY and the RX power
+     * @param ppdu the PPDU being sent
+     */
+    static void ScheduleReceive(Time delay, const Reception& reception, Ptr<const WifiPpdu> ppdu);
+
+    /**
+     * Add to the spatial index of the receivers the PHYs that are not
+     * indexed yet and whose mobility model is now known.
+     */
+    void UpdateReceiverIndex() const;
+
     /**
      * This method is scheduled by Send for each associated YansWifiPhy.
      * The method then calls the corresponding YansWifiPhy that the first
@@ -104,9 +182,33 @@ class YansWifiChannel : public Channel
      */
     static void Receive(Ptr<YansWifiPhy> receiver, Ptr<const WifiPpdu> ppdu, dBm_u txPower);
 
+    /**
+     * @param phy the receiving PHY
+     * @param ppdu the PPDU being sent
+     * @param rxPower the RX power of the PPDU, before the RX gain of the PHY
+     * @return whether the PPDU is received with a power too weak to be processed by the PHY
+     */
+    static bool IsTooWeak(Ptr<YansWifiPhy> phy, Ptr<const WifiPpdu> ppdu, dBm_u rxPower);
+
+    /**
+     * This method is scheduled by Send for each group of receptions of a PPDU
+     * that start at the same time and are too weak to be processed, if
+     * receptions are coalesced. The method then notifies all the PHYs of the
+     * group, in order, that the first bit of the PPDU has arrived.
+     *
+     * @param receptions the receiving PHYs and the corresponding RX powers
+     * @param ppdu the PPDU being sent
+     */
+    static void ReceiveBatch(const std::vector<Reception>& receptions, Ptr<const WifiPpdu> ppdu);
+
     PhyList m_phyList;                  //!< List of YansWifiPhys connected to this YansWifiChannel
     Ptr<PropagationLossModel> m_loss;   //!< Propagation loss model
     Ptr<PropagationDelayModel> m_delay; //!< Propagation delay model
+    double m_receiverCullingRange;      //!< Max distance (m) to the receivers, 0 to disable
+    dB_u m_maxLossDb;                   //!< Max loss for which a reception is scheduled
+    bool m_coalesceReceptions;          //!< Whether weak receptions are coalesced
+    mutable Ptr<GridSpatialIndex> m_receiverIndex; //!< Spatial index of the receivers
+    mutable std::vector<uint32_t> m_unindexedPhys; //!< PHYs not in the index, in increasing order
 };
 
 } // namespace ns3
@@ -98,6 +98,12 @@ YansWifiPhy::TraceSignalArrival(Ptr<const WifiPpdu> ppdu, double rxPowerDbm, Tim
     m_signalArrivalCb(ppdu, rxPowerDbm, ppdu->GetTxDuration());
 }
 
+bool
+YansWifiPhy::IsSignalArrivalTraced() const
+{
+    return !m_signalArrivalCb.IsEmpty();
+}
+
 MHz_u
 YansWifiPhy::GetGuardBandwidth(MHz_u currentChannelWidth) const
 {
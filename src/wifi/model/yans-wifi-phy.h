@@ -72,6 +72,11 @@ class YansWifiPhy : public WifiPhy
      */
     void TraceSignalArrival(Ptr<const WifiPpdu> ppdu, double rxPowerDbm, Time duration);
 
+    /**
+     * @return whether a sink is connected to the SignalArrival trace source
+     */
+    bool IsSignalArrivalTraced() const;
+
     /**
      * Callback invoked when the PHY model starts to process a signal
      *
@@ -8,6 +8,7 @@
 
 #include "ns3/ap-wifi-mac.h"
 #include "ns3/attribute-container.h"
+#include "ns3/block-ack-window.h"
 #include "ns3/boolean.h"
 #include "ns3/config.h"
 #include "ns3/ctrl-headers.h"
@@ -24,6 +25,7 @@
 #include "ns3/pointer.h"
 #include "ns3/qos-txop.h"
 #include "ns3/qos-utils.h"
+#include "ns3/random-variable-stream.h"
 #include "ns3/recipient-block-ack-agreement.h"
 #include "ns3/spectrum-wifi-helper.h"
 #include "ns3/string.h"
@@ -36,6 +38,7 @@
 #include "ns3/wifi-phy.h"
 #include "ns3/yans-wifi-helper.h"
 
+#include <deque>
 #include <list>
 
 using namespace ns3;
@@ -664,6 +667,136 @@ OriginatorBlockAckWindowTest::DoRun()
     }
 }
 
+/**
+ * @ingroup wifi-test
+ * @ingroup tests
+ *
+ * @brief Test for the block ack window
+ *
+ * Random sequences of operations are performed on block ack windows of various sizes
+ * (including the 1024-MPDU windows of EHT and sizes that are not a multiple of the
+ * size of the words storing the window) and on a reference model of the window. After
+ * each operation, the elements of the window, the number of elements that are set,
+ * the number of consecutive elements that are set from winStart and the bitmap
+ * obtained by copying the window are checked against the reference model. The bitmap
+ * is also checked against the bitmap of a BlockAck frame built one MPDU at a time.
+ */
+class BlockAckWindowTest : public TestCase
+{
+  public:
+    BlockAckWindowTest();
+
+  private:
+    void DoRun() override;
+
+    /**
+     * Check the given window against the given reference model.
+     *
+     * @param window the block ack window
+     * @param model the reference model of the block ack window
+     */
+    void CheckWindow(const BlockAckWindow& window, const std::deque<bool>& model);
+};
+
+BlockAckWindowTest::BlockAckWindowTest()
+    : TestCase("Check the correctness of the block ack window")
+{
+}
+
+void
+BlockAckWindowTest::CheckWindow(const BlockAckWindow& window, const std::deque<bool>& model)
+{
+    std::size_t count = 0;
+    std::optional<std::size_t> nSetFromStart;
+    for (std::size_t i = 0; i < model.size(); i++)
+    {
+        NS_TEST_ASSERT_MSG_EQ(window.At(i), model[i], "Unexpected element at distance " << i);
+        count += (model[i] ? 1 : 0);
+        if (!model[i] && !nSetFromStart)
+        {
+            nSetFromStart = i;
+        }
+    }
+    NS_TEST_EXPECT_MSG_EQ(window.Count(), count, "Unexpected number of elements set");
+    NS_TEST_EXPECT_MSG_EQ(window.GetNSetFromStart(),
+                          nSetFromStart.value_or(model.size()),
+                          "Unexpected number of consecutive elements set from winStart");
+
+    // the size of the bitmap of a BlockAck frame is 8, 32, 64 or 128 bytes
+    for (const uint8_t bitmapLen : {8, 32, 64, 128})
+    {
+        std::vector<uint8_t> bitmap(bitmapLen, 0xff);
+        window.CopyTo(bitmap);
+
+        CtrlBAckResponseHeader blockAck;
+        blockAck.SetType({BlockAckType::COMPRESSED, {bitmapLen}});
+        blockAck.SetStartingSequence(window.GetWinStart());
+        for (std::size_t i = 0; i < model.size(); i++)
+        {
+            if (model[i])
+            {
+                blockAck.SetReceivedPacket((window.GetWinStart() + i) % SEQNO_SPACE_SIZE);
+            }
+        }
+        NS_TEST_EXPECT_MSG_EQ((bitmap == blockAck.GetBitmap()),
+                              true,
+                              "Unexpected bitmap of " << +bitmapLen << " bytes");
+    }
+}
+
+void
+BlockAckWindowTest::DoRun()
+{
+    auto random = CreateObject<UniformRandomVariable>();
+    random->SetStream(1);
+
+    for (const uint16_t winSize : {1, 64, 100, 256, 1000, 1024})
+    {
+        const uint16_t winStart = 4000;
+        BlockAckWindow window;
+        window.Init(winStart, winSize);
+        std::deque<bool> model(winSize, false);
+        uint16_t modelWinStart = winStart;
+
+        NS_TEST_EXPECT_MSG_EQ(window.GetWinSize(), winSize, "Incorrect window size");
+        CheckWindow(window, model);
+
+        for (uint32_t round = 0; round < 200; round++)
+        {
+            // set (or clear) a few random elements
+            for (uint32_t i = 0; i < random->GetInteger(1, 3 * winSize / 4 + 1); i++)
+            {
+                const auto distance = random->GetInteger(0, winSize - 1);
+                const bool value = (random->GetValue() < 0.9);
+                window.At(distance) = value;
+                model[distance] = value;
+            }
+            CheckWindow(window, model);
+
+            // advance by a random number of positions or up to the first unset element
+            std::size_t count = (round % 2 == 0) ? window.GetNSetFromStart()
+                                                 : random->GetInteger(0, winSize + winSize / 4);
+            window.Advance(count);
+            for (std::size_t i = 0; i < count; i++)
+            {
+                model.pop_front();
+                model.push_back(false);
+            }
+            modelWinStart = (modelWinStart + count) % SEQNO_SPACE_SIZE;
+            NS_TEST_EXPECT_MSG_EQ(window.GetWinStart(), modelWinStart, "Incorrect winStart");
+            NS_TEST_EXPECT_MSG_EQ(window.GetWinEnd(),
+                                  (modelWinStart + winSize - 1) % SEQNO_SPACE_SIZE,
+                                  "Incorrect winEnd");
+            CheckWindow(window, model);
+        }
+
+        window.Reset(winStart);
+        std::fill(model.begin(), model.end(), false);
+        NS_TEST_EXPECT_MSG_EQ(window.GetWinStart(), winStart, "Incorrect winStart after reset");
+        CheckWindow(window, model);
+    }
+}
+
 /**
  * @ingroup wifi-test
  * @ingroup tests
@@ -2258,6 +2391,7 @@ BlockAckTestSuite::BlockAckTestSuite()
     AddTestCase(new PacketBufferingCaseA, TestCase::Duration::QUICK);
     AddTestCase(new PacketBufferingCaseB, TestCase::Duration::QUICK);
     AddTestCase(new OriginatorBlockAckWindowTest, TestCase::Duration::QUICK);
+    AddTestCase(new BlockAckWindowTest, TestCase::Duration::QUICK);
     AddTestCase(new CtrlBAckResponseHeaderTest, TestCase::Duration::QUICK);
     AddTestCase(new BlockAckRecipientBufferTest(0), TestCase::Duration::QUICK);
     AddTestCase(new BlockAckRecipientBufferTest(4090), TestCase::Duration::QUICK);
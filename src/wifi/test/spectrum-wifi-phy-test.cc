@@ -4,9 +4,12 @@
  * SPDX-License-Identifier: GPL-2.0-only
  */
 
+#include "ns3/abstract-wifi-phy.h"
 #include "ns3/boolean.h"
 #include "ns3/constant-position-mobility-model.h"
+#include "ns3/enum.h"
 #include "ns3/he-phy.h" //includes OFDM PHY
+#include "ns3/he-ppdu.h"
 #include "ns3/interference-helper.h"
 #include "ns3/log.h"
 #include "ns3/mobility-helper.h"
@@ -21,6 +24,7 @@
 #include "ns3/test.h"
 #include "ns3/waveform-generator.h"
 #include "ns3/wifi-mac-header.h"
+#include "ns3/wifi-mpdu.h"
 #include "ns3/wifi-net-device.h"
 #include "ns3/wifi-phy-listener.h"
 #include "ns3/wifi-psdu.h"
@@ -31,6 +35,7 @@
 
 #include <memory>
 #include <optional>
+#include <sstream>
 #include <tuple>
 #include <vector>
 
@@ -2782,6 +2787,562 @@ SpectrumWifiPhyInterfacesHelperTest::DoRun()
     Simulator::Destroy();
 }
 
+/**
+ * @ingroup wifi-test
+ * @ingroup tests
+ *
+ * @brief Test the reception of A-MPDUs by an AbstractWifiPhy
+ *
+ * The same sequence of HE SU PPDUs is received by a SpectrumWifiPhy and by an
+ * AbstractWifiPhy: an A-MPDU received without interference, an A-MPDU whose
+ * payload is hit by an interfering PPDU of the same power and another A-MPDU
+ * received without interference. The test checks that both PHYs give the same
+ * reception outcomes and that the AbstractWifiPhy needs fewer events. It also
+ * checks the effective SNR mappings.
+ */
+class AbstractWifiPhyTest : public TestCase
+{
+  public:
+    AbstractWifiPhyTest();
+
+  private:
+    void DoRun() override;
+
+    /**
+     * Check the effective SNR mappings.
+     */
+    void CheckEffectiveSnr();
+
+    /**
+     * Receive the sequence of PPDUs with a PHY of the given type.
+     *
+     * @param phyType the type of the PHY
+     * @return the number of events executed by the simulator
+     */
+    uint64_t RunReception(const std::string& phyType);
+
+    /**
+     * Send an HE SU PPDU carrying an A-MPDU to the PHY.
+     *
+     * @param txPower the transmit power
+     */
+    void SendAmpdu(Watt_u txPower);
+
+    /**
+     * Callback invoked when a PSDU is successfully received.
+     * @param psdu the PSDU
+     * @param rxSignalInfo the info on the received signal (\see RxSignalInfo)
+     * @param txVector the transmit vector
+     * @param statusPerMpdu reception status per MPDU
+     */
+    void RxSuccess(Ptr<const WifiPsdu> psdu,
+                   RxSignalInfo rxSignalInfo,
+                   const WifiTxVector& txVector,
+                   const std::vector<bool>& statusPerMpdu);
+
+    /**
+     * Callback invoked when a PSDU is not successfully received.
+     * @param psdu the PSDU
+     */
+    void RxFailure(Ptr<const WifiPsdu> psdu);
+
+    Ptr<SpectrumWifiPhy> m_phy; ///< the receiving PHY
+    uint64_t m_uid{0};          ///< the UID to use for the next PPDU
+    std::size_t m_nMpdus{4};    ///< the number of MPDUs per A-MPDU
+    std::size_t m_rxSuccess{0}; ///< the number of successfully received PSDUs
+    std::size_t m_rxFailure{0}; ///< the number of PSDUs that were not received
+    std::size_t m_rxMpdus{0};   ///< the number of notified MPDUs of A-MPDUs
+};
+
+AbstractWifiPhyTest::AbstractWifiPhyTest()
+    : TestCase("AbstractWifiPhy test case receives A-MPDUs like SpectrumWifiPhy")
+{
+}
+
+void
+AbstractWifiPhyTest::SendAmpdu(Watt_u txPower)
+{
+    WifiTxVector txVector{HePhy::GetHeMcs5(),
+                          0,
+                          WIFI_PREAMBLE_HE_SU,
+                          NanoSeconds(800),
+                          1,
+                          1,
+                          0,
+                          CHANNEL_WIDTH,
+                          true};
+
+    WifiMacHeader hdr;
+    hdr.SetType(WIFI_MAC_QOSDATA);
+    hdr.SetQosTid(0);
+    std::vector<Ptr<WifiMpdu>> mpduList;
+    for (std::size_t i = 0; i < m_nMpdus; ++i)
+    {
+        mpduList.push_back(Create<WifiMpdu>(Create<Packet>(1000), hdr));
+    }
+    auto psdu = Create<WifiPsdu>(mpduList);
+    const auto txDuration =
+        SpectrumWifiPhy::CalculateTxDuration(psdu->GetSize(), txVector, m_phy->GetPhyBand());
+    const auto& channel = m_phy->GetOperatingChannel();
+
+    auto txParams = Create<WifiSpectrumSignalParameters>();
+    txParams->psd = WifiSpectrumValueHelper::CreateHeOfdmTxPowerSpectralDensity(
+        channel.GetPrimaryChannelCenterFrequency(CHANNEL_WIDTH),
+        CHANNEL_WIDTH,
+        txPower,
+        GUARD_WIDTH);
+    txParams->txPhy = nullptr;
+    txParams->duration = txDuration;
+    txParams->ppdu = Create<HePpdu>(psdu, txVector, channel, txDuration, m_uid++);
+    m_phy->StartRx(txParams, nullptr);
+}
+
+void
+AbstractWifiPhyTest::RxSuccess(Ptr<const WifiPsdu> psdu,
+                               RxSignalInfo rxSignalInfo,
+                               const WifiTxVector& txVector,
+                               const std::vector<bool>& statusPerMpdu)
+{
+    NS_LOG_FUNCTION(this << *psdu << rxSignalInfo << txVector);
+    if (statusPerMpdu.empty())
+    {
+        // notification of an MPDU of the A-MPDU under reception
+        m_rxMpdus++;
+        return;
+    }
+    NS_TEST_EXPECT_MSG_EQ(static_cast<std::size_t>(
+                              std::count(statusPerMpdu.cbegin(), statusPerMpdu.cend(), true)),
+                          m_nMpdus,
+                          "All the MPDUs should have been received");
+    m_rxSuccess++;
+}
+
+void
+AbstractWifiPhyTest::RxFailure(Ptr<const WifiPsdu> psdu)
+{
+    NS_LOG_FUNCTION(this << *psdu);
+    m_rxFailure++;
+}
+
+uint64_t
+AbstractWifiPhyTest::RunReception(const std::string& phyType)
+{
+    m_rxSuccess = 0;
+    m_rxFailure = 0;
+    m_rxMpdus = 0;
+
+    auto spectrumChannel = CreateObject<MultiModelSpectrumChannel>();
+    auto node = CreateObject<Node>();
+    auto dev = CreateObject<WifiNetDevice>();
+    ObjectFactory factory(phyType);
+    m_phy = factory.Create<SpectrumWifiPhy>();
+    m_phy->SetInterferenceHelper(CreateObject<InterferenceHelper>());
+    m_phy->SetErrorRateModel(CreateObject<NistErrorRateModel>());
+    m_phy->SetDevice(dev);
+    m_phy->AddChannel(spectrumChannel);
+    m_phy->SetOperatingChannel(WifiPhy::ChannelTuple{CHANNEL_NUMBER, 0, WIFI_PHY_BAND_5GHZ, 0});
+    m_phy->ConfigureStandard(WIFI_STANDARD_80211ax);
+    m_phy->SetReceiveOkCallback(MakeCallback(&AbstractWifiPhyTest::RxSuccess, this));
+    m_phy->SetReceiveErrorCallback(MakeCallback(&AbstractWifiPhyTest::RxFailure, this));
+    dev->SetPhy(m_phy);
+    node->AddDevice(dev);
+
+    const Watt_u txPower{0.01};
+    Simulator::Schedule(Seconds(1), &AbstractWifiPhyTest::SendAmpdu, this, txPower);
+    // the interfering PPDU starts after the PHY header of the A-MPDU
+    Simulator::Schedule(Seconds(2), &AbstractWifiPhyTest::SendAmpdu, this, txPower);
+    Simulator::Schedule(Seconds(2) + MicroSeconds(50),
+                        &AbstractWifiPhyTest::SendAmpdu,
+                        this,
+                        txPower);
+    Simulator::Schedule(Seconds(3), &AbstractWifiPhyTest::SendAmpdu, this, txPower);
+    Simulator::Run();
+    const auto nEvents = Simulator::GetEventCount();
+
+    NS_TEST_EXPECT_MSG_EQ(m_rxSuccess, 2, phyType << " did not receive the expected PSDUs");
+    NS_TEST_EXPECT_MSG_EQ(m_rxFailure, 1, phyType << " did not fail the expected PSDU");
+    NS_TEST_EXPECT_MSG_EQ(m_rxMpdus,
+                          2 * m_nMpdus,
+                          phyType << " did not receive the expected MPDUs");
+
+    m_phy->Dispose();
+    m_phy = nullptr;
+    Simulator::Destroy();
+    return nEvents;
+}
+
+void
+AbstractWifiPhyTest::CheckEffectiveSnr()
+{
+    const auto mode = HePhy::GetHeMcs1(); // QPSK
+    for (auto mapping : {AbstractWifiPhy::EESM, AbstractWifiPhy::MIESM})
+    {
+        NS_TEST_EXPECT_MSG_EQ_TOL(AbstractWifiPhy::GetEffectiveSnr({10, 10, 10}, mapping, mode),
+                                  10,
+                                  1e-9,
+                                  "The effective SNR of a flat channel is its SNR");
+        const auto snr = AbstractWifiPhy::GetEffectiveSnr({1, 100}, mapping, mode);
+        NS_TEST_EXPECT_MSG_GT(snr, 1, "The effective SNR exceeds the lowest SNR");
+        NS_TEST_EXPECT_MSG_LT(snr, 50.5, "The effective SNR is below the mean SNR");
+    }
+    const auto beta = AbstractWifiPhy::GetEesmBeta(mode);
+    NS_TEST_EXPECT_MSG_EQ_TOL(
+        AbstractWifiPhy::GetEffectiveSnr({1, 100}, AbstractWifiPhy::EESM, mode),
+        -beta * std::log((std::exp(-1 / beta) + std::exp(-100 / beta)) / 2),
+        1e-9,
+        "Unexpected EESM effective SNR");
+    NS_TEST_EXPECT_MSG_EQ_TOL(
+        AbstractWifiPhy::GetEffectiveSnr({1, 100}, AbstractWifiPhy::MIESM, mode),
+        std::sqrt(2.0 * 101.0) - 1,
+        1e-9,
+        "Unexpected MIESM effective SNR");
+}
+
+void
+AbstractWifiPhyTest::DoRun()
+{
+    CheckEffectiveSnr();
+    const auto nEventsFull = RunReception("ns3::SpectrumWifiPhy");
+    const auto nEventsAbstract = RunReception("ns3::AbstractWifiPhy");
+    NS_TEST_EXPECT_MSG_LT(nEventsAbstract,
+                          nEventsFull,
+                          "AbstractWifiPhy should need fewer events than SpectrumWifiPhy");
+}
+
+/**
+ * HE PHY returning a given STA-ID for DL MU PPDUs, so that DL MU PPDUs can be received
+ * by a PHY that does not belong to an associated STA.
+ */
+class DlMuTestHePhy : public HePhy
+{
+  public:
+    /**
+     * Constructor
+     *
+     * @param staId the STA-ID to return for DL MU PPDUs
+     */
+    DlMuTestHePhy(uint16_t staId)
+        : m_staId(staId)
+    {
+    }
+
+    uint16_t GetStaId(const Ptr<const WifiPpdu> ppdu) const override
+    {
+        if (ppdu->GetType() == WIFI_PPDU_TYPE_DL_MU)
+        {
+            return m_staId;
+        }
+        return HePhy::GetStaId(ppdu);
+    }
+
+  private:
+    uint16_t m_staId; ///< the STA-ID to return for DL MU PPDUs
+};
+
+/**
+ * PHY of the given type whose HE PHY instance is a DlMuTestHePhy.
+ *
+ * @tparam T the type of the PHY
+ */
+template <class T>
+class DlMuTestWifiPhy : public T
+{
+  public:
+    /**
+     * Constructor
+     *
+     * @param staId the STA-ID to use for DL MU PPDUs
+     */
+    DlMuTestWifiPhy(uint16_t staId)
+        : m_hePhy(Create<DlMuTestHePhy>(staId))
+    {
+        m_hePhy->SetOwner(this);
+    }
+
+  protected:
+    void DoInitialize() override
+    {
+        // Replace HE PHY instance with test instance
+        this->m_phyEntities[WIFI_MOD_CLASS_HE] = m_hePhy;
+        T::DoInitialize();
+    }
+
+    void DoDispose() override
+    {
+        m_hePhy = nullptr;
+        T::DoDispose();
+    }
+
+  private:
+    Ptr<DlMuTestHePhy> m_hePhy; ///< HE PHY instance used for the test
+};
+
+/**
+ * @ingroup wifi-test
+ * @ingroup tests
+ *
+ * @brief Test the reception of DL MU PPDUs by an AbstractWifiPhy
+ *
+ * An AP sends two DL MU PPDUs over a 40 MHz channel, each carrying an A-MPDU on the
+ * 242-tone RU of the primary 20 MHz channel (STA 1) and an A-MPDU on the 242-tone RU
+ * of the secondary 20 MHz channel (STA 2). The payload of the second DL MU PPDU is hit
+ * by a strong signal occupying the secondary 20 MHz channel only. The PPDUs are received
+ * by the PHY of STA 1 and by the PHY of STA 2, which are SpectrumWifiPhys or
+ * AbstractWifiPhys using either effective SNR mapping. The test checks that the
+ * AbstractWifiPhy evaluates the reception of each A-MPDU over the RU it is transmitted
+ * on, hence STA 1 receives both A-MPDUs and STA 2 only receives the first one, like the
+ * SpectrumWifiPhy.
+ */
+class AbstractWifiPhyOfdmaTest : public TestCase
+{
+  public:
+    AbstractWifiPhyOfdmaTest();
+
+  private:
+    void DoRun() override;
+
+    /**
+     * Receive the sequence of PPDUs with the PHY of the given STA.
+     *
+     * @param staId the STA-ID of the receiving STA
+     * @param mapping the effective SNR mapping used by the AbstractWifiPhy, if the
+     *                receiving PHY is an AbstractWifiPhy
+     */
+    void RunReception(uint16_t staId,
+                      std::optional<AbstractWifiPhy::EffectiveSnrMapping> mapping);
+
+    /**
+     * Send a DL MU PPDU carrying an A-MPDU to each STA from the PHY of the AP.
+     */
+    void SendMuPpdu();
+
+    /**
+     * Send a signal occupying the secondary 20 MHz channel to the PHY of the STA.
+     *
+     * @param duration the duration of the signal
+     */
+    void SendInterference(Time duration);
+
+    /**
+     * Callback invoked when a PSDU is successfully received.
+     * @param psdu the PSDU
+     * @param rxSignalInfo the info on the received signal (\see RxSignalInfo)
+     * @param txVector the transmit vector
+     * @param statusPerMpdu reception status per MPDU
+     */
+    void RxSuccess(Ptr<const WifiPsdu> psdu,
+                   RxSignalInfo rxSignalInfo,
+                   const WifiTxVector& txVector,
+                   const std::vector<bool>& statusPerMpdu);
+
+    /**
+     * Callback invoked when a PSDU is not successfully received.
+     * @param psdu the PSDU
+     */
+    void RxFailure(Ptr<const WifiPsdu> psdu);
+
+    Ptr<SpectrumWifiPhy> m_phyAp; ///< the PHY of the AP
+    Ptr<SpectrumWifiPhy> m_phy;   ///< the PHY of the receiving STA
+    std::size_t m_nMpdus{4};      ///< the number of MPDUs per A-MPDU
+    std::size_t m_rxSuccess{0};   ///< the number of successfully received PSDUs
+    std::size_t m_rxFailure{0};   ///< the number of PSDUs that were not received
+
+    static constexpr uint8_t MU_CHANNEL_NUMBER{38}; ///< the number of the 40 MHz channel
+    static constexpr MHz_u MU_CHANNEL_WIDTH{40};    ///< the width of the 40 MHz channel
+    static constexpr dBm_u TX_POWER{20};            ///< the power of the DL MU PPDUs
+};
+
+AbstractWifiPhyOfdmaTest::AbstractWifiPhyOfdmaTest()
+    : TestCase("AbstractWifiPhy test case receives DL MU PPDUs over the addressed RU")
+{
+}
+
+void
+AbstractWifiPhyOfdmaTest::SendMuPpdu()
+{
+    WifiTxVector txVector{HePhy::GetHeMcs5(),
+                          0,
+                          WIFI_PREAMBLE_HE_MU,
+                          NanoSeconds(800),
+                          1,
+                          1,
+                          0,
+                          MU_CHANNEL_WIDTH,
+                          true,
+                          false};
+    txVector.SetRuAllocation({192, 192}, 0);
+    txVector.SetSigBMode(VhtPhy::GetVhtMcs5());
+
+    WifiConstPsduMap psdus;
+    for (uint16_t staId : {1, 2})
+    {
+        txVector.SetRu(HeRu::RuSpec(HeRu::RU_242_TONE, staId, true), staId);
+        txVector.SetMode(HePhy::GetHeMcs5(), staId);
+        txVector.SetNss(1, staId);
+
+        WifiMacHeader hdr;
+        hdr.SetType(WIFI_MAC_QOSDATA);
+        hdr.SetQosTid(0);
+        std::vector<Ptr<WifiMpdu>> mpduList;
+        for (std::size_t i = 0; i < m_nMpdus; ++i)
+        {
+            mpduList.push_back(Create<WifiMpdu>(Create<Packet>(1000), hdr));
+        }
+        psdus.emplace(staId, Create<WifiPsdu>(mpduList));
+    }
+
+    m_phyAp->Send(psdus, txVector);
+}
+
+void
+AbstractWifiPhyOfdmaTest::SendInterference(Time duration)
+{
+    const auto& channel = m_phy->GetOperatingChannel();
+
+    // a signal whose power spectral density is ten times the one of the DL MU PPDUs,
+    // occupying the secondary 20 MHz channel only, i.e., the upper half of the 40 MHz channel
+    // the returned PSD is shared, hence it is copied before being modified
+    auto txParams = Create<SpectrumSignalParameters>();
+    txParams->psd = WifiSpectrumValueHelper::CreateHeOfdmTxPowerSpectralDensity(
+                        channel.GetFrequency(),
+                        MU_CHANNEL_WIDTH,
+                        10 * DbmToW(TX_POWER),
+                        m_phy->GetGuardBandwidth(MU_CHANNEL_WIDTH))
+                        ->Copy();
+    auto band = txParams->psd->ConstBandsBegin();
+    for (auto value = txParams->psd->ValuesBegin(); value != txParams->psd->ValuesEnd();
+         ++value, ++band)
+    {
+        if (band->fc < MHzToHz(channel.GetFrequency()))
+        {
+            *value = 0;
+        }
+    }
+    txParams->txPhy = nullptr;
+    txParams->duration = duration;
+    m_phy->StartRx(txParams, nullptr);
+}
+
+void
+AbstractWifiPhyOfdmaTest::RxSuccess(Ptr<const WifiPsdu> psdu,
+                                    RxSignalInfo rxSignalInfo,
+                                    const WifiTxVector& txVector,
+                                    const std::vector<bool>& statusPerMpdu)
+{
+    NS_LOG_FUNCTION(this << *psdu << rxSignalInfo << txVector);
+    if (statusPerMpdu.empty())
+    {
+        // notification of an MPDU of the A-MPDU under reception
+        return;
+    }
+    NS_TEST_EXPECT_MSG_EQ(static_cast<std::size_t>(
+                              std::count(statusPerMpdu.cbegin(), statusPerMpdu.cend(), true)),
+                          m_nMpdus,
+                          "All the MPDUs should have been received");
+    m_rxSuccess++;
+}
+
+void
+AbstractWifiPhyOfdmaTest::RxFailure(Ptr<const WifiPsdu> psdu)
+{
+    NS_LOG_FUNCTION(this << *psdu);
+    m_rxFailure++;
+}
+
+void
+AbstractWifiPhyOfdmaTest::RunReception(uint16_t staId,
+                                       std::optional<AbstractWifiPhy::EffectiveSnrMapping> mapping)
+{
+    m_rxSuccess = 0;
+    m_rxFailure = 0;
+
+    const WifiPhy::ChannelTuple channel{MU_CHANNEL_NUMBER,
+                                        MU_CHANNEL_WIDTH,
+                                        WIFI_PHY_BAND_5GHZ,
+                                        0};
+    auto spectrumChannel = CreateObject<MultiModelSpectrumChannel>();
+
+    auto apNode = CreateObject<Node>();
+    auto apDev = CreateObject<WifiNetDevice>();
+    m_phyAp = CreateObject<SpectrumWifiPhy>();
+    m_phyAp->SetInterferenceHelper(CreateObject<InterferenceHelper>());
+    m_phyAp->SetErrorRateModel(CreateObject<NistErrorRateModel>());
+    m_phyAp->SetDevice(apDev);
+    m_phyAp->AddChannel(spectrumChannel);
+    m_phyAp->ConfigureStandard(WIFI_STANDARD_80211ax);
+    m_phyAp->SetOperatingChannel(channel);
+    m_phyAp->SetTxPowerStart(TX_POWER);
+    m_phyAp->SetTxPowerEnd(TX_POWER);
+    auto apMobility = CreateObject<ConstantPositionMobilityModel>();
+    m_phyAp->SetMobility(apMobility);
+    apDev->SetPhy(m_phyAp);
+    apNode->AggregateObject(apMobility);
+    apNode->AddDevice(apDev);
+
+    auto node = CreateObject<Node>();
+    auto dev = CreateObject<WifiNetDevice>();
+    if (mapping)
+    {
+        m_phy = CreateObject<DlMuTestWifiPhy<AbstractWifiPhy>>(staId);
+        m_phy->SetAttribute("EffectiveSnrMapping", EnumValue(*mapping));
+    }
+    else
+    {
+        m_phy = CreateObject<DlMuTestWifiPhy<SpectrumWifiPhy>>(staId);
+    }
+    m_phy->SetInterferenceHelper(CreateObject<InterferenceHelper>());
+    m_phy->SetErrorRateModel(CreateObject<NistErrorRateModel>());
+    m_phy->SetDevice(dev);
+    m_phy->AddChannel(spectrumChannel);
+    m_phy->ConfigureStandard(WIFI_STANDARD_80211ax);
+    m_phy->SetOperatingChannel(channel);
+    m_phy->SetReceiveOkCallback(MakeCallback(&AbstractWifiPhyOfdmaTest::RxSuccess, this));
+    m_phy->SetReceiveErrorCallback(MakeCallback(&AbstractWifiPhyOfdmaTest::RxFailure, this));
+    auto mobility = CreateObject<ConstantPositionMobilityModel>();
+    m_phy->SetMobility(mobility);
+    dev->SetPhy(m_phy);
+    node->AggregateObject(mobility);
+    node->AddDevice(dev);
+
+    Simulator::Schedule(Seconds(1), &AbstractWifiPhyOfdmaTest::SendMuPpdu, this);
+    // the interfering signal starts after the PHY header of the DL MU PPDU and lasts
+    // until the end of the DL MU PPDU
+    Simulator::Schedule(Seconds(2), &AbstractWifiPhyOfdmaTest::SendMuPpdu, this);
+    Simulator::Schedule(Seconds(2) + MicroSeconds(100),
+                        &AbstractWifiPhyOfdmaTest::SendInterference,
+                        this,
+                        MilliSeconds(1));
+    Simulator::Run();
+
+    // STA 2 does not receive the A-MPDU sent over the RU hit by the interfering signal
+    const std::size_t expectedFailures = (staId == 1) ? 0 : 1;
+    std::stringstream ss;
+    ss << (mapping ? "AbstractWifiPhy" : "SpectrumWifiPhy") << " of STA " << staId;
+    NS_TEST_EXPECT_MSG_EQ(m_rxSuccess,
+                          2 - expectedFailures,
+                          ss.str() << " did not receive the expected PSDUs");
+    NS_TEST_EXPECT_MSG_EQ(m_rxFailure,
+                          expectedFailures,
+                          ss.str() << " did not fail the expected PSDUs");
+
+    m_phyAp->Dispose();
+    m_phyAp = nullptr;
+    m_phy->Dispose();
+    m_phy = nullptr;
+    Simulator::Destroy();
+}
+
+void
+AbstractWifiPhyOfdmaTest::DoRun()
+{
+    for (uint16_t staId : {1, 2})
+    {
+        RunReception(staId, std::nullopt);
+        RunReception(staId, AbstractWifiPhy::EESM);
+        RunReception(staId, AbstractWifiPhy::MIESM);
+    }
+}
+
 /**
  * @ingroup wifi-test
  * @ingroup tests
@@ -2816,6 +3377,8 @@ SpectrumWifiPhyTestSuite::SpectrumWifiPhyTestSuite()
                     SpectrumWifiPhyMultipleInterfacesTest::ChannelSwitchScenario::BETWEEN_TX_RX),
                 TestCase::Duration::QUICK);
     AddTestCase(new SpectrumWifiPhyInterfacesHelperTest, TestCase::Duration::QUICK);
+    AddTestCase(new AbstractWifiPhyTest, TestCase::Duration::QUICK);
+    AddTestCase(new AbstractWifiPhyOfdmaTest, TestCase::Duration::QUICK);
 }
 
 static SpectrumWifiPhyTestSuite spectrumWifiPhyTestSuite; ///< the test suite
@@ -1925,6 +1925,161 @@ PhyHeaderSectionsTest::DoRun()
     CheckPhyHeaderSections(phyEntity->GetPhyHeaderSections(txVector, ppduStart), sections);
 }
 
+/**
+ * @ingroup wifi-test
+ * @ingroup tests
+ *
+ * @brief TX duration cache test
+ *
+ * Check that the TX durations returned by WifiPhy::CalculateTxDuration when the cache of
+ * TX durations is enabled match those computed when the cache is disabled, that the
+ * durations of non-MU PPDUs are only computed once and that the durations of MU PPDUs
+ * are not cached.
+ */
+class TxDurationCacheTest : public TestCase
+{
+  public:
+    TxDurationCacheTest();
+    void DoRun() override;
+};
+
+TxDurationCacheTest::TxDurationCacheTest()
+    : TestCase("Check the cache of TX durations")
+{
+}
+
+void
+TxDurationCacheTest::DoRun()
+{
+    Ptr<YansWifiPhy> phy = CreateObject<YansWifiPhy>();
+
+    std::list<std::pair<WifiTxVector, WifiPhyBand>> configs;
+    auto addConfig = [&configs](WifiMode mode,
+                                WifiPreamble preamble,
+                                MHz_u width,
+                                Time guardInterval,
+                                uint8_t nss,
+                                WifiPhyBand band) {
+        WifiTxVector txVector;
+        txVector.SetMode(mode);
+        txVector.SetPreambleType(preamble);
+        txVector.SetChannelWidth(width);
+        txVector.SetGuardInterval(guardInterval);
+        txVector.SetNss(nss);
+        if (IsEht(preamble))
+        {
+            txVector.SetEhtPpduType(1);
+        }
+        configs.emplace_back(txVector, band);
+    };
+    addConfig(DsssPhy::GetDsssRate11Mbps(),
+              WIFI_PREAMBLE_SHORT,
+              MHz_u{22},
+              NanoSeconds(800),
+              1,
+              WIFI_PHY_BAND_2_4GHZ);
+    addConfig(OfdmPhy::GetOfdmRate54Mbps(),
+              WIFI_PREAMBLE_LONG,
+              MHz_u{20},
+              NanoSeconds(800),
+              1,
+              WIFI_PHY_BAND_5GHZ);
+    addConfig(HtPhy::GetHtMcs7(),
+              WIFI_PREAMBLE_HT_MF,
+              MHz_u{40},
+              NanoSeconds(400),
+              1,
+              WIFI_PHY_BAND_2_4GHZ);
+    addConfig(VhtPhy::GetVhtMcs9(),
+              WIFI_PREAMBLE_VHT_SU,
+              MHz_u{80},
+              NanoSeconds(800),
+              2,
+              WIFI_PHY_BAND_5GHZ);
+    addConfig(HePhy::GetHeMcs11(),
+              WIFI_PREAMBLE_HE_SU,
+              MHz_u{160},
+              NanoSeconds(800),
+              2,
+              WIFI_PHY_BAND_6GHZ);
+    // same as above, except for the guard interval
+    addConfig(HePhy::GetHeMcs11(),
+              WIFI_PREAMBLE_HE_SU,
+              MHz_u{160},
+              NanoSeconds(3200),
+              2,
+              WIFI_PHY_BAND_6GHZ);
+    addConfig(EhtPhy::GetEhtMcs13(),
+              WIFI_PREAMBLE_EHT_MU,
+              MHz_u{320},
+              NanoSeconds(800),
+              4,
+              WIFI_PHY_BAND_6GHZ);
+    const std::list<uint32_t> sizes{14, 1500, 65535};
+
+    // reference durations, computed with the cache disabled
+    WifiPhy::EnableTxDurationCache(false);
+    WifiPhy::ResetTxDurationCache();
+    std::list<Time> expected;
+    for (const auto& [txVector, band] : configs)
+    {
+        for (const auto size : sizes)
+        {
+            expected.push_back(WifiPhy::CalculateTxDuration(size, txVector, band));
+        }
+    }
+    auto stats = WifiPhy::GetTxDurationCacheStats();
+    NS_TEST_EXPECT_MSG_EQ(stats.hits + stats.misses, 0, "The disabled cache has been used");
+
+    WifiPhy::EnableTxDurationCache(true);
+    const auto n = configs.size() * sizes.size();
+    for (std::size_t round = 1; round <= 2; round++)
+    {
+        auto expectedIt = expected.cbegin();
+        for (const auto& [txVector, band] : configs)
+        {
+            for (const auto size : sizes)
+            {
+                NS_TEST_EXPECT_MSG_EQ(WifiPhy::CalculateTxDuration(size, txVector, band),
+                                      *expectedIt++,
+                                      "Unexpected TX duration for size " << size << " and TXVECTOR "
+                                                                         << txVector);
+            }
+        }
+        stats = WifiPhy::GetTxDurationCacheStats();
+        NS_TEST_EXPECT_MSG_EQ(stats.misses,
+                              n,
+                              "Unexpected number of misses (round " << round << ")");
+        NS_TEST_EXPECT_MSG_EQ(stats.hits,
+                              (round - 1) * n,
+                              "Unexpected number of hits (round " << round << ")");
+        NS_TEST_EXPECT_MSG_EQ(stats.size, n, "Unexpected cache size (round " << round << ")");
+    }
+
+    // the duration of MU PPDUs is not cached
+    WifiTxVector muTxVector;
+    muTxVector.SetPreambleType(WIFI_PREAMBLE_HE_MU);
+    muTxVector.SetChannelWidth(MHz_u{40});
+    muTxVector.SetGuardInterval(NanoSeconds(800));
+    muTxVector.SetHeMuUserInfo(1, {{HeRu::RU_242_TONE, 1, true}, 11, 1});
+    muTxVector.SetHeMuUserInfo(2, {{HeRu::RU_242_TONE, 2, true}, 10, 1});
+    muTxVector.SetSigBMode(VhtPhy::GetVhtMcs0());
+    muTxVector.SetRuAllocation({192, 192}, 0);
+    const auto muDuration = WifiPhy::CalculateTxDuration(1500, muTxVector, WIFI_PHY_BAND_5GHZ, 1);
+    WifiPhy::EnableTxDurationCache(false);
+    NS_TEST_EXPECT_MSG_EQ(WifiPhy::CalculateTxDuration(1500, muTxVector, WIFI_PHY_BAND_5GHZ, 1),
+                          muDuration,
+                          "Unexpected TX duration for a MU PPDU");
+    WifiPhy::EnableTxDurationCache(true);
+    stats = WifiPhy::GetTxDurationCacheStats();
+    NS_TEST_EXPECT_MSG_EQ(stats.hits + stats.misses, 2 * n, "MU PPDUs must not use the cache");
+    NS_TEST_EXPECT_MSG_EQ(stats.size, 0, "Disabling the cache must clear it");
+
+    WifiPhy::ResetTxDurationCache();
+    stats = WifiPhy::GetTxDurationCacheStats();
+    NS_TEST_EXPECT_MSG_EQ(stats.hits + stats.misses + stats.size, 0, "Cache not reset");
+}
+
 /**
  * @ingroup wifi-test
  * @ingroup tests
@@ -1944,6 +2099,8 @@ TxDurationTestSuite::TxDurationTestSuite()
 
     AddTestCase(new PhyHeaderSectionsTest, TestCase::Duration::QUICK);
 
+    AddTestCase(new TxDurationCacheTest, TestCase::Duration::QUICK);
+
     // 20 MHz band, HeSigBDurationTest::OFDMA, even number of users per HE-SIG-B content channel
     AddTestCase(new HeSigBDurationTest(
                     {{{HeRu::RU_106_TONE, 1, true}, 11, 1}, {{HeRu::RU_106_TONE, 2, true}, 10, 4}},
@@ -14,11 +14,14 @@
 #include <gsl/gsl_sf_bessel.h>
 #endif
 
+#include "ns3/cached-error-rate-model.h"
+#include "ns3/double.h"
 #include "ns3/dsss-error-rate-model.h"
 #include "ns3/he-phy.h" //includes HT and VHT
 #include "ns3/interference-helper.h"
 #include "ns3/log.h"
 #include "ns3/nist-error-rate-model.h"
+#include "ns3/pointer.h"
 #include "ns3/table-based-error-rate-model.h"
 #include "ns3/test.h"
 #include "ns3/wifi-phy.h"
@@ -1102,6 +1105,98 @@ TableBasedErrorRateTestCase::DoRun()
     }
 }
 
+/**
+ * @ingroup wifi-test
+ * @ingroup tests
+ *
+ * @brief Cached Error Rate Model Test Case
+ *
+ * The chunk success rates returned by a CachedErrorRateModel are compared against
+ * those returned by the wrapped error rate model, for various modes, chunk sizes
+ * and SNR values, including SNR values out of the tabulated range.
+ */
+class CachedErrorRateTestCase : public TestCase
+{
+  public:
+    /**
+     * Constructor
+     *
+     * @param model the wrapped error rate model
+     * @param tolerance the maximum difference between the PERs of both models
+     */
+    CachedErrorRateTestCase(Ptr<ErrorRateModel> model, double tolerance);
+
+  private:
+    void DoRun() override;
+
+    Ptr<ErrorRateModel> m_model; ///< The wrapped error rate model
+    double m_tolerance;          ///< The maximum difference between the PERs of both models
+};
+
+CachedErrorRateTestCase::CachedErrorRateTestCase(Ptr<ErrorRateModel> model, double tolerance)
+    : TestCase("Check the accuracy of the cached " + model->GetInstanceTypeId().GetName()),
+      m_model(model),
+      m_tolerance(tolerance)
+{
+}
+
+void
+CachedErrorRateTestCase::DoRun()
+{
+    auto cached =
+        CreateObjectWithAttributes<CachedErrorRateModel>("ErrorRateModel",
+                                                         PointerValue(m_model),
+                                                         "MinSnr",
+                                                         DoubleValue(-5),
+                                                         "MaxSnr",
+                                                         DoubleValue(35));
+    std::vector<WifiMode> modes{OfdmPhy::GetOfdmRate6Mbps(),
+                                OfdmPhy::GetOfdmRate54Mbps(),
+                                HtPhy::GetHtMcs0(),
+                                HtPhy::GetHtMcs7(),
+                                VhtPhy::GetVhtMcs8(),
+                                HePhy::GetHeMcs0(),
+                                HePhy::GetHeMcs11()};
+    for (const auto& mode : modes)
+    {
+        WifiTxVector txVector;
+        txVector.SetMode(mode);
+        txVector.SetChannelWidth(MHz_u{20});
+        for (uint64_t nbits : {8, 100, 1000, 12000, 12345, 65535 * 8})
+        {
+            for (dB_u snr = -10; snr <= dB_u{40}; snr += dB_u{0.13})
+            {
+                const auto expected =
+                    1 - m_model->GetChunkSuccessRate(mode, txVector, DbToRatio(snr), nbits);
+                const auto per =
+                    1 - cached->GetChunkSuccessRate(mode, txVector, DbToRatio(snr), nbits);
+                NS_TEST_ASSERT_MSG_EQ_TOL(per,
+                                          expected,
+                                          m_tolerance,
+                                          "Unexpected PER for mode " << mode << ", " << nbits
+                                                                     << " bits, SNR " << snr
+                                                                     << " dB");
+            }
+        }
+    }
+    // one table per mode and per group of chunk sizes (12000 and 12345 bits share a group)
+    NS_TEST_EXPECT_MSG_EQ(cached->GetNTables(), modes.size() * 5, "Unexpected number of tables");
+    cached->Flush();
+    NS_TEST_EXPECT_MSG_EQ(cached->GetNTables(), 0, "Tables not flushed");
+
+    // objects created without a wrapped error rate model do not share the default one
+    auto first = CreateObject<CachedErrorRateModel>();
+    auto second = CreateObject<CachedErrorRateModel>();
+    PointerValue firstModel;
+    PointerValue secondModel;
+    first->GetAttribute("ErrorRateModel", firstModel);
+    second->GetAttribute("ErrorRateModel", secondModel);
+    NS_TEST_ASSERT_MSG_NE(firstModel.Get<ErrorRateModel>(), nullptr, "No default model created");
+    NS_TEST_EXPECT_MSG_NE(firstModel.Get<ErrorRateModel>(),
+                          secondModel.Get<ErrorRateModel>(),
+                          "The default error rate model is shared");
+}
+
 /**
  * @ingroup wifi-test
  * @ingroup tests
@@ -1169,6 +1264,10 @@ WifiErrorRateModelsTestSuite::WifiErrorRateModelsTestSuite()
                                                 HePhy::GetHeMcs11(),
                                                 1458),
                 TestCase::Duration::QUICK);
+    AddTestCase(new CachedErrorRateTestCase(CreateObject<NistErrorRateModel>(), 1e-3),
+                TestCase::Duration::QUICK);
+    AddTestCase(new CachedErrorRateTestCase(CreateObject<YansErrorRateModel>(), 1e-3),
+                TestCase::Duration::QUICK);
 }
 
 static WifiErrorRateModelsTestSuite wifiErrorRateModelsTestSuite; ///< the test suite
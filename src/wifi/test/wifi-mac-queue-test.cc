@@ -12,6 +12,10 @@
 #include "ns3/wifi-mac-queue.h"
 
 #include <algorithm>
+#include <iterator>
+#include <map>
+#include <set>
+#include <vector>
 
 using namespace ns3;
 
@@ -417,6 +421,156 @@ WifiExtractExpiredMpdusTest::DoRun()
     Simulator::Destroy();
 }
 
+/**
+ * @ingroup wifi-test
+ * @ingroup tests
+ *
+ * @brief Test the expiry timer wheel of the MAC queue container
+ *
+ * This test enqueues MPDUs in many container queues, with expiry times spanning
+ * several rounds of the expiry timer wheel, and verifies that ExtractAllExpiredMpdus
+ * extracts all and only the MPDUs with expired lifetime, also when MPDUs are removed
+ * before their expiry time and when their expiry time is changed.
+ */
+class WifiExpiryTimerWheelTest : public TestCase
+{
+  public:
+    WifiExpiryTimerWheelTest();
+
+  private:
+    void DoRun() override;
+
+    /**
+     * Extract all the MPDUs with expired lifetime and check that they are the
+     * expected ones.
+     */
+    void CheckExpiredMpdus();
+
+    WifiMacQueueContainer m_container;              //!< MAC queue container
+    std::map<uint16_t, Time> m_expiryTimes;         //!< expiry time of queued MPDUs by seq no
+    std::vector<WifiContainerQueueId> m_queueIds;   //!< IDs of the container queues
+    std::map<uint16_t, WifiMpdu::Iterator> m_elems; //!< container elements by seq no
+};
+
+WifiExpiryTimerWheelTest::WifiExpiryTimerWheelTest()
+    : TestCase("Test the expiry timer wheel of the MAC queue container")
+{
+}
+
+void
+WifiExpiryTimerWheelTest::CheckExpiredMpdus()
+{
+    std::set<uint16_t> expectedSeqNo;
+    for (const auto& [seqNo, expiryTime] : m_expiryTimes)
+    {
+        if (expiryTime <= Simulator::Now())
+        {
+            expectedSeqNo.insert(seqNo);
+        }
+    }
+
+    auto [first, last] = m_container.ExtractAllExpiredMpdus();
+    std::set<uint16_t> actualSeqNo;
+    std::transform(first, last, std::inserter(actualSeqNo, actualSeqNo.end()), [](auto& elem) {
+        return elem.mpdu->GetHeader().GetSequenceNumber();
+    });
+
+    NS_TEST_EXPECT_MSG_EQ((actualSeqNo == expectedSeqNo),
+                          true,
+                          "Unexpected MPDUs extracted at " << Simulator::Now().As(Time::MS)
+                                                           << ": " << actualSeqNo.size()
+                                                           << " extracted, "
+                                                           << expectedSeqNo.size() << " expected");
+    for (auto seqNo : expectedSeqNo)
+    {
+        m_expiryTimes.erase(seqNo);
+    }
+    // remove the expired MPDUs from the container
+    for (auto [first, last] = m_container.GetAllExpiredMpdus(); first != last;)
+    {
+        first = m_container.erase(first);
+    }
+}
+
+void
+WifiExpiryTimerWheelTest::DoRun()
+{
+    auto txAddr = Mac48Address::Allocate();
+    uint16_t seqNo = 0;
+    const uint16_t nQueues = 100;
+    const uint16_t nMpdusPerQueue = 5;
+
+    for (uint16_t i = 0; i < nQueues; i++)
+    {
+        auto rxAddr = Mac48Address::Allocate();
+        for (uint16_t k = 0; k < nMpdusPerQueue; k++)
+        {
+            WifiMacHeader header(WIFI_MAC_QOSDATA);
+            header.SetAddr1(rxAddr);
+            header.SetAddr2(txAddr);
+            header.SetQosTid(i % 8);
+            header.SetSequenceNumber(seqNo);
+            auto mpdu = Create<WifiMpdu>(Create<Packet>(), header);
+
+            auto queueId = WifiMacQueueContainer::GetQueueId(mpdu);
+            auto elemIt = m_container.insert(m_container.GetQueue(queueId).cend(), mpdu);
+            elemIt->deleter = [](auto mpdu) {};
+            // expiry times span several rounds of the wheel
+            auto expiryTime = MilliSeconds(7 * i + 300 * k + 1);
+            m_container.SetExpiryTime(elemIt, expiryTime);
+            m_expiryTimes[seqNo] = expiryTime;
+            m_elems.emplace(seqNo, elemIt);
+            seqNo++;
+            if (k == 0)
+            {
+                m_queueIds.push_back(queueId);
+            }
+        }
+    }
+
+    // a control frame never expires
+    WifiMacHeader ctlHeader(WIFI_MAC_CTL_BACKREQ);
+    ctlHeader.SetAddr1(Mac48Address::Allocate());
+    ctlHeader.SetAddr2(txAddr);
+    auto ctl = Create<WifiMpdu>(Create<Packet>(), ctlHeader);
+    auto ctlIt = m_container.insert(
+        m_container.GetQueue(WifiMacQueueContainer::GetQueueId(ctl)).cend(),
+        ctl);
+    ctlIt->deleter = [](auto mpdu) {};
+    m_container.SetExpiryTime(ctlIt, Time::Max());
+
+    Simulator::Schedule(MilliSeconds(50), [&]() {
+        // dequeue the first MPDU of the even queues before its expiry
+        for (uint16_t i = 0; i < nQueues; i += 2)
+        {
+            auto it = m_container.GetQueue(m_queueIds[i]).cbegin();
+            m_expiryTimes.erase(it->mpdu->GetHeader().GetSequenceNumber());
+            m_container.erase(it);
+        }
+        // postpone the expiry of all the MPDUs of queue 1 by 10 seconds
+        for (const auto& elem : m_container.GetQueue(m_queueIds[1]))
+        {
+            auto seqNo = elem.mpdu->GetHeader().GetSequenceNumber();
+            auto& expiryTime = m_expiryTimes.at(seqNo);
+            expiryTime += Seconds(10);
+            m_container.SetExpiryTime(m_elems.at(seqNo), expiryTime);
+        }
+        CheckExpiredMpdus();
+    });
+    for (auto ms : {51, 200, 400, 401, 1000, 1500, 3000, 12000})
+    {
+        Simulator::Schedule(MilliSeconds(ms), &WifiExpiryTimerWheelTest::CheckExpiredMpdus, this);
+    }
+
+    Simulator::Run();
+    Simulator::Destroy();
+
+    NS_TEST_EXPECT_MSG_EQ(m_expiryTimes.empty(), true, "All the MPDUs should have expired");
+    NS_TEST_EXPECT_MSG_EQ(m_container.GetQueue(WifiMacQueueContainer::GetQueueId(ctl)).size(),
+                          1,
+                          "The control frame should not have expired");
+}
+
 /**
  * @ingroup wifi-test
  * @ingroup tests
@@ -434,6 +588,7 @@ WifiMacQueueTestSuite::WifiMacQueueTestSuite()
 {
     AddTestCase(new WifiMacQueueDropOldestTest, TestCase::Duration::QUICK);
     AddTestCase(new WifiExtractExpiredMpdusTest, TestCase::Duration::QUICK);
+    AddTestCase(new WifiExpiryTimerWheelTest, TestCase::Duration::QUICK);
 }
 
 static WifiMacQueueTestSuite g_wifiMacQueueTestSuite; ///< the test suite
@@ -8,6 +8,7 @@
 
 #include "wifi-mlo-test.h"
 
+#include "ns3/attribute-container.h"
 #include "ns3/config.h"
 #include "ns3/eht-configuration.h"
 #include "ns3/ht-frame-exchange-manager.h"
@@ -2980,6 +2981,286 @@ StartSeqNoUpdateAfterAddBaTimeoutTest::DoRun()
     Simulator::Destroy();
 }
 
+FastForwardSetupTest::FastForwardSetupTest()
+    : TestCase("Test the fast-forward of the association and Block Ack agreement setup"),
+      m_linkChannels({"{36, 0, BAND_5GHZ, 0}", "{1, 0, BAND_6GHZ, 0}", "{2, 0, BAND_2_4GHZ, 0}"}),
+      m_nPackets(20),
+      m_rxPkts(3, 0),
+      m_nSetupFrames(0),
+      m_nBlockAcks(0),
+      m_nDlMuPpdus(0),
+      m_nTriggerFrames(0)
+{
+}
+
+void
+FastForwardSetupTest::DoSetup()
+{
+    RngSeedManager::SetSeed(1);
+    RngSeedManager::SetRun(1);
+    int64_t streamNumber{1};
+
+    NodeContainer wifiApNode(1);
+    NodeContainer wifiStaNodes(2);
+
+    WifiHelper wifi;
+    wifi.SetStandard(WIFI_STANDARD_80211be);
+    wifi.SetRemoteStationManager("ns3::ConstantRateWifiManager",
+                                 "DataMode",
+                                 StringValue("EhtMcs0"),
+                                 "ControlMode",
+                                 StringValue("HtMcs0"));
+    wifi.ConfigEhtOptions("EmlsrActivated", BooleanValue(true));
+
+    auto channel = CreateObject<MultiModelSpectrumChannel>();
+
+    // AP MLD and EMLSR client
+    SpectrumWifiPhyHelper phyHelper(3);
+    uint8_t linkId = 0;
+    for (const auto& str : m_linkChannels)
+    {
+        phyHelper.Set(linkId++, "ChannelSettings", StringValue(str));
+    }
+    phyHelper.SetChannel(channel);
+
+    WifiMacHelper mac;
+    mac.SetType("ns3::ApWifiMac",
+                "Ssid",
+                SsidValue(Ssid("ns-3-ssid")),
+                "BeaconGeneration",
+                BooleanValue(true));
+    mac.SetMultiUserScheduler("ns3::RrMultiUserScheduler",
+                              "EnableUlOfdma",
+                              BooleanValue(true),
+                              "EnableBsrp",
+                              BooleanValue(false));
+
+    auto apDevice = wifi.Install(phyHelper, mac, wifiApNode);
+
+    mac.SetType("ns3::StaWifiMac",
+                "Ssid",
+                SsidValue(Ssid("ns-3-ssid")),
+                "MaxMissedBeacons",
+                UintegerValue(1e6), // do not deassociate
+                "ActiveProbing",
+                BooleanValue(false));
+    mac.SetEmlsrManager("ns3::DefaultEmlsrManager",
+                        "EmlsrLinkSet",
+                        AttributeContainerValue<UintegerValue>(std::set<uint8_t>{0, 1}));
+
+    NetDeviceContainer staDevices = wifi.Install(phyHelper, mac, wifiStaNodes.Get(0));
+
+    // single-link non-AP STA operating on the second link of the AP MLD
+    wifi.ConfigEhtOptions("EmlsrActivated", BooleanValue(false));
+    phyHelper = SpectrumWifiPhyHelper();
+    phyHelper.Set("ChannelSettings", StringValue(m_linkChannels.at(1)));
+    phyHelper.SetChannel(channel);
+
+    staDevices.Add(wifi.Install(phyHelper, mac, wifiStaNodes.Get(1)));
+
+    // Assign fixed streams to random variables in use
+    streamNumber += WifiHelper::AssignStreams(apDevice, streamNumber);
+    streamNumber += WifiHelper::AssignStreams(staDevices, streamNumber);
+
+    auto positionAlloc = CreateObject<ListPositionAllocator>();
+    positionAlloc->Add(Vector(0.0, 0.0, 0.0));
+    MobilityHelper mobility;
+    mobility.SetPositionAllocator(positionAlloc);
+    mobility.SetMobilityModel("ns3::ConstantPositionMobilityModel");
+    mobility.Install(wifiApNode);
+    mobility.Install(wifiStaNodes);
+
+    m_apMac = DynamicCast<ApWifiMac>(DynamicCast<WifiNetDevice>(apDevice.Get(0))->GetMac());
+    for (uint32_t i = 0; i < staDevices.GetN(); ++i)
+    {
+        m_staMacs.push_back(
+            DynamicCast<StaWifiMac>(DynamicCast<WifiNetDevice>(staDevices.Get(i))->GetMac()));
+    }
+
+    // skip the association and the Block Ack agreement setup
+    WifiHelper::FastForwardAssociation(apDevice.Get(0), staDevices);
+    WifiHelper::FastForwardBaAgreements(apDevice.Get(0), staDevices, {0});
+
+    Config::ConnectWithoutContext(
+        "/NodeList/*/DeviceList/*/$ns3::WifiNetDevice/Phys/*/PhyTxPsduBegin",
+        MakeCallback(&FastForwardSetupTest::Transmit, this));
+
+    PacketSocketHelper packetSocket;
+    packetSocket.Install(wifiApNode);
+    packetSocket.Install(wifiStaNodes);
+
+    for (std::size_t nodeId = 0; nodeId < NodeList::GetNNodes(); nodeId++)
+    {
+        auto node = NodeList::GetNode(nodeId);
+        auto device = DynamicCast<WifiNetDevice>(node->GetDevice(0));
+
+        PacketSocketAddress srvAddr;
+        srvAddr.SetSingleDevice(device->GetIfIndex());
+        srvAddr.SetProtocol(1);
+
+        auto server = CreateObject<PacketSocketServer>();
+        server->SetLocal(srvAddr);
+        node->AddApplication(server);
+        server->TraceConnectWithoutContext(
+            "Rx",
+            MakeCallback(&FastForwardSetupTest::L7Receive, this).Bind(nodeId));
+
+        // generate packets addressed to all the non-AP STAs (if this is the AP) or to the AP
+        std::vector<Ptr<NetDevice>> receivers;
+        if (nodeId == 0)
+        {
+            receivers.assign(staDevices.Begin(), staDevices.End());
+        }
+        else
+        {
+            receivers.push_back(apDevice.Get(0));
+        }
+        for (const auto& receiver : receivers)
+        {
+            PacketSocketAddress sockAddr;
+            sockAddr.SetSingleDevice(device->GetIfIndex());
+            sockAddr.SetPhysicalAddress(receiver->GetAddress());
+            sockAddr.SetProtocol(1);
+
+            auto client = CreateObject<PacketSocketClient>();
+            client->SetAttribute("PacketSize", UintegerValue(1000));
+            client->SetAttribute("MaxPackets", UintegerValue(m_nPackets));
+            client->SetAttribute("Interval", TimeValue(MicroSeconds(0)));
+            client->SetAttribute("Priority", UintegerValue(0));
+            client->SetRemote(sockAddr);
+            client->SetStartTime(MilliSeconds(5));
+            node->AddApplication(client);
+        }
+    }
+}
+
+void
+FastForwardSetupTest::Transmit(WifiConstPsduMap psduMap, WifiTxVector txVector, double txPowerW)
+{
+    if (txVector.IsDlMu())
+    {
+        ++m_nDlMuPpdus;
+    }
+    for (const auto& [staId, psdu] : psduMap)
+    {
+        for (const auto& mpdu : *PeekPointer(psdu))
+        {
+            const auto& hdr = mpdu->GetHeader();
+            if (hdr.IsBlockAck())
+            {
+                ++m_nBlockAcks;
+            }
+            if (hdr.IsTrigger())
+            {
+                ++m_nTriggerFrames;
+            }
+            if (hdr.IsAssocReq() || hdr.IsReassocReq())
+            {
+                ++m_nSetupFrames;
+            }
+            if (hdr.IsAction())
+            {
+                WifiActionHeader actionHdr;
+                mpdu->GetPacket()->PeekHeader(actionHdr);
+                if (actionHdr.GetCategory() == WifiActionHeader::BLOCK_ACK ||
+                    actionHdr.GetCategory() == WifiActionHeader::PROTECTED_EHT)
+                {
+                    ++m_nSetupFrames;
+                }
+            }
+        }
+    }
+}
+
+void
+FastForwardSetupTest::L7Receive(std::size_t nodeId, Ptr<const Packet> p, const Address& addr)
+{
+    NS_LOG_INFO("Packet received by NODE " << nodeId << "\n");
+    m_rxPkts.at(nodeId)++;
+}
+
+void
+FastForwardSetupTest::DoRun()
+{
+    // check the state of the devices before the start of the simulation
+    for (std::size_t i = 0; i < m_staMacs.size(); ++i)
+    {
+        const auto& staMac = m_staMacs[i];
+        NS_TEST_ASSERT_MSG_EQ(staMac->IsAssociated(), true, "STA " << i << " is not associated");
+        NS_TEST_EXPECT_MSG_EQ(staMac->GetAssociationId(), i + 1, "Unexpected AID for STA " << i);
+
+        for (const auto linkId : staMac->GetSetupLinkIds())
+        {
+            const auto bssid = staMac->GetBssid(linkId);
+            const auto apLinkId = m_apMac->GetLinkIdByAddress(bssid);
+            NS_TEST_ASSERT_MSG_EQ(apLinkId.has_value(),
+                                  true,
+                                  "BSSID " << bssid << " is not an AP MLD link address");
+            NS_TEST_EXPECT_MSG_EQ(m_linkChannels.at(*apLinkId),
+                                  m_linkChannels.at(i == 0 ? linkId : 1),
+                                  "STA " << i << " link " << +linkId << " on unexpected AP link");
+
+            const auto staAddr = staMac->GetFrameExchangeManager(linkId)->GetAddress();
+            const auto apRsm = m_apMac->GetWifiRemoteStationManager(*apLinkId);
+            NS_TEST_EXPECT_MSG_EQ(apRsm->IsAssociated(staAddr),
+                                  true,
+                                  "STA " << staAddr << " not associated at the AP MLD");
+            NS_TEST_EXPECT_MSG_EQ(apRsm->GetEmlsrEnabled(staAddr),
+                                  (i == 0 && linkId < 2),
+                                  "Unexpected EMLSR mode for STA " << staAddr << " at the AP MLD");
+            NS_TEST_EXPECT_MSG_EQ(staMac->IsEmlsrLink(linkId),
+                                  (i == 0 && linkId < 2),
+                                  "Unexpected EMLSR mode for link " << +linkId << " of STA " << i);
+
+            // Block Ack agreements are established with the MLD address, if any
+            const auto apAddr =
+                staMac->GetWifiRemoteStationManager(linkId)->GetMldAddress(bssid).value_or(bssid);
+            const auto staMldAddr = apRsm->GetMldAddress(staAddr).value_or(staAddr);
+            NS_TEST_EXPECT_MSG_EQ(m_apMac->GetBaAgreementEstablishedAsOriginator(staMldAddr, 0)
+                                      .has_value(),
+                                  true,
+                                  "No DL agreement established at the AP MLD with STA " << i);
+            NS_TEST_EXPECT_MSG_EQ(staMac->GetBaAgreementEstablishedAsRecipient(apAddr, 0)
+                                      .has_value(),
+                                  true,
+                                  "No DL agreement established at STA " << i);
+            NS_TEST_EXPECT_MSG_EQ(staMac->GetBaAgreementEstablishedAsOriginator(apAddr, 0)
+                                      .has_value(),
+                                  true,
+                                  "No UL agreement established at STA " << i);
+            NS_TEST_EXPECT_MSG_EQ(m_apMac->GetBaAgreementEstablishedAsRecipient(staMldAddr, 0)
+                                      .has_value(),
+                                  true,
+                                  "No UL agreement established at the AP MLD with STA " << i);
+        }
+    }
+    NS_TEST_EXPECT_MSG_EQ((m_staMacs[0]->GetSetupLinkIds() == std::set<uint8_t>{0, 1, 2}),
+                          true,
+                          "Unexpected set of setup links for the EMLSR client");
+    NS_TEST_EXPECT_MSG_EQ(m_staMacs[1]->GetSetupLinkIds().size(),
+                          1,
+                          "Unexpected number of setup links for the single-link STA");
+
+    Simulator::Stop(MilliSeconds(200));
+    Simulator::Run();
+
+    NS_TEST_EXPECT_MSG_EQ(m_nSetupFrames, 0, "No setup frame should have been transmitted");
+    NS_TEST_EXPECT_MSG_GT(m_nBlockAcks, 0, "Expected BlockAck frames to be transmitted");
+    NS_TEST_EXPECT_MSG_GT(m_nDlMuPpdus, 0, "Expected the MU scheduler to send DL MU PPDUs");
+    NS_TEST_EXPECT_MSG_GT(m_nTriggerFrames, 0, "Expected the MU scheduler to send Trigger Frames");
+    NS_TEST_EXPECT_MSG_EQ(m_rxPkts[0],
+                          m_staMacs.size() * m_nPackets,
+                          "Unexpected number of packets received by the AP MLD");
+    for (std::size_t i = 0; i < m_staMacs.size(); ++i)
+    {
+        NS_TEST_EXPECT_MSG_EQ(m_rxPkts[i + 1],
+                              m_nPackets,
+                              "Unexpected number of packets received by STA " << i);
+    }
+
+    Simulator::Destroy();
+}
+
 WifiMultiLinkOperationsTestSuite::WifiMultiLinkOperationsTestSuite()
     : TestSuite("wifi-mlo", Type::UNIT)
 {
@@ -3185,6 +3466,7 @@ WifiMultiLinkOperationsTestSuite::WifiMultiLinkOperationsTestSuite()
 
     AddTestCase(new ReleaseSeqNoAfterCtsTimeoutTest(), TestCase::Duration::QUICK);
     AddTestCase(new StartSeqNoUpdateAfterAddBaTimeoutTest(), TestCase::Duration::QUICK);
+    AddTestCase(new FastForwardSetupTest(), TestCase::Duration::QUICK);
 }
 
 static WifiMultiLinkOperationsTestSuite g_wifiMultiLinkOperationsTestSuite; ///< the test suite
@@ -775,6 +775,64 @@ class StartSeqNoUpdateAfterAddBaTimeoutTest : public MultiLinkOperationsTestBase
     Ptr<ListErrorModel> m_staErrorModel; //!< error rate model to corrupt frames at the non-AP MLD
 };
 
+/**
+ * @ingroup wifi-test
+ * @ingroup tests
+ *
+ * @brief Test the fast-forward of the association and Block Ack agreement setup.
+ *
+ * An AP MLD with three links, an EMLSR client with three links and a single-link non-AP STA
+ * operating on the second link of the AP MLD are created. The association of the non-AP STAs
+ * with the AP MLD and the establishment of Block Ack agreements for TID 0 in both directions
+ * are fast-forwarded via the WifiHelper before the start of the simulation. We verify that:
+ *
+ * - the non-AP STAs are associated with the AP MLD, the expected links are setup and the EMLSR
+ *   mode is enabled on the expected links of the EMLSR client, both at the non-AP STA side and
+ *   at the AP MLD side
+ * - the Block Ack agreements are established at both the originator and the recipient
+ * - no Association Request, ADDBA Request or EML Operating Mode Notification frame is sent
+ *   over the air and all the packets generated in both directions are received
+ * - the MU scheduler of the AP MLD, which is initialized after the association is
+ *   fast-forwarded, schedules the non-AP STAs for DL MU PPDUs and Trigger Frames
+ */
+class FastForwardSetupTest : public TestCase
+{
+  public:
+    FastForwardSetupTest();
+
+  private:
+    void DoSetup() override;
+    void DoRun() override;
+
+    /**
+     * Callback invoked when a FEM passes PSDUs to the PHY.
+     *
+     * @param psduMap the PSDU map
+     * @param txVector the TX vector
+     * @param txPowerW the tx power in Watts
+     */
+    void Transmit(WifiConstPsduMap psduMap, WifiTxVector txVector, double txPowerW);
+
+    /**
+     * Function to trace packets received by the server application
+     *
+     * @param nodeId the ID of the node that received the packet
+     * @param p the packet
+     * @param addr the address
+     */
+    void L7Receive(std::size_t nodeId, Ptr<const Packet> p, const Address& addr);
+
+    const std::vector<std::string> m_linkChannels; //!< channels for all AP links
+    const std::size_t m_nPackets;                  //!< number of packets generated per flow
+    Ptr<ApWifiMac> m_apMac;                        //!< AP wifi MAC
+    std::vector<Ptr<StaWifiMac>> m_staMacs;        //!< STA wifi MACs
+    std::vector<std::size_t> m_rxPkts;             //!< number of packets received at each node
+    std::size_t m_nSetupFrames;                    //!< number of setup frames sent over the air
+    std::size_t m_nBlockAcks;                      //!< number of BlockAck frames sent
+    std::size_t m_nDlMuPpdus;                      //!< number of DL MU PPDUs sent
+    std::size_t m_nTriggerFrames;                  //!< number of Trigger Frames sent
+};
+
 /**
  * @ingroup wifi-test
  * @ingroup tests
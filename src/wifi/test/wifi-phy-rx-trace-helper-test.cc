@@ -30,12 +30,15 @@
 #include "ns3/single-model-spectrum-channel.h"
 #include "ns3/spectrum-wifi-helper.h"
 #include "ns3/spectrum-wifi-phy.h"
+#include "ns3/ssid.h"
+#include "ns3/string.h"
 #include "ns3/test.h"
 #include "ns3/threshold-preamble-detection-model.h"
 #include "ns3/wifi-bandwidth-filter.h"
 #include "ns3/wifi-mac-header.h"
 #include "ns3/wifi-mpdu.h"
 #include "ns3/wifi-net-device.h"
+#include "ns3/wifi-phy-rx-trace-file.h"
 #include "ns3/wifi-phy-rx-trace-helper.h"
 #include "ns3/wifi-psdu.h"
 #include "ns3/wifi-spectrum-phy-interface.h"
@@ -43,6 +46,7 @@
 #include "ns3/wifi-spectrum-value-helper.h"
 #include "ns3/wifi-utils.h"
 #include "ns3/yans-wifi-channel.h"
+#include "ns3/yans-wifi-helper.h"
 #include "ns3/yans-wifi-phy.h"
 
 #include <optional>
@@ -2486,6 +2490,275 @@ TestWifiPhyRxTraceHelperYans::DoRun()
     Simulator::Destroy();
 }
 
+/**
+ * @ingroup wifi-test
+ * @brief Test the binary output of the WifiPhyRxTraceHelper.
+ *
+ * Stations send uplink traffic to an AP. Two trace helpers are enabled on the same nodes: the
+ * first one keeps the completed PPDU records in memory, while the second one streams them to a
+ * binary file without keeping them. It is checked that both helpers report the same statistics
+ * and that the records read from the binary file match the records kept in memory. The records
+ * read from the file are then written to another file using small blocks, to check that the
+ * address dictionary is correctly carried over from one block to the next.
+ */
+class TestWifiPhyRxTraceHelperBinaryOutput : public TestCase
+{
+  public:
+    TestWifiPhyRxTraceHelperBinaryOutput();
+
+  private:
+    void DoRun() override;
+
+    /**
+     * Check that the given records are equal.
+     * @param actual The record read from a file.
+     * @param expected The expected record.
+     */
+    void CheckRecord(const WifiPhyRxTraceFileRecord& actual,
+                     const WifiPhyRxTraceFileRecord& expected);
+
+    /**
+     * Read all the records of the given file.
+     * @param filename The name of the file.
+     * @return The records read from the file.
+     */
+    std::vector<WifiPhyRxTraceFileRecord> ReadAll(const std::string& filename) const;
+
+    static constexpr std::size_t N_STAS = 3; ///< number of stations
+};
+
+TestWifiPhyRxTraceHelperBinaryOutput::TestWifiPhyRxTraceHelperBinaryOutput()
+    : TestCase("Test the binary output of the trace helper")
+{
+}
+
+std::vector<WifiPhyRxTraceFileRecord>
+TestWifiPhyRxTraceHelperBinaryOutput::ReadAll(const std::string& filename) const
+{
+    std::vector<WifiPhyRxTraceFileRecord> records;
+    WifiPhyRxTraceFileReader reader(filename);
+    WifiPhyRxTraceFileRecord record;
+    while (reader.Read(record))
+    {
+        records.push_back(record);
+    }
+    return records;
+}
+
+void
+TestWifiPhyRxTraceHelperBinaryOutput::CheckRecord(const WifiPhyRxTraceFileRecord& actual,
+                                                  const WifiPhyRxTraceFileRecord& expected)
+{
+    NS_TEST_EXPECT_MSG_EQ(actual.m_startTime, expected.m_startTime, "Unexpected start time");
+    NS_TEST_EXPECT_MSG_EQ(actual.m_endTime, expected.m_endTime, "Unexpected end time");
+    NS_TEST_EXPECT_MSG_EQ(static_cast<float>(actual.m_rssi),
+                          static_cast<float>(expected.m_rssi),
+                          "Unexpected RSSI");
+    NS_TEST_EXPECT_MSG_EQ(actual.m_ppduUid, expected.m_ppduUid, "Unexpected PPDU UID");
+    NS_TEST_EXPECT_MSG_EQ(actual.m_receiverId, expected.m_receiverId, "Unexpected receiver");
+    NS_TEST_EXPECT_MSG_EQ(actual.m_receiverDeviceId,
+                          expected.m_receiverDeviceId,
+                          "Unexpected receiver device");
+    NS_TEST_EXPECT_MSG_EQ(+actual.m_linkId, +expected.m_linkId, "Unexpected link ID");
+    NS_TEST_EXPECT_MSG_EQ(actual.m_senderId, expected.m_senderId, "Unexpected sender");
+    NS_TEST_EXPECT_MSG_EQ(actual.m_senderDeviceId,
+                          expected.m_senderDeviceId,
+                          "Unexpected sender device");
+    NS_TEST_EXPECT_MSG_EQ(actual.m_reason, expected.m_reason, "Unexpected drop reason");
+    NS_TEST_EXPECT_MSG_EQ(actual.m_nMpdus, expected.m_nMpdus, "Unexpected number of MPDUs");
+    NS_TEST_EXPECT_MSG_EQ(actual.m_nSuccessfulMpdus,
+                          expected.m_nSuccessfulMpdus,
+                          "Unexpected number of successful MPDUs");
+    NS_TEST_EXPECT_MSG_EQ(actual.m_nOverlappingPpdus,
+                          expected.m_nOverlappingPpdus,
+                          "Unexpected number of overlapping PPDUs");
+    NS_TEST_EXPECT_MSG_EQ(static_cast<int>(actual.m_macType),
+                          static_cast<int>(expected.m_macType),
+                          "Unexpected MAC type");
+    NS_TEST_EXPECT_MSG_EQ((actual.m_addr1 == expected.m_addr1), true, "Unexpected Address 1");
+    NS_TEST_EXPECT_MSG_EQ((actual.m_addr2 == expected.m_addr2), true, "Unexpected Address 2");
+}
+
+void
+TestWifiPhyRxTraceHelperBinaryOutput::DoRun()
+{
+    RngSeedManager::SetSeed(1);
+    RngSeedManager::SetRun(1);
+    int64_t streamNumber = 100;
+
+    NodeContainer wifiApNode(1);
+    NodeContainer wifiStaNodes(N_STAS);
+
+    auto channel = YansWifiChannelHelper::Default();
+    YansWifiPhyHelper phy;
+    phy.SetChannel(channel.Create());
+
+    WifiHelper wifi;
+    wifi.SetStandard(WIFI_STANDARD_80211ax);
+    wifi.SetRemoteStationManager("ns3::ConstantRateWifiManager",
+                                 "DataMode",
+                                 StringValue("HeMcs7"),
+                                 "ControlMode",
+                                 StringValue("OfdmRate24Mbps"));
+
+    WifiMacHelper mac;
+    mac.SetType("ns3::StaWifiMac", "Ssid", SsidValue(Ssid("binary-output")));
+    auto staDevices = wifi.Install(phy, mac, wifiStaNodes);
+    mac.SetType("ns3::ApWifiMac", "Ssid", SsidValue(Ssid("binary-output")));
+    auto apDevice = wifi.Install(phy, mac, wifiApNode);
+    streamNumber += WifiHelper::AssignStreams(apDevice, streamNumber);
+    streamNumber += WifiHelper::AssignStreams(staDevices, streamNumber);
+
+    MobilityHelper mobility;
+    auto positionAlloc = CreateObject<ListPositionAllocator>();
+    positionAlloc->Add(Vector(0.0, 0.0, 0.0));
+    for (std::size_t i = 0; i < N_STAS; i++)
+    {
+        positionAlloc->Add(Vector(5.0 * (i + 1), 0.0, 0.0));
+    }
+    mobility.SetPositionAllocator(positionAlloc);
+    mobility.SetMobilityModel("ns3::ConstantPositionMobilityModel");
+    mobility.Install(wifiApNode);
+    mobility.Install(wifiStaNodes);
+
+    PacketSocketHelper packetSocket;
+    packetSocket.Install(wifiApNode);
+    packetSocket.Install(wifiStaNodes);
+
+    // saturated uplink traffic, so that some PPDUs overlap
+    for (std::size_t i = 0; i < N_STAS; i++)
+    {
+        PacketSocketAddress socket;
+        socket.SetSingleDevice(staDevices.Get(i)->GetIfIndex());
+        socket.SetPhysicalAddress(apDevice.Get(0)->GetAddress());
+        socket.SetProtocol(1);
+
+        auto client = CreateObject<PacketSocketClient>();
+        client->SetAttribute("PacketSize", UintegerValue(1000));
+        client->SetAttribute("MaxPackets", UintegerValue(0));
+        client->SetAttribute("Interval", TimeValue(MicroSeconds(200)));
+        client->SetRemote(socket);
+        wifiStaNodes.Get(i)->AddApplication(client);
+        client->SetStartTime(MilliSeconds(500));
+        client->SetStopTime(MilliSeconds(700));
+
+        auto server = CreateObject<PacketSocketServer>();
+        server->SetLocal(socket);
+        wifiApNode.Get(0)->AddApplication(server);
+    }
+
+    NodeContainer nodes(wifiApNode, wifiStaNodes);
+    const auto filename = CreateTempDirFilename("wifi-phy-rx-trace.bin");
+
+    WifiPhyRxTraceHelper memoryHelper;
+    memoryHelper.Enable(nodes);
+    memoryHelper.Start(MilliSeconds(100));
+    memoryHelper.Stop(Seconds(1));
+
+    WifiPhyRxTraceHelper binaryHelper;
+    binaryHelper.Enable(nodes);
+    binaryHelper.EnableBinaryOutput(filename);
+    binaryHelper.Start(MilliSeconds(100));
+    binaryHelper.Stop(Seconds(1));
+
+    Simulator::Stop(Seconds(1.1));
+    Simulator::Run();
+
+    const auto stats = memoryHelper.GetStatistics();
+    NS_TEST_EXPECT_MSG_GT(stats.m_receivedPpdus, 0, "Expected some successful PPDUs");
+    NS_TEST_EXPECT_MSG_GT(stats.m_overlappingPpdus, 0, "Expected some overlapping PPDUs");
+    NS_TEST_EXPECT_MSG_EQ((binaryHelper.GetStatistics() == stats),
+                          true,
+                          "Statistics differ when records are not kept");
+    for (uint32_t nodeId = 0; nodeId < nodes.GetN(); nodeId++)
+    {
+        NS_TEST_EXPECT_MSG_EQ((binaryHelper.GetStatistics(nodeId) ==
+                               memoryHelper.GetStatistics(nodeId)),
+                              true,
+                              "Statistics of node " << nodeId << " differ");
+    }
+    NS_TEST_EXPECT_MSG_EQ(binaryHelper.GetPpduRecords().empty(),
+                          true,
+                          "Records should not be kept in memory");
+
+    // the remaining records are written when the simulator is destroyed
+    Simulator::Destroy();
+
+    // records are written in order of completion, which is the order in which they are stored
+    // in memory for a given receiver, device, and link
+    std::map<std::tuple<uint32_t, uint16_t, uint8_t>, std::vector<WifiPhyRxTraceFileRecord>>
+        fileRecords;
+    const auto records = ReadAll(filename);
+    for (const auto& record : records)
+    {
+        fileRecords[{record.m_receiverId, record.m_receiverDeviceId, record.m_linkId}].push_back(
+            record);
+    }
+
+    std::size_t nRecords = 0;
+    for (const auto& [nodeId, deviceMap] : memoryHelper.m_traceSink->m_completedRecords)
+    {
+        for (const auto& [deviceId, linkMap] : deviceMap)
+        {
+            for (const auto& [linkId, memoryRecords] : linkMap)
+            {
+                const auto& readRecords = fileRecords[{nodeId, deviceId, linkId}];
+                NS_TEST_ASSERT_MSG_EQ(readRecords.size(),
+                                      memoryRecords.size(),
+                                      "Unexpected number of records for node " << nodeId);
+                for (std::size_t i = 0; i < memoryRecords.size(); i++)
+                {
+                    const auto& memoryRecord = memoryRecords[i];
+                    WifiPhyRxTraceFileRecord expected;
+                    expected.m_startTime = memoryRecord.m_startTime;
+                    expected.m_endTime = memoryRecord.m_endTime;
+                    expected.m_rssi = memoryRecord.m_rssi;
+                    expected.m_ppduUid = memoryRecord.m_ppdu->GetUid();
+                    expected.m_receiverId = nodeId;
+                    expected.m_receiverDeviceId = deviceId;
+                    expected.m_linkId = linkId;
+                    expected.m_senderId = memoryRecord.m_senderId;
+                    expected.m_senderDeviceId = memoryRecord.m_senderDeviceId;
+                    expected.m_reason = memoryRecord.m_reason;
+                    expected.m_nSuccessfulMpdus = std::count(memoryRecord.m_statusPerMpdu.cbegin(),
+                                                             memoryRecord.m_statusPerMpdu.cend(),
+                                                             true);
+                    expected.m_nOverlappingPpdus = memoryRecord.m_overlappingPpdu.size();
+                    const auto psdu = memoryRecord.m_ppdu->GetPsdu();
+                    const auto& hdr = psdu->GetHeader(0);
+                    expected.m_nMpdus = psdu->GetNMpdus();
+                    expected.m_macType = hdr.GetType();
+                    expected.m_addr1 = hdr.GetAddr1();
+                    if (!hdr.IsCts() && !hdr.IsAck())
+                    {
+                        expected.m_addr2 = hdr.GetAddr2();
+                    }
+                    CheckRecord(readRecords[i], expected);
+                }
+                nRecords += memoryRecords.size();
+            }
+        }
+    }
+    NS_TEST_EXPECT_MSG_EQ(records.size(), nRecords, "Unexpected total number of records");
+
+    // copy the records to another file using small blocks and check that they are preserved
+    const auto copyFilename = CreateTempDirFilename("wifi-phy-rx-trace-copy.bin");
+    {
+        WifiPhyRxTraceFileWriter writer(copyFilename, 7);
+        for (const auto& record : records)
+        {
+            writer.Write(record);
+        }
+        NS_TEST_EXPECT_MSG_EQ(writer.GetNRecords(), records.size(), "Unexpected record count");
+    }
+    const auto copiedRecords = ReadAll(copyFilename);
+    NS_TEST_ASSERT_MSG_EQ(copiedRecords.size(), records.size(), "Unexpected number of copies");
+    for (std::size_t i = 0; i < records.size(); i++)
+    {
+        CheckRecord(copiedRecords[i], records[i]);
+    }
+}
+
 /**
  * @ingroup wifi-test
  * @ingroup tests
@@ -2504,6 +2777,7 @@ WifiPhyRxTraceHelperTestSuite::WifiPhyRxTraceHelperTestSuite()
     AddTestCase(new TestWifiPhyRxTraceHelper("test-statistics"), TestCase::Duration::QUICK);
     AddTestCase(new TestWifiPhyRxTraceHelperMloStr, TestCase::Duration::QUICK);
     AddTestCase(new TestWifiPhyRxTraceHelperYans, TestCase::Duration::QUICK);
+    AddTestCase(new TestWifiPhyRxTraceHelperBinaryOutput, TestCase::Duration::QUICK);
 }
 
 static WifiPhyRxTraceHelperTestSuite wifiPhyRxTestSuite; ///< the test suite
@@ -11,6 +11,7 @@
 
 #include "ns3/adhoc-wifi-mac.h"
 #include "ns3/ap-wifi-mac.h"
+#include "ns3/boolean.h"
 #include "ns3/config.h"
 #include "ns3/constant-position-mobility-model.h"
 #include "ns3/constant-rate-wifi-manager.h"
@@ -49,6 +50,8 @@
 #include "ns3/yans-wifi-phy.h"
 
 #include <optional>
+#include <utility>
+#include <vector>
 
 using namespace ns3;
 
@@ -3961,6 +3964,181 @@ DsssModulationTest::DoRun()
     NS_TEST_ASSERT_MSG_EQ(m_received, 4, "Did not receive four DSSS packets");
 }
 
+/**
+ * @ingroup wifi-test
+ * @ingroup tests
+ *
+ * @brief Make sure that coalescing the receptions of a YansWifiChannel does not
+ * change what the PHYs observe while reducing the number of events.
+ *
+ * A node broadcasts a few packets to eight nodes, four of which are located
+ * 10 meters away from the sender and the other four 1 km away, where the
+ * signal is too weak to be processed. The SignalArrival trace source is
+ * connected for one close node and for two distant nodes. The simulation is
+ * run with and without the CoalesceReceptions attribute of the channel set.
+ * The traced signal arrivals and the received packets must be the same in
+ * both runs, while the receptions of a packet must be dispatched by five
+ * events (one per close node and one for the traced distant nodes) rather
+ * than eight when receptions are coalesced.
+ */
+class YansReceptionCoalescingTest : public TestCase
+{
+  public:
+    YansReceptionCoalescingTest();
+
+  private:
+    void DoRun() override;
+
+    /// Event (signal arrival or packet reception) occurred at a node
+    using Record = std::pair<std::size_t, Time>;
+
+    /// Observations made during a run
+    struct Observations
+    {
+        std::vector<Record> arrivals;   ///< traced signal arrivals
+        std::vector<Record> receptions; ///< received packets
+        uint64_t nEvents{0};            ///< number of executed events
+    };
+
+    /**
+     * Run the scenario
+     * @param coalesce whether receptions are coalesced
+     * @return the observations made during the run
+     */
+    Observations RunOne(bool coalesce);
+
+    /**
+     * Callback invoked when a signal arrives at a PHY
+     * @param index the index of the node
+     * @param ppdu the PPDU
+     * @param rxPowerDbm the RX power (dBm)
+     * @param duration the duration of the PPDU
+     */
+    void SignalArrival(std::size_t index,
+                       Ptr<const WifiPpdu> ppdu,
+                       double rxPowerDbm,
+                       Time duration);
+
+    /**
+     * Callback invoked when a PHY has received a packet
+     * @param index the index of the node
+     * @param packet the received packet
+     */
+    void PhyRxEnd(std::size_t index, Ptr<const Packet> packet);
+
+    Observations m_observations;     ///< observations of the current run
+    const std::size_t m_nPackets{5}; ///< number of packets sent
+};
+
+YansReceptionCoalescingTest::YansReceptionCoalescingTest()
+    : TestCase("Coalescing of the receptions of a YANS channel")
+{
+}
+
+void
+YansReceptionCoalescingTest::SignalArrival(std::size_t index,
+                                           Ptr<const WifiPpdu> ppdu,
+                                           double rxPowerDbm,
+                                           Time duration)
+{
+    m_observations.arrivals.emplace_back(index, Simulator::Now());
+}
+
+void
+YansReceptionCoalescingTest::PhyRxEnd(std::size_t index, Ptr<const Packet> packet)
+{
+    m_observations.receptions.emplace_back(index, Simulator::Now());
+}
+
+YansReceptionCoalescingTest::Observations
+YansReceptionCoalescingTest::RunOne(bool coalesce)
+{
+    m_observations = Observations{};
+
+    NodeContainer nodes(9);
+
+    WifiHelper wifi;
+    wifi.SetStandard(WIFI_STANDARD_80211a);
+    wifi.SetRemoteStationManager("ns3::ConstantRateWifiManager",
+                                 "DataMode",
+                                 StringValue("OfdmRate6Mbps"));
+
+    auto channel = YansWifiChannelHelper::Default().Create();
+    channel->SetAttribute("CoalesceReceptions", BooleanValue(coalesce));
+    YansWifiPhyHelper phy;
+    phy.SetChannel(channel);
+
+    WifiMacHelper mac;
+    mac.SetType("ns3::AdhocWifiMac");
+    auto devices = wifi.Install(phy, mac, nodes);
+
+    auto positionAlloc = CreateObject<ListPositionAllocator>();
+    positionAlloc->Add(Vector(0.0, 0.0, 0.0));
+    for (const auto distance : {10.0, 1000.0})
+    {
+        positionAlloc->Add(Vector(distance, 0.0, 0.0));
+        positionAlloc->Add(Vector(-distance, 0.0, 0.0));
+        positionAlloc->Add(Vector(0.0, distance, 0.0));
+        positionAlloc->Add(Vector(0.0, -distance, 0.0));
+    }
+    MobilityHelper mobility;
+    mobility.SetPositionAllocator(positionAlloc);
+    mobility.SetMobilityModel("ns3::ConstantPositionMobilityModel");
+    mobility.Install(nodes);
+
+    for (std::size_t i = 1; i < devices.GetN(); i++)
+    {
+        auto rxPhy = DynamicCast<WifiNetDevice>(devices.Get(i))->GetPhy();
+        rxPhy->TraceConnectWithoutContext(
+            "PhyRxEnd",
+            MakeCallback(&YansReceptionCoalescingTest::PhyRxEnd, this).Bind(i));
+        if (i == 1 || i == 5 || i == 6)
+        {
+            rxPhy->TraceConnectWithoutContext(
+                "SignalArrival",
+                MakeCallback(&YansReceptionCoalescingTest::SignalArrival, this).Bind(i));
+        }
+    }
+
+    auto sender = devices.Get(0);
+    for (std::size_t i = 0; i < m_nPackets; i++)
+    {
+        Simulator::Schedule(Seconds(1) + MilliSeconds(10 * i), [=]() {
+            sender->Send(Create<Packet>(1000), sender->GetBroadcast(), 1);
+        });
+    }
+
+    Simulator::Stop(Seconds(2));
+    Simulator::Run();
+    m_observations.nEvents = Simulator::GetEventCount();
+    Simulator::Destroy();
+
+    return m_observations;
+}
+
+void
+YansReceptionCoalescingTest::DoRun()
+{
+    const auto observations = RunOne(false);
+    const auto coalesced = RunOne(true);
+
+    NS_TEST_ASSERT_MSG_EQ(observations.arrivals.size(),
+                          3 * m_nPackets,
+                          "Unexpected number of traced signal arrivals");
+    NS_TEST_ASSERT_MSG_EQ(observations.receptions.size(),
+                          4 * m_nPackets,
+                          "Unexpected number of received packets");
+    NS_TEST_EXPECT_MSG_EQ((coalesced.arrivals == observations.arrivals),
+                          true,
+                          "Coalescing receptions changed the traced signal arrivals");
+    NS_TEST_EXPECT_MSG_EQ((coalesced.receptions == observations.receptions),
+                          true,
+                          "Coalescing receptions changed the received packets");
+    NS_TEST_EXPECT_MSG_EQ(observations.nEvents - coalesced.nEvents,
+                          (8 - 5) * m_nPackets,
+                          "Unexpected number of events saved by coalescing receptions");
+}
+
 /**
  * @ingroup wifi-test
  * @ingroup tests
@@ -3995,6 +4173,7 @@ WifiTestSuite::WifiTestSuite()
     AddTestCase(new HeRuMcsDataRateTestCase, TestCase::Duration::QUICK);
     AddTestCase(new WifiMgtHeaderTest, TestCase::Duration::QUICK);
     AddTestCase(new DsssModulationTest, TestCase::Duration::QUICK);
+    AddTestCase(new YansReceptionCoalescingTest, TestCase::Duration::QUICK);
 }
 
 static WifiTestSuite g_wifiTestSuite; ///< the test suite
@@ -299,6 +299,58 @@ WifiOfdmMaskSlopesTestCase::DoRun()
     }
 }
 
+/**
+ * @ingroup wifi-test
+ * @ingroup tests
+ *
+ * @brief Test that the transmit PSDs created from the same parameters share a template
+ * that is not affected by the modifications made to the copies of the returned PSDs.
+ */
+class WifiTxPsdTemplateTestCase : public TestCase
+{
+  public:
+    WifiTxPsdTemplateTestCase();
+
+  private:
+    void DoRun() override;
+};
+
+WifiTxPsdTemplateTestCase::WifiTxPsdTemplateTestCase()
+    : TestCase("Check the transmit PSD templates")
+{
+}
+
+void
+WifiTxPsdTemplateTestCase::DoRun()
+{
+    auto createPsd = [](Watt_u txPower) {
+        return WifiSpectrumValueHelper::CreateHeOfdmTxPowerSpectralDensity(
+            std::vector<MHz_u>{MHz_u{5250}},
+            MHz_u{160},
+            txPower,
+            MHz_u{160},
+            dBr_u{-20.0},
+            dBr_u{-28.0},
+            dBr_u{-40.0});
+    };
+
+    auto first = createPsd(Watt_u{1});
+    const auto reference = *first;
+    auto second = createPsd(Watt_u{1});
+    NS_TEST_ASSERT_MSG_EQ(first, second, "Calls with the same parameters should share the PSD");
+
+    // modifying a copy of a returned PSD does not modify the template
+    auto copy = second->Copy();
+    (*copy) *= 2.0;
+    (*copy)[0] = 1.0;
+    auto third = createPsd(Watt_u{1});
+    NS_TEST_ASSERT_MSG_EQ(third, first, "Calls with the same parameters should share the PSD");
+    NS_TEST_ASSERT_MSG_EQ((*third == reference), true, "Template should not have been modified");
+
+    auto other = createPsd(Watt_u{2});
+    NS_TEST_ASSERT_MSG_EQ_TOL(Integral(*other), 2.0, 1e-6, "Unexpected total transmit power");
+}
+
 /**
  * @ingroup wifi-test
  * @ingroup tests
@@ -1504,4 +1556,6 @@ WifiTransmitMaskTestSuite::WifiTransmitMaskTestSuite()
                                        prec,
                                        {false, false, false, false, false, false, true, true}),
         TestCase::Duration::QUICK);
+
+    AddTestCase(new WifiTxPsdTemplateTestCase(), TestCase::Duration::QUICK);
 }